@@ -92,6 +92,46 @@ void app::benchmark::task_func()
 
   const bool result_is_ok = app::benchmark::run_pi_agm();
 
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_CHUDNOVSKY)
+
+  const bool result_is_ok = app::benchmark::run_pi_chudnovsky();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_BBP)
+
+  const bool result_is_ok = app::benchmark::run_pi_bbp();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC)
+
+  const bool result_is_ok = app::benchmark::run_fixed_point_cordic();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC)
+
+  const bool result_is_ok = app::benchmark::run_wide_decimal_dynamic();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL)
+
+  const bool result_is_ok = app::benchmark::run_pi_spigot_parallel();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR)
+
+  const bool result_is_ok = app::benchmark::run_wide_integer_modular();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC)
+
+  const bool result_is_ok = app::benchmark::run_wide_integer_arithmetic();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT)
+
+  const bool result_is_ok = app::benchmark::run_wide_decimal_pi_checkpoint();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY)
+
+  const bool result_is_ok = app::benchmark::run_fixed_point_array();
+
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES)
+
+  const bool result_is_ok = app::benchmark::run_fixed_point_policies();
+
   #endif
 
   // Set the benchmark port pin level to low.
@@ -22,6 +22,16 @@
   #define APP_BENCHMARK_TYPE_WIDE_DECIMAL         11
   #define APP_BENCHMARK_TYPE_TRAPEZOID_INTEGRAL   12
   #define APP_BENCHMARK_TYPE_PI_AGM               13
+  #define APP_BENCHMARK_TYPE_PI_CHUDNOVSKY        14
+  #define APP_BENCHMARK_TYPE_PI_BBP               15
+  #define APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC   16
+  #define APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC 17
+  #define APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL   18
+  #define APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR 19
+  #define APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC 20
+  #define APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT 21
+  #define APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY    22
+  #define APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES 23
 
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_NONE
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_COMPLEX
@@ -37,6 +47,16 @@
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_WIDE_DECIMAL
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_TRAPEZOID_INTEGRAL
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_PI_AGM
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_PI_CHUDNOVSKY
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_PI_BBP
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES
 
   #if !defined(APP_BENCHMARK_TYPE)
   #define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_NONE
@@ -73,6 +93,26 @@
   bool run_trapezoid_integral();
   #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_AGM)
   bool run_pi_agm();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_CHUDNOVSKY)
+  bool run_pi_chudnovsky();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_BBP)
+  bool run_pi_bbp();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC)
+  bool run_fixed_point_cordic();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC)
+  bool run_wide_decimal_dynamic();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL)
+  bool run_pi_spigot_parallel();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR)
+  bool run_wide_integer_modular();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC)
+  bool run_wide_integer_arithmetic();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT)
+  bool run_wide_decimal_pi_checkpoint();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY)
+  bool run_fixed_point_array();
+  #elif(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES)
+  bool run_fixed_point_policies();
   #endif
 
   } } // namespace app:::benchmark
@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2018 - 2019.
+//  Copyright Christopher Kormanyos 2018 - 2021.
 //  Distributed under the Boost Software License,
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -12,8 +12,13 @@
 
 #define FAST_MATH_IMPLEMENT_SPECIALIZED_SQRT
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 #include <app/benchmark/app_benchmark_detail.h>
 #include <math/fast_math/fast_math.h>
+#include <math/fast_math/fast_math_array.h>
 
 using float_type = fast_math::float32_t;
 
@@ -22,26 +27,57 @@ extern float_type yy;
 
 bool app::benchmark::run_fast_math()
 {
-  static bool toggle_test_case;
+  static std::uint_fast8_t test_case;
 
   bool result_is_ok;
 
-  if(toggle_test_case != true)
+  if(test_case == 0U)
   {
-    toggle_test_case = true;
+    test_case = 1U;
 
     yy = fast_math::exp(xx);
 
     result_is_ok = detail::is_close_fraction(yy, 10.381236562731844796F, 1.0E-03F);
   }
-  else
+  else if(test_case == 1U)
   {
-    toggle_test_case = false;
+    test_case = 2U;
 
     yy = fast_math::sqrt(xx);
 
     result_is_ok = detail::is_close_fraction(yy, 1.5297058540778354490F, 2.0E-03F);
   }
+  else
+  {
+    test_case = 0U;
+
+    // Take the logarithm of a small buffer and the exponent of the result
+    // with the batch versions. The size of the buffer exercises both the
+    // vectorized paths and the portable loops on the host.
+    std::array<float_type, 17U> x;
+    std::array<float_type, 17U> y;
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      x[i] = xx + float_type(i);
+    }
+
+    fast_math_array::log(x.data(), y.data(), x.size());
+    fast_math_array::exp(y.data(), y.data(), y.size());
+
+    result_is_ok = true;
+
+    for(std::size_t i = 0U; i < x.size(); ++i)
+    {
+      result_is_ok &= detail::is_close_fraction(y[i], x[i], 1.0E-05F);
+    }
+
+    fast_math_array::sqrt(x.data(), y.data(), x.size());
+
+    yy = y[0U];
+
+    result_is_ok &= detail::is_close_fraction(yy, 1.5297058540778354490F, 1.0E-05F);
+  }
 
   return result_is_ok;
 }
@@ -0,0 +1,393 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY)
+
+#define FIXED_POINT_DISABLE_IOSTREAM
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <math/fixed_point/fixed_point.h>
+#include <math/fixed_point/fixed_point_array.h>
+
+namespace
+{
+  std::uint32_t next_random(std::uint32_t& seed)
+  {
+    // A simple xorshift generator for the pseudo-random values.
+    seed ^= static_cast<std::uint32_t>(seed << 13U);
+    seed ^= static_cast<std::uint32_t>(seed >> 17U);
+    seed ^= static_cast<std::uint32_t>(seed <<  5U);
+
+    return seed;
+  }
+
+  template<typename integer_type, const std::size_t fractional_digits>
+  integer_type make_value(const std::size_t i, std::uint32_t& seed)
+  {
+    // Mix full-range values, small values and the special values
+    // at the limits, which lead to the saturation of the results.
+    const integer_type lo = (std::numeric_limits<integer_type>::min)();
+    const integer_type hi = (std::numeric_limits<integer_type>::max)();
+
+    const integer_type one = static_cast<integer_type>(static_cast<integer_type>(1) << fractional_digits);
+
+    // The shift of the small values, which are below 4 in magnitude.
+    constexpr std::size_t small_shift = (((fractional_digits + 2U) < 31U) ? (31U - (fractional_digits + 2U)) : 0U);
+
+    const std::uint32_t r = next_random(seed);
+
+    const integer_type special_values[8U] =
+    {
+      lo, hi, static_cast<integer_type>(0), static_cast<integer_type>(-1),
+      static_cast<integer_type>(1), one, static_cast<integer_type>(-one), static_cast<integer_type>(hi - 1)
+    };
+
+    if((i % 4U) == 1U)
+    {
+      return static_cast<integer_type>(static_cast<std::int32_t>(r) >> small_shift);
+    }
+    else if((i % 4U) == 2U)
+    {
+      return special_values[r % 8U];
+    }
+    else
+    {
+      return static_cast<integer_type>(static_cast<std::int32_t>(r));
+    }
+  }
+
+  template<typename integer_type, const std::size_t fractional_digits>
+  bool run_fixed_point_array_kernels(std::uint32_t& seed)
+  {
+    // The results of the kernels are compared value by value with those
+    // of the scalar operators of fixed_point with saturation, which also
+    // round products toward zero. The count is not a multiple of the
+    // register width, such that the vectorized paths and the portable
+    // loops at the end of the arrays are both checked.
+    using array_value_type  = fixed_point<integer_type, fractional_digits>;
+    using scalar_value_type = fixed_point<integer_type, fractional_digits, fixed_point_round_toward_zero, fixed_point_overflow_saturate>;
+
+    using array_access  = fixed_point_access<array_value_type>;
+    using scalar_access = fixed_point_access<scalar_value_type>;
+
+    constexpr std::size_t count = 203U;
+
+    std::array<array_value_type, count> a;
+    std::array<array_value_type, count> b;
+    std::array<array_value_type, count> out_add;
+    std::array<array_value_type, count> out_mul;
+    std::array<array_value_type, count> out_scale;
+    std::array<array_value_type, count> acc;
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      a  [i] = array_access::make(make_value<integer_type, fractional_digits>(i,      seed));
+      b  [i] = array_access::make(make_value<integer_type, fractional_digits>(i + 1U, seed));
+      acc[i] = array_access::make(make_value<integer_type, fractional_digits>(i + 2U, seed));
+    }
+
+    const std::array<array_value_type, count> acc_in = acc;
+
+    const array_value_type s = array_access::make(make_value<integer_type, fractional_digits>(1U, seed));
+
+    fixed_point_array::add    (a.data(), b.data(), out_add.data(),   count);
+    fixed_point_array::mul    (a.data(), b.data(), out_mul.data(),   count);
+    fixed_point_array::mul_add(a.data(), b.data(), acc.data(),       count);
+    fixed_point_array::scale  (a.data(), s,        out_scale.data(), count);
+
+    auto to_scalar = [](const array_value_type& x) -> scalar_value_type
+    {
+      return scalar_access::make(*array_access::data(&x));
+    };
+
+    auto is_equal = [](const array_value_type& x, const scalar_value_type& y) -> bool
+    {
+      return (*array_access::data(&x) == *scalar_access::data(&y));
+    };
+
+    bool result_is_ok = true;
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      const scalar_value_type sa = to_scalar(a[i]);
+      const scalar_value_type sb = to_scalar(b[i]);
+
+      result_is_ok &= is_equal(out_add  [i], sa + sb);
+      result_is_ok &= is_equal(out_mul  [i], sa * sb);
+      result_is_ok &= is_equal(acc      [i], to_scalar(acc_in[i]) + (sa * sb));
+      result_is_ok &= is_equal(out_scale[i], sa * to_scalar(s));
+    }
+
+    // The exact sum of the products is rounded toward zero (which is
+    // the truncation of the integer division) and then saturated.
+    // It must be within the range of std::int64_t, so the magnitudes
+    // of the 32-bit values are reduced below 2^24.
+    std::array<array_value_type, count> c;
+    std::array<array_value_type, count> d;
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      const int reduce = ((std::numeric_limits<integer_type>::digits > 24) ? (std::numeric_limits<integer_type>::digits - 23) : 0);
+
+      c[i] = array_access::make(static_cast<integer_type>(*array_access::data(&a[i]) >> reduce));
+      d[i] = array_access::make(static_cast<integer_type>(*array_access::data(&b[i]) >> reduce));
+    }
+
+    const std::size_t dot_counts[9U] = { 0U, 1U, 7U, 8U, 9U, 15U, 16U, 17U, count };
+
+    for(const std::size_t n : dot_counts)
+    {
+      std::int64_t sum = 0;
+
+      for(std::size_t i = 0U; i < n; ++i)
+      {
+        sum += static_cast<std::int64_t>(*array_access::data(&c[i])) * *array_access::data(&d[i]);
+      }
+
+      sum /= static_cast<std::int64_t>(static_cast<std::int64_t>(1) << fractional_digits);
+
+      const std::int64_t lo = static_cast<std::int64_t>((std::numeric_limits<integer_type>::min)());
+      const std::int64_t hi = static_cast<std::int64_t>((std::numeric_limits<integer_type>::max)());
+
+      const integer_type control = static_cast<integer_type>((sum < lo) ? lo : ((sum > hi) ? hi : sum));
+
+      const array_value_type result = fixed_point_array::dot(c.data(), d.data(), n);
+
+      result_is_ok &= (*array_access::data(&result) == control);
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_fixed_point_array_controls()
+  {
+    // A few results in the 15.16 and 7.8 formats.
+    using access_15pt16 = fixed_point_access<fixed_point_15pt16>;
+    using access_7pt8   = fixed_point_access<fixed_point_7pt8>;
+
+    const fixed_point_15pt16 min_15pt16 = access_15pt16::make((std::numeric_limits<std::int32_t>::min)());
+    const fixed_point_15pt16 max_15pt16 = access_15pt16::make((std::numeric_limits<std::int32_t>::max)());
+    const fixed_point_15pt16 ulp_15pt16 = access_15pt16::make(1);
+
+    const fixed_point_7pt8 min_7pt8 = access_7pt8::make((std::numeric_limits<std::int16_t>::min)());
+    const fixed_point_7pt8 max_7pt8 = access_7pt8::make((std::numeric_limits<std::int16_t>::max)());
+
+    const std::array<fixed_point_15pt16, 4U> a_15pt16 = {{ fixed_point_15pt16(7) / 2, -fixed_point_15pt16(200), -ulp_15pt16, fixed_point_15pt16(32767) + fixed_point_15pt16(1) / 2 }};
+    const std::array<fixed_point_15pt16, 4U> b_15pt16 = {{ fixed_point_15pt16(9) / 4, fixed_point_15pt16( 200), fixed_point_15pt16(1) / 2, fixed_point_15pt16(1) / 2 }};
+
+    std::array<fixed_point_15pt16, 4U> sum_15pt16;
+    std::array<fixed_point_15pt16, 4U> prod_15pt16;
+
+    fixed_point_array::add(a_15pt16.data(), b_15pt16.data(), sum_15pt16.data(),  4U);
+    fixed_point_array::mul(a_15pt16.data(), b_15pt16.data(), prod_15pt16.data(), 4U);
+
+    // 3.5 * 2.25 = 7.875, -200 * 200 saturates at the lowest value,
+    // -2^-16 * 0.5 rounds toward zero, and 32767.5 + 0.5 saturates
+    // at the largest value.
+    const bool result_15pt16_is_ok =
+      (   (prod_15pt16[0U] == fixed_point_15pt16(63) / 8)
+       && (prod_15pt16[1U] == min_15pt16)
+       && (prod_15pt16[2U] == fixed_point_15pt16(0))
+       && (sum_15pt16 [0U] == fixed_point_15pt16(23) / 4)
+       && (sum_15pt16 [1U] == fixed_point_15pt16(0))
+       && (sum_15pt16 [3U] == max_15pt16));
+
+    // 1.5 * 2 - 3 * 0.25 + 3 * (-1) = -0.75, and the products of 50
+    // with -3 and 3 saturate at the limits of about -128 and +128.
+    const std::array<fixed_point_7pt8, 3U> a_7pt8 = {{ fixed_point_7pt8(3) / 2, -fixed_point_7pt8(3),     fixed_point_7pt8(3) }};
+    const std::array<fixed_point_7pt8, 3U> b_7pt8 = {{ fixed_point_7pt8(2),      fixed_point_7pt8(1) / 4, -fixed_point_7pt8(1) }};
+
+    std::array<fixed_point_7pt8, 3U> scaled_7pt8;
+
+    fixed_point_array::scale(a_7pt8.data(), fixed_point_7pt8(50), scaled_7pt8.data(), 3U);
+
+    const bool result_7pt8_is_ok =
+      (   (fixed_point_array::dot(a_7pt8.data(), b_7pt8.data(), 3U) == -(fixed_point_7pt8(3) / 4))
+       && (scaled_7pt8[0U] == fixed_point_7pt8(75))
+       && (scaled_7pt8[1U] == min_7pt8)
+       && (scaled_7pt8[2U] == max_7pt8));
+
+    return (result_15pt16_is_ok && result_7pt8_is_ok);
+  }
+}
+
+bool app::benchmark::run_fixed_point_array()
+{
+  static std::uint_fast8_t select_test_case;
+
+  static std::uint32_t seed = UINT32_C(0x2545F491);
+
+  bool result_is_ok;
+
+  if(select_test_case == 0U)
+  {
+    result_is_ok = (   run_fixed_point_array_kernels<std::int16_t,  8U>(seed)
+                    && run_fixed_point_array_kernels<std::int16_t, 14U>(seed));
+  }
+  else if(select_test_case == 1U)
+  {
+    result_is_ok = (   run_fixed_point_array_kernels<std::int32_t, 16U>(seed)
+                    && run_fixed_point_array_kernels<std::int32_t, 30U>(seed));
+  }
+  else if(select_test_case == 2U)
+  {
+    result_is_ok = (   run_fixed_point_array_kernels<std::int8_t,  4U>(seed)
+                    && run_fixed_point_array_controls());
+  }
+  else
+  {
+    result_is_ok = false;
+  }
+
+  ++select_test_case;
+
+  if(select_test_case >= 3U)
+  {
+    select_test_case = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_STANDALONE_TIMING)
+
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  template<typename FunctionType>
+  double timing_nanoseconds_per_value(FunctionType f, const std::size_t count)
+  {
+    // Repeat the call for at least 0.2s and return the mean time per value.
+    using clock_type = std::chrono::steady_clock;
+
+    std::uint_fast32_t n = 0U;
+
+    const clock_type::time_point start = clock_type::now();
+
+    clock_type::time_point stop;
+
+    do
+    {
+      f();
+
+      ++n;
+
+      stop = clock_type::now();
+    }
+    while((stop - start) < std::chrono::milliseconds(200));
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (double(n) * double(count));
+  }
+
+  template<typename integer_type>
+  void timing_kernels()
+  {
+    // Time the kernels, loops with the scalar operators of fixed_point
+    // with saturation, and loops with the default scalar operators,
+    // which wrap around.
+    using array_value_type  = fixed_point<integer_type>;
+    using scalar_value_type = fixed_point<integer_type, std::size_t(std::numeric_limits<integer_type>::digits + 1) / 2U, fixed_point_round_toward_zero, fixed_point_overflow_saturate>;
+
+    constexpr std::size_t count = 4096U;
+
+    static std::array<array_value_type,  count> a;
+    static std::array<array_value_type,  count> b;
+    static std::array<array_value_type,  count> out;
+    static std::array<scalar_value_type, count> sa;
+    static std::array<scalar_value_type, count> sb;
+    static std::array<scalar_value_type, count> sout;
+
+    std::uint32_t seed = UINT32_C(0x2545F491);
+
+    for(std::size_t i = 0U; i < count; ++i)
+    {
+      a [i] = fixed_point_access<array_value_type> ::make(static_cast<integer_type>(static_cast<std::int32_t>(next_random(seed)) >> 20));
+      b [i] = fixed_point_access<array_value_type> ::make(static_cast<integer_type>(static_cast<std::int32_t>(next_random(seed)) >> 20));
+      sa[i] = fixed_point_access<scalar_value_type>::make(*fixed_point_access<array_value_type>::data(&a[i]));
+      sb[i] = fixed_point_access<scalar_value_type>::make(*fixed_point_access<array_value_type>::data(&b[i]));
+    }
+
+    // The arrays are accessed through volatile pointers,
+    // so that the loops are not hoisted out of the timing.
+    array_value_type*  volatile p_a    = a.data();
+    array_value_type*  volatile p_b    = b.data();
+    array_value_type*  volatile p_out  = out.data();
+    scalar_value_type* volatile p_sa   = sa.data();
+    scalar_value_type* volatile p_sb   = sb.data();
+    scalar_value_type* volatile p_sout = sout.data();
+
+    const char* names[5U] = { "add", "mul", "mul_add", "scale", "dot" };
+
+    double t[3U][5U];
+
+    t[0U][0U] = timing_nanoseconds_per_value([&]() { fixed_point_array::add    (p_a, p_b, p_out, count); }, count);
+    t[0U][1U] = timing_nanoseconds_per_value([&]() { fixed_point_array::mul    (p_a, p_b, p_out, count); }, count);
+    t[0U][2U] = timing_nanoseconds_per_value([&]() { fixed_point_array::mul_add(p_a, p_b, p_out, count); }, count);
+    t[0U][3U] = timing_nanoseconds_per_value([&]() { fixed_point_array::scale  (p_a, *p_b, p_out, count); }, count);
+    t[0U][4U] = timing_nanoseconds_per_value([&]() { p_out[0U] = fixed_point_array::dot(p_a, p_b, count); }, count);
+
+    t[1U][0U] = timing_nanoseconds_per_value([&]() { scalar_value_type* pa = p_sa; scalar_value_type* pb = p_sb; scalar_value_type* po = p_sout; for(std::size_t i = 0U; i < count; ++i) { po[i]  = pa[i] + pb[i]; } }, count);
+    t[1U][1U] = timing_nanoseconds_per_value([&]() { scalar_value_type* pa = p_sa; scalar_value_type* pb = p_sb; scalar_value_type* po = p_sout; for(std::size_t i = 0U; i < count; ++i) { po[i]  = pa[i] * pb[i]; } }, count);
+    t[1U][2U] = timing_nanoseconds_per_value([&]() { scalar_value_type* pa = p_sa; scalar_value_type* pb = p_sb; scalar_value_type* po = p_sout; for(std::size_t i = 0U; i < count; ++i) { po[i] += pa[i] * pb[i]; } }, count);
+    t[1U][3U] = timing_nanoseconds_per_value([&]() { scalar_value_type* pa = p_sa; const scalar_value_type s = *p_sb; scalar_value_type* po = p_sout; for(std::size_t i = 0U; i < count; ++i) { po[i] = pa[i] * s; } }, count);
+    t[1U][4U] = timing_nanoseconds_per_value([&]() { scalar_value_type* pa = p_sa; scalar_value_type* pb = p_sb; scalar_value_type sum(0); for(std::size_t i = 0U; i < count; ++i) { sum += pa[i] * pb[i]; } p_sout[0U] = sum; }, count);
+
+    t[2U][0U] = timing_nanoseconds_per_value([&]() { array_value_type* pa = p_a; array_value_type* pb = p_b; array_value_type* po = p_out; for(std::size_t i = 0U; i < count; ++i) { po[i]  = pa[i] + pb[i]; } }, count);
+    t[2U][1U] = timing_nanoseconds_per_value([&]() { array_value_type* pa = p_a; array_value_type* pb = p_b; array_value_type* po = p_out; for(std::size_t i = 0U; i < count; ++i) { po[i]  = pa[i] * pb[i]; } }, count);
+    t[2U][2U] = timing_nanoseconds_per_value([&]() { array_value_type* pa = p_a; array_value_type* pb = p_b; array_value_type* po = p_out; for(std::size_t i = 0U; i < count; ++i) { po[i] += pa[i] * pb[i]; } }, count);
+    t[2U][3U] = timing_nanoseconds_per_value([&]() { array_value_type* pa = p_a; const array_value_type s = *p_b; array_value_type* po = p_out; for(std::size_t i = 0U; i < count; ++i) { po[i] = pa[i] * s; } }, count);
+    t[2U][4U] = timing_nanoseconds_per_value([&]() { array_value_type* pa = p_a; array_value_type* pb = p_b; array_value_type sum(0); for(std::size_t i = 0U; i < count; ++i) { sum += pa[i] * pb[i]; } p_out[0U] = sum; }, count);
+
+    for(std::size_t k = 0U; k < 5U; ++k)
+    {
+      std::printf("int%2u %-8s kernel %6.3f ns, saturating loop %6.3f ns (ratio %5.2f), wrapping loop %6.3f ns (ratio %5.2f)\n",
+                  unsigned(std::numeric_limits<integer_type>::digits + 1),
+                  names[k],
+                  t[0U][k],
+                  t[1U][k],
+                  t[1U][k] / t[0U][k],
+                  t[2U][k],
+                  t[2U][k] / t[0U][k]);
+    }
+  }
+}
+#endif // APP_BENCHMARK_STANDALONE_TIMING
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_fixed_point_array.cpp -o ./ref_app/bin/app_benchmark_fixed_point_array.exe
+
+  // Add -DAPP_BENCHMARK_STANDALONE_TIMING to print the timings of
+  // the kernels compared with loops of the scalar operators.
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 48U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_fixed_point_array();
+  }
+
+  #if defined(APP_BENCHMARK_STANDALONE_TIMING)
+  timing_kernels<std::int16_t>();
+  timing_kernels<std::int32_t>();
+  #endif
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <cstdint>
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC)
+
+#define FIXED_POINT_DISABLE_IOSTREAM
+
+#include <math/fixed_point/fixed_point.h>
+#include <math/fixed_point/fixed_point_cordic.h>
+
+namespace
+{
+  using fixed_point_type = fixed_point<std::int32_t>;
+
+  bool is_within_one_ulp(const fixed_point_type& x, const std::int32_t control_data)
+  {
+    // The control values are the correctly rounded
+    // results in the data representation of 15.16.
+    const std::int32_t delta = *fixed_point_access<fixed_point_type>::data(&x) - control_data;
+
+    return ((delta >= INT32_C(-1)) && (delta <= INT32_C(1)));
+  }
+}
+
+extern fixed_point_type global_one;
+extern fixed_point_type global_two;
+extern fixed_point_type global_ten;
+
+bool app::benchmark::run_fixed_point_cordic()
+{
+  const fixed_point_type one = global_one;
+  const fixed_point_type two = global_two;
+  const fixed_point_type ten = global_ten;
+
+  fixed_point_type s;
+  fixed_point_type c;
+
+  fixed_point_cordic::sincos(one, s, c);
+
+  bool result_is_ok = true;
+
+  result_is_ok &= is_within_one_ulp(s, INT32_C(55147));                                                  // sin(1)
+  result_is_ok &= is_within_one_ulp(c, INT32_C(35409));                                                  // cos(1)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::sin  (-(ten * ten)),             INT32_C( 33185)); // sin(-100)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::atan2(one,  two),                INT32_C( 30386)); // atan2(1, 2)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::atan2(one, -two),                INT32_C(175502)); // atan2(1, -2)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::hypot(one + two, two * two),     INT32_C(327680)); // hypot(3, 4)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::sqrt (two),                      INT32_C( 92682)); // sqrt(2)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::exp  (one),                      INT32_C(178145)); // exp(1)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::exp  (-(one + (one / 2))),       INT32_C( 14623)); // exp(-3/2)
+  result_is_ok &= is_within_one_ulp(fixed_point_cordic::log  (ten),                      INT32_C(150902)); // log(10)
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_fixed_point_cordic.cpp -o ./ref_app/bin/app_benchmark_fixed_point_cordic.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 64U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_fixed_point_cordic();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+fixed_point_type global_one = fixed_point_type(1);
+fixed_point_type global_two = fixed_point_type(2);
+fixed_point_type global_ten = fixed_point_type(10);
+
+#endif // APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES)
+
+#define FIXED_POINT_DISABLE_IOSTREAM
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <math/fixed_point/fixed_point.h>
+
+namespace
+{
+  // Note: The control values have been computed independently
+  // with exact rational arithmetic. They are the data of the
+  // operands a and b, and of a + b, a - b, a * b and a / b.
+  struct control_type
+  {
+    std::int64_t a;
+    std::int64_t b;
+    std::int64_t sum;
+    std::int64_t difference;
+    std::int64_t product;
+    std::int64_t quotient;
+  };
+
+  template<typename fixed_point_type, const std::size_t N>
+  bool check_controls(const std::array<control_type, N>& controls)
+  {
+    using access_type       = fixed_point_access<fixed_point_type>;
+    using signed_value_type = typename fixed_point_type::signed_value_type;
+
+    bool result_is_ok = true;
+
+    for(const control_type& control : controls)
+    {
+      const fixed_point_type a = access_type::make(static_cast<signed_value_type>(control.a));
+      const fixed_point_type b = access_type::make(static_cast<signed_value_type>(control.b));
+
+      const fixed_point_type sum        = a + b;
+      const fixed_point_type difference = a - b;
+      const fixed_point_type product    = a * b;
+      const fixed_point_type quotient   = a / b;
+
+      result_is_ok &= (static_cast<std::int64_t>(*access_type::data(&sum))        == control.sum);
+      result_is_ok &= (static_cast<std::int64_t>(*access_type::data(&difference)) == control.difference);
+      result_is_ok &= (static_cast<std::int64_t>(*access_type::data(&product))    == control.product);
+      result_is_ok &= (static_cast<std::int64_t>(*access_type::data(&quotient))   == control.quotient);
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_fixed_point_round_to_nearest()
+  {
+    // The 15.16 format with fixed_point_round_to_nearest, which wraps
+    // around. The ties (3 * 2^-16) * 0.5 and 2^-16 / 2 round upward to
+    // 2 * 2^-16 and 2^-16, and the ties (-3 * 2^-16) * 0.5 and
+    // -2^-16 / 2 round upward to -2^-16 and 0.
+    using fixed_point_15pt16_nearest = fixed_point<std::int32_t, 16U, fixed_point_round_to_nearest>;
+
+    const std::array<control_type, 8U> controls_15pt16_nearest =
+    {{
+      {      INT64_C(3),   INT64_C(32768),  INT64_C(32771),  INT64_C(-32765),       INT64_C(2),       INT64_C(6) },
+      {     INT64_C(-3),   INT64_C(32768),  INT64_C(32765),  INT64_C(-32771),      INT64_C(-1),      INT64_C(-6) },
+      {     INT64_C(-5),   INT64_C(32768),  INT64_C(32763),  INT64_C(-32773),      INT64_C(-2),     INT64_C(-10) },
+      {      INT64_C(1),  INT64_C(131072), INT64_C(131073), INT64_C(-131071),       INT64_C(2),       INT64_C(1) },
+      {     INT64_C(-1),  INT64_C(131072), INT64_C(131071), INT64_C(-131073),      INT64_C(-2),       INT64_C(0) },
+      { INT64_C(655360),  INT64_C(196608), INT64_C(851968),  INT64_C(458752), INT64_C(1966080),  INT64_C(218453) },
+      { INT64_C(131072), INT64_C(-196608), INT64_C(-65536),  INT64_C(327680), INT64_C(-393216),  INT64_C(-43691) },
+      { INT64_C(212992),  INT64_C(-74565), INT64_C(138427),  INT64_C(287557), INT64_C(-242336), INT64_C(-187201) }
+    }};
+
+    return check_controls<fixed_point_15pt16_nearest>(controls_15pt16_nearest);
+  }
+
+  bool run_fixed_point_overflow_saturate()
+  {
+    // The 15.16 format with fixed_point_overflow_saturate, which rounds
+    // toward zero. The results of 200 * 200, -200 * 200, 32767.5 + 0.5,
+    // -32768 - 2^-16 and 100 / 2^-16 saturate. The quotients are exact.
+    // For those of the last two rows, the former bitwise division gave
+    // 43691 and -591886 (in units of 2^-16), which are off by one.
+    using fixed_point_15pt16_saturate = fixed_point<std::int32_t, 16U, fixed_point_round_toward_zero, fixed_point_overflow_saturate>;
+
+    const std::array<control_type, 10U> controls_15pt16_saturate =
+    {{
+      {    INT64_C(13107200), INT64_C(13107200),    INT64_C(26214400),           INT64_C(0),  INT64_C(2147483647),       INT64_C(65536) },
+      {   INT64_C(-13107200), INT64_C(13107200),           INT64_C(0),   INT64_C(-26214400), INT64_C(-2147483648),      INT64_C(-65536) },
+      {  INT64_C(2147450880),    INT64_C(32768),  INT64_C(2147483647),  INT64_C(2147418112),  INT64_C(1073725440),  INT64_C(2147483647) },
+      { INT64_C(-2147483648),        INT64_C(1), INT64_C(-2147483647), INT64_C(-2147483648),      INT64_C(-32768), INT64_C(-2147483648) },
+      {     INT64_C(6553600),        INT64_C(1),     INT64_C(6553601),     INT64_C(6553599),         INT64_C(100),  INT64_C(2147483647) },
+      {    INT64_C(-6553600),        INT64_C(1),    INT64_C(-6553599),    INT64_C(-6553601),        INT64_C(-100), INT64_C(-2147483648) },
+      {      INT64_C(196608),  INT64_C(-458752),     INT64_C(-262144),      INT64_C(655360),    INT64_C(-1376256),      INT64_C(-28086) },
+      {          INT64_C(-3),    INT64_C(32768),       INT64_C(32765),      INT64_C(-32771),          INT64_C(-1),          INT64_C(-6) },
+      {      INT64_C(131072),   INT64_C(196608),      INT64_C(327680),      INT64_C(-65536),      INT64_C(393216),       INT64_C(43690) },
+      {    INT64_C(-3742348),   INT64_C(414368),    INT64_C(-3327980),    INT64_C(-4156716),   INT64_C(-23661945),     INT64_C(-591885) }
+    }};
+
+    // The 7.8 format with both policies, which has
+    // ties and saturated results of all operations.
+    using fixed_point_7pt8_nearest_saturate = fixed_point<std::int16_t, 8U, fixed_point_round_to_nearest, fixed_point_overflow_saturate>;
+
+    const std::array<control_type, 9U> controls_7pt8_nearest_saturate =
+    {{
+      {  INT64_C(25600), INT64_C(512),  INT64_C(26112),  INT64_C(25088),  INT64_C(32767),  INT64_C(12800) },
+      { INT64_C(-25600), INT64_C(512), INT64_C(-25088), INT64_C(-26112), INT64_C(-32768), INT64_C(-12800) },
+      {      INT64_C(3), INT64_C(128),    INT64_C(131),   INT64_C(-125),      INT64_C(2),      INT64_C(6) },
+      {     INT64_C(-3), INT64_C(128),    INT64_C(125),   INT64_C(-131),     INT64_C(-1),     INT64_C(-6) },
+      {      INT64_C(1), INT64_C(512),    INT64_C(513),   INT64_C(-511),      INT64_C(2),      INT64_C(1) },
+      {     INT64_C(-1), INT64_C(512),    INT64_C(511),   INT64_C(-513),     INT64_C(-2),      INT64_C(0) },
+      {  INT64_C(32512), INT64_C(255),  INT64_C(32767),  INT64_C(32257),  INT64_C(32385),  INT64_C(32639) },
+      {  INT64_C(12800),   INT64_C(3),  INT64_C(12803),  INT64_C(12797),    INT64_C(150),  INT64_C(32767) },
+      {   INT64_C(2560), INT64_C(768),   INT64_C(3328),   INT64_C(1792),   INT64_C(7680),    INT64_C(853) }
+    }};
+
+    return (   check_controls<fixed_point_15pt16_saturate>      (controls_15pt16_saturate)
+            && check_controls<fixed_point_7pt8_nearest_saturate>(controls_7pt8_nearest_saturate));
+  }
+
+  bool run_fixed_point_31pt32()
+  {
+    // The 31.32 format of std::int64_t, for which no integer type of
+    // twice the width exists. The product is formed from the partial
+    // products of the halves, and the quotient with a long division,
+    // which gives the exact quotient, rounded toward zero.
+    const std::array<control_type, 9U> controls_31pt32 =
+    {{
+      {      INT64_C(20016857337327),        INT64_C(-22548578304), INT64_C(19994308759023), INT64_C(20039405915631), INT64_C(-105088501020966),    INT64_C(-3812734730919) },
+      {         INT64_C(30064771072),         INT64_C(12884901888),    INT64_C(42949672960),    INT64_C(17179869184),      INT64_C(90194313216),       INT64_C(10021590357) },
+      {        INT64_C(-30064771072),         INT64_C(12884901888),   INT64_C(-17179869184),   INT64_C(-42949672960),     INT64_C(-90194313216),      INT64_C(-10021590357) },
+      {                   INT64_C(3),          INT64_C(2147483648),     INT64_C(2147483651),    INT64_C(-2147483645),                INT64_C(1),                 INT64_C(6) },
+      {                  INT64_C(-3),          INT64_C(2147483648),     INT64_C(2147483645),    INT64_C(-2147483651),               INT64_C(-1),                INT64_C(-6) },
+      { INT64_C(9223372036854775807), INT64_C(9223372036854775807),             INT64_C(-2),              INT64_C(0),      INT64_C(-4294967296),        INT64_C(4294967296) },
+      {       INT64_C(1250999896491),               INT64_C(65535),  INT64_C(1250999962026),  INT64_C(1250999830956),         INT64_C(19088452), INT64_C(81986780235419701) },
+      {                   INT64_C(1),                   INT64_C(3),              INT64_C(4),             INT64_C(-2),                INT64_C(0),        INT64_C(1431655765) },
+      {      INT64_C(-1250999896491),          INT64_C(2271560481), INT64_C(-1248728336010), INT64_C(-1253271456972),    INT64_C(-661639945256),    INT64_C(-2365335938738) }
+    }};
+
+    // The 31.32 format with both policies. The ties round upward,
+    // and the results of 2^30 * 2, -2^30 * 2, 2^30 / 2^-32,
+    // -2^30 / 2^-32 and -2^31 * -1 and -2^31 / -1 saturate.
+    using fixed_point_31pt32_nearest_saturate = fixed_point<std::int64_t, 32U, fixed_point_round_to_nearest, fixed_point_overflow_saturate>;
+
+    const std::array<control_type, 14U> controls_31pt32_nearest_saturate =
+    {{
+      {             INT64_C(20016857337327), INT64_C(-22548578304),             INT64_C(19994308759023),       INT64_C(20039405915631),           INT64_C(-105088501020967),             INT64_C(-3812734730919) },
+      {                 INT64_C(8589934592),  INT64_C(12884901888),                INT64_C(21474836480),          INT64_C(-4294967296),                INT64_C(25769803776),                 INT64_C(2863311531) },
+      {                INT64_C(-8589934592),  INT64_C(12884901888),                 INT64_C(4294967296),         INT64_C(-21474836480),               INT64_C(-25769803776),                INT64_C(-2863311531) },
+      {                          INT64_C(3),   INT64_C(2147483648),                 INT64_C(2147483651),          INT64_C(-2147483645),                          INT64_C(2),                          INT64_C(6) },
+      {                         INT64_C(-3),   INT64_C(2147483648),                 INT64_C(2147483645),          INT64_C(-2147483651),                         INT64_C(-1),                         INT64_C(-6) },
+      {                          INT64_C(1),   INT64_C(8589934592),                 INT64_C(8589934593),          INT64_C(-8589934591),                          INT64_C(2),                          INT64_C(1) },
+      {                         INT64_C(-1),   INT64_C(8589934592),                 INT64_C(8589934591),          INT64_C(-8589934593),                         INT64_C(-2),                          INT64_C(0) },
+      {        INT64_C(4611686018427387904),   INT64_C(8589934592),        INT64_C(4611686027017322496),  INT64_C(4611686009837453312),        INT64_C(9223372036854775807),        INT64_C(2305843009213693952) },
+      {       INT64_C(-4611686018427387904),   INT64_C(8589934592),       INT64_C(-4611686009837453312), INT64_C(-4611686027017322496), (INT64_C(-9223372036854775807) - 1),       INT64_C(-2305843009213693952) },
+      {        INT64_C(4611686018427387904),            INT64_C(1),        INT64_C(4611686018427387905),  INT64_C(4611686018427387903),                 INT64_C(1073741824),        INT64_C(9223372036854775807) },
+      {       INT64_C(-4611686018427387904),            INT64_C(1),       INT64_C(-4611686018427387903), INT64_C(-4611686018427387905),                INT64_C(-1073741824), (INT64_C(-9223372036854775807) - 1) },
+      {        INT64_C(1311768464867721216),   INT64_C(2271560481),        INT64_C(1311768467139281697),  INT64_C(1311768462596160735),         INT64_C(693779765864729976),        INT64_C(2480234492392099151) },
+      {       INT64_C(-1311768464867721216),   INT64_C(2271560481),       INT64_C(-1311768462596160735), INT64_C(-1311768467139281697),        INT64_C(-693779765864729976),       INT64_C(-2480234492392099151) },
+      { (INT64_C(-9223372036854775807) - 1),  INT64_C(-4294967296), (INT64_C(-9223372036854775807) - 1), INT64_C(-9223372032559808512),        INT64_C(9223372036854775807),        INT64_C(9223372036854775807) }
+    }};
+
+    return (   check_controls<fixed_point_31pt32>                 (controls_31pt32)
+            && check_controls<fixed_point_31pt32_nearest_saturate>(controls_31pt32_nearest_saturate));
+  }
+}
+
+bool app::benchmark::run_fixed_point_policies()
+{
+  static std::uint_fast8_t select_test_case;
+
+  bool result_is_ok;
+
+  if(select_test_case == 0U)
+  {
+    result_is_ok = run_fixed_point_round_to_nearest();
+  }
+  else if(select_test_case == 1U)
+  {
+    result_is_ok = run_fixed_point_overflow_saturate();
+  }
+  else if(select_test_case == 2U)
+  {
+    result_is_ok = run_fixed_point_31pt32();
+  }
+  else
+  {
+    result_is_ok = false;
+  }
+
+  ++select_test_case;
+
+  if(select_test_case >= 3U)
+  {
+    select_test_case = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_fixed_point_policies.cpp -o ./ref_app/bin/app_benchmark_fixed_point_policies.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 64U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_fixed_point_policies();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <array>
+#include <cstdint>
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_BBP)
+
+#include <math/constants/pi_bbp.h>
+#include <mcal_memory/mcal_memory_progmem_array.h>
+
+namespace
+{
+  // The first 96 hexadecimal digits of pi after the hexadecimal point,
+  // pi = 3.243F6A88...
+  const mcal::memory::progmem::array<std::uint8_t, 96U> app_benchmark_pi_bbp_control MY_PROGMEM =
+  {{
+    0x2U, 0x4U, 0x3U, 0xFU, 0x6U, 0xAU, 0x8U, 0x8U, 0x8U, 0x5U, 0xAU, 0x3U, 0x0U, 0x8U, 0xDU, 0x3U,
+    0x1U, 0x3U, 0x1U, 0x9U, 0x8U, 0xAU, 0x2U, 0xEU, 0x0U, 0x3U, 0x7U, 0x0U, 0x7U, 0x3U, 0x4U, 0x4U,
+    0xAU, 0x4U, 0x0U, 0x9U, 0x3U, 0x8U, 0x2U, 0x2U, 0x2U, 0x9U, 0x9U, 0xFU, 0x3U, 0x1U, 0xDU, 0x0U,
+    0x0U, 0x8U, 0x2U, 0xEU, 0xFU, 0xAU, 0x9U, 0x8U, 0xEU, 0xCU, 0x4U, 0xEU, 0x6U, 0xCU, 0x8U, 0x9U,
+    0x4U, 0x5U, 0x2U, 0x8U, 0x2U, 0x1U, 0xEU, 0x6U, 0x3U, 0x8U, 0xDU, 0x0U, 0x1U, 0x3U, 0x7U, 0x7U,
+    0xBU, 0xEU, 0x5U, 0x4U, 0x6U, 0x6U, 0xCU, 0xFU, 0x3U, 0x4U, 0xEU, 0x9U, 0x0U, 0xCU, 0x6U, 0xCU
+  }};
+
+  using pi_bbp_type = math::constants::pi_bbp;
+
+  std::array<std::uint8_t, pi_bbp_type::block_digit> app_benchmark_pi_bbp_out;
+
+  pi_bbp_type app_benchmark_pi_bbp_object;
+
+  std::uint32_t app_benchmark_pi_bbp_position;
+}
+
+bool app::benchmark::run_pi_bbp()
+{
+  // Each run extracts the next block of hexadecimal digits directly
+  // at its position, without calculating any of the prior digits.
+  // The position wraps around after the last block of control digits.
+  bool result_is_ok = app_benchmark_pi_bbp_object.calculate(app_benchmark_pi_bbp_position,
+                                                            app_benchmark_pi_bbp_out.data(),
+                                                            pi_bbp_type::block_digit);
+
+  for(std::uint32_t i = 0U; i < pi_bbp_type::block_digit; ++i)
+  {
+    const std::uint8_t by_calculated = app_benchmark_pi_bbp_out    [i];
+    const std::uint8_t by_control    = app_benchmark_pi_bbp_control[app_benchmark_pi_bbp_position + i];
+
+    const bool next_digit_is_ok = (by_calculated == by_control);
+
+    result_is_ok &= next_digit_is_ok;
+  }
+
+  // Positions beyond the supported range are rejected.
+  std::uint32_t block_out_of_range;
+
+  result_is_ok &= (app_benchmark_pi_bbp_object.calculate_block(pi_bbp_type::max_position + 1U, block_out_of_range) == false);
+
+  app_benchmark_pi_bbp_position += pi_bbp_type::block_digit;
+
+  if(app_benchmark_pi_bbp_position >= std::uint32_t(app_benchmark_pi_bbp_control.size()))
+  {
+    app_benchmark_pi_bbp_position = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_BBP -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_pi_bbp.cpp -o ./ref_app/bin/app_benchmark_pi_bbp.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 12U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_pi_bbp();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_PI_BBP
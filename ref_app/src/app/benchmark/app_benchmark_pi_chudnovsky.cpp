@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <cmath>
+#include <cstdint>
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_CHUDNOVSKY)
+
+#define WIDE_DECIMAL_DISABLE_IOSTREAM
+#define WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+#define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
+#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
+#define WIDE_INTEGER_DISABLE_IOSTREAM
+
+#include <math/wide_decimal/decwide_t.h>
+#include <math/wide_integer/generic_template_uintwide_t.h>
+#include <mcal_memory/mcal_memory_progmem_array.h>
+#include <util/memory/util_n_slot_array_allocator.h>
+
+namespace
+{
+  // Compute pi with the binary-splitting Chudnovsky series and with
+  // the Gauss AGM at the same precision, and check that they agree.
+  // The exact sums P, Q and T are BinarySplittingDigits2-bit
+  // unsigned integers.
+  template<const std::int32_t       WideDecimalDigits10,
+           const std::uint_fast32_t BinarySplittingDigits2>
+  bool app_benchmark_pi_chudnovsky_agm_cross_check()
+  {
+    using local_limb_type = std::uint32_t;
+
+    constexpr std::int32_t local_elem_number =
+      math::wide_decimal::detail::decwide_t_helper<WideDecimalDigits10, local_limb_type>::elem_number;
+
+    using local_allocator_type = util::n_slot_array_allocator<void, static_cast<std::uint_fast32_t>(local_elem_number), 18U>;
+
+    using local_decwide_type = math::wide_decimal::decwide_t<WideDecimalDigits10, local_limb_type, local_allocator_type, float>;
+
+    using local_integer_type = wide_integer::generic_template::uintwide_t<BinarySplittingDigits2, std::uint32_t>;
+
+    const local_decwide_type pi_chudnovsky =
+      math::wide_decimal::calc_pi_chudnovsky<WideDecimalDigits10, local_limb_type, local_allocator_type, float, std::int64_t, local_integer_type>();
+
+    const local_decwide_type pi_agm =
+      math::wide_decimal::pi<WideDecimalDigits10, local_limb_type, local_allocator_type, float>();
+
+    using std::fabs;
+
+    const local_decwide_type closeness = fabs(1 - (pi_chudnovsky / pi_agm));
+
+    return (closeness < (std::numeric_limits<local_decwide_type>::epsilon() * 10));
+  }
+}
+
+bool app::benchmark::run_pi_chudnovsky()
+{
+  // N[Pi, 106] and truncate the final digit.
+  // This is the same computation as in app_benchmark_pi_agm.cpp,
+  // here with the binary-splitting Chudnovsky series. Without
+  // dynamic memory, the exact sums P, Q and T are taken to be
+  // 1024-bit unsigned integers, which suffices for 105 digits.
+  using local_limb_type = std::uint32_t;
+
+  constexpr std::uint32_t wide_decimal_digits10 = UINT32_C(105);
+
+  constexpr std::int32_t local_elem_number =
+    math::wide_decimal::detail::decwide_t_helper<wide_decimal_digits10, local_limb_type>::elem_number;
+
+  using local_allocator_type = util::n_slot_array_allocator<void, local_elem_number, 18U>;
+
+  using dec105_t = math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, local_allocator_type, float>;
+
+  using local_integer_type = wide_integer::generic_template::uintwide_t<1024U, std::uint32_t>;
+
+  static const mcal::memory::progmem::array<typename dec105_t::limb_type, 14U> app_benchmark_pi_chudnovsky_control MY_PROGMEM =
+  {{
+    (typename dec105_t::limb_type) 3UL,
+    (typename dec105_t::limb_type) 14159265UL,
+    (typename dec105_t::limb_type) 35897932UL,
+    (typename dec105_t::limb_type) 38462643UL,
+    (typename dec105_t::limb_type) 38327950UL,
+    (typename dec105_t::limb_type) 28841971UL,
+    (typename dec105_t::limb_type) 69399375UL,
+    (typename dec105_t::limb_type) 10582097UL,
+    (typename dec105_t::limb_type) 49445923UL,
+    (typename dec105_t::limb_type)  7816406UL,
+    (typename dec105_t::limb_type) 28620899UL,
+    (typename dec105_t::limb_type) 86280348UL,
+    (typename dec105_t::limb_type) 25342117UL,
+    (typename dec105_t::limb_type)  6798214UL
+  }};
+
+  const dec105_t my_pi =
+    math::wide_decimal::calc_pi_chudnovsky<wide_decimal_digits10, local_limb_type, local_allocator_type, float, std::int64_t, local_integer_type>();
+
+  bool result_is_ok = std::equal(app_benchmark_pi_chudnovsky_control.cbegin(),
+                                 app_benchmark_pi_chudnovsky_control.cend(),
+                                 my_pi.crepresentation().cbegin());
+
+  result_is_ok &= app_benchmark_pi_chudnovsky_agm_cross_check<static_cast<std::int32_t>(wide_decimal_digits10), 1024U>();
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_CHUDNOVSKY -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_pi_chudnovsky.cpp -o ./ref_app/bin/app_benchmark_pi_chudnovsky.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 64U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_pi_chudnovsky();
+  }
+
+  // Cross-check with the AGM at larger digit counts. These need
+  // several tens of kilobytes of memory, which the 8-bit target
+  // does not have.
+  #if !defined(__AVR__)
+  result_is_ok &= app_benchmark_pi_chudnovsky_agm_cross_check<INT32_C( 501), 4096U>();
+  result_is_ok &= app_benchmark_pi_chudnovsky_agm_cross_check<INT32_C(1001), 8192U>();
+  #endif
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_PI_CHUDNOVSKY
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL)
+
+#include <math/constants/pi_spigot_parallel.h>
+#include <math/constants/pi_spigot_single.h>
+
+namespace
+{
+  // The multi-threaded spigot uses std::thread, and it only divides
+  // the sweep among the threads for large digit counts. This benchmark
+  // is, therefore, intended for the host. The digits are checked against
+  // those of the single-threaded spigot, which is computed once.
+  constexpr std::uint32_t app_benchmark_pi_spigot_result_digit = UINT32_C(10001);
+  constexpr std::uint32_t app_benchmark_pi_spigot_thread_count = UINT32_C(4);
+
+  using pi_spigot_parallel_type = math::constants::pi_spigot_parallel<app_benchmark_pi_spigot_result_digit, 9U>;
+  using pi_spigot_single_type   = math::constants::pi_spigot_single  <app_benchmark_pi_spigot_result_digit, 9U>;
+
+  std::array<std::uint32_t, pi_spigot_parallel_type::get_input__static_size()> app_benchmark_pi_spigot_in_;
+  std::array<std::uint8_t,  pi_spigot_parallel_type::get_output_static_size()> app_benchmark_pi_spigot_out;
+
+  std::array<std::uint32_t, pi_spigot_single_type::get_input__static_size()> app_benchmark_pi_spigot_control_in_;
+  std::array<std::uint8_t,  pi_spigot_single_type::get_output_static_size()> app_benchmark_pi_spigot_control_out;
+
+  pi_spigot_parallel_type app_benchmark_pi_spigot_object(app_benchmark_pi_spigot_thread_count);
+  pi_spigot_single_type   app_benchmark_pi_spigot_control_object;
+
+  bool app_benchmark_pi_spigot_control_is_calculated;
+}
+
+bool app::benchmark::run_pi_spigot_parallel()
+{
+  if(app_benchmark_pi_spigot_control_is_calculated == false)
+  {
+    app_benchmark_pi_spigot_control_object.calculate(app_benchmark_pi_spigot_control_in_.data(),
+                                                     app_benchmark_pi_spigot_control_out.data());
+
+    app_benchmark_pi_spigot_control_is_calculated = true;
+  }
+
+  app_benchmark_pi_spigot_out.fill(UINT8_C(0));
+
+  app_benchmark_pi_spigot_object.calculate(app_benchmark_pi_spigot_in_.data(),
+                                           app_benchmark_pi_spigot_out.data());
+
+  // The digits and the operation count are identical
+  // to those of the single-threaded spigot.
+  const bool result_is_ok =
+    (   (app_benchmark_pi_spigot_object.get_output_digit_count() == app_benchmark_pi_spigot_control_object.get_output_digit_count())
+     && (app_benchmark_pi_spigot_object.get_operation_count()    == app_benchmark_pi_spigot_control_object.get_operation_count())
+     && std::equal(app_benchmark_pi_spigot_out.cbegin(),
+                   app_benchmark_pi_spigot_out.cend(),
+                   app_benchmark_pi_spigot_control_out.cbegin()));
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -pthread -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_pi_spigot_parallel.cpp -o ./ref_app/bin/app_benchmark_pi_spigot_parallel.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 8U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_pi_spigot_parallel();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL
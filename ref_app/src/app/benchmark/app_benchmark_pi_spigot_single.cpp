@@ -35,6 +35,30 @@ namespace
 
   using pi_spigot_type = math::constants::pi_spigot_single<21U, 9U>;
 
+  using rcp_type = pi_spigot_type::reciprocal_type;
+
+  static_assert(pi_spigot_type::get_recip__static_size() == 72U,
+                "Error: The table of reciprocals does not match the spigot size");
+
+  // The reciprocals of the divisors b = (2 * i) + 1 of the spigot
+  // algorithm, which are constructed at compile-time and placed
+  // in read-only program memory.
+  const mcal::memory::progmem::array<rcp_type, 72U> app_benchmark_pi_spigot_rcp MY_PROGMEM =
+  {{
+    rcp_type(  1U), rcp_type(  3U), rcp_type(  5U), rcp_type(  7U), rcp_type(  9U), rcp_type( 11U),
+    rcp_type( 13U), rcp_type( 15U), rcp_type( 17U), rcp_type( 19U), rcp_type( 21U), rcp_type( 23U),
+    rcp_type( 25U), rcp_type( 27U), rcp_type( 29U), rcp_type( 31U), rcp_type( 33U), rcp_type( 35U),
+    rcp_type( 37U), rcp_type( 39U), rcp_type( 41U), rcp_type( 43U), rcp_type( 45U), rcp_type( 47U),
+    rcp_type( 49U), rcp_type( 51U), rcp_type( 53U), rcp_type( 55U), rcp_type( 57U), rcp_type( 59U),
+    rcp_type( 61U), rcp_type( 63U), rcp_type( 65U), rcp_type( 67U), rcp_type( 69U), rcp_type( 71U),
+    rcp_type( 73U), rcp_type( 75U), rcp_type( 77U), rcp_type( 79U), rcp_type( 81U), rcp_type( 83U),
+    rcp_type( 85U), rcp_type( 87U), rcp_type( 89U), rcp_type( 91U), rcp_type( 93U), rcp_type( 95U),
+    rcp_type( 97U), rcp_type( 99U), rcp_type(101U), rcp_type(103U), rcp_type(105U), rcp_type(107U),
+    rcp_type(109U), rcp_type(111U), rcp_type(113U), rcp_type(115U), rcp_type(117U), rcp_type(119U),
+    rcp_type(121U), rcp_type(123U), rcp_type(125U), rcp_type(127U), rcp_type(129U), rcp_type(131U),
+    rcp_type(133U), rcp_type(135U), rcp_type(137U), rcp_type(139U), rcp_type(141U), rcp_type(143U)
+  }};
+
   std::array<std::uint32_t, pi_spigot_type::get_input__static_size()> app_benchmark_pi_spigot_in_;
   std::array<std::uint8_t,  pi_spigot_type::get_output_static_size()> app_benchmark_pi_spigot_out;
 
@@ -45,8 +69,11 @@ namespace
 
 bool app::benchmark::run_pi_spigot_single()
 {
+  // The divisions of the spigot algorithm are done with multiplication
+  // by the reciprocals of the divisors, taken from the table in ROM.
   app_benchmark_pi_spigot_object.calculate(app_benchmark_pi_spigot_in_.data(),
-                                           app_benchmark_pi_spigot_out.data());
+                                           app_benchmark_pi_spigot_out.data(),
+                                           app_benchmark_pi_spigot_rcp.cbegin());
 
   bool result_is_ok = true;
 
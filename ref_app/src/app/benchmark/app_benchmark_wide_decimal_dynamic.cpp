@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <cstdint>
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC)
+
+#define WIDE_DECIMAL_DISABLE_IOSTREAM
+
+#include <math/wide_decimal/decwide_dynamic_t.h>
+#include <util/memory/util_pool_allocator.h>
+
+namespace
+{
+  // The limbs of decwide_dynamic_t are taken from the pool allocator,
+  // which in turn gets its memory from the heap. This benchmark
+  // is, therefore, intended for the host.
+  using dec_dynamic_t = math::wide_decimal::decwide_dynamic_t<std::uint32_t, util::pool_allocator<void>>;
+
+  bool is_close_fraction(const dec_dynamic_t& a, const dec_dynamic_t& b, const std::int32_t prec_digits10)
+  {
+    // Check that |1 - (a / b)| < 10^-(prec_digits10 - 1).
+    const dec_dynamic_t tolerance = pow(dec_dynamic_t(10U, prec_digits10), -static_cast<std::int64_t>(prec_digits10 - 1));
+
+    return (fabs(1 - (a / b)) < tolerance);
+  }
+
+  bool run_wide_decimal_dynamic_at(const std::int32_t prec_digits10)
+  {
+    // The same instantiation of decwide_dynamic_t serves
+    // all of the precisions.
+    const dec_dynamic_t x = dec_dynamic_t(123456U, prec_digits10) / 100;
+
+    const dec_dynamic_t s = sqrt(x);
+
+    bool result_is_ok = is_close_fraction(s * s, x, prec_digits10);
+
+    // Check the round trip of log and exp.
+    result_is_ok &= is_close_fraction(exp(log(s)), s, prec_digits10 - 2);
+
+    return result_is_ok;
+  }
+}
+
+bool app::benchmark::run_wide_decimal_dynamic()
+{
+  static util::memory_pool::size_type blocks_in_use_previous = 0U;
+  static bool                         is_first_call          = true;
+
+  bool result_is_ok = true;
+
+  {
+    // N[Sqrt[123456/100], 101]
+    const dec_dynamic_t control("35.136306009596398663933384640418055759751518287169314528165976164717710895452890928635031219132220978", 101);
+
+    result_is_ok &= is_close_fraction(sqrt(dec_dynamic_t(123456U, 101) / 100), control, 101);
+  }
+
+  result_is_ok &= run_wide_decimal_dynamic_at(INT32_C( 101));
+  result_is_ok &= run_wide_decimal_dynamic_at(INT32_C( 501));
+  result_is_ok &= run_wide_decimal_dynamic_at(INT32_C(1001));
+
+  // The FFT scratch of the limb multiplication stays in the pool
+  // after the first call. Apart from that, all of the temporaries
+  // have been returned, so the block count must not grow.
+  const util::memory_pool::size_type blocks_in_use = util::memory_pool::instance().blocks_in_use();
+
+  if(is_first_call)
+  {
+    is_first_call = false;
+  }
+  else
+  {
+    result_is_ok &= (blocks_in_use == blocks_in_use_previous);
+  }
+
+  blocks_in_use_previous = blocks_in_use;
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_decimal_dynamic.cpp -o ./ref_app/bin/app_benchmark_wide_decimal_dynamic.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 64U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_wide_decimal_dynamic();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC
@@ -0,0 +1,318 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT)
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <math/wide_decimal/decwide_t_pi_checkpoint.h>
+
+namespace
+{
+  constexpr std::int32_t wide_decimal_digits10 = INT32_C(1001);
+
+  using dec1001_t   = math::wide_decimal::decwide_t<wide_decimal_digits10, std::uint32_t>;
+  using state_type  = math::wide_decimal::calc_pi_state<wide_decimal_digits10, std::uint32_t>;
+
+  // The checkpoint files are written to the working directory.
+  const std::string checkpoint_file_name = "app_benchmark_wide_decimal_pi_checkpoint.bin";
+  const std::string saved_file_name      = checkpoint_file_name + ".saved";
+
+  // Note: The control digits have been computed independently
+  // with Machin's formula.
+
+  // N[Pi, 101]
+  const char control_pi_100[] =
+    "3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679";
+
+  // The digits 961 through 1000 after the decimal point of pi.
+  const char control_pi_961_to_1000[] = "1712268066130019278766111959092164201989";
+
+  std::uint32_t callback_count;
+  std::uint32_t callback_count_to_save;
+
+  void copy_file(const std::string& source_file_name, const std::string& target_file_name)
+  {
+    std::ifstream in (source_file_name, std::ios::in  | std::ios::binary);
+    std::ofstream out(target_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    out << in.rdbuf();
+  }
+
+  void callback_to_count_and_save(const std::uint32_t digits10)
+  {
+    static_cast<void>(digits10);
+
+    ++callback_count;
+
+    // Save a copy of the checkpoint file during the calculation.
+    // The copy is the checkpoint that an interruption at this
+    // point would have left behind.
+    if(callback_count == callback_count_to_save)
+    {
+      copy_file(checkpoint_file_name, saved_file_name);
+    }
+  }
+
+  bool files_are_removed()
+  {
+    const std::ifstream in    (checkpoint_file_name,          std::ios::in | std::ios::binary);
+    const std::ifstream in_tmp(checkpoint_file_name + ".tmp", std::ios::in | std::ios::binary);
+    const std::ifstream in_old(checkpoint_file_name + ".old", std::ios::in | std::ios::binary);
+
+    return ((in.is_open() == false) && (in_tmp.is_open() == false) && (in_old.is_open() == false));
+  }
+
+  bool run_wide_decimal_pi_checkpointed()
+  {
+    const dec1001_t pi_control = math::wide_decimal::calc_pi<wide_decimal_digits10, std::uint32_t, std::allocator<void>, double, std::int64_t>(nullptr);
+
+    // Calculate pi with checkpoints, and save the checkpoint
+    // from the third iteration (which holds the state after
+    // the second iteration).
+    callback_count         = 0U;
+    callback_count_to_save = 4U;
+
+    const dec1001_t pi_full = math::wide_decimal::calc_pi_checkpointed<wide_decimal_digits10>(checkpoint_file_name, callback_to_count_and_save);
+
+    const std::uint32_t callback_count_full = callback_count;
+
+    const bool result_full_is_ok = ((pi_full == pi_control) && files_are_removed());
+
+    // Resume the interrupted calculation from the saved checkpoint,
+    // which skips the first two iterations.
+    static_cast<void>(std::rename(saved_file_name.c_str(), checkpoint_file_name.c_str()));
+
+    callback_count         = 0U;
+    callback_count_to_save = 0U;
+
+    const dec1001_t pi_resumed = math::wide_decimal::calc_pi_checkpointed<wide_decimal_digits10>(checkpoint_file_name, callback_to_count_and_save);
+
+    const bool result_resumed_is_ok =
+      (   (pi_resumed == pi_control)
+       && (callback_count == (callback_count_full - 2U))
+       && files_are_removed());
+
+    // Resume from the temporary file and from the old checkpoint,
+    // which are left behind by an interruption while replacing the
+    // checkpoint. A damaged checkpoint is ignored.
+    bool result_fallback_is_ok = true;
+
+    const std::string fallback_file_names[2U] = { checkpoint_file_name + ".tmp", checkpoint_file_name + ".old" };
+
+    for(const std::string& fallback_file_name : fallback_file_names)
+    {
+      state_type state;
+
+      static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+      static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+      static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+
+      {
+        std::ofstream out(fallback_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        result_fallback_is_ok &= math::wide_decimal::write_checkpoint(out, state);
+      }
+
+      {
+        std::ofstream out(checkpoint_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        out << "damaged";
+      }
+
+      callback_count = 0U;
+
+      const dec1001_t pi_fallback = math::wide_decimal::calc_pi_checkpointed<wide_decimal_digits10>(checkpoint_file_name, callback_to_count_and_save);
+
+      result_fallback_is_ok &=
+        (   (pi_fallback == pi_control)
+         && (callback_count == (callback_count_full - 3U))
+         && files_are_removed());
+    }
+
+    return (result_full_is_ok && result_resumed_is_ok && result_fallback_is_ok);
+  }
+
+  bool run_wide_decimal_pi_checkpoint_io()
+  {
+    // Write the state after three iterations and read it back.
+    state_type state;
+
+    static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+    static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+    static_cast<void>(math::wide_decimal::calc_pi_iterate(state));
+
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+
+    const bool result_write_is_ok = math::wide_decimal::write_checkpoint(ss, state);
+
+    const std::string checkpoint = ss.str();
+
+    state_type state_read;
+
+    const bool result_read_is_ok =
+      (   math::wide_decimal::read_checkpoint(ss, state_read)
+       && (state_read.k            == state.k)
+       && (state_read.is_converged == state.is_converged)
+       && (state_read.a            == state.a)
+       && (state_read.bB           == state.bB)
+       && (state_read.t            == state.t)
+       && (state_read.s            == state.s));
+
+    // Both states continue to the same value of pi.
+    while(math::wide_decimal::calc_pi_iterate(state)      == false) { ; }
+    while(math::wide_decimal::calc_pi_iterate(state_read) == false) { ; }
+
+    const bool result_continue_is_ok = (math::wide_decimal::calc_pi_result(state_read) == math::wide_decimal::calc_pi_result(state));
+
+    // Damaged checkpoints and checkpoints of another type are
+    // rejected, and the state is left unchanged. The header has
+    // 19 bytes, and it is followed by the sign (1 byte), the
+    // exponent (8 bytes) and the limbs of a.
+    auto checkpoint_is_rejected =
+      [](const std::string& damaged_checkpoint) -> bool
+      {
+        std::stringstream ss_damaged(damaged_checkpoint, std::ios::in | std::ios::binary);
+
+        state_type state_damaged;
+
+        return (   (math::wide_decimal::read_checkpoint(ss_damaged, state_damaged) == false)
+                && (state_damaged.k == 0U)
+                && (state_damaged.a == 1U));
+      };
+
+    std::string checkpoint_magic (checkpoint); checkpoint_magic [0U]  = 'X';
+    std::string checkpoint_sign  (checkpoint); checkpoint_sign  [19U] = static_cast<char>(2);
+    std::string checkpoint_limb  (checkpoint); checkpoint_limb.replace(28U, 4U, 4U, static_cast<char>(0xFF));
+
+    using dec501_t   = math::wide_decimal::decwide_t<INT32_C(501), std::uint32_t>;
+    using state501_t = math::wide_decimal::calc_pi_state<INT32_C(501), std::uint32_t>;
+
+    std::stringstream ss_other(checkpoint, std::ios::in | std::ios::binary);
+
+    state501_t state_other;
+
+    const bool result_reject_is_ok =
+      (   checkpoint_is_rejected(checkpoint_magic)
+       && checkpoint_is_rejected(checkpoint_sign)
+       && checkpoint_is_rejected(checkpoint_limb)
+       && checkpoint_is_rejected(checkpoint.substr(0U, checkpoint.size() - 1U))
+       && (math::wide_decimal::read_checkpoint(ss_other, state_other) == false)
+       && (state_other.a == dec501_t(1U)));
+
+    return (result_write_is_ok && result_read_is_ok && result_continue_is_ok && result_reject_is_ok);
+  }
+
+  bool run_wide_decimal_pi_write_digits()
+  {
+    const dec1001_t pi = math::wide_decimal::calc_pi<wide_decimal_digits10, std::uint32_t, std::allocator<void>, double, std::int64_t>(nullptr);
+
+    // The first 100 digits, written in small chunks.
+    std::stringstream ss_100;
+
+    const bool result_100_is_ok =
+      (   math::wide_decimal::write_digits(ss_100, pi, 100U, 7U)
+       && (ss_100.str() == control_pi_100));
+
+    // The first 1000 digits, written in one chunk and in chunks
+    // of a single character.
+    std::stringstream ss_1000;
+    std::stringstream ss_1000_chunk_1;
+
+    const bool result_1000_is_ok =
+      (   math::wide_decimal::write_digits(ss_1000,         pi, 1000U)
+       && math::wide_decimal::write_digits(ss_1000_chunk_1, pi, 1000U, 1U)
+       && (ss_1000.str().size() == 1002U)
+       && (ss_1000.str().substr(0U, 102U) == control_pi_100)
+       && (ss_1000.str().substr(962U)     == control_pi_961_to_1000)
+       && (ss_1000_chunk_1.str() == ss_1000.str()));
+
+    // Negative values, small values, integers and zero.
+    //   N[-1/8, 6], N[1/1000, 6], N[(2^40) * 10^4 + 1/2, 20]
+    const dec1001_t x_neg   = -(dec1001_t(1U) / 8U);
+    const dec1001_t x_small =   dec1001_t(1U) / 1000U;
+    const dec1001_t x_int   =   (dec1001_t(UINT64_C(1099511627776)) * 10000U) + (dec1001_t(1U) / 2U);
+
+    std::stringstream ss_neg;
+    std::stringstream ss_small;
+    std::stringstream ss_int;
+    std::stringstream ss_int_no_fraction;
+    std::stringstream ss_zero;
+
+    const bool result_values_is_ok =
+      (   math::wide_decimal::write_digits(ss_neg,             x_neg,          5U)
+       && math::wide_decimal::write_digits(ss_small,           x_small,        5U)
+       && math::wide_decimal::write_digits(ss_int,             x_int,          3U)
+       && math::wide_decimal::write_digits(ss_int_no_fraction, x_int,          0U)
+       && math::wide_decimal::write_digits(ss_zero,            dec1001_t(0U),  2U)
+       && (ss_neg.str()             == "-0.12500")
+       && (ss_small.str()           == "0.00100")
+       && (ss_int.str()             == "10995116277760000.500")
+       && (ss_int_no_fraction.str() == "10995116277760000")
+       && (ss_zero.str()            == "0.00"));
+
+    return (result_100_is_ok && result_1000_is_ok && result_values_is_ok);
+  }
+}
+
+bool app::benchmark::run_wide_decimal_pi_checkpoint()
+{
+  static std::uint_fast8_t select_test_case;
+
+  bool result_is_ok;
+
+  if(select_test_case == 0U)
+  {
+    result_is_ok = run_wide_decimal_pi_checkpointed();
+  }
+  else if(select_test_case == 1U)
+  {
+    result_is_ok = run_wide_decimal_pi_checkpoint_io();
+  }
+  else if(select_test_case == 2U)
+  {
+    result_is_ok = run_wide_decimal_pi_write_digits();
+  }
+  else
+  {
+    result_is_ok = false;
+  }
+
+  ++select_test_case;
+
+  if(select_test_case >= 3U)
+  {
+    select_test_case = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_decimal_pi_checkpoint.cpp -o ./ref_app/bin/app_benchmark_wide_decimal_pi_checkpoint.exe
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 6U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_wide_decimal_pi_checkpoint();
+  }
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT
@@ -0,0 +1,776 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC)
+
+#define WIDE_INTEGER_DISABLE_IOSTREAM
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <math/wide_integer/generic_template_uintwide_t.h>
+#include <math/wide_integer/generic_template_uintwide_t_batch.h>
+
+namespace
+{
+  using uint256_t  = wide_integer::generic_template::uintwide_t< 256U, std::uint32_t>;
+  using uint4096_t = wide_integer::generic_template::uintwide_t<4096U, std::uint32_t>;
+
+  // Note: Some of the comments in this file use the Wolfram Language(TM).
+  // The control values have been computed independently.
+
+  // The digit-by-digit decimal conversion, which divides the whole
+  // value by ten once per output digit and multiplies it by ten once
+  // per input digit. It is the reference for the chunked and the
+  // divide-and-conquer decimal conversion of uintwide_t.
+  template<typename WideIntegerType>
+  const char* wr_string_dec_by_digits(WideIntegerType t, char* p_end)
+  {
+    char* p = p_end;
+
+    *p = char('\0');
+
+    do
+    {
+      const WideIntegerType q = t / 10U;
+
+      *(--p) = char(static_cast<std::uint32_t>(t - WideIntegerType(q).mul_by_limb(10U)) + 0x30U);
+
+      t = q;
+    }
+    while(t != 0U);
+
+    return p;
+  }
+
+  template<typename WideIntegerType>
+  WideIntegerType rd_string_dec_by_digits(const char* p)
+  {
+    WideIntegerType u(0U);
+
+    for( ; *p != char('\0'); ++p)
+    {
+      u.mul_by_limb(10U);
+
+      u += static_cast<std::uint32_t>(*p - char('0'));
+    }
+
+    return u;
+  }
+
+  bool run_wide_integer_decimal_io()
+  {
+    // A 256-bit value, which is converted with chunks only.
+    //   IntegerString[v, 10]
+    const uint256_t v("0x39F5C88E2D94628BB64BA4FD98E616EC8BB01460217F871CBE0AE8FA1CEAC2CC");
+
+    const char v_dec[] = "26216094082498768296797031755339785092623104294834129923600535849537347699404";
+
+    char str_256[uint256_t::wr_string_max_buffer_size_dec];
+
+    const bool result_256_is_ok =
+      (   v.wr_string(str_256, 10U, false)
+       && (std::strcmp(str_256, v_dec) == 0)
+       && (uint256_t(v_dec) == v));
+
+    // Decimal input wraps around modulo 2^256, and apostrophes
+    // are allowed as digit separators.
+    //   Mod[w, 2^256] for a 300-bit value w
+    const uint256_t w_mod("0x24F1E3CD369CBD3F35FEF5876AE5BC08C37F0CE876CF29A6A34FAAB921EB4E08");
+
+    const bool result_wrap_is_ok =
+      (   (uint256_t("1350427377032546084692633215699097440136935794511874634892142951739300101070426288568356360") == w_mod)
+       && (uint256_t("115'792'089'237'316'195'423'570'985'008'687'907'853'269'984'665'640'564'039'457'584'007'913'129'639'935") == (std::numeric_limits<uint256_t>::max)()));
+
+    // A 4096-bit value, which is converted with divide-and-conquer
+    // splitting. The result is compared with the digit-by-digit
+    // conversion, and the leading and trailing digits with controls.
+    //   t = 3^2583, IntegerLength[t] = 1233
+    //   First 32 digits: 25363018640659988174725483055266
+    //   Last  32 digits: 81036597160455930907324686385227
+    const uint4096_t t = pow(uint4096_t(3U), 2583U);
+
+    static char str_4096[uint4096_t::wr_string_max_buffer_size_dec];
+    static char ref_4096[uint4096_t::wr_string_max_buffer_size_dec];
+
+    const char* p_ref = wr_string_dec_by_digits(t, ref_4096 + (sizeof(ref_4096) - 1U));
+
+    const bool result_4096_is_ok =
+      (   t.wr_string(str_4096, 10U, false)
+       && (std::strlen(str_4096) == 1233U)
+       && (std::strncmp(str_4096, "25363018640659988174725483055266", 32U) == 0)
+       && (std::strcmp (str_4096 + (1233U - 32U), "81036597160455930907324686385227") == 0)
+       && (std::strcmp (str_4096, p_ref) == 0)
+       && (uint4096_t(str_4096) == t));
+
+    // A power of ten has long runs of zeros, which the lower
+    // halves of the splitting need to pad.
+    const uint4096_t ten_pow = pow(uint4096_t(10U), 1200U);
+
+    const bool result_zeros_is_ok =
+      (   ten_pow.wr_string(str_4096, 10U, false)
+       && (std::strlen(str_4096) == 1201U)
+       && (std::strcmp(str_4096, wr_string_dec_by_digits(ten_pow, ref_4096 + (sizeof(ref_4096) - 1U))) == 0)
+       && (rd_string_dec_by_digits<uint4096_t>(str_4096) == ten_pow)
+       && (uint4096_t(str_4096) == ten_pow));
+
+    return (result_256_is_ok && result_wrap_is_ok && result_4096_is_ok && result_zeros_is_ok);
+  }
+
+  // Write a pseudo-random hexadecimal number having bit_count bits
+  // into str. The linear congruential generator of Knuth's MMIX
+  // is used with the given seed.
+  void make_hex_string(char* str, const std::uint_fast32_t bit_count, std::uint64_t& seed)
+  {
+    const char hex_digits[] = "0123456789ABCDEF";
+
+    *str++ = char('0');
+    *str++ = char('x');
+
+    for(std::uint_fast32_t i = 0U; i < (bit_count / 4U); ++i)
+    {
+      seed = (seed * UINT64_C(6364136223846793005)) + UINT64_C(1442695040888963407);
+
+      *str++ = hex_digits[std::uint_fast8_t(seed >> 60U)];
+    }
+
+    *str = char('\0');
+  }
+
+  template<typename WideIntegerTypeA,
+           typename WideIntegerTypeB>
+  bool hex_strings_are_equal(const WideIntegerTypeA& a, const WideIntegerTypeB& b)
+  {
+    char str_a[WideIntegerTypeA::wr_string_max_buffer_size_hex];
+    char str_b[WideIntegerTypeB::wr_string_max_buffer_size_hex];
+
+    return (a.wr_string(str_a) && b.wr_string(str_b) && (std::strcmp(str_a, str_b) == 0));
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  bool run_wide_integer_limb_kernels(std::uint64_t& seed)
+  {
+    // On x86-64, the add, subtract and multiply kernels for 32-bit
+    // limbs are dedicated kernels, which process pairs of limbs.
+    // The same values held with 16-bit limbs use the portable loops,
+    // and the results are compared via their hexadecimal strings.
+    using local_wide_integer_32_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+    using local_wide_integer_16_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint16_t>;
+
+    char str_a[local_wide_integer_32_type::wr_string_max_buffer_size_hex];
+    char str_b[local_wide_integer_32_type::wr_string_max_buffer_size_hex];
+    char str_c[local_wide_integer_32_type::wr_string_max_buffer_size_hex];
+
+    // The divisor c has somewhat more than half as many bits as a.
+    make_hex_string(str_a, Digits2, seed);
+    make_hex_string(str_b, Digits2, seed);
+    make_hex_string(str_c, (Digits2 / 2U) + 16U, seed);
+
+    const local_wide_integer_32_type a32(str_a);
+    const local_wide_integer_32_type b32(str_b);
+    const local_wide_integer_32_type c32(str_c);
+    const local_wide_integer_16_type a16(str_a);
+    const local_wide_integer_16_type b16(str_b);
+    const local_wide_integer_16_type c16(str_c);
+
+    local_wide_integer_32_type a32_times_limb(a32);
+    local_wide_integer_16_type a16_times_limb(a16);
+
+    a32_times_limb.mul_by_limb(40503U);
+    a16_times_limb.mul_by_limb(40503U);
+
+    const bool result_is_ok =
+      (   hex_strings_are_equal(a32 + b32, a16 + b16)
+       && hex_strings_are_equal(a32 - b32, a16 - b16)
+       && hex_strings_are_equal(b32 - a32, b16 - a16)
+       && hex_strings_are_equal(a32 * b32, a16 * b16)
+       && hex_strings_are_equal(a32 * a32, a16 * a16)
+       && hex_strings_are_equal(a32 / c32, a16 / c16)
+       && hex_strings_are_equal(a32 % c32, a16 % c16)
+       && hex_strings_are_equal(a32_times_limb, a16_times_limb));
+
+    return result_is_ok;
+  }
+
+  bool run_wide_integer_limb_kernels()
+  {
+    // Control values for 224 bits (an odd number of limbs).
+    //   a = 2^224 - 1 and b = 0x89ABCDEF * 2^192 + 0x76543210
+    //   Mod[a * b, 2^224], Mod[a + b, 2^224] and Mod[a - b, 2^224]
+    using uint224_t = wide_integer::generic_template::uintwide_t<224U, std::uint32_t>;
+
+    const uint224_t a = (std::numeric_limits<uint224_t>::max)();
+    const uint224_t b("0x89ABCDEF000000000000000000000000000000000000000076543210");
+
+    const bool result_control_is_ok =
+      (   ((a * b) == uint224_t("0x76543210FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF89ABCDF0"))
+       && ((a + b) == uint224_t("0x89ABCDEF00000000000000000000000000000000000000007654320F"))
+       && ((a - b) == uint224_t("0x76543210FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF89ABCDEF")));
+
+    // Widths with odd and even limb counts, and a width which
+    // uses Karatsuba multiplication (at least 129 limbs).
+    std::uint64_t seed = UINT64_C(29);
+
+    bool result_is_ok = result_control_is_ok;
+
+    for(std::uint_fast8_t i = 0U; i < 4U; ++i)
+    {
+      result_is_ok &= run_wide_integer_limb_kernels<  96U>(seed);
+      result_is_ok &= run_wide_integer_limb_kernels< 224U>(seed);
+      result_is_ok &= run_wide_integer_limb_kernels<1024U>(seed);
+      result_is_ok &= run_wide_integer_limb_kernels<8192U>(seed);
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_wide_integer_ntt()
+  {
+    // Multiplication of the 2^17-bit type uses the number-theoretic
+    // transform, and multiplication of the 2^16-bit type uses the
+    // Karatsuba multiplication (with the default threshold).
+    using uint65536_t  = wide_integer::generic_template::uintwide_t<UINT32_C( 65536), std::uint32_t>;
+    using uint131072_t = wide_integer::generic_template::uintwide_t<UINT32_C(131072), std::uint32_t>;
+
+    // The square of the maximum 2^16-bit value.
+    //   Mod[(2^65536 - 1)^2, 2^131072] = 2^131072 - 2^65537 + 1
+    const uint131072_t x((std::numeric_limits<uint65536_t>::max)());
+
+    const bool result_control_is_ok = ((x * x) == (uint131072_t(1U) - (uint131072_t(1U) << 65537U)));
+
+    // The full product of two pseudo-random 2^16-bit values a and b.
+    // The reference is assembled from the four products of their
+    // 2^15-bit halves, which are exact in the 2^16-bit type.
+    static char str_a[uint65536_t::wr_string_max_buffer_size_hex];
+    static char str_b[uint65536_t::wr_string_max_buffer_size_hex];
+
+    std::uint64_t seed = UINT64_C(30);
+
+    make_hex_string(str_a, UINT32_C(65536), seed);
+    make_hex_string(str_b, UINT32_C(65536), seed);
+
+    const uint65536_t a(str_a);
+    const uint65536_t b(str_b);
+
+    const uint65536_t a_hi = (a >> 32768U);
+    const uint65536_t b_hi = (b >> 32768U);
+    const uint65536_t a_lo = (a - (a_hi << 32768U));
+    const uint65536_t b_lo = (b - (b_hi << 32768U));
+
+    const uint131072_t ab_ref =
+        (uint131072_t(a_hi * b_hi) << 65536U)
+      + ((uint131072_t(a_hi * b_lo) + uint131072_t(a_lo * b_hi)) << 32768U)
+      +  uint131072_t(a_lo * b_lo);
+
+    const bool result_product_is_ok = ((uint131072_t(a) * uint131072_t(b)) == ab_ref);
+
+    // The product of two full 2^17-bit values wraps around, and
+    // its lower half is the product in the 2^16-bit type.
+    const uint131072_t c = (uint131072_t(a) << 65536U) + uint131072_t(b);
+    const uint131072_t d = (uint131072_t(b) << 65536U) + uint131072_t(a);
+
+    const bool result_wrap_is_ok = (uint65536_t(c * d) == (b * a));
+
+    return (result_control_is_ok && result_product_is_ok && result_wrap_is_ok);
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType,
+           const std::uint_fast32_t BatchSize>
+  bool run_wide_integer_batch(std::uint64_t& seed)
+  {
+    // Each operation of the batch is compared with the same
+    // operation of uintwide_t, value by value.
+    using local_batch_type = wide_integer::generic_template::uintwide_t_batch<Digits2, LimbType, BatchSize>;
+    using local_value_type = typename local_batch_type::value_type;
+
+    std::array<local_value_type, BatchSize> a;
+    std::array<local_value_type, BatchSize> b;
+
+    char str[local_value_type::wr_string_max_buffer_size_hex];
+
+    for(std::uint_fast32_t i = 0U; i < BatchSize; ++i)
+    {
+      make_hex_string(str, Digits2, seed);
+
+      a[i] = local_value_type(str);
+
+      make_hex_string(str, Digits2, seed);
+
+      b[i] = local_value_type(str);
+    }
+
+    // The carry and the borrow run through all of the limbs
+    // in the first two values, and the third values are equal.
+    a[0U] = (std::numeric_limits<local_value_type>::max)();
+    b[0U] = 1U;
+    a[1U] = 0U;
+    b[1U] = 1U;
+    b[2U] = a[2U];
+
+    local_batch_type ua;
+    local_batch_type ub;
+
+    ua.load(a.cbegin());
+    ub.load(b.cbegin());
+
+    const local_batch_type u_sum = ua + ub;
+    const local_batch_type u_dif = ua - ub;
+
+    local_batch_type u_mul(ua);
+    local_batch_type u_shl(ua);
+    local_batch_type u_shr(ua);
+    local_batch_type u_shl_limb(ua);
+
+    u_mul.mul_by_limb(LimbType(0x9DU));
+    u_shl <<= 37U;
+    u_shr >>= 37U;
+    u_shl_limb <<= std::uint_fast32_t(std::numeric_limits<LimbType>::digits * 2);
+
+    typename local_batch_type::compare_result_type cmp;
+
+    ua.compare(ub, cmp);
+
+    std::array<local_value_type, BatchSize> dif;
+
+    static_cast<void>(u_dif.store(dif.begin()));
+
+    bool result_is_ok =
+      (   (u_sum.get(0U) == 0U)
+       && (u_dif.get(1U) == (std::numeric_limits<local_value_type>::max)())
+       && (cmp[2U] == 0));
+
+    for(std::uint_fast32_t i = 0U; i < BatchSize; ++i)
+    {
+      local_value_type a_mul(a[i]);
+
+      a_mul.mul_by_limb(LimbType(0x9DU));
+
+      const std::int_fast8_t cmp_ab = std::int_fast8_t((a[i] > b[i]) ? 1 : ((a[i] < b[i]) ? -1 : 0));
+
+      result_is_ok &=
+        (   (u_sum.get(i) == (a[i] + b[i]))
+         && (dif[i] == (a[i] - b[i]))
+         && (u_mul.get(i) == a_mul)
+         && (u_shl.get(i) == (a[i] << 37U))
+         && (u_shr.get(i) == (a[i] >> 37U))
+         && (u_shl_limb.get(i) == (a[i] << (std::numeric_limits<LimbType>::digits * 2)))
+         && (cmp[i] == cmp_ab)
+         && (local_batch_type(b[i]).get(BatchSize - 1U) == b[i]));
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_wide_integer_batch()
+  {
+    // Batch sizes which are and are not a multiple of the vector width.
+    std::uint64_t seed = UINT64_C(31);
+
+    const bool result_is_ok =
+      (   run_wide_integer_batch<256U, std::uint32_t, 16U>(seed)
+       && run_wide_integer_batch<512U, std::uint32_t,  7U>(seed)
+       && run_wide_integer_batch<128U, std::uint16_t,  5U>(seed)
+       && run_wide_integer_batch<128U, std::uint8_t,   3U>(seed));
+
+    return result_is_ok;
+  }
+
+  // A table of the powers of ten, which is computed
+  // by the compiler where uintwide_t is constexpr.
+  WIDE_INTEGER_CONSTEXPR std::array<uint256_t, 60U> make_powers_of_ten()
+  {
+    std::array<uint256_t, 60U> powers { };
+
+    powers[0U] = 1U;
+
+    for(std::size_t k = 1U; k < powers.size(); ++k)
+    {
+      powers[k] = powers[k - 1U] * 10U;
+    }
+
+    return powers;
+  }
+
+  #if (WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST == 1)
+  constexpr std::array<uint256_t, 60U> powers_of_ten = make_powers_of_ten();
+
+  // Division, remainder, shifts and comparisons in constant expressions.
+  //   Mod[10^59, 10^19 + 1] = 10^19 - 99
+  //   BitShiftRight[10^59, 128] and Mod[BitShiftLeft[10^59, 77], 2^256]
+  static_assert(powers_of_ten[19U] == uint256_t(UINT64_C(10000000000000000000)), "Error: constexpr multiplication is not OK");
+  static_assert((powers_of_ten[59U] / powers_of_ten[40U]) == powers_of_ten[19U], "Error: constexpr division is not OK");
+  static_assert((powers_of_ten[59U] % (powers_of_ten[19U] + 1U)) == uint256_t(UINT64_C(9999999999999999901)), "Error: constexpr remainder is not OK");
+  static_assert((powers_of_ten[59U] >> 128U) == ((uint256_t(UINT32_C(0xF)) << 64U) | UINT64_C(0xEE50B7025C36A080)), "Error: constexpr right shift is not OK");
+  static_assert((powers_of_ten[59U] << 77U) == (uint256_t(UINT64_C(0x16E04B86D41005E4)) << 192U) + (uint256_t(UINT64_C(0x6DA08EA7AB691D00)) << 128U), "Error: constexpr left shift is not OK");
+  static_assert((powers_of_ten[59U] < powers_of_ten[58U]) == false, "Error: constexpr comparison is not OK");
+  static_assert(((std::numeric_limits<uint256_t>::max)() + 1U) == (std::numeric_limits<uint256_t>::min)(), "Error: constexpr limits are not OK");
+
+  // Limbs of 8 bits, compared with the built-in 64-bit product.
+  using uint64_8_t = wide_integer::generic_template::uintwide_t<64U, std::uint8_t>;
+
+  static_assert(static_cast<std::uint64_t>(uint64_8_t(UINT64_C(0x0123456789ABCDEF)) * uint64_8_t(UINT64_C(0xFEDCBA9876543210))) == UINT64_C(0x2236D88FE5618CF0), "Error: constexpr multiplication with 8-bit limbs is not OK");
+
+  // A Karatsuba multiplication (at least 129 limbs).
+  //   Mod[(2^4096 - 1)^2, 2^8192] = 2^8192 - 2^4097 + 1
+  using uint8192_t = wide_integer::generic_template::uintwide_t<8192U, std::uint32_t>;
+
+  static_assert((((uint8192_t(1U) << 4096U) - 1U) * ((uint8192_t(1U) << 4096U) - 1U)) == (uint8192_t(1U) - (uint8192_t(1U) << 4097U)), "Error: constexpr Karatsuba multiplication is not OK");
+  #else
+  const std::array<uint256_t, 60U> powers_of_ten = make_powers_of_ten();
+  #endif
+
+  bool run_wide_integer_constexpr()
+  {
+    // Compare the table, which is computed by the compiler from
+    // C++17 on, with the powers of ten read from strings at runtime.
+    char str[64U];
+
+    bool result_is_ok = true;
+
+    for(std::size_t k = 0U; k < powers_of_ten.size(); ++k)
+    {
+      str[0U] = char('1');
+
+      std::fill(str + 1U, str + (k + 1U), char('0'));
+
+      str[k + 1U] = char('\0');
+
+      result_is_ok &= (uint256_t(str) == powers_of_ten[k]);
+    }
+
+    return result_is_ok;
+  }
+}
+
+bool app::benchmark::run_wide_integer_arithmetic()
+{
+  static std::uint_fast8_t select_test_case;
+
+  bool result_is_ok;
+
+  if(select_test_case == 0U)
+  {
+    result_is_ok = run_wide_integer_decimal_io();
+  }
+  else if(select_test_case == 1U)
+  {
+    result_is_ok = run_wide_integer_limb_kernels();
+  }
+  else if(select_test_case == 2U)
+  {
+    result_is_ok = run_wide_integer_ntt();
+  }
+  else if(select_test_case == 3U)
+  {
+    result_is_ok = run_wide_integer_batch();
+  }
+  else if(select_test_case == 4U)
+  {
+    result_is_ok = run_wide_integer_constexpr();
+  }
+  else
+  {
+    result_is_ok = false;
+  }
+
+  ++select_test_case;
+
+  if(select_test_case >= 5U)
+  {
+    select_test_case = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_STANDALONE_TIMING)
+
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  volatile std::uint32_t timing_sink;
+
+  template<typename FunctionType>
+  double timing_microseconds_per_call(FunctionType f)
+  {
+    // Repeat the call for at least 0.2s and return the mean time.
+    // The calls are made in batches, which grow as long as a batch
+    // is short, so that reading the clock does not affect the result.
+    using clock_type = std::chrono::steady_clock;
+
+    std::uint_fast32_t n     = 0U;
+    std::uint_fast32_t batch = 1U;
+
+    const clock_type::time_point start = clock_type::now();
+
+    clock_type::time_point stop;
+
+    do
+    {
+      for(std::uint_fast32_t i = 0U; i < batch; ++i)
+      {
+        timing_sink = f();
+      }
+
+      n += batch;
+
+      stop = clock_type::now();
+
+      if((stop - start) < std::chrono::milliseconds(10))
+      {
+        batch *= 2U;
+      }
+    }
+    while((stop - start) < std::chrono::milliseconds(200));
+
+    return std::chrono::duration<double, std::micro>(stop - start).count() / double(n);
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  void timing_decimal_io()
+  {
+    using local_wide_integer_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+
+    // A value which uses all of the limbs.
+    const local_wide_integer_type t = (std::numeric_limits<local_wide_integer_type>::max)() / 3U;
+
+    static char str    [local_wide_integer_type::wr_string_max_buffer_size_dec];
+    static char str_out[local_wide_integer_type::wr_string_max_buffer_size_dec];
+
+    static local_wide_integer_type u;
+
+    static_cast<void>(t.wr_string(str, 10U, false));
+
+    // The arguments and the results are accessed through volatile
+    // pointers, so that the calls are neither hoisted out of the
+    // timing loop nor reduced to the parts of the results used.
+    const local_wide_integer_type* volatile p_t   = &t;
+    const char*                    volatile p_str = str;
+          char*                    volatile p_out = str_out;
+          local_wide_integer_type* volatile p_u   = &u;
+
+    const double t_wr     = timing_microseconds_per_call([&p_t, &p_out]() { static_cast<void>(p_t->wr_string(p_out, 10U, false)); return std::uint32_t(p_out[0U]); });
+    const double t_wr_ref = timing_microseconds_per_call([&p_t, &p_out]() { return std::uint32_t(*wr_string_dec_by_digits(*p_t, p_out + (sizeof(str_out) - 1U))); });
+    const double t_rd     = timing_microseconds_per_call([&p_str, &p_u]() { *p_u = local_wide_integer_type(p_str); return static_cast<std::uint32_t>(*p_u); });
+    const double t_rd_ref = timing_microseconds_per_call([&p_str, &p_u]() { *p_u = rd_string_dec_by_digits<local_wide_integer_type>(p_str); return static_cast<std::uint32_t>(*p_u); });
+
+    // The time divided by the square of the limb count stays
+    // roughly constant for quadratic algorithms.
+    const double n2 = double(local_wide_integer_type::number_of_limbs) * double(local_wide_integer_type::number_of_limbs);
+
+    std::printf("%6u bits: output %10.2f us (digit-by-digit %10.2f us, ratio %6.1f, %6.2f ns/limb^2), input %10.2f us (digit-by-digit %10.2f us, ratio %6.1f, %6.2f ns/limb^2)\n",
+                unsigned(Digits2),
+                t_wr, t_wr_ref, t_wr_ref / t_wr, (t_wr * 1000.0) / n2,
+                t_rd, t_rd_ref, t_rd_ref / t_rd, (t_rd * 1000.0) / n2);
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  void timing_add_and_multiply()
+  {
+    // Compare builds with and without WIDE_INTEGER_DISABLE_X86_64_LIMB_KERNELS
+    // to measure the x86-64 limb kernels.
+    using local_wide_integer_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+
+    static char str_a[local_wide_integer_type::wr_string_max_buffer_size_hex];
+    static char str_b[local_wide_integer_type::wr_string_max_buffer_size_hex];
+
+    std::uint64_t seed = UINT64_C(29);
+
+    make_hex_string(str_a, Digits2, seed);
+    make_hex_string(str_b, Digits2, seed);
+
+    const local_wide_integer_type a(str_a);
+    const local_wide_integer_type b(str_b);
+
+    static local_wide_integer_type c;
+
+    const local_wide_integer_type* volatile p_a = &a;
+    const local_wide_integer_type* volatile p_b = &b;
+          local_wide_integer_type* volatile p_c = &c;
+
+    const double t_add = timing_microseconds_per_call([&p_a, &p_b, &p_c]() { *p_c = *p_a + *p_b; return static_cast<std::uint32_t>(*p_c); });
+    const double t_mul = timing_microseconds_per_call([&p_a, &p_b, &p_c]() { *p_c = *p_a * *p_b; return static_cast<std::uint32_t>(*p_c); });
+
+    std::printf("%6u bits: a + b %10.4f us, a * b %10.4f us (x86-64 limb kernels: %s)\n",
+                unsigned(Digits2),
+                t_add,
+                t_mul,
+                (wide_integer::generic_template::detail::x86_64_limb_kernels_are_enabled<std::uint32_t>::value ? "on" : "off"));
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  void timing_multiply()
+  {
+    // Compare builds with WIDE_INTEGER_NTT_DIGITS2_THRESHOLD set low
+    // and high to measure the crossover point of the number-theoretic
+    // transform and the Karatsuba multiplication.
+    using local_wide_integer_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+
+    static char str_a[local_wide_integer_type::wr_string_max_buffer_size_hex];
+    static char str_b[local_wide_integer_type::wr_string_max_buffer_size_hex];
+
+    std::uint64_t seed = UINT64_C(30);
+
+    make_hex_string(str_a, Digits2, seed);
+    make_hex_string(str_b, Digits2, seed);
+
+    static local_wide_integer_type a;
+    static local_wide_integer_type b;
+    static local_wide_integer_type c;
+
+    a = local_wide_integer_type(str_a);
+    b = local_wide_integer_type(str_b);
+
+    const local_wide_integer_type* volatile p_a = &a;
+    const local_wide_integer_type* volatile p_b = &b;
+          local_wide_integer_type* volatile p_c = &c;
+
+    const double t_mul = timing_microseconds_per_call([&p_a, &p_b, &p_c]() { *p_c = *p_a * *p_b; return static_cast<std::uint32_t>(*p_c); });
+
+    const bool ntt_is_used =
+      (   ((Digits2 / 32U) >= local_wide_integer_type::number_of_limbs_karatsuba_threshold)
+       && wide_integer::generic_template::detail::ntt_multiplication_is_enabled(Digits2, WIDE_INTEGER_NTT_DIGITS2_THRESHOLD));
+
+    std::printf("%7u bits: a * b %12.2f us (%s)\n",
+                unsigned(Digits2),
+                t_mul,
+                (ntt_is_used ? "number-theoretic transform" : "Karatsuba"));
+  }
+
+  template<const std::uint_fast32_t BatchSize>
+  void timing_batch()
+  {
+    // Add and shift 4096 values of 256 bits, which are kept in cache,
+    // with the scalar uintwide_t and with the batch type.
+    using local_batch_type = wide_integer::generic_template::uintwide_t_batch<256U, std::uint32_t, BatchSize>;
+    using local_value_type = typename local_batch_type::value_type;
+
+    constexpr std::uint_fast32_t value_count = 4096U;
+    constexpr std::uint_fast32_t batch_count = value_count / BatchSize;
+
+    static std::array<local_value_type, value_count> a;
+    static std::array<local_value_type, value_count> b;
+    static std::array<local_value_type, value_count> c;
+
+    static std::array<local_batch_type, batch_count> ua;
+    static std::array<local_batch_type, batch_count> ub;
+    static std::array<local_batch_type, batch_count> uc;
+
+    char str[local_value_type::wr_string_max_buffer_size_hex];
+
+    std::uint64_t seed = UINT64_C(31);
+
+    for(std::uint_fast32_t i = 0U; i < value_count; ++i)
+    {
+      make_hex_string(str, 256U, seed);
+
+      a[i] = local_value_type(str);
+
+      make_hex_string(str, 256U, seed);
+
+      b[i] = local_value_type(str);
+    }
+
+    for(std::uint_fast32_t j = 0U; j < batch_count; ++j)
+    {
+      ua[j].load(a.cbegin() + (j * BatchSize));
+      ub[j].load(b.cbegin() + (j * BatchSize));
+    }
+
+    const std::array<local_value_type, value_count>* volatile p_a = &a;
+    const std::array<local_value_type, value_count>* volatile p_b = &b;
+          std::array<local_value_type, value_count>* volatile p_c = &c;
+
+    const std::array<local_batch_type, batch_count>* volatile p_ua = &ua;
+    const std::array<local_batch_type, batch_count>* volatile p_ub = &ub;
+          std::array<local_batch_type, batch_count>* volatile p_uc = &uc;
+
+    const double t_add = timing_microseconds_per_call([&p_a, &p_b, &p_c]()
+                                                      {
+                                                        for(std::uint_fast32_t i = 0U; i < value_count; ++i) { (*p_c)[i] = (*p_a)[i] + (*p_b)[i]; }
+                                                        return static_cast<std::uint32_t>((*p_c)[0U]);
+                                                      });
+
+    const double t_add_batch = timing_microseconds_per_call([&p_ua, &p_ub, &p_uc]()
+                                                            {
+                                                              for(std::uint_fast32_t j = 0U; j < batch_count; ++j) { (*p_uc)[j] = (*p_ua)[j] + (*p_ub)[j]; }
+                                                              return static_cast<std::uint32_t>((*p_uc)[0U].get(0U));
+                                                            });
+
+    const double t_shl = timing_microseconds_per_call([&p_a, &p_c]()
+                                                      {
+                                                        for(std::uint_fast32_t i = 0U; i < value_count; ++i) { (*p_c)[i] = ((*p_a)[i] << 37U); }
+                                                        return static_cast<std::uint32_t>((*p_c)[0U]);
+                                                      });
+
+    const double t_shl_batch = timing_microseconds_per_call([&p_ua, &p_uc]()
+                                                            {
+                                                              for(std::uint_fast32_t j = 0U; j < batch_count; ++j) { (*p_uc)[j] = (*p_ua)[j]; (*p_uc)[j] <<= 37U; }
+                                                              return static_cast<std::uint32_t>((*p_uc)[0U].get(0U));
+                                                            });
+
+    std::printf("batch size %3u: add %8.2f us (scalar %8.2f us, ratio %5.2f), shift %8.2f us (scalar %8.2f us, ratio %5.2f)\n",
+                unsigned(BatchSize),
+                t_add_batch, t_add, t_add / t_add_batch,
+                t_shl_batch, t_shl, t_shl / t_shl_batch);
+  }
+}
+#endif // APP_BENCHMARK_STANDALONE_TIMING
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_integer_arithmetic.cpp -o ./ref_app/bin/app_benchmark_wide_integer_arithmetic.exe
+
+  // Add -DAPP_BENCHMARK_STANDALONE_TIMING to print the timings
+  // of the decimal conversion compared with the digit-by-digit one,
+  // and of addition and multiplication. The multiplication timings
+  // of wide types depend on WIDE_INTEGER_NTT_DIGITS2_THRESHOLD.
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 10U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_wide_integer_arithmetic();
+  }
+
+  #if defined(APP_BENCHMARK_STANDALONE_TIMING)
+  timing_decimal_io<  256U>();
+  timing_decimal_io< 1024U>();
+  timing_decimal_io< 4096U>();
+  timing_decimal_io<16384U>();
+  timing_decimal_io<65536U>();
+
+  timing_add_and_multiply< 256U>();
+  timing_add_and_multiply<1024U>();
+  timing_add_and_multiply<4096U>();
+
+  timing_multiply<UINT32_C(  16384)>();
+  timing_multiply<UINT32_C(  32768)>();
+  timing_multiply<UINT32_C(  65536)>();
+  timing_multiply<UINT32_C( 131072)>();
+  timing_multiply<UINT32_C( 262144)>();
+  timing_multiply<UINT32_C( 524288)>();
+  timing_multiply<UINT32_C(1048576)>();
+
+  timing_batch< 8U>();
+  timing_batch<16U>();
+  timing_batch<64U>();
+  #endif
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC
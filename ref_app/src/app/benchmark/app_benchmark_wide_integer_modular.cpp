@@ -0,0 +1,564 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if(APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR)
+
+#define WIDE_INTEGER_DISABLE_IOSTREAM
+#define WIDE_INTEGER_ENABLE_THREADS
+
+#include <math/wide_integer/generic_template_uintwide_t.h>
+#include <math/wide_integer/generic_template_uintwide_t_prime_stream.h>
+
+namespace
+{
+  using uint256_t  = wide_integer::generic_template::uintwide_t< 256U, std::uint32_t>;
+  using uint1024_t = wide_integer::generic_template::uintwide_t<1024U, std::uint32_t>;
+
+  // Note: Some of the comments in this file use the Wolfram Language(TM).
+  // The control values have been computed independently.
+
+  bool run_wide_integer_montgomery()
+  {
+    // An odd 256-bit modulus m, a base a < m and a 256-bit exponent p.
+    //   r = PowerMod[a, p, m]
+    const uint256_t m("0x8B4486C599CB381B6EB58EEA34854702A8D4293433E798A0E81F9B0CBF4E7AF7");
+    const uint256_t a("0x2FA7F9B070E402790B77C0498F2B2BDF4AABBE8592D5DFE0389CA4CA4F392A5C");
+    const uint256_t p("0x3E113028F427D2BB6DFA23E7A2AC704C2BEF1F6B80B367149F97C413AEF2F88A");
+    const uint256_t r("0x8020E110D5BCA3B44C88EB80BF4E942430767BBB7ED6C8166451C2D1FE18DDB6");
+
+    // Mod[a * r, m] and Mod[a^2, m].
+    const uint256_t ar("0x103775BAF39002ADFCE58CA133A96600A77EB8A011428EBC56E10601A902D5C5");
+    const uint256_t aa("0x12F0BCA57B95753C9349C46DBD38F010BAB3D04C9D66416039BC58C9D6723009");
+
+    const wide_integer::generic_template::montgomery_context<256U, std::uint32_t> mont_ctx(m);
+
+    const uint256_t a_m = mont_ctx.to_montgomery(a);
+
+    // The powm() function uses the Montgomery context for odd moduli.
+    const bool result_powm_is_ok = (powm(a, p, m) == r);
+
+    const bool result_ctx_is_ok =
+      (   (mont_ctx.powm(a, p) == r)
+       && (mont_ctx.from_montgomery(mont_ctx.powm_montgomery(a_m, p)) == r)
+       && (mont_ctx.from_montgomery(mont_ctx.multiply(a_m, mont_ctx.to_montgomery(r))) == ar)
+       && (mont_ctx.from_montgomery(mont_ctx.square(a_m)) == aa)
+       && (mont_ctx.from_montgomery(mont_ctx.one()) == 1U));
+
+    // An even modulus takes the path with long division.
+    //   PowerMod[a, p, m - 1]
+    const uint256_t r_even("0x4E8E106409D49994484AF9308DBEE17EE38B118E933B0A8FA846CDB54543797C");
+
+    const bool result_even_is_ok = (powm(a, p, m - 1U) == r_even);
+
+    // An RSA round trip with a 1024-bit modulus n = p * q,
+    // where p and q are 512-bit primes, and e = 65537.
+    //   c = PowerMod[x, e, n] and x = PowerMod[c, d, n]
+    const uint1024_t n("0x553B6CDD3FD4541EF1421E8D50BF72C9DEA4AFCD0BE0ACA8E6507F6056EA0C4FEE7FCA8E5D6B18879A0CBA254E95CA30F6565894541E957C0967BDCD2083A44DCCE0D219DB43D362E091CBE1788B4A47309D0474FB8FA231126CD7CCC0D0271666CBC686B810335AAB84A959D452FFE1D77629EAACE66C327F92FE695936D28D");
+    const uint1024_t d("0x3E0C3ADE7EBF3656285078296C65534D7E95E99D9E4DFBA421B6EC63D8221EC079E1F235DDF03F3548828768ED62C2850E7021A029F4F1E2107EC37FF7719E4465832A9328C0692AE674191C7D7E584B26A58191496704ACA50E2D6C2623BD6CFBC035E397B8EC2F42C6EC8565ECBB4C726FD314726D895F71908218DF19FF41");
+    const uint1024_t x("0xF1C488DF842CAE21D98F44B2A459B390FB0610ADDEFA9D7E96EF45A21C1A1D85B034EB8334A346E2DBC1293F780B2289854CEF68745923606E09052D30CEB29BEA477F93C6E9D5DA0E525CFEFE2C39F721CAAAAE8AE6555E4753AD0874B899060E371E3E2B4B2D897B6421016D9C5F7646D88980B33027BB392E3A5EAD");
+    const uint1024_t c("0x1F0FC15E06F93CE2DE22E5927B014786A614CBA4C1230A0AD6D2CADCF364E64F824645EFA2DA78C1E7284F08559D51A5766E14D401D73FFAA2566EDED82322A2B22D9900A8AB731944D71D214888EC448EBBA8348F842FC7AA2826826C30F6B90D690FE3D29F25E1DBEAAC3839A315299EE1D783397EAE5294EA85DB5465DD3E");
+
+    const bool result_rsa_is_ok = ((powm(x, 65537U, n) == c) && (powm(c, d, n) == x));
+
+    return (result_powm_is_ok && result_ctx_is_ok && result_even_is_ok && result_rsa_is_ok);
+  }
+
+  bool run_wide_integer_barrett()
+  {
+    // A 256-bit value x reduced by moduli of 250, 128 and 33 bits.
+    //   Mod[x, m1], Mod[x, m2] and Mod[x, m3]
+    const uint256_t x ("0x92EE52D2324779614935B675F501084146F7C9EAB38CF45A7AD98A70A603E9E1");
+    const uint256_t m1("0x3562BE55F53F30140BEE3855543DB2B8A20D9BFD30288E74120AC1510BC09C5");
+    const uint256_t m2("0xBF725D532EEF070E672490E5D09B0BF1");
+    const uint256_t m3("0x1E8E0E237");
+
+    const uint256_t r1("0x1EC765CFD9B52A28669B8B4D575CC589525CF26F1D6C9B493BF6D1C5B23C05");
+    const uint256_t r2("0x530652A29F103F7E2EE8F6DB5C69A816");
+    const uint256_t r3("0xDF98D78B");
+
+    const wide_integer::generic_template::barrett_reducer<256U, std::uint32_t> barrett1(m1);
+    const wide_integer::generic_template::barrett_reducer<256U, std::uint32_t> barrett2(m2);
+    const wide_integer::generic_template::barrett_reducer<256U, std::uint32_t> barrett3(m3);
+
+    const bool result_reduce_is_ok =
+      (   (barrett1.reduce(x) == r1)
+       && (barrett2.reduce(x) == r2)
+       && (barrett3.reduce(x) == r3)
+       && (barrett1.reduce(r1) == r1)
+       && (barrett1.reduce(m1) == 0U));
+
+    // Reduce the product of two residues modulo m2, as in modular
+    // multiplication. The product of a and b has 256 bits.
+    //   Mod[a * b, m2]
+    const uint256_t a  ("0xBAD02341124327D2D24375777DBD48A3");
+    const uint256_t b  ("0xA77BF53192B007DAA3377235EAF5C04F");
+    const uint256_t ab ("0x8BFD59C984EB2302B6F35FA4B18F6EBF");
+
+    const std::array<uint256_t, 3U> values = {{ x, a * b, m2 - 1U }};
+
+    std::array<uint256_t, 3U> results;
+
+    static_cast<void>(barrett2.reduce(values.cbegin(), values.cend(), results.begin()));
+
+    const bool result_range_is_ok = ((results[0U] == r2) && (results[1U] == ab) && (results[2U] == (m2 - 1U)));
+
+    // Reduction modulo one is zero, in agreement with operator%.
+    const wide_integer::generic_template::barrett_reducer<256U, std::uint32_t> barrett_one(uint256_t(1U));
+
+    const bool result_trivial_is_ok = (barrett_one.reduce(x) == 0U);
+
+    return (result_reduce_is_ok && result_range_is_ok && result_trivial_is_ok);
+  }
+
+  // The binary gcd of Stein, which uintwide_t used before Lehmer's
+  // algorithm. It is the reference for the values and the timing.
+  template<typename WideIntegerType>
+  WideIntegerType gcd_binary(WideIntegerType u, WideIntegerType v)
+  {
+    using local_ularge_type = typename WideIntegerType::double_limb_type;
+
+    if(u == 0U) { return v; }
+    if(v == 0U) { return u; }
+
+    const std::uint_fast32_t u_shift = lsb(u);
+    const std::uint_fast32_t v_shift = lsb(v);
+
+    const std::uint_fast32_t left_shift_amount = (std::min)(u_shift, v_shift);
+
+    u >>= u_shift;
+    v >>= v_shift;
+
+    for(;;)
+    {
+      // Now u and v are both odd, so diff(u, v) is even.
+      if(u > v)
+      {
+        std::swap(u, v);
+      }
+
+      if(u == v)
+      {
+        break;
+      }
+
+      if(v <= (std::numeric_limits<local_ularge_type>::max)())
+      {
+        const local_ularge_type v_large = wide_integer::generic_template::detail::make_large(v.crepresentation()[0U], v.crepresentation()[1U]);
+        const local_ularge_type u_large = wide_integer::generic_template::detail::make_large(u.crepresentation()[0U], u.crepresentation()[1U]);
+
+        u = WideIntegerType(wide_integer::generic_template::detail::integer_gcd_reduce_large(v_large, u_large));
+
+        break;
+      }
+
+      v  -= u;
+      v >>= lsb(v);
+    }
+
+    return (u << left_shift_amount);
+  }
+
+  // A pseudo-random value having at most bit_count bits. The linear
+  // congruential generator of Knuth's MMIX is used with the given seed.
+  template<typename WideIntegerType>
+  WideIntegerType make_random(const std::uint_fast32_t bit_count, std::uint64_t& seed)
+  {
+    WideIntegerType x;
+
+    for(auto& limb : x.representation())
+    {
+      seed = (seed * UINT64_C(6364136223846793005)) + UINT64_C(1442695040888963407);
+
+      limb = typename WideIntegerType::limb_type(seed >> 32U);
+    }
+
+    return (x >> (std::numeric_limits<WideIntegerType>::digits - int(bit_count)));
+  }
+
+  template<typename WideIntegerType>
+  bool run_wide_integer_gcd(std::uint64_t& seed)
+  {
+    // Compare gcd with the binary gcd, and check modinv with the
+    // product in the double-width type, for values of random sizes.
+    using local_double_width_type = wide_integer::generic_template::uintwide_t<std::uint_fast32_t(std::numeric_limits<WideIntegerType>::digits * 2), typename WideIntegerType::limb_type>;
+
+    constexpr std::uint_fast32_t digits2 = std::uint_fast32_t(std::numeric_limits<WideIntegerType>::digits);
+
+    bool result_is_ok = true;
+
+    for(std::uint_fast8_t i = 0U; i < 8U; ++i)
+    {
+      // Every other pair has a common factor g of up to 40 bits.
+      const WideIntegerType g = (((i % 2U) == 0U) ? WideIntegerType(1U) : (make_random<WideIntegerType>(40U, seed) | 1U));
+      const WideIntegerType x = make_random<WideIntegerType>(digits2 - 40U - std::uint_fast32_t(seed % (digits2 / 2U)), seed) * g;
+      const WideIntegerType m = make_random<WideIntegerType>(digits2 - 40U, seed) * g;
+
+      const WideIntegerType x_inv = modinv(x, m);
+
+      const WideIntegerType r = WideIntegerType((local_double_width_type(x) * local_double_width_type(x_inv)) % local_double_width_type(m));
+
+      const WideIntegerType gcd_x_m = gcd(x, m);
+
+      result_is_ok &=
+        (   (gcd_x_m == gcd_binary(x, m))
+         && (gcd(m, x) == gcd_x_m)
+         && (((gcd_x_m == 1U) && (r == 1U)) || ((gcd_x_m != 1U) && (x_inv == 0U))));
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_wide_integer_gcd()
+  {
+    // The values g * a and g * b have 255 and 248 bits,
+    // and a and b are coprime.
+    //   GCD[g * a, g * b] = g
+    const uint256_t g ("0xA1661DF6F09F5F22D15A0CF93");
+    const uint256_t ga("0x7A587B96F06866344E987A51D5A4D2FDA503CD5C2AE316ED336995718E848CA3");
+    const uint256_t gb("0xA2DC6AA385263C750BCC75836281555154080B8BC2AF3FDA4B4450B0BE7DF7");
+
+    // The Fibonacci numbers F(370) and F(369) need the largest number
+    // of Euclidean steps below 2^256. Since F(369)^2 = F(370) F(368) + 1,
+    // F(369) is its own inverse modulo F(370).
+    const uint256_t f370("0xD12BF5C7F45A49F54FDF4E79A339EB28E1CC739052CBFA4BCC70EB22D7C28187");
+    const uint256_t f369("0x814675988EB7041005EE9F4355A59A00629B7C0123408B65D25F59EC1A328E62");
+
+    const bool result_gcd_is_ok =
+      (   (gcd(ga, gb) == g)
+       && (gcd(gb, ga) == g)
+       && (gcd(ga, ga) == ga)
+       && (gcd(ga, uint256_t(0U)) == ga)
+       && (gcd(uint256_t(0U), gb) == gb)
+       && (gcd(f370, f369) == 1U));
+
+    // Modular inverses with 256-bit and 1024-bit moduli.
+    //   ModularInverse[a, m]
+    const uint256_t m256  ("0xABF5E4FA881DEAAEA40AEA08FDF124FAB48E9607218D01E5203FF15CA665667E");
+    const uint256_t a256  ("0x3CAF10CA826F8156C32851B9992DD10533607FEF5E2917959E4C78781E993D9B");
+    const uint256_t inv256("0x60B7431CF3252C27829E271ED85E7C258FC95703F32FE87AA45CCC31780DFA17");
+
+    const uint1024_t m1024  ("0xE918DC44AE4498BE50C29B8370A0241375C0C551D89184C778F5920E44E4FD60F1C057ED4E44BF8CC938C3E05B961D232EE6E9D2A019C7C559672D55CF18E0A81984925149CD71B0664A1937C65A1979411F4FA1D79E6FC20F8D9AB0413F533788783D8291589A5B969864F1A6269CE5D8245FC68FD7D8A6CD48F25DBEF6344B");
+    const uint1024_t a1024  ("0x39C9C44AA4AEBFE1EB4F3E61BABAC33681322BC1DC93685C7B4B51F5C7906A93B990FAAEBBAD95C91BA3B88765BD6E52C6C054D6689F9040B99B436AE266AA6E56FE4710416C4963E4EFB83CF01190BC4364D60792E75CADDC912FE1A7E3069B9C7B62C0CC01FC54CD3C588103423F223F7D39006B56D75BFE274818359CDB7F");
+    const uint1024_t inv1024("0xA3BF4F58F4D044C57C63822C0B9D277C4D22B775839E09503D0C68D5E581E61C80793BC3499567DB415FD97131DC54AE9C5E9CDF533676DF8B2DB16407C7F05F44E5311ACD448A243BCFAE107E676D01F18FAF119406FCAF94AE24721BB4D8672EA470C14921BFFA1026C3E87D3E9509A9E9674A4A5C218331CB9E3D36A1C798");
+
+    // There is no inverse if gcd(a, m) != 1, and none for m <= 1.
+    const bool result_modinv_is_ok =
+      (   (modinv(a256, m256) == inv256)
+       && (modinv(a256 + m256, m256) == inv256)
+       && (modinv(f369, f370) == f369)
+       && (modinv(a1024, m1024) == inv1024)
+       && (modinv(ga, gb) == 0U)
+       && (modinv(a256, uint256_t(1U)) == 0U)
+       && (modinv(a256, uint256_t(0U)) == 0U));
+
+    std::uint64_t seed = UINT64_C(32);
+
+    const bool result_random_is_ok =
+      (   run_wide_integer_gcd<uint256_t>(seed)
+       && run_wide_integer_gcd<uint1024_t>(seed));
+
+    return (result_gcd_is_ok && result_modinv_is_ok && result_random_is_ok);
+  }
+
+  template<typename PrimeStreamType>
+  bool prime_stream_is_ok(PrimeStreamType& stream, const std::array<typename PrimeStreamType::wide_integer_type, 3U>& primes)
+  {
+    typename PrimeStreamType::wide_integer_type p;
+
+    bool result_is_ok = true;
+
+    for(const auto& q : primes)
+    {
+      result_is_ok &= (stream.next(p) && (p == q));
+    }
+
+    return result_is_ok;
+  }
+
+  bool run_wide_integer_prime_stream()
+  {
+    using prime_stream_256_type  = wide_integer::generic_template::prime_candidate_stream< 256U, std::uint32_t>;
+    using prime_stream_1024_type = wide_integer::generic_template::prime_candidate_stream<1024U, std::uint32_t>;
+
+    // There are 1229 primes below 10^4, the largest being 9973.
+    // They span two sieve windows.
+    prime_stream_256_type stream_small(uint256_t(0U));
+
+    uint256_t p;
+
+    std::uint_fast32_t prime_count = 0U;
+
+    uint256_t p_last(0U);
+
+    while(stream_small.next(p) && (p < 10000U))
+    {
+      ++prime_count;
+
+      p_last = p;
+    }
+
+    const bool result_small_is_ok = ((prime_count == 1229U) && (p_last == 9973U) && (p == 10007U));
+
+    // The first three primes above 2^255 + 12345678901234567,
+    // where 12345678901234567 = 0x2BDC545D6B4B87.
+    //   NextPrime[2^255 + 12345678901234567, {1, 2, 3}]
+    const uint256_t start_256("0x800000000000000000000000000000000000000000000000002BDC545D6B4B87");
+
+    const std::array<uint256_t, 3U> primes_256 =
+    {{
+      uint256_t("0x800000000000000000000000000000000000000000000000002BDC545D6B4C01"),
+      uint256_t("0x800000000000000000000000000000000000000000000000002BDC545D6B4C3F"),
+      uint256_t("0x800000000000000000000000000000000000000000000000002BDC545D6B4D45")
+    }};
+
+    prime_stream_256_type stream_256(start_256);
+
+    const bool result_256_is_ok = prime_stream_is_ok(stream_256, primes_256);
+
+    // The first three primes above 2^1023 + 12345678901313024, found
+    // with one thread and with two threads. These primes lie closely
+    // together, which avoids the many Miller-Rabin tests of a typical
+    // prime gap at 1024 bits. Note 12345678901313024 = 0x2BDC545D6C7E00.
+    //   NextPrime[2^1023 + 12345678901313024, {1, 2, 3}]
+    const uint1024_t start_1024 = (uint1024_t(1U) << 1023U) + uint1024_t("0x2BDC545D6C7E00");
+
+    const std::array<uint1024_t, 3U> primes_1024 =
+    {{
+      start_1024 + 0x33U,
+      start_1024 + 0x39U,
+      start_1024 + 0xA9U
+    }};
+
+    prime_stream_1024_type stream_1024_1(start_1024, 0U, 1U);
+    prime_stream_1024_type stream_1024_2(start_1024, 0U, 2U);
+
+    const bool result_1024_is_ok =
+      (   prime_stream_is_ok(stream_1024_1, primes_1024)
+       && prime_stream_is_ok(stream_1024_2, primes_1024));
+
+    return (result_small_is_ok && result_256_is_ok && result_1024_is_ok);
+  }
+}
+
+bool app::benchmark::run_wide_integer_modular()
+{
+  static std::uint_fast8_t select_test_case;
+
+  bool result_is_ok;
+
+  if(select_test_case == 0U)
+  {
+    result_is_ok = run_wide_integer_montgomery();
+  }
+  else if(select_test_case == 1U)
+  {
+    result_is_ok = run_wide_integer_barrett();
+  }
+  else if(select_test_case == 2U)
+  {
+    result_is_ok = run_wide_integer_gcd();
+  }
+  else if(select_test_case == 3U)
+  {
+    result_is_ok = run_wide_integer_prime_stream();
+  }
+  else
+  {
+    result_is_ok = false;
+  }
+
+  ++select_test_case;
+
+  if(select_test_case >= 4U)
+  {
+    select_test_case = 0U;
+  }
+
+  return result_is_ok;
+}
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_STANDALONE_TIMING)
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+  volatile std::uint32_t timing_sink;
+
+  template<typename FunctionType>
+  double timing_microseconds_per_call(FunctionType f)
+  {
+    // Repeat the call for at least 0.2s and return the mean time.
+    // The calls are made in batches, which grow as long as a batch
+    // is short, so that reading the clock does not affect the result.
+    using clock_type = std::chrono::steady_clock;
+
+    std::uint_fast32_t n     = 0U;
+    std::uint_fast32_t batch = 1U;
+
+    const clock_type::time_point start = clock_type::now();
+
+    clock_type::time_point stop;
+
+    do
+    {
+      for(std::uint_fast32_t i = 0U; i < batch; ++i)
+      {
+        timing_sink = f();
+      }
+
+      n += batch;
+
+      stop = clock_type::now();
+
+      if((stop - start) < std::chrono::milliseconds(10))
+      {
+        batch *= 2U;
+      }
+    }
+    while((stop - start) < std::chrono::milliseconds(200));
+
+    return std::chrono::duration<double, std::micro>(stop - start).count() / double(n);
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  void timing_gcd()
+  {
+    // Time gcd (Lehmer's algorithm) and the binary gcd, which it
+    // replaced, and modinv for two full-width pseudo-random values.
+    using local_wide_integer_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+
+    std::uint64_t seed = UINT64_C(32);
+
+    static local_wide_integer_type a;
+    static local_wide_integer_type m;
+    static local_wide_integer_type r;
+
+    a = make_random<local_wide_integer_type>(Digits2, seed);
+    m = make_random<local_wide_integer_type>(Digits2, seed) | 1U;
+
+    // The arguments and the results are accessed through volatile
+    // pointers, so that the calls are not hoisted out of the loop.
+    const local_wide_integer_type* volatile p_a = &a;
+    const local_wide_integer_type* volatile p_m = &m;
+          local_wide_integer_type* volatile p_r = &r;
+
+    const double t_gcd        = timing_microseconds_per_call([&p_a, &p_m, &p_r]() { *p_r = gcd       (*p_a, *p_m); return static_cast<std::uint32_t>(*p_r); });
+    const double t_gcd_binary = timing_microseconds_per_call([&p_a, &p_m, &p_r]() { *p_r = gcd_binary(*p_a, *p_m); return static_cast<std::uint32_t>(*p_r); });
+    const double t_modinv     = timing_microseconds_per_call([&p_a, &p_m, &p_r]() { *p_r = modinv    (*p_a, *p_m); return static_cast<std::uint32_t>(*p_r); });
+
+    std::printf("%5u bits: gcd %10.2f us (binary gcd %10.2f us, ratio %5.2f), modinv %10.2f us\n",
+                unsigned(Digits2),
+                t_gcd,
+                t_gcd_binary,
+                t_gcd_binary / t_gcd,
+                t_modinv);
+  }
+
+  template<const std::uint_fast32_t Digits2>
+  void timing_prime_stream(const std::uint_fast32_t number_of_threads)
+  {
+    // Find the next prime after a few pseudo-random starting values,
+    // with the prime stream and with a sequential search of the odd
+    // values with miller_rabin() and 25 trials.
+    using local_wide_integer_type = wide_integer::generic_template::uintwide_t<Digits2, std::uint32_t>;
+    using local_distribution_type = wide_integer::generic_template::uniform_int_distribution<Digits2, std::uint32_t>;
+
+    using clock_type = std::chrono::steady_clock;
+
+    std::uint64_t seed = UINT64_C(33);
+
+    local_distribution_type distribution;
+
+    std::mt19937 generator(33U);
+
+    clock_type::duration t_stream     (0);
+    clock_type::duration t_miller_rabin(0);
+
+    bool result_is_ok = true;
+
+    constexpr std::uint_fast32_t number_of_primes = 4U;
+
+    for(std::uint_fast32_t i = 0U; i < number_of_primes; ++i)
+    {
+      const local_wide_integer_type start = make_random<local_wide_integer_type>(Digits2, seed) | (local_wide_integer_type(1U) << (Digits2 - 1U));
+
+      const clock_type::time_point t0 = clock_type::now();
+
+      wide_integer::generic_template::prime_candidate_stream<Digits2, std::uint32_t> stream(start, 0U, number_of_threads);
+
+      local_wide_integer_type p;
+
+      result_is_ok &= stream.next(p);
+
+      const clock_type::time_point t1 = clock_type::now();
+
+      local_wide_integer_type n = start | 1U;
+
+      while(miller_rabin(n, 25U, distribution, generator) == false)
+      {
+        n += 2U;
+      }
+
+      const clock_type::time_point t2 = clock_type::now();
+
+      t_stream       += (t1 - t0);
+      t_miller_rabin += (t2 - t1);
+
+      result_is_ok &= (n == p);
+    }
+
+    const double ms_stream       = std::chrono::duration<double, std::milli>(t_stream).count()       / double(number_of_primes);
+    const double ms_miller_rabin = std::chrono::duration<double, std::milli>(t_miller_rabin).count() / double(number_of_primes);
+
+    std::printf("%5u bits: prime stream %10.2f ms per prime with %u thread(s) (miller_rabin %10.2f ms, ratio %5.2f), same primes: %s\n",
+                unsigned(Digits2),
+                ms_stream,
+                unsigned(number_of_threads),
+                ms_miller_rabin,
+                ms_miller_rabin / ms_stream,
+                (result_is_ok ? "yes" : "no"));
+  }
+}
+#endif // APP_BENCHMARK_STANDALONE_TIMING
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -pthread -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_integer_modular.cpp -o ./ref_app/bin/app_benchmark_wide_integer_modular.exe
+
+  // Add -DAPP_BENCHMARK_STANDALONE_TIMING to print the timings
+  // of gcd compared with the binary gcd, of modinv, and of the prime
+  // stream compared with a search using miller_rabin().
+
+  bool result_is_ok = true;
+
+  for(unsigned i = 0U; i < 16U; ++i)
+  {
+    result_is_ok &= app::benchmark::run_wide_integer_modular();
+  }
+
+  #if defined(APP_BENCHMARK_STANDALONE_TIMING)
+  timing_gcd< 256U>();
+  timing_gcd<1024U>();
+  timing_gcd<4096U>();
+
+  timing_prime_stream< 256U>(1U);
+  timing_prime_stream<1024U>(1U);
+  timing_prime_stream<1024U>(2U);
+  #endif
+
+  return result_is_ok ? 0 : -1;
+}
+#endif
+
+#endif // APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR
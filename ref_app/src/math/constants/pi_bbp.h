@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Extraction of hexadecimal digits of pi at an arbitrary position
+// using the Bailey-Borwein-Plouffe (BBP) formula
+//
+//   pi = sum_{k >= 0} 16^-k [   4 / (8k + 1) - 2 / (8k + 4)
+//                             - 1 / (8k + 5) - 1 / (8k + 6) ],
+//
+// as described in D.H. Bailey, P.B. Borwein and S. Plouffe,
+// "On the Rapid Computation of Various Polylogarithmic Constants",
+// Math. Comp. 66 (1997), 903-913.
+
+// The fractional part of 16^p * pi is accumulated in unsigned 0.64
+// fixed-point arithmetic, in which the wraparound of the unsigned
+// integer discards the integer part for free. The terms with k <= p
+// use 16^(p - k) mod (8k + j), found by binary modular exponentiation.
+// The remaining terms are added until they vanish. In contrast to the
+// spigot calculation, the memory needed is constant and no prior digits
+// are calculated. The time grows as O(p log p).
+
+#ifndef PI_BBP_2026_10_18_H_
+  #define PI_BBP_2026_10_18_H_
+
+  #include <cstdint>
+
+  #include <math/constants/pi_spigot_base.h>
+
+  namespace math { namespace constants {
+
+  class pi_bbp
+  {
+  public:
+    using output_value_type = std::uint8_t;
+
+    // The number of hexadecimal digits extracted from one evaluation
+    // of the formula. These are the upper 32 bits of the 0.64 fixed-point
+    // fraction. The lower 32 bits are guard bits, which absorb the
+    // truncation error of the (at most 8 * (p + 16)) terms.
+    static constexpr std::uint32_t block_digit = UINT32_C(8);
+
+    // The largest supported position. The divisors 8k + j and the
+    // exponent 4 * (p - k) must fit in 32 bits. Positions beyond
+    // this are rejected by calculate_block() and calculate().
+    static constexpr std::uint32_t max_position = UINT32_C(0x1FFFFFF0);
+
+    pi_bbp() : my_operation_count(0U) { }
+
+    pi_bbp(const pi_bbp&) = delete;
+
+    ~pi_bbp() = default;
+
+    pi_bbp& operator=(const pi_bbp&) = delete;
+
+    bool calculate_block(const std::uint32_t position, std::uint32_t& block)
+    {
+      // Calculate the block of block_digit hexadecimal digits of pi
+      // beginning at the zero-based position after the hexadecimal
+      // point. For instance, pi = 3.243F6A88 85A308D3..., so position 0
+      // gives 0x243F6A88 and position 8 gives 0x85A308D3.
+
+      // As with any such digit extraction, the last digit of a block
+      // is only uncertain in the unlikely case that the fraction lies
+      // within the truncation error of a digit boundary.
+
+      // Positions beyond max_position are rejected (the result is false
+      // and block is zero), since the 32-bit divisors would overflow.
+      if(position > max_position)
+      {
+        block = UINT32_C(0);
+
+        return false;
+      }
+
+      const std::uint64_t s1 = series_sum(position, UINT32_C(1));
+      const std::uint64_t s4 = series_sum(position, UINT32_C(4));
+      const std::uint64_t s5 = series_sum(position, UINT32_C(5));
+      const std::uint64_t s6 = series_sum(position, UINT32_C(6));
+
+      const std::uint64_t fraction =
+        std::uint64_t(std::uint64_t(std::uint64_t(s1 * 4U) - std::uint64_t(s4 * 2U)) - s5) - s6;
+
+      block = std::uint32_t(fraction >> 32U);
+
+      return true;
+    }
+
+    template<typename ItOut>
+    bool calculate(const std::uint32_t position,
+                   ItOut               output_first,
+                   const std::uint32_t count)
+    {
+      // Write count hexadecimal digits (each having a value 0...15)
+      // beginning at the zero-based position after the hexadecimal point.
+
+      // The request is rejected (the result is false and nothing
+      // is written) if any of its digits lies beyond max_position.
+
+      my_operation_count = UINTMAX_C(0);
+
+      if((count != UINT32_C(0)) && ((position > max_position) || (std::uint32_t(count - 1U) > std::uint32_t(max_position - position))))
+      {
+        return false;
+      }
+
+      for(std::uint32_t i = UINT32_C(0); i < count; i += block_digit)
+      {
+        std::uint32_t block;
+
+        static_cast<void>(calculate_block(std::uint32_t(position + i), block));
+
+        const std::uint32_t n = ((count - i) < block_digit) ? (count - i) : block_digit;
+
+        for(std::uint32_t m = UINT32_C(0); m < n; ++m)
+        {
+          output_first[i + m] =
+            output_value_type(std::uint32_t(block >> std::uint32_t(28U - (m * 4U))) & UINT32_C(0xF));
+        }
+      }
+
+      return true;
+    }
+
+    std::uintmax_t get_operation_count() const
+    {
+      return my_operation_count;
+    }
+
+  private:
+    std::uintmax_t my_operation_count;
+
+    static std::uint64_t fraction_of(const std::uint32_t r, const detail::pi_spigot_divider& divider)
+    {
+      // Compute floor((r * 2^64) / b) for r < b with two steps
+      // of long division by b, each of which uses the reciprocal.
+      std::uint64_t hi = std::uint64_t(r) << 32U;
+
+      const std::uint32_t r1 = divider.divide(hi);
+
+      std::uint64_t lo = std::uint64_t(r1) << 32U;
+
+      divider.divide(lo);
+
+      return std::uint64_t(hi << 32U) | lo;
+    }
+
+    std::uint32_t pow16_mod(const std::uint32_t e, const std::uint32_t b, const detail::pi_spigot_divider& divider)
+    {
+      // Compute 16^e mod b = 2^(4e) mod b with left-to-right binary
+      // exponentiation. The squaring reduces with the reciprocal
+      // of b, and the multiplication by 2 is a shift and a subtraction.
+      const std::uint32_t x = std::uint32_t(e * 4U);
+
+      std::uint64_t r = UINT64_C(1);
+
+      std::uint32_t bit = UINT32_C(0x80000000);
+
+      while((bit != UINT32_C(0)) && ((x & bit) == UINT32_C(0)))
+      {
+        bit >>= 1U;
+      }
+
+      for( ; bit != UINT32_C(0); bit >>= 1U)
+      {
+        std::uint64_t rr = std::uint64_t(r * r);
+
+        r = divider.divide(rr);
+
+        if((x & bit) != UINT32_C(0))
+        {
+          r <<= 1U;
+
+          if(r >= b)
+          {
+            r -= b;
+          }
+        }
+
+        ++my_operation_count;
+      }
+
+      // The reduction is needed for e = 0 in combination with b = 1.
+      std::uint64_t result = r;
+
+      return divider.divide(result);
+    }
+
+    std::uint64_t series_sum(const std::uint32_t p, const std::uint32_t j)
+    {
+      // Compute the fractional part of sum_{k >= 0} 16^(p - k) / (8k + j)
+      // in 0.64 fixed-point representation.
+      std::uint64_t s = UINT64_C(0);
+
+      for(std::uint32_t k = UINT32_C(0); k <= p; ++k)
+      {
+        const std::uint32_t b = std::uint32_t(std::uint32_t(k * 8U) + j);
+
+        const detail::pi_spigot_divider divider(b);
+
+        s += fraction_of(pow16_mod(std::uint32_t(p - k), b, divider), divider);
+      }
+
+      // The terms with k > p are 2^(64 - 4(k - p)) / (8k + j) in 0.64
+      // fixed-point, which vanish after 16 terms.
+      for(std::uint32_t t = UINT32_C(1); t < UINT32_C(16); ++t)
+      {
+        const std::uint32_t b = std::uint32_t(std::uint32_t(std::uint32_t(p + t) * 8U) + j);
+
+        s += std::uint64_t(UINT64_C(1) << std::uint32_t(64U - (t * 4U))) / b;
+      }
+
+      return s;
+    }
+  };
+
+  } } // namespace math::constants
+
+#endif // PI_BBP_2026_10_18_H_
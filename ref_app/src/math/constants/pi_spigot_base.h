@@ -27,6 +27,92 @@
     static constexpr std::uint32_t value = 1U;
   };
 
+  // Division of the 64-bit dividends of the spigot algorithm by the
+  // fixed 32-bit divisors b = (2 * i) + 1 using multiplication with
+  // a precomputed reciprocal, as described in T. Granlund and
+  // P.L. Montgomery, "Division by Invariant Integers using
+  // Multiplication", Fig. 4.1 (with N = 64). The quotient and the
+  // remainder are exact for all 64-bit dividends. The constructor
+  // is constexpr, so that a table of dividers can be placed
+  // in read-only program memory.
+  class pi_spigot_divider
+  {
+  public:
+    constexpr pi_spigot_divider() : my_m  (0U),
+                                    my_b  (1U),
+                                    my_sh1(0U),
+                                    my_sh2(0U) { }
+
+    explicit constexpr pi_spigot_divider(const std::uint32_t b)
+      : my_m  (make_m(b, ceil_log2(b))),
+        my_b  (b),
+        my_sh1(std::uint8_t((ceil_log2(b) < 1U) ? ceil_log2(b) : 1U)),
+        my_sh2(std::uint8_t(((ceil_log2(b) > 1U) ? ceil_log2(b) : 1U) - 1U)) { }
+
+    std::uint32_t divide(std::uint64_t& d) const
+    {
+      // Replace d with d / b and return the remainder d % b.
+      const std::uint64_t t1 = mul_hi(my_m, d);
+      const std::uint64_t q  = std::uint64_t(t1 + std::uint64_t(std::uint64_t(d - t1) >> my_sh1)) >> my_sh2;
+
+      const std::uint32_t r = std::uint32_t(d - std::uint64_t(q * my_b));
+
+      d = q;
+
+      return r;
+    }
+
+  private:
+    std::uint64_t my_m;
+    std::uint32_t my_b;
+    std::uint8_t  my_sh1;
+    std::uint8_t  my_sh2;
+
+    static constexpr std::uint32_t ceil_log2(const std::uint32_t b, const std::uint32_t l = 0U)
+    {
+      // Find l = ceil(log2(b)).
+      return ((std::uint64_t(UINT64_C(1) << l) < std::uint64_t(b)) ? ceil_log2(b, l + 1U) : l);
+    }
+
+    static constexpr std::uint64_t make_m(const std::uint32_t b, const std::uint32_t l)
+    {
+      // Compute m = floor((2^64 * (2^l - b)) / b) + 1 with two
+      // steps of long division, using r0 = (2^l - b) < b.
+      return make_m_from_r0(b, std::uint64_t(std::uint64_t(UINT64_C(1) << l) - b));
+    }
+
+    static constexpr std::uint64_t make_m_from_r0(const std::uint32_t b, const std::uint64_t r0)
+    {
+      return   std::uint64_t(std::uint64_t(std::uint64_t(r0 << 32U) / b) << 32U)
+             + std::uint64_t(std::uint64_t(std::uint64_t(std::uint64_t(r0 << 32U) % b) << 32U) / b)
+             + 1U;
+    }
+
+    static std::uint64_t mul_hi(const std::uint64_t u, const std::uint64_t v)
+    {
+      // Compute the upper 64 bits of the 128-bit product u * v.
+      #if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_type;
+
+      return std::uint64_t((uint128_type(u) * v) >> 64U);
+      #else
+      const std::uint64_t u_lo = std::uint32_t(u);
+      const std::uint64_t u_hi = std::uint32_t(u >> 32U);
+      const std::uint64_t v_lo = std::uint32_t(v);
+      const std::uint64_t v_hi = std::uint32_t(v >> 32U);
+
+      const std::uint64_t lo_lo = u_lo * v_lo;
+      const std::uint64_t hi_lo = u_hi * v_lo;
+      const std::uint64_t lo_hi = u_lo * v_hi;
+      const std::uint64_t hi_hi = u_hi * v_hi;
+
+      const std::uint64_t cross = std::uint64_t(std::uint32_t(hi_lo)) + std::uint32_t(lo_hi) + (lo_lo >> 32U);
+
+      return ((hi_hi + (hi_lo >> 32U)) + (lo_hi >> 32U)) + (cross >> 32U);
+      #endif
+    }
+  };
+
   } // namespace detail
 
   template<const std::uint32_t ResultDigit,
@@ -90,6 +176,7 @@
 
   public:
     using output_value_type = std::uint8_t;
+    using reciprocal_type   = detail::pi_spigot_divider;
 
     pi_spigot_base(const pi_spigot_base&) = delete;
 
@@ -107,6 +194,25 @@
       return input_scale(result_digit);
     }
 
+    static constexpr std::uint32_t get_recip__static_size()
+    {
+      return input_scale(result_digit);
+    }
+
+    template<typename ItRecip>
+    static void initialize_reciprocals(ItRecip recip_first)
+    {
+      // Fill the table of reciprocals of the divisors b = (2 * i) + 1.
+      // This is done once, after which the table can be used for any
+      // number of calculations. A table in read-only memory can,
+      // instead, be initialized with pi_spigot_divider((2 * i) + 1),
+      // whose constructor is constexpr.
+      for(std::uint32_t i = UINT32_C(0); i < get_recip__static_size(); ++i)
+      {
+        recip_first[i] = reciprocal_type(std::uint32_t(std::uint32_t(i * UINT32_C(2)) + UINT32_C(1)));
+      }
+    }
+
     std::uintmax_t get_operation_count() const
     {
       return my_operation_count;
@@ -0,0 +1,334 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// The pi spigot program, as multi-threaded calculation (for the host).
+
+// The sweep of each digit group runs downward over the input array,
+// whereby the running value d is carried from one element to the next.
+// The array is divided into contiguous chunks, one per thread. Each
+// thread sweeps its chunk for one digit group after the other, and it
+// passes the carry out of the bottom of its chunk to the thread below
+// it. So the threads work on successive digit groups at the same time,
+// in the manner of a pipeline. The bottom thread extracts the digits.
+// The result is identical to that of pi_spigot_single.
+
+// The range of the sweep shrinks from one digit group to the next.
+// For this reason, the calculation is divided into epochs, in which
+// the range shrinks by at most one eighth. At the start of each epoch,
+// the current range is divided into equal chunks.
+
+#ifndef PI_SPIGOT_PARALLEL_2026_10_18_H_
+  #define PI_SPIGOT_PARALLEL_2026_10_18_H_
+
+  #include <algorithm>
+  #include <array>
+  #include <atomic>
+  #include <thread>
+  #include <vector>
+
+  #include <math/constants/pi_spigot_base.h>
+
+  namespace math { namespace constants {
+
+  namespace detail
+  {
+
+  // The single-producer, single-consumer queue of the carries
+  // between two neighboring chunks. The producer can be at most
+  // carry_queue_size digit groups ahead of the consumer.
+  class pi_spigot_carry_queue
+  {
+  public:
+    pi_spigot_carry_queue() : my_ring    (),
+                              my_produced(0U),
+                              my_consumed(0U) { }
+
+    pi_spigot_carry_queue(const pi_spigot_carry_queue&) = delete;
+
+    pi_spigot_carry_queue& operator=(const pi_spigot_carry_queue&) = delete;
+
+    void push(const std::uint64_t d)
+    {
+      const std::uint32_t p = my_produced.load(std::memory_order_relaxed);
+
+      while(std::uint32_t(p - my_consumed.load(std::memory_order_acquire)) >= carry_queue_size)
+      {
+        std::this_thread::yield();
+      }
+
+      my_ring[p % carry_queue_size] = d;
+
+      my_produced.store(std::uint32_t(p + 1U), std::memory_order_release);
+    }
+
+    std::uint64_t pop()
+    {
+      const std::uint32_t c = my_consumed.load(std::memory_order_relaxed);
+
+      while(my_produced.load(std::memory_order_acquire) == c)
+      {
+        std::this_thread::yield();
+      }
+
+      const std::uint64_t d = my_ring[c % carry_queue_size];
+
+      my_consumed.store(std::uint32_t(c + 1U), std::memory_order_release);
+
+      return d;
+    }
+
+  private:
+    static constexpr std::uint32_t carry_queue_size = UINT32_C(64);
+
+    std::array<std::uint64_t, carry_queue_size> my_ring;
+    std::atomic<std::uint32_t>                  my_produced;
+    std::atomic<std::uint32_t>                  my_consumed;
+  };
+
+  } // namespace detail
+
+  template<const std::uint32_t ResultDigit,
+           const std::uint32_t LoopDigit>
+  class pi_spigot_parallel
+    : public pi_spigot_base<ResultDigit,
+                            LoopDigit>
+  {
+  private:
+    using base_class_type = pi_spigot_base<ResultDigit,
+                                           LoopDigit>;
+
+    // The smallest chunk of the input array given to one thread.
+    static constexpr std::uint32_t min_chunk_size = UINT32_C(4096);
+
+  public:
+    explicit pi_spigot_parallel(const std::uint32_t thread_count = std::uint32_t(std::thread::hardware_concurrency()))
+      : my_thread_count((std::max)(thread_count, UINT32_C(1))) { }
+
+    virtual ~pi_spigot_parallel() = default;
+
+    std::uint32_t get_thread_count() const { return my_thread_count; }
+
+    template<typename ItIn,
+             typename ItOut>
+    void calculate(ItIn  input_first,
+                   ItOut output_first)
+    {
+      // Use pi_spigot::calculate() to calculate
+      // result_digit decimal digits of pi.
+
+      // The caller is responsible for providing both
+      // input memory for the internal calculation details
+      // as well as output memory for the result of pi.
+      // The iterators are used concurrently by the threads.
+
+      calculate_impl(input_first,
+                     output_first,
+                     [](std::uint64_t& d, const std::uint32_t i) -> std::uint32_t
+                     {
+                       const std::uint32_t b =
+                         std::uint32_t(std::uint32_t(i * UINT32_C(2)) + UINT32_C(1));
+
+                       const std::uint32_t r = std::uint32_t(d % b);
+
+                       d /= b;
+
+                       return r;
+                     });
+    }
+
+    template<typename ItIn,
+             typename ItOut,
+             typename ItRecip>
+    void calculate(ItIn    input_first,
+                   ItOut   output_first,
+                   ItRecip recip_first)
+    {
+      // This is the same calculation as above, using the table
+      // of reciprocals of the divisors (see pi_spigot_single).
+
+      calculate_impl(input_first,
+                     output_first,
+                     [recip_first](std::uint64_t& d, const std::uint32_t i) -> std::uint32_t
+                     {
+                       const typename base_class_type::reciprocal_type recip(recip_first[i]);
+
+                       return recip.divide(d);
+                     });
+    }
+
+  private:
+    const std::uint32_t my_thread_count;
+
+    static std::uint32_t group_count()
+    {
+      return std::uint32_t(std::uint32_t(base_class_type::result_digit + base_class_type::loop_digit) - 1U) / base_class_type::loop_digit;
+    }
+
+    static std::uint32_t sweep_size(const std::uint32_t g)
+    {
+      // The number of elements of the input array in the sweep of digit group g.
+      return base_class_type::input_scale(std::uint32_t(base_class_type::result_digit - std::uint32_t(g * base_class_type::loop_digit)));
+    }
+
+    template<typename ItIn,
+             typename ItOut,
+             typename DivideFunctionType>
+    void calculate_impl(ItIn               input_first,
+                        ItOut              output_first,
+                        DivideFunctionType divide_function)
+    {
+      base_class_type::my_c = UINT32_C(0);
+
+      base_class_type::my_output_count = UINT32_C(0);
+
+      base_class_type::my_operation_count = UINTMAX_C(0);
+
+      std::uint32_t g = UINT32_C(0);
+
+      while(g < group_count())
+      {
+        // Find the digit groups of this epoch, in which
+        // the size of the sweep shrinks by at most 1/8.
+        const std::uint32_t n = sweep_size(g);
+
+        std::uint32_t g_next = std::uint32_t(g + 1U);
+
+        while((g_next < group_count()) && (sweep_size(g_next) > std::uint32_t(n - (n / 8U))))
+        {
+          ++g_next;
+        }
+
+        // Divide the sweep into equal chunks.
+        const std::uint32_t chunk_count =
+          (std::max)(UINT32_C(1), (std::min)(my_thread_count, std::uint32_t(n / min_chunk_size)));
+
+        std::vector<detail::pi_spigot_carry_queue> queues(chunk_count);
+        std::vector<std::uintmax_t>                operation_counts(chunk_count, UINTMAX_C(0));
+        std::vector<std::thread>                   threads;
+
+        threads.reserve(chunk_count - 1U);
+
+        for(std::uint32_t c = UINT32_C(1); c < chunk_count; ++c)
+        {
+          threads.emplace_back([this, input_first, output_first, divide_function, g, g_next, n, c, chunk_count, &queues, &operation_counts]()
+                               {
+                                 sweep_chunk(input_first, output_first, divide_function, g, g_next,
+                                             std::uint32_t((std::uint64_t(n) *  c      ) / chunk_count),
+                                             std::uint32_t((std::uint64_t(n) * (c + 1U)) / chunk_count),
+                                             ((c + 1U < chunk_count) ? &queues[c + 1U] : nullptr),
+                                             &queues[c],
+                                             operation_counts[c]);
+                               });
+        }
+
+        // The calling thread takes the bottom chunk.
+        sweep_chunk(input_first, output_first, divide_function, g, g_next,
+                    UINT32_C(0),
+                    std::uint32_t(n / chunk_count),
+                    ((chunk_count > 1U) ? &queues[1U] : nullptr),
+                    nullptr,
+                    operation_counts[0U]);
+
+        for(std::thread& t : threads)
+        {
+          t.join();
+        }
+
+        for(const std::uintmax_t& count : operation_counts)
+        {
+          base_class_type::my_operation_count += count;
+        }
+
+        g = g_next;
+      }
+    }
+
+    template<typename ItIn,
+             typename ItOut,
+             typename DivideFunctionType>
+    void sweep_chunk(ItIn                            input_first,
+                     ItOut                           output_first,
+                     DivideFunctionType              divide_function,
+                     const std::uint32_t             g_first,
+                     const std::uint32_t             g_last,
+                     const std::uint32_t             i_lo,
+                     const std::uint32_t             i_hi,
+                     detail::pi_spigot_carry_queue*  carry_in,
+                     detail::pi_spigot_carry_queue*  carry_out,
+                     std::uintmax_t&                 operation_count)
+    {
+      // Sweep the elements i_lo...(i_hi - 1) for the digit groups
+      // g_first...(g_last - 1). The carry into the top of the chunk
+      // comes from the chunk above it (if the sweep reaches so far),
+      // and the carry out of the bottom goes to the chunk below it.
+      // The bottom chunk (having no carry_out) extracts the digits.
+
+      for(std::uint32_t g = g_first; g < g_last; ++g)
+      {
+        const std::uint32_t n = sweep_size(g);
+
+        if(n <= i_lo)
+        {
+          // The sweeps of this and of all following digit groups
+          // end below this chunk.
+          break;
+        }
+
+        const std::uint32_t j = std::uint32_t(g * base_class_type::loop_digit);
+
+        std::uint64_t d;
+        std::int32_t  i;
+
+        if((n > i_hi) && (carry_in != nullptr))
+        {
+          d = carry_in->pop();
+          i = std::int32_t(i_hi - 1U);
+        }
+        else
+        {
+          d = UINT64_C(0);
+          i = std::int32_t(n - 1U);
+        }
+
+        for( ; i >= std::int32_t(i_lo); --i)
+        {
+          const std::uint32_t di =
+            ((j == UINT32_C(0)) ? base_class_type::d_init : input_first[std::uint32_t(i)]);
+
+          d += std::uint64_t(std::uint64_t(di) * detail::pow10<base_class_type::loop_digit>::value);
+
+          // Divide by b = (2 * i) + 1, keeping the remainder.
+          input_first[std::uint32_t(i)] = divide_function(d, std::uint32_t(i));
+
+          if(i > INT32_C(1))
+          {
+            d *= std::uint32_t(i);
+          }
+
+          ++operation_count;
+        }
+
+        if(carry_out != nullptr)
+        {
+          carry_out->push(d);
+        }
+        else
+        {
+          base_class_type::my_d = d;
+          base_class_type::my_j = j;
+
+          base_class_type::do_extract_digit_group(output_first);
+
+          base_class_type::my_j = std::uint32_t(j + base_class_type::loop_digit);
+        }
+      }
+    }
+  };
+
+  } } // namespace math::constants
+
+#endif // PI_SPIGOT_PARALLEL_2026_10_18_H_
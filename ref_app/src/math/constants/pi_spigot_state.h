@@ -56,6 +56,63 @@
       // input memory for the internal calculation details
       // as well as output memory for the result of pi.
 
+      calculate_impl(input_first,
+                     output_first,
+                     [](std::uint64_t& d, const std::uint32_t i) -> std::uint32_t
+                     {
+                       const std::uint32_t b =
+                         std::uint32_t(std::uint32_t(i * UINT32_C(2)) + UINT32_C(1));
+
+                       const std::uint32_t r = std::uint32_t(d % b);
+
+                       d /= b;
+
+                       return r;
+                     });
+    }
+
+    template<typename ItIn,
+             typename ItOut,
+             typename ItRecip>
+    void calculate(ItIn    input_first,
+                   ItOut   output_first,
+                   ItRecip recip_first)
+    {
+      // This is the same calculation as above, whereby the divisions
+      // are replaced by multiplications with the reciprocals of the
+      // divisors. The caller is responsible for providing the table
+      // of reciprocals, which has get_recip__static_size() elements
+      // for the divisors b = (2 * i) + 1. It is filled either with
+      // initialize_reciprocals() or as a constant table in ROM.
+
+      calculate_impl(input_first,
+                     output_first,
+                     [recip_first](std::uint64_t& d, const std::uint32_t i) -> std::uint32_t
+                     {
+                       // The reciprocal is copied from the table, which
+                       // may reside in read-only program memory.
+                       const typename base_class_type::reciprocal_type recip(recip_first[i]);
+
+                       return recip.divide(d);
+                     });
+    }
+
+    bool is_finished() const
+    {
+      return (my_state == state_type::finished);
+    }
+
+  private:
+    state_type   my_state;
+    std::int32_t my_i;
+
+    template<typename ItIn,
+             typename ItOut,
+             typename DivideFunctionType>
+    void calculate_impl(ItIn               input_first,
+                        ItOut              output_first,
+                        DivideFunctionType divide_function)
+    {
       switch(my_state)
       {
         case state_type::loop_j_init:
@@ -86,12 +143,8 @@
             base_class_type::my_d +=
               std::uint64_t(std::uint64_t(di) * detail::pow10<base_class_type::loop_digit>::value);
 
-            const std::uint32_t b =
-              std::uint32_t(std::uint32_t(my_i) * UINT32_C(2)) + UINT32_C(1);
-
-            input_first[std::uint32_t(my_i)] = std::uint32_t(base_class_type::my_d % b);
-
-            base_class_type::my_d /= b;
+            // Divide by b = (2 * i) + 1, keeping the remainder.
+            input_first[std::uint32_t(my_i)] = divide_function(base_class_type::my_d, std::uint32_t(my_i));
           }
 
           ++base_class_type::my_operation_count;
@@ -131,15 +184,6 @@
           break;
       };
     }
-
-    bool is_finished() const
-    {
-      return (my_state == state_type::finished);
-    }
-
-  private:
-    state_type   my_state;
-    std::int32_t my_i;
   };
 
   } } // namespace math::constants
@@ -10,6 +10,7 @@
 
   #include <cmath>
   #include <cstdint>
+  #include <cstring>
 
   #if defined(__GNUC__)
   #pragma GCC diagnostic push
@@ -68,12 +69,17 @@
     // Make the initial guess of the inverse square root.
     // The constant differs slightly from the original value.
 
-    // Note that the cast in the following line breaks strict alignment rules.
-    const uint32_t i =
-      (uint32_t) 0X5F375A86ULL - (uint32_t) ((*(const uint32_t*) ((const void*) &x)) >> 1);
+    // The bits are copied with memcpy, which respects the strict aliasing
+    // rules and which the compiler reduces to a register move.
+    uint32_t i;
 
-    // Note that the cast in the following line breaks strict alignment rules.
-    fast_math_float32_t y = *(const fast_math_float32_t*) ((const void*) &i);
+    memcpy(&i, &x, sizeof(i));
+
+    i = (uint32_t) 0X5F375A86ULL - (uint32_t) (i >> 1);
+
+    fast_math_float32_t y;
+
+    memcpy(&y, &i, sizeof(y));
 
     // Perform the first Newton iteration.
     y = y * ((fast_math_float32_t) 1.5F - ((x * (fast_math_float32_t) 0.5F) * (y * y)));
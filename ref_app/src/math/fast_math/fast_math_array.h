@@ -0,0 +1,532 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////
+
+#ifndef FAST_MATH_ARRAY_2026_10_18_H_
+  #define FAST_MATH_ARRAY_2026_10_18_H_
+
+  // Batch versions of the fast_math functions for arrays of floats,
+  // for instance for the conversion of sample buffers to decibels
+  // or for the calculation of RMS values.
+
+  // The functions exp and log use argument reduction by powers of two
+  // and a minimax polynomial, whose degree is a template parameter.
+  // The functions sqrt_q and sqrt use the fast inverse square root
+  // (as in fast_math_sqrt_q), whose number of Newton iterations is
+  // a template parameter. Callers trade accuracy for speed with these.
+
+  // The calculations are written without branches, so that the same
+  // algorithm runs on every path. When compiling for AVX-512, 16 values
+  // are calculated per instruction. When compiling for AVX2, 8 values
+  // are calculated per instruction. The remaining values at the end
+  // of the arrays (and all values on other targets) use portable loops.
+  // The results of the paths may differ in the last bit, depending
+  // on the use of fused multiply-add.
+
+  // The measured maximum relative errors are:
+  //   exp<2...6>                 : 1.7E-03, 7.5E-05, 2.7E-06, 2.2E-07, 1.1E-07.
+  //   log<3, 5, 7>               : 2.3E-05, 2.9E-07, 1.8E-07.
+  //   sqrt_q<0...3>, sqrt<0...3> : 3.4E-02, 1.8E-03, 4.8E-06, 2.5E-07.
+  // The arguments of exp are limited to about -110...89, which
+  // gives 0 and infinity beyond the range of float. The arguments
+  // of log, sqrt_q and sqrt must be positive and finite. The
+  // function log gives about -88 for 0 and subnormal arguments.
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstring>
+
+  #if defined(__AVX2__) || defined(__AVX512F__)
+  // Some versions of GCC warn about the (intentionally) undefined
+  // registers within the inline functions of the AVX-512 intrinsics.
+  #if defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  #include <immintrin.h>
+  #if defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+  #endif
+
+  #include <math/fast_math/fast_math.h>
+
+  namespace fast_math_array
+  {
+    using float32_t = fast_math::float32_t;
+
+    namespace detail
+    {
+      // The minimax polynomials of exp(a) for |a| <= ln(2)/2,
+      // with the coefficients in ascending order.
+      template<const std::size_t degree> struct exp_polynomial;
+
+      template<> struct exp_polynomial<2U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[3U] = { 1.000443142E+00F, 1.014860950E+00F, 4.962585912E-01F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct exp_polynomial<3U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[4U] = { 9.999280735E-01F, 1.000164186E+00F, 5.049632642E-01F, 1.656684235E-01F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct exp_polynomial<4U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[5U] = { 9.999992614E-01F, 9.999634049E-01F, 5.000435866E-01F, 1.679090722E-01F,
+                                               4.145860819E-02F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct exp_polynomial<5U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[6U] = { 1.000000072E+00F, 9.999996920E-01F, 4.999889485E-01F, 1.666757473E-01F,
+                                               4.191538199E-02F, 8.297655080E-03F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct exp_polynomial<6U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[7U] = { 1.000000001E+00F, 1.000000036E+00F, 4.999999208E-01F, 1.666642017E-01F,
+                                               4.166822557E-02F, 8.374815804E-03F, 1.383684599E-03F };
+
+          return table[k];
+        }
+      };
+
+      // The minimax polynomials P(z) of log(m) = s P(s^2), where
+      // s = (m - 1) / (m + 1) and 1/sqrt(2) <= m < sqrt(2), with the
+      // coefficients in ascending order. The degree is that in s.
+      template<const std::size_t degree> struct log_polynomial;
+
+      template<> struct log_polynomial<3U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[2U] = { 1.999955489E+00F, 6.786798576E-01F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct log_polynomial<5U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[3U] = { 2.000000237E+00F, 6.665222370E-01F, 4.129637287E-01F };
+
+          return table[k];
+        }
+      };
+
+      template<> struct log_polynomial<7U>
+      {
+        static float32_t coefficient(const std::size_t k)
+        {
+          static const float32_t table[4U] = { 1.999999999E+00F, 6.666681595E-01F, 3.997479493E-01F, 2.992565068E-01F };
+
+          return table[k];
+        }
+      };
+
+      // The number of coefficients of the polynomials.
+      template<const std::size_t degree> struct exp_size { static const std::size_t value = degree + 1U; };
+      template<const std::size_t degree> struct log_size { static const std::size_t value = (degree + 1U) / 2U; };
+
+      // The constants of the argument reduction. The upper part of ln(2)
+      // has 15 significant bits, so that its product with the integer
+      // exponent is exact. Adding round_bias (1.5 * 2^23) rounds
+      // to the nearest integer, which is held in the lower bits.
+      constexpr float32_t log2_e     = 1.442695022F;
+      constexpr float32_t ln2_hi     = 6.931457520E-01F;
+      constexpr float32_t ln2_lo     = 1.428606765E-06F;
+      constexpr float32_t round_bias = 12582912.0F;
+      constexpr float32_t exp_lo     = -110.0F;
+      constexpr float32_t exp_hi     = 89.0F;
+
+      constexpr std::uint32_t round_bias_bits = UINT32_C(0x4B400000);
+      constexpr std::uint32_t sqrt_half_bits  = UINT32_C(0x3F3504F3);
+      constexpr std::uint32_t rsqrt_magic     = UINT32_C(0x5F375A86);
+
+      inline std::uint32_t to_bits(const float32_t x)
+      {
+        std::uint32_t u;
+
+        std::memcpy(&u, &x, sizeof(u));
+
+        return u;
+      }
+
+      inline float32_t from_bits(const std::uint32_t u)
+      {
+        float32_t x;
+
+        std::memcpy(&x, &u, sizeof(x));
+
+        return x;
+      }
+
+      inline float32_t pow2(const std::int32_t n)
+      {
+        // Form 2^n (for -126 <= n <= 127) directly in the exponent bits.
+        return from_bits(std::uint32_t(std::uint32_t(n + INT32_C(127)) << 23U));
+      }
+
+      template<typename polynomial_type, const std::size_t size>
+      inline float32_t horner(const float32_t a)
+      {
+        float32_t p = polynomial_type::coefficient(size - 1U);
+
+        for(std::size_t k = size - 1U; k > 0U; --k)
+        {
+          p = (p * a) + polynomial_type::coefficient(k - 1U);
+        }
+
+        return p;
+      }
+
+      // The portable scalar versions.
+      template<const std::size_t degree>
+      inline float32_t exp(const float32_t x)
+      {
+        // Limit the argument, in the form of the instructions max and min.
+        const float32_t xl = ((x  > exp_lo) ? x  : exp_lo);
+        const float32_t xc = ((xl < exp_hi) ? xl : exp_hi);
+
+        // Reduce x = (n * ln(2)) + a, with |a| <= ln(2)/2.
+        const float32_t    t  = (xc * log2_e) + round_bias;
+        const float32_t    nf = t - round_bias;
+        const std::int32_t n  = std::int32_t(to_bits(t) - round_bias_bits);
+
+        const float32_t a = (xc - (nf * ln2_hi)) - (nf * ln2_lo);
+
+        const float32_t p = horner<exp_polynomial<degree>, exp_size<degree>::value>(a);
+
+        // Scale by 2^n in two steps, which also reaches
+        // the limits of the range and the subnormals.
+        const std::int32_t n1 = std::int32_t(n >> 1U);
+
+        return (p * pow2(n1)) * pow2(std::int32_t(n - n1));
+      }
+
+      template<const std::size_t degree>
+      inline float32_t log(const float32_t x)
+      {
+        // Reduce x = 2^e * m, with 1/sqrt(2) <= m < sqrt(2).
+        const std::uint32_t u = std::uint32_t(std::uint32_t(to_bits(x) & UINT32_C(0x7FFFFFFF)) - sqrt_half_bits);
+
+        const std::int32_t e = std::int32_t(std::int32_t(u) >> 23U);
+
+        const float32_t m = from_bits(std::uint32_t(u & UINT32_C(0x007FFFFF)) + sqrt_half_bits);
+
+        const float32_t f = m - 1.0F;
+        const float32_t s = f / (f + 2.0F);
+
+        const float32_t log_m = s * horner<log_polynomial<degree>, log_size<degree>::value>(s * s);
+
+        const float32_t ef = float32_t(e);
+
+        return (ef * ln2_hi) + ((ef * ln2_lo) + log_m);
+      }
+
+      template<const std::size_t iterations>
+      inline float32_t sqrt_q(const float32_t x)
+      {
+        float32_t y = from_bits(std::uint32_t(rsqrt_magic - std::uint32_t(to_bits(x) >> 1U)));
+
+        for(std::size_t i = 0U; i < iterations; ++i)
+        {
+          y = y * (1.5F - ((x * 0.5F) * (y * y)));
+        }
+
+        return y;
+      }
+
+      // The vectorized paths return the number of values done, being
+      // a multiple of the register width. The generic versions do none.
+      #if defined(__AVX512F__)
+
+      template<typename polynomial_type, const std::size_t size>
+      inline __m512 avx512_horner(const __m512 a)
+      {
+        __m512 p = _mm512_set1_ps(polynomial_type::coefficient(size - 1U));
+
+        for(std::size_t k = size - 1U; k > 0U; --k)
+        {
+          p = _mm512_fmadd_ps(p, a, _mm512_set1_ps(polynomial_type::coefficient(k - 1U)));
+        }
+
+        return p;
+      }
+
+      inline __m512 avx512_pow2(const __m512i n)
+      {
+        return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(n, _mm512_set1_epi32(127)), 23));
+      }
+
+      template<const std::size_t degree>
+      inline std::size_t exp_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 16U) <= count; i += 16U)
+        {
+          const __m512 xc = _mm512_min_ps(_mm512_max_ps(_mm512_loadu_ps(x + i), _mm512_set1_ps(exp_lo)), _mm512_set1_ps(exp_hi));
+
+          const __m512  t  = _mm512_fmadd_ps(xc, _mm512_set1_ps(log2_e), _mm512_set1_ps(round_bias));
+          const __m512  nf = _mm512_sub_ps(t, _mm512_set1_ps(round_bias));
+          const __m512i n  = _mm512_sub_epi32(_mm512_castps_si512(t), _mm512_set1_epi32(std::int32_t(round_bias_bits)));
+
+          const __m512 a = _mm512_fnmadd_ps(nf, _mm512_set1_ps(ln2_lo), _mm512_fnmadd_ps(nf, _mm512_set1_ps(ln2_hi), xc));
+
+          const __m512 p = avx512_horner<exp_polynomial<degree>, exp_size<degree>::value>(a);
+
+          const __m512i n1 = _mm512_srai_epi32(n, 1);
+
+          _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_mul_ps(p, avx512_pow2(n1)), avx512_pow2(_mm512_sub_epi32(n, n1))));
+        }
+
+        return i;
+      }
+
+      template<const std::size_t degree>
+      inline std::size_t log_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 16U) <= count; i += 16U)
+        {
+          const __m512i u = _mm512_sub_epi32(_mm512_and_si512(_mm512_castps_si512(_mm512_loadu_ps(x + i)), _mm512_set1_epi32(INT32_C(0x7FFFFFFF))),
+                                             _mm512_set1_epi32(std::int32_t(sqrt_half_bits)));
+
+          const __m512 ef = _mm512_cvtepi32_ps(_mm512_srai_epi32(u, 23));
+
+          const __m512 m = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_and_si512(u, _mm512_set1_epi32(INT32_C(0x007FFFFF))),
+                                                                _mm512_set1_epi32(std::int32_t(sqrt_half_bits))));
+
+          const __m512 f = _mm512_sub_ps(m, _mm512_set1_ps(1.0F));
+          const __m512 s = _mm512_div_ps(f, _mm512_add_ps(f, _mm512_set1_ps(2.0F)));
+
+          const __m512 log_m = _mm512_mul_ps(s, avx512_horner<log_polynomial<degree>, log_size<degree>::value>(_mm512_mul_ps(s, s)));
+
+          _mm512_storeu_ps(out + i, _mm512_fmadd_ps(ef, _mm512_set1_ps(ln2_hi), _mm512_fmadd_ps(ef, _mm512_set1_ps(ln2_lo), log_m)));
+        }
+
+        return i;
+      }
+
+      template<const std::size_t iterations, const bool is_sqrt>
+      inline std::size_t sqrt_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 16U) <= count; i += 16U)
+        {
+          const __m512 vx = _mm512_loadu_ps(x + i);
+
+          __m512 y = _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32(std::int32_t(rsqrt_magic)), _mm512_srli_epi32(_mm512_castps_si512(vx), 1)));
+
+          const __m512 half_x = _mm512_mul_ps(vx, _mm512_set1_ps(0.5F));
+
+          for(std::size_t j = 0U; j < iterations; ++j)
+          {
+            y = _mm512_mul_ps(y, _mm512_fnmadd_ps(half_x, _mm512_mul_ps(y, y), _mm512_set1_ps(1.5F)));
+          }
+
+          _mm512_storeu_ps(out + i, (is_sqrt ? _mm512_mul_ps(y, vx) : y));
+        }
+
+        return i;
+      }
+
+      #elif defined(__AVX2__)
+
+      inline __m256 avx2_madd(const __m256 a, const __m256 b, const __m256 c)
+      {
+        #if defined(__FMA__)
+        return _mm256_fmadd_ps(a, b, c);
+        #else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+        #endif
+      }
+
+      template<typename polynomial_type, const std::size_t size>
+      inline __m256 avx2_horner(const __m256 a)
+      {
+        __m256 p = _mm256_set1_ps(polynomial_type::coefficient(size - 1U));
+
+        for(std::size_t k = size - 1U; k > 0U; --k)
+        {
+          p = avx2_madd(p, a, _mm256_set1_ps(polynomial_type::coefficient(k - 1U)));
+        }
+
+        return p;
+      }
+
+      inline __m256 avx2_pow2(const __m256i n)
+      {
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(127)), 23));
+      }
+
+      template<const std::size_t degree>
+      inline std::size_t exp_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 8U) <= count; i += 8U)
+        {
+          const __m256 xc = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(x + i), _mm256_set1_ps(exp_lo)), _mm256_set1_ps(exp_hi));
+
+          const __m256  t  = avx2_madd(xc, _mm256_set1_ps(log2_e), _mm256_set1_ps(round_bias));
+          const __m256  nf = _mm256_sub_ps(t, _mm256_set1_ps(round_bias));
+          const __m256i n  = _mm256_sub_epi32(_mm256_castps_si256(t), _mm256_set1_epi32(std::int32_t(round_bias_bits)));
+
+          const __m256 a = _mm256_sub_ps(_mm256_sub_ps(xc, _mm256_mul_ps(nf, _mm256_set1_ps(ln2_hi))), _mm256_mul_ps(nf, _mm256_set1_ps(ln2_lo)));
+
+          const __m256 p = avx2_horner<exp_polynomial<degree>, exp_size<degree>::value>(a);
+
+          const __m256i n1 = _mm256_srai_epi32(n, 1);
+
+          _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_mul_ps(p, avx2_pow2(n1)), avx2_pow2(_mm256_sub_epi32(n, n1))));
+        }
+
+        return i;
+      }
+
+      template<const std::size_t degree>
+      inline std::size_t log_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 8U) <= count; i += 8U)
+        {
+          const __m256i u = _mm256_sub_epi32(_mm256_and_si256(_mm256_castps_si256(_mm256_loadu_ps(x + i)), _mm256_set1_epi32(INT32_C(0x7FFFFFFF))),
+                                             _mm256_set1_epi32(std::int32_t(sqrt_half_bits)));
+
+          const __m256 ef = _mm256_cvtepi32_ps(_mm256_srai_epi32(u, 23));
+
+          const __m256 m = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(u, _mm256_set1_epi32(INT32_C(0x007FFFFF))),
+                                                                _mm256_set1_epi32(std::int32_t(sqrt_half_bits))));
+
+          const __m256 f = _mm256_sub_ps(m, _mm256_set1_ps(1.0F));
+          const __m256 s = _mm256_div_ps(f, _mm256_add_ps(f, _mm256_set1_ps(2.0F)));
+
+          const __m256 log_m = _mm256_mul_ps(s, avx2_horner<log_polynomial<degree>, log_size<degree>::value>(_mm256_mul_ps(s, s)));
+
+          _mm256_storeu_ps(out + i, avx2_madd(ef, _mm256_set1_ps(ln2_hi), avx2_madd(ef, _mm256_set1_ps(ln2_lo), log_m)));
+        }
+
+        return i;
+      }
+
+      template<const std::size_t iterations, const bool is_sqrt>
+      inline std::size_t sqrt_simd(const float32_t* x, float32_t* out, const std::size_t count)
+      {
+        std::size_t i = 0U;
+
+        for( ; (i + 8U) <= count; i += 8U)
+        {
+          const __m256 vx = _mm256_loadu_ps(x + i);
+
+          __m256 y = _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32(std::int32_t(rsqrt_magic)), _mm256_srli_epi32(_mm256_castps_si256(vx), 1)));
+
+          const __m256 half_x = _mm256_mul_ps(vx, _mm256_set1_ps(0.5F));
+
+          for(std::size_t j = 0U; j < iterations; ++j)
+          {
+            y = _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5F), _mm256_mul_ps(half_x, _mm256_mul_ps(y, y))));
+          }
+
+          _mm256_storeu_ps(out + i, (is_sqrt ? _mm256_mul_ps(y, vx) : y));
+        }
+
+        return i;
+      }
+
+      #else
+
+      template<const std::size_t degree>
+      inline std::size_t exp_simd(const float32_t*, float32_t*, const std::size_t) { return 0U; }
+
+      template<const std::size_t degree>
+      inline std::size_t log_simd(const float32_t*, float32_t*, const std::size_t) { return 0U; }
+
+      template<const std::size_t iterations, const bool is_sqrt>
+      inline std::size_t sqrt_simd(const float32_t*, float32_t*, const std::size_t) { return 0U; }
+
+      #endif
+    }
+
+    // Calculate out[i] = exp(x[i]), with a polynomial of degree 2...6.
+    template<const std::size_t degree = 5U>
+    void exp(const float32_t* x, float32_t* out, const std::size_t count)
+    {
+      static_assert((degree >= 2U) && (degree <= 6U), "the degree of exp must be 2...6");
+
+      for(std::size_t i = detail::exp_simd<degree>(x, out, count); i < count; ++i)
+      {
+        out[i] = detail::exp<degree>(x[i]);
+      }
+    }
+
+    // Calculate out[i] = log(x[i]), with a polynomial of degree 3, 5 or 7.
+    template<const std::size_t degree = 5U>
+    void log(const float32_t* x, float32_t* out, const std::size_t count)
+    {
+      static_assert((degree == 3U) || (degree == 5U) || (degree == 7U), "the degree of log must be 3, 5 or 7");
+
+      for(std::size_t i = detail::log_simd<degree>(x, out, count); i < count; ++i)
+      {
+        out[i] = detail::log<degree>(x[i]);
+      }
+    }
+
+    // Calculate out[i] = 1 / sqrt(x[i]), with 0...3 Newton iterations.
+    template<const std::size_t iterations = 2U>
+    void sqrt_q(const float32_t* x, float32_t* out, const std::size_t count)
+    {
+      static_assert(iterations <= 3U, "the number of iterations of sqrt_q must be 0...3");
+
+      for(std::size_t i = detail::sqrt_simd<iterations, false>(x, out, count); i < count; ++i)
+      {
+        out[i] = detail::sqrt_q<iterations>(x[i]);
+      }
+    }
+
+    // Calculate out[i] = sqrt(x[i]) = x[i] / sqrt(x[i]), with 0...3 Newton iterations.
+    template<const std::size_t iterations = 2U>
+    void sqrt(const float32_t* x, float32_t* out, const std::size_t count)
+    {
+      static_assert(iterations <= 3U, "the number of iterations of sqrt must be 0...3");
+
+      for(std::size_t i = detail::sqrt_simd<iterations, true>(x, out, count); i < count; ++i)
+      {
+        out[i] = x[i] * detail::sqrt_q<iterations>(x[i]);
+      }
+    }
+  }
+
+#endif // FAST_MATH_ARRAY_2026_10_18_H_
@@ -13,6 +13,7 @@
   #include <cstddef>
   #include <cstdint>
   #include <limits>
+  #include <type_traits>
 
   #if !defined(FIXED_POINT_DISABLE_IOSTREAM)
     #include <istream>
@@ -25,18 +26,329 @@
   // Utility structure to help with the epsilon limits for fixed_point.
   // These special numbers represent the smallest value for a decimal part
   // that differs from 1 for the corresponding decimal-part width.
-  template<const std::size_t> struct epsilon_helper      { static const std::size_t epsilon_value = std::size_t(0U); };
+  template<const std::size_t> struct epsilon_helper      { static const std::size_t epsilon_value = std::size_t(1U); };
   template<>                  struct epsilon_helper<4U>  { static const std::size_t epsilon_value = std::size_t(1U); };
   template<>                  struct epsilon_helper<8U>  { static const std::size_t epsilon_value = std::size_t(3U); };
   template<>                  struct epsilon_helper<16U> { static const std::size_t epsilon_value = std::size_t(7U); };
   template<>                  struct epsilon_helper<32U> { static const std::size_t epsilon_value = std::size_t(44U); };
 
+  // The rounding policies of fixed_point, which are used for multiplication
+  // and division. The function bias gives the value that is added to the
+  // double-width product before its arithmetic right shift by n bits,
+  // depending on the sign mask (zero or all ones) of the product.
+  // The function increment gives the increment of the magnitude
+  // of a truncated quotient having the remainder r and the divisor d.
+  // Both are resolved at compile time, and neither of them branches.
+
+  // Round toward zero. This is the default, which truncates the magnitude.
+  struct fixed_point_round_toward_zero
+  {
+    static const std::float_round_style round_style = std::round_toward_zero;
+
+    template<typename unsigned_type>
+    static unsigned_type bias(const unsigned_type sign_mask, const std::size_t n)
+    {
+      return unsigned_type(sign_mask & unsigned_type(unsigned_type(unsigned_type(1U) << n) - 1U));
+    }
+
+    template<typename unsigned_type>
+    static unsigned_type increment(const unsigned_type, const unsigned_type, const bool)
+    {
+      return unsigned_type(0U);
+    }
+  };
+
+  // Round downward (toward minus infinity), which is the plain arithmetic shift.
+  struct fixed_point_round_down
+  {
+    static const std::float_round_style round_style = std::round_toward_neg_infinity;
+
+    template<typename unsigned_type>
+    static unsigned_type bias(const unsigned_type, const std::size_t)
+    {
+      return unsigned_type(0U);
+    }
+
+    template<typename unsigned_type>
+    static unsigned_type increment(const unsigned_type r, const unsigned_type, const bool is_neg)
+    {
+      return unsigned_type((is_neg && (r != 0U)) ? 1U : 0U);
+    }
+  };
+
+  // Round to nearest, whereby a tie is rounded upward.
+  struct fixed_point_round_to_nearest
+  {
+    static const std::float_round_style round_style = std::round_to_nearest;
+
+    template<typename unsigned_type>
+    static unsigned_type bias(const unsigned_type, const std::size_t n)
+    {
+      return unsigned_type(unsigned_type(1U) << (n - 1U));
+    }
+
+    template<typename unsigned_type>
+    static unsigned_type increment(const unsigned_type r, const unsigned_type d, const bool is_neg)
+    {
+      return unsigned_type((is_neg ? (r > unsigned_type(d - r)) : (r >= unsigned_type(d - r))) ? 1U : 0U);
+    }
+  };
+
+  // The overflow policies of fixed_point, which are used for addition,
+  // subtraction, multiplication and division. The function limit receives
+  // the result wrapped to the width of the type, together with the flag
+  // of overflow and the sign of the exact result.
+
+  // Wrap around, like the underlying integer type. This is the default.
+  struct fixed_point_overflow_wrap
+  {
+    template<typename signed_type>
+    static signed_type limit(const signed_type x, const bool, const bool)
+    {
+      return x;
+    }
+  };
+
+  // Saturate at the largest or the lowest value.
+  struct fixed_point_overflow_saturate
+  {
+    template<typename signed_type>
+    static signed_type limit(const signed_type x, const bool is_overflow, const bool is_neg)
+    {
+      return ((!is_overflow) ? x : (is_neg ? (std::numeric_limits<signed_type>::min)()
+                                           : (std::numeric_limits<signed_type>::max)()));
+    }
+  };
+
   // Forward declaration of the fixed_point template class.
-  template<typename integer_type>
+  // The default number of fractional bits is half of the bits
+  // of the integer type, and the default policies truncate
+  // toward zero and wrap around, as integer arithmetic does.
+  template<typename integer_type,
+           const std::size_t fractional_digits = std::size_t(std::numeric_limits<integer_type>::digits + 1) / 2U,
+           typename rounding_policy = fixed_point_round_toward_zero,
+           typename overflow_policy = fixed_point_overflow_wrap>
   class fixed_point;
 
-  // The scalable fixed_point template class.
-  template<typename integer_type>
+  namespace fixed_point_detail
+  {
+    // The arithmetic of the data representation of fixed_point,
+    // which is selected at compile time. If an integer type having
+    // twice the width exists, the product and the dividend are formed
+    // exactly in it. Otherwise (for the widest integer type), the product
+    // is formed from the four partial products of the halves and the
+    // quotient from a long division, both without branches.
+    template<typename signed_type,
+             const std::size_t split,
+             typename rounding_policy,
+             typename overflow_policy,
+             const bool has_wide_type = ((std::numeric_limits<typename util::utype_helper<std::numeric_limits<signed_type>::digits + 1>::exact_type>::digits * 2) <= std::numeric_limits<std::uintmax_t>::digits)>
+    struct arithmetic;
+
+    template<typename signed_type,
+             typename overflow_policy>
+    struct arithmetic_base
+    {
+      typedef typename util::utype_helper<std::numeric_limits<signed_type>::digits + 1>::exact_type unsigned_type;
+
+      static signed_type add(const signed_type a, const signed_type b)
+      {
+        const signed_type s = signed_type(unsigned_type(unsigned_type(a) + unsigned_type(b)));
+
+        // The sum overflows if its sign differs from the signs of both summands.
+        const bool is_overflow = (signed_type(signed_type(a ^ s) & signed_type(b ^ s)) < signed_type(0));
+
+        return overflow_policy::limit(s, is_overflow, (a < signed_type(0)));
+      }
+
+      static signed_type sub(const signed_type a, const signed_type b)
+      {
+        const signed_type s = signed_type(unsigned_type(unsigned_type(a) - unsigned_type(b)));
+
+        // The difference overflows if the operands have different signs
+        // and the sign of the difference differs from the sign of a.
+        const bool is_overflow = (signed_type(signed_type(a ^ b) & signed_type(a ^ s)) < signed_type(0));
+
+        return overflow_policy::limit(s, is_overflow, (a < signed_type(0)));
+      }
+    };
+
+    template<typename signed_type,
+             const std::size_t split,
+             typename rounding_policy,
+             typename overflow_policy>
+    struct arithmetic<signed_type, split, rounding_policy, overflow_policy, true>
+      : public arithmetic_base<signed_type, overflow_policy>
+    {
+      typedef typename arithmetic_base<signed_type, overflow_policy>::unsigned_type unsigned_type;
+
+      typedef typename util::utype_helper<std::numeric_limits<unsigned_type>::digits * 2>::exact_type unsigned_wide_type;
+      typedef typename std::make_signed<unsigned_wide_type>::type                                      signed_wide_type;
+
+      static signed_type narrow(const signed_wide_type x)
+      {
+        const bool is_overflow =
+          (   (x < signed_wide_type((std::numeric_limits<signed_type>::min)()))
+           || (x > signed_wide_type((std::numeric_limits<signed_type>::max)())));
+
+        return overflow_policy::limit(signed_type(x), is_overflow, (x < signed_wide_type(0)));
+      }
+
+      static signed_type mul(const signed_type a, const signed_type b)
+      {
+        const signed_wide_type p = signed_wide_type(signed_wide_type(a) * signed_wide_type(b));
+
+        const unsigned_wide_type sign_mask =
+          unsigned_wide_type(signed_wide_type(p >> std::numeric_limits<signed_wide_type>::digits));
+
+        const unsigned_wide_type biased =
+          unsigned_wide_type(unsigned_wide_type(p) + rounding_policy::bias(sign_mask, split));
+
+        return narrow(signed_wide_type(signed_wide_type(biased) >> split));
+      }
+
+      static signed_type div(const signed_type a, const signed_type b)
+      {
+        const signed_wide_type n = signed_wide_type(signed_wide_type(a) * signed_wide_type(signed_wide_type(1) << split));
+
+        // The quotient and remainder are truncated toward zero.
+        const signed_wide_type q = signed_wide_type(n / b);
+        const signed_wide_type r = signed_wide_type(n % b);
+
+        const bool is_neg = ((a < signed_type(0)) != (b < signed_type(0)));
+
+        const unsigned_wide_type inc =
+          rounding_policy::increment(unsigned_wide_type((r < signed_wide_type(0)) ? -r : r),
+                                     unsigned_wide_type((b < signed_type(0)) ? -signed_wide_type(b) : signed_wide_type(b)),
+                                     is_neg);
+
+        return narrow(signed_wide_type(is_neg ? (q - signed_wide_type(inc)) : (q + signed_wide_type(inc))));
+      }
+    };
+
+    template<typename signed_type,
+             const std::size_t split,
+             typename rounding_policy,
+             typename overflow_policy>
+    struct arithmetic<signed_type, split, rounding_policy, overflow_policy, false>
+      : public arithmetic_base<signed_type, overflow_policy>
+    {
+      typedef typename arithmetic_base<signed_type, overflow_policy>::unsigned_type unsigned_type;
+
+      static const std::size_t digits      = std::size_t(std::numeric_limits<unsigned_type>::digits);
+      static const std::size_t half_digits = digits / 2U;
+
+      static unsigned_type magnitude(const signed_type x)
+      {
+        return ((x < signed_type(0)) ? unsigned_type(unsigned_type(0U) - unsigned_type(x)) : unsigned_type(x));
+      }
+
+      static signed_type mul(const signed_type a, const signed_type b)
+      {
+        // Form the unsigned double-width product of the two's complement
+        // representations from the four partial products of the halves.
+        const unsigned_type ua = unsigned_type(a);
+        const unsigned_type ub = unsigned_type(b);
+
+        const unsigned_type half_mask = unsigned_type(unsigned_type(unsigned_type(1U) << half_digits) - 1U);
+
+        const unsigned_type a0 = unsigned_type(ua & half_mask);
+        const unsigned_type a1 = unsigned_type(ua >> half_digits);
+        const unsigned_type b0 = unsigned_type(ub & half_mask);
+        const unsigned_type b1 = unsigned_type(ub >> half_digits);
+
+        const unsigned_type p00 = unsigned_type(a0 * b0);
+        const unsigned_type p01 = unsigned_type(a0 * b1);
+        const unsigned_type p10 = unsigned_type(a1 * b0);
+        const unsigned_type p11 = unsigned_type(a1 * b1);
+
+        const unsigned_type mid = unsigned_type(unsigned_type(unsigned_type(p00 >> half_digits) + unsigned_type(p01 & half_mask)) + unsigned_type(p10 & half_mask));
+
+        unsigned_type lo = unsigned_type(unsigned_type(p00 & half_mask) | unsigned_type(mid << half_digits));
+        unsigned_type hi = unsigned_type(unsigned_type(unsigned_type(p11 + unsigned_type(p01 >> half_digits)) + unsigned_type(p10 >> half_digits)) + unsigned_type(mid >> half_digits));
+
+        // Correct the upper word for the signs, which gives the signed product.
+        hi = unsigned_type(hi - unsigned_type(unsigned_type(unsigned_type(0U) - unsigned_type(ua >> (digits - 1U))) & ub));
+        hi = unsigned_type(hi - unsigned_type(unsigned_type(unsigned_type(0U) - unsigned_type(ub >> (digits - 1U))) & ua));
+
+        // Add the rounding bias to the two words.
+        const unsigned_type sign_mask = unsigned_type(unsigned_type(0U) - unsigned_type(hi >> (digits - 1U)));
+
+        const unsigned_type lo_biased = unsigned_type(lo + rounding_policy::bias(sign_mask, split));
+
+        hi = unsigned_type(hi + unsigned_type((lo_biased < lo) ? 1U : 0U));
+        lo = lo_biased;
+
+        // The result is the middle word. It overflows if the bits
+        // above it are not the sign extension of its upper bit.
+        const signed_type result = signed_type(unsigned_type(unsigned_type(lo >> split) | unsigned_type(hi << (digits - split))));
+
+        const signed_type above = signed_type(signed_type(hi) >> (split - 1U));
+
+        const bool is_overflow = ((above != signed_type(0)) && (above != signed_type(-1)));
+
+        return overflow_policy::limit(result, is_overflow, (signed_type(hi) < signed_type(0)));
+      }
+
+      static signed_type div(const signed_type a, const signed_type b)
+      {
+        const bool is_neg = ((a < signed_type(0)) != (b < signed_type(0)));
+
+        const unsigned_type ua = magnitude(a);
+        const unsigned_type ub = magnitude(b);
+
+        // The dividend is (ua * 2^split) in the two words (hi, lo).
+        // The upper part of the quotient is found with one division.
+        unsigned_type hi = unsigned_type(ua >> (digits - split));
+        unsigned_type lo = unsigned_type(ua << split);
+
+        const unsigned_type q_hi = unsigned_type(hi / ub);
+
+        hi = unsigned_type(hi % ub);
+
+        // The lower part of the quotient is found with a restoring
+        // long division, one bit at a time, which does not branch.
+        unsigned_type q = unsigned_type(0U);
+
+        for(std::size_t i = 0U; i < digits; ++i)
+        {
+          const unsigned_type carry = unsigned_type(hi >> (digits - 1U));
+
+          hi = unsigned_type(unsigned_type(hi << 1U) | unsigned_type(lo >> (digits - 1U)));
+          lo = unsigned_type(lo << 1U);
+
+          const unsigned_type bit = unsigned_type(carry | unsigned_type((hi >= ub) ? 1U : 0U));
+
+          hi = unsigned_type(hi - unsigned_type(unsigned_type(unsigned_type(0U) - bit) & ub));
+          q  = unsigned_type(unsigned_type(q << 1U) | bit);
+        }
+
+        const unsigned_type m = unsigned_type(q + rounding_policy::increment(hi, ub, is_neg));
+
+        const unsigned_type limit = unsigned_type(unsigned_type(unsigned_type(1U) << (digits - 1U)) - unsigned_type(is_neg ? 0U : 1U));
+
+        const bool is_overflow = ((q_hi != unsigned_type(0U)) || (m < q) || (m > limit));
+
+        const signed_type result = signed_type(is_neg ? unsigned_type(unsigned_type(0U) - m) : m);
+
+        return overflow_policy::limit(result, is_overflow, is_neg);
+      }
+    };
+  }
+
+  // Forward declaration of the access to the internal data
+  // representation, as used by the array kernels and CORDIC functions.
+  template<typename fixed_point_type>
+  struct fixed_point_access;
+
+  // The scalable fixed_point template class. The Q-format, in other words
+  // the number of fractional bits, and the policies of rounding and
+  // overflow are template parameters, which are resolved at compile time.
+  // The sample elementary functions are tuned for the default format.
+  template<typename integer_type,
+           const std::size_t fractional_digits,
+           typename rounding_policy,
+           typename overflow_policy>
   class fixed_point
   {
   public:
@@ -44,24 +356,34 @@
     typedef typename util::utype_helper<std::numeric_limits<signed_value_type>::digits + 1>::exact_type unsigned_value_type;
 
   private:
-    typedef typename util::utype_helper<std::numeric_limits<unsigned_value_type>::digits / 2>::exact_type unsigned_short_type;
+    typedef fixed_point_detail::arithmetic<signed_value_type, fractional_digits, rounding_policy, overflow_policy> arithmetic_type;
 
-    static const std::size_t         decimal_split       = std::numeric_limits<unsigned_value_type>::digits / 2;
-    static const signed_value_type   decimal_split_value = unsigned_value_type(1ULL) << decimal_split;
-    static const unsigned_short_type decimal_split_mask  = unsigned_value_type(decimal_split_value) - 1U;
+    static const std::size_t       decimal_split       = fractional_digits;
+    static const signed_value_type decimal_split_value = unsigned_value_type(1ULL) << decimal_split;
 
     // Ensure that the underlying integer type of the fixed_point class is signed.
     static_assert(std::numeric_limits<signed_value_type>::is_signed == true,
                   "the fixed point signed_value_type must be signed");
 
+    // Ensure that there is at least one integer bit and one fractional bit.
+    // The built-in constants have 32 fractional bits.
+    static_assert(   (decimal_split >= 1U)
+                  && (decimal_split <  std::size_t(std::numeric_limits<signed_value_type>::digits))
+                  && (decimal_split <= 32U),
+                  "the fixed point fractional_digits must be 1...(digits - 1) and at most 32");
+
     // Another template kind of this class itself is a friend.
     // This is needed for the copy ctor and operator=().
-    template<typename other_signed_type>
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy>
     friend class fixed_point;
 
     // Forward-declare my_numeric_limits and make it a friend of fixed_point.
     friend class my_numeric_limits;
 
+    // The array kernels and CORDIC functions work directly on the data representation.
+    template<typename fixed_point_type>
+    friend struct fixed_point_access;
+
   public:
     // Constructors.
     fixed_point() : data() { }
@@ -79,10 +401,10 @@
     fixed_point(const long double& l)   : data(signed_value_type(l * decimal_split_value)) { }
     fixed_point(const fixed_point& fp)  : data(fp.data) { }
 
-    template<typename other_signed_type>
-    fixed_point(const fixed_point<other_signed_type>& other)
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy>
+    fixed_point(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& other)
     {
-      const std::size_t other_decimal_split = fixed_point<other_signed_type>::decimal_split;
+      const std::size_t other_decimal_split = other_fractional_digits;
 
       // TBD: Needs compiler support for conditional compilation.
       if(other_decimal_split > decimal_split)
@@ -117,12 +439,12 @@
       return *this;
     }
 
-    template<typename other_signed_type>
-    fixed_point& operator=(const fixed_point<other_signed_type>& other)
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy>
+    fixed_point& operator=(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& other)
     {
       // TBD: Needs compiler support for conditional compilation.
-      const std::size_t other_decimal_split = fixed_point<other_signed_type>::decimal_split;
-      const bool other_has_more_digits = (fixed_point<other_signed_type>::decimal_split > decimal_split);
+      const std::size_t other_decimal_split = other_fractional_digits;
+      const bool other_has_more_digits = (other_decimal_split > decimal_split);
 
       data = (other_has_more_digits ? signed_value_type(other.data >> (other_decimal_split - decimal_split))
                                     : signed_value_type(other.data << (decimal_split - other_decimal_split)));
@@ -136,114 +458,24 @@
     fixed_point& operator++() { data += decimal_split_value; return *this; }
     fixed_point& operator--() { data -= decimal_split_value; return *this; }
 
-    fixed_point& operator+=(const fixed_point& v) { data += v.data; return *this; }
-    fixed_point& operator-=(const fixed_point& v) { data -= v.data; return *this; }
+    fixed_point& operator+=(const fixed_point& v) { data = arithmetic_type::add(data, v.data); return *this; }
+    fixed_point& operator-=(const fixed_point& v) { data = arithmetic_type::sub(data, v.data); return *this; }
 
     fixed_point& operator*=(const fixed_point& v)
     {
-      const bool self_is_neg  = (  data < static_cast<signed_value_type>(0));
-      const bool other_is_neg = (v.data < static_cast<signed_value_type>(0));
-
-      const unsigned_value_type u_self  = unsigned_value_type((!self_is_neg)  ?   data :   -data);
-      const unsigned_value_type v_other = unsigned_value_type((!other_is_neg) ? v.data : -v.data);
-
-      // TBD: Needs compiler support for conditional compilation.
-      if(std::numeric_limits<unsigned_value_type>::digits <= 16)
-      {
-        typedef typename util::utype_helper<std::numeric_limits<unsigned_value_type>::digits * 2>::exact_type unsigned_long_long_type;
-
-        const unsigned_long_long_type result = (static_cast<unsigned_long_long_type>(u_self) * v_other) >> decimal_split;
-
-        data = static_cast<signed_value_type>(result);
-      }
-      else
-      {
-        const unsigned_short_type self_upper = static_cast<unsigned_short_type>(u_self >> decimal_split);
-        const unsigned_short_type self_lower = static_cast<unsigned_short_type>(u_self) & decimal_split_mask;
-
-        const unsigned_short_type other_upper = static_cast<unsigned_short_type>(v_other >> decimal_split);
-        const unsigned_short_type other_lower = static_cast<unsigned_short_type>(v_other) & decimal_split_mask;
-
-        const unsigned_value_type lower_self_upper_other = static_cast<unsigned_value_type>(self_lower) * other_upper;
-        const unsigned_short_type lower_self_lower_other = static_cast<unsigned_short_type>(static_cast<unsigned_value_type>(static_cast<unsigned_value_type>(self_lower) * other_lower) >> decimal_split);
-
-        data =
-          signed_value_type(  static_cast<unsigned_value_type>(static_cast<unsigned_value_type>(self_upper * v_other))
-                            + static_cast<unsigned_value_type>(lower_self_upper_other + lower_self_lower_other));
-      }
-
-      if(self_is_neg != other_is_neg)
-      {
-        negate();
-      }
+      data = arithmetic_type::mul(data, v.data);
 
       return *this;
     }
 
     fixed_point& operator/=(const fixed_point& v)
     {
-      // TBD: Investigate other division algorithms.
-
       if(v.data == static_cast<signed_value_type>(0))
       {
         return (*this = value_max());
       }
 
-      const bool a_is_neg = (  data < static_cast<signed_value_type>(0));
-      const bool b_is_neg = (v.data < static_cast<signed_value_type>(0));
-
-      unsigned_value_type a = unsigned_value_type((!a_is_neg) ?   data :   -data);
-      unsigned_value_type b = unsigned_value_type((!b_is_neg) ? v.data : -v.data);
-
-      const bool a_is_larger = (a > b);
-
-      unsigned_value_type temp  = b;
-      std::uint_least8_t  shift = decimal_split;
-
-      if(a_is_larger)
-      {
-        const unsigned_value_type half_a = a >> 1U;
-
-        while(temp < half_a)
-        {
-          temp <<= 1u;
-          ++shift;
-        }
-      }
-
-      unsigned_value_type d = static_cast<unsigned_value_type>(1U) << shift;
-
-      data = static_cast<signed_value_type>(0U);
-
-      if(a_is_larger)
-      {
-        a    -= temp;
-        data += static_cast<signed_value_type>(d);
-      }
-
-      while(   (a     != static_cast<unsigned_value_type>(0U))
-            && (temp  != static_cast<unsigned_value_type>(0U))
-            && (shift != static_cast<std::uint_least8_t>(0U))
-           )
-      {
-        std::uint_least8_t right_shift = static_cast<std::uint_least8_t>(0U);
-
-        while((right_shift < shift) && (temp > a))
-        {
-          temp >>= 1u;
-          ++right_shift;
-        }
-
-        d    >>= right_shift;
-        shift -= right_shift;
-        a     -= temp;
-        data  += static_cast<signed_value_type>(d);
-      }
-
-      if(a_is_neg != b_is_neg)
-      {
-        data = -data;
-      }
+      data = arithmetic_type::div(data, v.data);
 
       return *this;
     }
@@ -374,8 +606,8 @@
       return ((data > other.data) ? 1 : ((data < other.data) ? -1 : 0));
     }
 
-    template<typename other_signed_type>
-    std::int_least8_t cmp(const fixed_point<other_signed_type>& other) const
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy>
+    std::int_least8_t cmp(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& other) const
     {
       const fixed_point other_in_my_format(other);
       return ((data > other_in_my_format.data) ? 1 : ((data < other_in_my_format.data) ? -1 : 0));
@@ -390,8 +622,8 @@
     friend inline fixed_point operator-(const fixed_point& self) { fixed_point tmp(self); tmp.data = -tmp.data; return tmp; }
 
     // Global add/sub/mul/div of const fixed_point reference with another.
-    friend inline fixed_point operator+(const fixed_point& a, const fixed_point& b) { return fixed_point(internal(), a.data + b.data); }
-    friend inline fixed_point operator-(const fixed_point& a, const fixed_point& b) { return fixed_point(internal(), a.data - b.data); }
+    friend inline fixed_point operator+(const fixed_point& a, const fixed_point& b) { return fixed_point(a) += b; }
+    friend inline fixed_point operator-(const fixed_point& a, const fixed_point& b) { return fixed_point(a) -= b; }
     friend inline fixed_point operator*(const fixed_point& a, const fixed_point& b) { return fixed_point(a) *= b; }
     friend inline fixed_point operator/(const fixed_point& a, const fixed_point& b) { return fixed_point(a) /= b; }
 
@@ -521,12 +753,12 @@
     template<typename other_type> friend inline bool operator>=(const fixed_point& a, const other_type n) { return (a.cmp(n) >= std::int_least8_t(0)); }
     template<typename other_type> friend inline bool operator> (const fixed_point& a, const other_type n) { return (a.cmp(n) >  std::int_least8_t(0)); }
 
-    template<typename other_signed_type> friend inline bool operator< (const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) <  std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator<=(const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) <= std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator==(const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) == std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator!=(const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) != std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator>=(const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) >= std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator> (const fixed_point& a, const fixed_point<other_signed_type>& b) { return (a.cmp(b) >  std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator< (const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) <  std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator<=(const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) <= std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator==(const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) == std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator!=(const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) != std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator>=(const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) >= std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator> (const fixed_point& a, const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b) { return (a.cmp(b) >  std::int_least8_t(0)); }
 
     // Global comparison operators of another with fixed_point.
     template<typename other_type> friend inline bool operator< (const other_type n, const fixed_point& a) { return (std::int_least8_t(-a.cmp(n)) <  std::int_least8_t(0)); }
@@ -536,12 +768,12 @@
     template<typename other_type> friend inline bool operator>=(const other_type n, const fixed_point& a) { return (std::int_least8_t(-a.cmp(n)) >= std::int_least8_t(0)); }
     template<typename other_type> friend inline bool operator> (const other_type n, const fixed_point& a) { return (std::int_least8_t(-a.cmp(n)) >  std::int_least8_t(0)); }
 
-    template<typename other_signed_type> friend inline bool operator< (const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) <  std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator<=(const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) <= std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator==(const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) == std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator!=(const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) != std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator>=(const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) >= std::int_least8_t(0)); }
-    template<typename other_signed_type> friend inline bool operator> (const fixed_point<other_signed_type>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) >  std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator< (const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) <  std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator<=(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) <= std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator==(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) == std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator!=(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) != std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator>=(const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) >= std::int_least8_t(0)); }
+    template<typename other_signed_type, const std::size_t other_fractional_digits, typename other_rounding_policy, typename other_overflow_policy> friend inline bool operator> (const fixed_point<other_signed_type, other_fractional_digits, other_rounding_policy, other_overflow_policy>& b, const fixed_point& a) { return (std::int_least8_t(-a.cmp(b)) >  std::int_least8_t(0)); }
 
     // Include a few global sample fixed_point functions.
     friend inline fixed_point fabs(const fixed_point& x)
@@ -889,7 +1121,7 @@
       static const bool is_modulo         = false;
       static const bool traps             = false;
       static const bool tinyness_before   = false;
-      static const std::float_round_style round_style = std::round_toward_zero;
+      static const std::float_round_style round_style = rounding_policy::round_style;
 
       static fixed_point (min)      () throw() { return fixed_point::value_min(); }
       static fixed_point (max)      () throw() { return fixed_point::value_max(); }
@@ -948,13 +1180,30 @@
 
   namespace std
   {
-    // Make numeric_limits specializations for the fixed_point types.
-    template<> class numeric_limits<fixed_point_3pt4> : public fixed_point_3pt4::my_numeric_limits { };
-    template<> class numeric_limits<fixed_point_7pt8> : public fixed_point_7pt8::my_numeric_limits { };
-    template<> class numeric_limits<fixed_point_15pt16> : public fixed_point_15pt16::my_numeric_limits { };
-    template<> class numeric_limits<fixed_point_31pt32> : public fixed_point_31pt32::my_numeric_limits { };
+    // Make the numeric_limits specialization for the fixed_point types.
+    template<typename integer_type, const std::size_t fractional_digits, typename rounding_policy, typename overflow_policy>
+    class numeric_limits<fixed_point<integer_type, fractional_digits, rounding_policy, overflow_policy>>
+      : public fixed_point<integer_type, fractional_digits, rounding_policy, overflow_policy>::my_numeric_limits { };
   }
 
+  // The access to the internal data representation of fixed_point.
+  template<typename integer_type, const std::size_t fractional_digits, typename rounding_policy, typename overflow_policy>
+  struct fixed_point_access<fixed_point<integer_type, fractional_digits, rounding_policy, overflow_policy>>
+  {
+    typedef fixed_point<integer_type, fractional_digits, rounding_policy, overflow_policy> fixed_point_type;
+
+    static_assert(   (sizeof(fixed_point_type) == sizeof(integer_type))
+                  && (std::is_standard_layout<fixed_point_type>::value == true),
+                  "the fixed_point type must have the layout of its integer type");
+
+    static const std::size_t decimal_split = fixed_point_type::decimal_split;
+
+    static const integer_type* data(const fixed_point_type* p) { return reinterpret_cast<const integer_type*>(p); }
+    static       integer_type* data(      fixed_point_type* p) { return reinterpret_cast<      integer_type*>(p); }
+
+    static fixed_point_type make(const integer_type n) { return fixed_point_type(typename fixed_point_type::internal(), n); }
+  };
+
   // Include a few more global sample fixed_point functions.
   template<typename fixed_point_type>
   inline fixed_point_type sqrt(const fixed_point_type& x) { return fixed_point_type(x).calculate_sqrt(); }
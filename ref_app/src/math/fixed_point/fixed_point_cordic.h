@@ -0,0 +1,477 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef FIXED_POINT_CORDIC_2026_10_18_H_
+  #define FIXED_POINT_CORDIC_2026_10_18_H_
+
+  // Elementary functions of fixed_point using only integer shifts,
+  // additions and small tables of constants, intended for
+  // microcontrollers that lack a floating-point unit.
+
+  // The functions sin, cos and sincos use circular CORDIC in rotation
+  // mode, and atan2 uses circular CORDIC in vectoring mode. The functions
+  // exp and log use the related shift-and-add algorithm with the table
+  // of ln(1 + 2^-i). The functions sqrt and hypot compute the exact
+  // integer square root of the (scaled) data representation, digit by digit.
+
+  // The calculations are done in 32-bit signed integers with 29 binary
+  // digits after the point (Q2.29) or in 32-bit unsigned integers with
+  // 31 binary digits after the point (Q1.31). Argument reduction uses
+  // 64-bit integers. The number of iterations is decimal_split + 3,
+  // which is the same for every argument. So the run time does not
+  // depend on the argument.
+
+  // The error bounds of the results, in units of the last place (ulp,
+  // being 2^-decimal_split) of the respective format, are:
+  //   sin, cos, sincos, atan2 : <= 1 ulp.
+  //   sqrt, hypot             : <= 0.5 ulp (the results are correctly rounded).
+  //   log                     : <= 1 ulp.
+  //   exp                     : <= 1 ulp + (2^-28 * result).
+  // The relative part of the error bound of exp only exceeds 1 ulp for
+  // results above 2^(28 - decimal_split), i.e., above 4096 in 15.16.
+  // Results out of range saturate, and log of arguments <= 0 gives the
+  // lowest value of the format. The formats 3.4, 7.8 and 15.16 are
+  // supported.
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+
+  #include <math/fixed_point/fixed_point.h>
+  #include <util/utility/util_utype_helper.h>
+
+  namespace fixed_point_cordic
+  {
+    namespace detail
+    {
+      // The tables hold atan(2^-i) in Q2.29 and ln(1 + 2^-i) in Q1.31.
+      // The entries for i = 0 are pi/4 and ln(2), respectively.
+      constexpr std::uint_fast8_t table_size = 20U;
+
+      inline std::int32_t atan_table(const std::uint_fast8_t i)
+      {
+        static const std::int32_t table[table_size] =
+        {
+          INT32_C(421657428), INT32_C(248918915), INT32_C(131521918), INT32_C(66762579),
+          INT32_C( 33510843), INT32_C( 16771758), INT32_C(  8387925), INT32_C( 4194219),
+          INT32_C(  2097141), INT32_C(  1048575), INT32_C(   524288), INT32_C(  262144),
+          INT32_C(   131072), INT32_C(    65536), INT32_C(    32768), INT32_C(   16384),
+          INT32_C(     8192), INT32_C(     4096), INT32_C(     2048), INT32_C(    1024)
+        };
+
+        return table[i];
+      }
+
+      inline std::uint32_t ln1p_table(const std::uint_fast8_t i)
+      {
+        static const std::uint32_t table[table_size] =
+        {
+          UINT32_C(1488522236), UINT32_C(870729689), UINT32_C(479197128), UINT32_C(252937143),
+          UINT32_C( 130190384), UINT32_C( 66081634), UINT32_C( 33294987), UINT32_C( 16712019),
+          UINT32_C(   8372267), UINT32_C(  4190213), UINT32_C(  2096129), UINT32_C(  1048320),
+          UINT32_C(    524224), UINT32_C(   262128), UINT32_C(   131068), UINT32_C(    65535),
+          UINT32_C(     32768), UINT32_C(    16384), UINT32_C(     8192), UINT32_C(     4096)
+        };
+
+        return table[i];
+      }
+
+      // The inverse of the CORDIC gain, 0.60725293... in Q2.29.
+      constexpr std::int32_t cordic_inverse_gain = INT32_C(326016437);
+
+      constexpr std::int32_t pi_q29  = INT32_C(1686629713);
+      constexpr std::int64_t pi_half_q45 = INT64_C(55267482437722);
+      constexpr std::int64_t ln2_q45 = INT64_C(24387948313146);
+
+      // 2/pi in Q0.32 and 1/ln(2) in Q1.31.
+      constexpr std::int64_t two_over_pi_q32 = INT64_C(2734261102);
+      constexpr std::int64_t one_over_ln2_q31 = INT64_C(3098164009);
+
+      template<typename integer_type>
+      struct format_traits
+      {
+        typedef fixed_point_access<fixed_point<integer_type>> access_type;
+
+        static const std::size_t decimal_split = access_type::decimal_split;
+
+        static const std::uint_fast8_t iterations = std::uint_fast8_t(decimal_split + 3U);
+
+        static_assert(iterations <= table_size,
+                      "the CORDIC functions support the formats up to 15.16");
+      };
+
+      template<typename integer_type, typename other_type>
+      inline integer_type saturate(const other_type x)
+      {
+        const other_type lo = other_type((std::numeric_limits<integer_type>::min)());
+        const other_type hi = other_type((std::numeric_limits<integer_type>::max)());
+
+        return integer_type((x < lo) ? lo : ((x > hi) ? hi : x));
+      }
+
+      template<const std::size_t decimal_split>
+      inline std::int64_t round_from_q29(const std::int64_t x)
+      {
+        // Round x in Q2.29 to the nearest value with decimal_split
+        // binary digits after the point.
+        const std::size_t shift = std::size_t(29U - decimal_split);
+
+        return std::int64_t(x + (INT64_C(1) << (shift - 1U))) >> shift;
+      }
+
+      template<typename integer_type>
+      inline void sincos_q29(const integer_type x, std::int32_t& s, std::int32_t& c)
+      {
+        typedef format_traits<integer_type> traits_type;
+
+        // Reduce the argument to r = x - k(pi/2), with |r| <= pi/4
+        // (roughly). The argument x, having at most 15 binary digits
+        // before the point, is scaled to Q45, which fits in 64 bits.
+        const std::int64_t x_q45 = std::int64_t(x) * (INT64_C(1) << (45U - traits_type::decimal_split));
+
+        const std::int64_t k =
+          std::int64_t(std::int64_t(x) * two_over_pi_q32 + (INT64_C(1) << (traits_type::decimal_split + 31U))) >> (traits_type::decimal_split + 32U);
+
+        std::int32_t z = std::int32_t(std::int64_t(std::int64_t(x_q45 - (k * pi_half_q45)) + (INT64_C(1) << 15U)) >> 16U);
+
+        // Rotate the vector (1/gain, 0) by the angle z.
+        std::int32_t xc = cordic_inverse_gain;
+        std::int32_t yc = INT32_C(0);
+
+        // The direction of each micro-rotation is the sign of z. It is
+        // applied with the mask d (0 or -1) using (v ^ d) - d = +-v,
+        // which avoids branching on the data.
+        for(std::uint_fast8_t i = 0U; i < traits_type::iterations; ++i)
+        {
+          const std::int32_t d  = std::int32_t(z >> 31U);
+          const std::int32_t dx = std::int32_t(yc >> i);
+          const std::int32_t dy = std::int32_t(xc >> i);
+
+          xc -= std::int32_t((dx ^ d) - d);
+          yc += std::int32_t((dy ^ d) - d);
+          z  -= std::int32_t((atan_table(i) ^ d) - d);
+        }
+
+        // Account for the quadrant of the argument.
+        switch(std::uint_fast8_t(std::uint64_t(k) & 3U))
+        {
+          case 1U:  s =  xc; c = -yc; break;
+          case 2U:  s = -yc; c = -xc; break;
+          case 3U:  s = -xc; c =  yc; break;
+          default:  s =  yc; c =  xc; break;
+        }
+      }
+
+      template<typename integer_type>
+      inline std::int32_t vectoring_q29(const integer_type y, const integer_type x)
+      {
+        typedef format_traits<integer_type> traits_type;
+
+        // Rotate the vector (x, y) onto the positive x-axis,
+        // giving the angle in Q2.29.
+        if((x == integer_type(0)) && (y == integer_type(0)))
+        {
+          return INT32_C(0);
+        }
+
+        // Scale the vector such that the larger of |x| and |y| lies
+        // in [2^27, 2^28). The growth due to the CORDIC gain (1.6467...)
+        // and the rotation keeps the values within 2^30.
+        std::int64_t xv = std::int64_t(x);
+        std::int64_t yv = std::int64_t(y);
+
+        const std::uint64_t ux = std::uint64_t((xv < 0) ? -xv : xv);
+        const std::uint64_t uy = std::uint64_t((yv < 0) ? -yv : yv);
+
+        std::uint64_t m = ((ux > uy) ? ux : uy);
+
+        int shift = 0;
+
+        while(m < UINT64_C(0x8000000))  { m <<= 1U; ++shift; }
+        while(m > UINT64_C(0xFFFFFFF))  { m >>= 1U; --shift; }
+
+        if(shift >= 0)
+        {
+          xv *= (INT64_C(1) << shift);
+          yv *= (INT64_C(1) << shift);
+        }
+        else
+        {
+          xv >>= -shift;
+          yv >>= -shift;
+        }
+
+        // Rotate the vectors in the left half-plane by pi.
+        std::int32_t z = INT32_C(0);
+
+        if(xv < 0)
+        {
+          z  = ((yv >= 0) ? pi_q29 : -pi_q29);
+          xv = -xv;
+          yv = -yv;
+        }
+
+        std::int32_t xc = std::int32_t(xv);
+        std::int32_t yc = std::int32_t(yv);
+
+        // The direction of each micro-rotation is the sign of y,
+        // applied with a mask as in sincos_q29.
+        for(std::uint_fast8_t i = 0U; i < traits_type::iterations; ++i)
+        {
+          const std::int32_t d  = std::int32_t(yc >> 31U);
+          const std::int32_t dx = std::int32_t(yc >> i);
+          const std::int32_t dy = std::int32_t(xc >> i);
+
+          xc += std::int32_t((dx ^ d) - d);
+          yc -= std::int32_t((dy ^ d) - d);
+          z  += std::int32_t((atan_table(i) ^ d) - d);
+        }
+
+        return z;
+      }
+
+      template<const unsigned digits, typename unsigned_type>
+      inline unsigned_type square_root(unsigned_type remainder)
+      {
+        // Compute the square root of an integer having at most digits
+        // binary digits, rounded to nearest. The digits of the root are
+        // found from the most significant one downward.
+        unsigned_type root = unsigned_type(0U);
+        unsigned_type bit  = unsigned_type(unsigned_type(1U) << (((digits - 1U) / 2U) * 2U));
+
+        while(bit != unsigned_type(0U))
+        {
+          const unsigned_type trial = unsigned_type(root + bit);
+
+          // The mask is all ones if the trial value fits in the remainder.
+          const unsigned_type mask = unsigned_type(unsigned_type(0U) - unsigned_type((remainder >= trial) ? 1U : 0U));
+
+          remainder = unsigned_type(remainder - unsigned_type(trial & mask));
+          root      = unsigned_type(unsigned_type(root >> 1U) + unsigned_type(bit & mask));
+
+          bit = unsigned_type(bit >> 2U);
+        }
+
+        // The remainder is now n - root^2, and the root rounds
+        // upward if n >= (root + 1/2)^2 = root^2 + root + 1/4.
+        if(remainder > root)
+        {
+          ++root;
+        }
+
+        return root;
+      }
+    }
+
+    template<typename integer_type>
+    void sincos(const fixed_point<integer_type>& x,
+                      fixed_point<integer_type>& s,
+                      fixed_point<integer_type>& c)
+    {
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      std::int32_t s_q29;
+      std::int32_t c_q29;
+
+      detail::sincos_q29(*access_type::data(&x), s_q29, c_q29);
+
+      s = access_type::make(integer_type(detail::round_from_q29<traits_type::decimal_split>(s_q29)));
+      c = access_type::make(integer_type(detail::round_from_q29<traits_type::decimal_split>(c_q29)));
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> sin(const fixed_point<integer_type>& x)
+    {
+      fixed_point<integer_type> s;
+      fixed_point<integer_type> c;
+
+      sincos(x, s, c);
+
+      return s;
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> cos(const fixed_point<integer_type>& x)
+    {
+      fixed_point<integer_type> s;
+      fixed_point<integer_type> c;
+
+      sincos(x, s, c);
+
+      return c;
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> atan2(const fixed_point<integer_type>& y,
+                                    const fixed_point<integer_type>& x)
+    {
+      // The result is in the range [-pi, pi], and atan2(0, 0) is 0.
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      const std::int32_t z = detail::vectoring_q29(*access_type::data(&y), *access_type::data(&x));
+
+      return access_type::make(integer_type(detail::round_from_q29<traits_type::decimal_split>(z)));
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> hypot(const fixed_point<integer_type>& x,
+                                    const fixed_point<integer_type>& y)
+    {
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      // Compute the square root of the sum of the squares of the data
+      // representations, which gives the result in the format of x and y.
+      static const unsigned wide_digits = unsigned(std::numeric_limits<integer_type>::digits * 2 + 1);
+
+      typedef typename util::utype_helper<wide_digits>::exact_type unsigned_wide_type;
+
+      const std::int64_t a = std::int64_t(*access_type::data(&x));
+      const std::int64_t b = std::int64_t(*access_type::data(&y));
+
+      const unsigned_wide_type ua = unsigned_wide_type((a < 0) ? -a : a);
+      const unsigned_wide_type ub = unsigned_wide_type((b < 0) ? -b : b);
+
+      const unsigned_wide_type root =
+        detail::square_root<wide_digits>(unsigned_wide_type(unsigned_wide_type(ua * ua) + unsigned_wide_type(ub * ub)));
+
+      return access_type::make(detail::saturate<integer_type>(std::int64_t(root)));
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> sqrt(const fixed_point<integer_type>& x)
+    {
+      // Compute the square root of the data representation scaled
+      // by 2^decimal_split, which gives the result in the format of x.
+      // Negative arguments give zero.
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      static const unsigned wide_digits =
+        unsigned(std::numeric_limits<integer_type>::digits + traits_type::decimal_split);
+
+      typedef typename util::utype_helper<wide_digits>::exact_type unsigned_wide_type;
+
+      const integer_type n = *access_type::data(&x);
+
+      if(n <= integer_type(0))
+      {
+        return access_type::make(integer_type(0));
+      }
+
+      const unsigned_wide_type root =
+        detail::square_root<wide_digits>(unsigned_wide_type(unsigned_wide_type(n) << traits_type::decimal_split));
+
+      return access_type::make(integer_type(root));
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> exp(const fixed_point<integer_type>& x)
+    {
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      const integer_type n = *access_type::data(&x);
+
+      // Reduce the argument to r = x - k ln(2), with 0 <= r < ln(2).
+      const std::int64_t x_q45 = std::int64_t(n) * (INT64_C(1) << (45U - traits_type::decimal_split));
+
+      std::int64_t k = std::int64_t(std::int64_t(n) * detail::one_over_ln2_q31) >> (traits_type::decimal_split + 31U);
+      std::int64_t r = std::int64_t(x_q45 - (k * detail::ln2_q45));
+
+      if(r < 0)                 { --k; r += detail::ln2_q45; }
+      if(r >= detail::ln2_q45)  { ++k; r -= detail::ln2_q45; }
+
+      // Compute e^r in Q1.31 by multiplying with those factors (1 + 2^-i)
+      // whose logarithms fit in the remaining part z of the argument.
+      std::uint32_t z = std::uint32_t(r >> 14U);
+      std::uint32_t y = UINT32_C(0x80000000);
+
+      for(std::uint_fast8_t i = 1U; i <= traits_type::iterations; ++i)
+      {
+        const std::uint32_t mask = std::uint32_t(UINT32_C(0) - std::uint32_t((z >= detail::ln1p_table(i)) ? 1U : 0U));
+
+        z -= std::uint32_t(detail::ln1p_table(i) & mask);
+        y += std::uint32_t(std::uint32_t(y >> i) & mask);
+      }
+
+      // Use e^z = 1 + z for the remaining part of the argument.
+      y += std::uint32_t((std::uint64_t(y) * z) >> 31U);
+
+      // Scale the result by 2^k.
+      const std::int64_t shift = std::int64_t(std::int64_t(31 - int(traits_type::decimal_split)) - k);
+
+      if(shift <= 0)
+      {
+        return access_type::make(((-shift) > std::int64_t(std::numeric_limits<integer_type>::digits))
+                                   ? (std::numeric_limits<integer_type>::max)()
+                                   : detail::saturate<integer_type>(std::int64_t(std::uint64_t(y) << (-shift))));
+      }
+      else if(shift > 32)
+      {
+        return access_type::make(integer_type(0));
+      }
+      else
+      {
+        const std::uint64_t result = std::uint64_t(std::uint64_t(y) + (UINT64_C(1) << (shift - 1))) >> shift;
+
+        return access_type::make(detail::saturate<integer_type>(std::int64_t(result)));
+      }
+    }
+
+    template<typename integer_type>
+    fixed_point<integer_type> log(const fixed_point<integer_type>& x)
+    {
+      typedef detail::format_traits<integer_type> traits_type;
+      typedef typename traits_type::access_type   access_type;
+
+      const integer_type n = *access_type::data(&x);
+
+      if(n <= integer_type(0))
+      {
+        return access_type::make((std::numeric_limits<integer_type>::min)());
+      }
+
+      // Split x = 2^e * m, with the mantissa 1 <= m < 2 in Q1.30.
+      std::uint32_t y = std::uint32_t(n);
+
+      int e = 30;
+
+      while(y < UINT32_C(0x40000000)) { y <<= 1U; --e; }
+
+      e -= int(traits_type::decimal_split);
+
+      // Multiply m with those factors (1 + 2^-i) for which the product
+      // remains below 2, accumulating the logarithms of the factors.
+      // Then ln(m) = ln(2) - (the accumulated logarithms) - ln(2 / y).
+      std::uint32_t sum = UINT32_C(0);
+
+      for(std::uint_fast8_t i = 1U; i <= traits_type::iterations; ++i)
+      {
+        const std::uint32_t step = std::uint32_t(y >> i);
+
+        const std::uint32_t mask = std::uint32_t(UINT32_C(0) - std::uint32_t((std::uint32_t(y + step) < UINT32_C(0x80000000)) ? 1U : 0U));
+
+        y   += std::uint32_t(step & mask);
+        sum += std::uint32_t(detail::ln1p_table(i) & mask);
+      }
+
+      // Use ln(2 / y) = (2 - y) / 2 for the remaining part of y,
+      // which is (2 - y) in Q1.30 or, equivalently, (2 - y) / 2 in Q1.31.
+      const std::int64_t ln_m = std::int64_t(std::int64_t(detail::ln1p_table(0U)) - sum) - std::int64_t(UINT32_C(0x80000000) - y);
+
+      const std::int64_t result =
+        std::int64_t(std::int64_t(std::int64_t(e) * std::int64_t(detail::ln1p_table(0U))) + ln_m)
+          + (INT64_C(1) << (30U - traits_type::decimal_split));
+
+      return access_type::make(detail::saturate<integer_type>(std::int64_t(result >> (31U - traits_type::decimal_split))));
+    }
+  }
+
+#endif // FIXED_POINT_CORDIC_2026_10_18_H_
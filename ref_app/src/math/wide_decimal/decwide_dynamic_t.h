@@ -0,0 +1,1546 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef DECWIDE_DYNAMIC_T_2026_10_18_H_
+  #define DECWIDE_DYNAMIC_T_2026_10_18_H_
+
+  #include <algorithm>
+  #include <cmath>
+  #include <cstdint>
+  #include <limits>
+  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  #include <ostream>
+  #endif
+  #include <memory>
+  #include <string>
+  #include <type_traits>
+  #include <vector>
+
+  #include <math/wide_decimal/decwide_t.h>
+  #include <math/wide_decimal/decwide_t_detail_dynamic_integer.h>
+  #include <util/memory/util_pool_allocator.h>
+
+  // decwide_dynamic_t is a wide decimal floating-point type whose
+  // precision is set at run-time (per value) instead of at compile-time.
+  // A single instantiation (per limb type) serves any number of
+  // precisions, and the limbs of each value take only the room
+  // needed for its precision.
+
+  // The limbs are obtained from AllocatorType, which is by default
+  // the pool allocator. In this way, the many temporaries of sqrt,
+  // the inverse, exp and log reuse the same few blocks of memory,
+  // instead of reaching the system allocator. The pool allocator
+  // is not thread-safe. When values are used in several threads,
+  // use std::allocator<void> (or another thread-safe allocator).
+
+  // The result of an arithmetic operation has the precision of
+  // its left operand (or of the decwide_dynamic_t operand for mixed
+  // arithmetic with built-in types). Copying, assignment included,
+  // takes over the precision of the source.
+
+  // The limb representation (base 10^8, 10^4 or 10^2 with the most
+  // significant limb first and an exponent normed to limb granularity)
+  // is the one of decwide_t, and values can be converted from and
+  // to decwide_t having the same limb type by simply copying limbs.
+
+  namespace math { namespace wide_decimal {
+
+  template<typename LimbType = std::uint32_t,
+           typename AllocatorType = util::pool_allocator<void>>
+  class decwide_dynamic_t
+  {
+  private:
+    using integer_type = detail::dynamic_integer<LimbType, AllocatorType>;
+
+  public:
+    using limb_type     = LimbType;
+    using exponent_type = std::int64_t;
+
+    static constexpr std::int32_t  decwide_t_elem_digits10 = static_cast<std::int32_t>(integer_type::limb_digits10);
+    static constexpr std::uint32_t decwide_t_elem_mask     = integer_type::limb_radix;
+
+    typedef enum fpclass_type
+    {
+      decwide_t_finite,
+      decwide_t_inf,
+      decwide_t_NaN
+    }
+    fpclass_type;
+
+    // The precision of the values that are created
+    // without an explicitly given precision.
+    static std::int32_t default_digits10() { return default_digits10_value(); }
+
+    static void set_default_digits10(const std::int32_t prec_digits10)
+    {
+      default_digits10_value() = (std::max)(prec_digits10, static_cast<std::int32_t>(1));
+    }
+
+    // The number of limbs of a value with the given precision. As in
+    // decwide_t, guard limbs are added for about 24 decimal digits.
+    static std::uint32_t elem_number(const std::int32_t prec_digits10)
+    {
+      const std::int32_t d = (std::max)(prec_digits10, static_cast<std::int32_t>(1));
+
+      return static_cast<std::uint32_t>(  ((d / decwide_t_elem_digits10) + (((d % decwide_t_elem_digits10) != 0) ? 1 : 0))
+                                        + (24 / decwide_t_elem_digits10));
+    }
+
+    // Default constructor (zero at the default precision).
+    decwide_dynamic_t() : my_data    (elem_number(default_digits10())),
+                          my_exp     (static_cast<exponent_type>(0)),
+                          my_neg     (false),
+                          my_fpclass (decwide_t_finite),
+                          my_digits10(default_digits10()) { }
+
+    // Constructors from built-in unsigned integral types.
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   (std::is_integral<UnsignedIntegralType>::value == true)
+                                      && (std::is_unsigned<UnsignedIntegralType>::value == true))>::type const* = nullptr>
+    decwide_dynamic_t(const UnsignedIntegralType u,
+                      const std::int32_t prec_digits10 = default_digits10())
+      : my_data    (elem_number(prec_digits10)),
+        my_exp     (static_cast<exponent_type>(0)),
+        my_neg     (false),
+        my_fpclass (decwide_t_finite),
+        my_digits10((std::max)(prec_digits10, static_cast<std::int32_t>(1)))
+    {
+      from_unsigned_long_long(static_cast<unsigned long long>(u));
+    }
+
+    // Constructors from built-in signed integral types.
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   (std::is_integral<SignedIntegralType>::value == true)
+                                      && (std::is_signed  <SignedIntegralType>::value == true))>::type const* = nullptr>
+    decwide_dynamic_t(const SignedIntegralType n,
+                      const std::int32_t prec_digits10 = default_digits10())
+      : my_data    (elem_number(prec_digits10)),
+        my_exp     (static_cast<exponent_type>(0)),
+        my_neg     (false),
+        my_fpclass (decwide_t_finite),
+        my_digits10((std::max)(prec_digits10, static_cast<std::int32_t>(1)))
+    {
+      const bool n_is_neg = (n < static_cast<SignedIntegralType>(0));
+
+      const unsigned long long u =
+        ((!n_is_neg) ? static_cast<unsigned long long>(n)
+                     : static_cast<unsigned long long>(-static_cast<signed long long>(n)));
+
+      from_unsigned_long_long(u);
+
+      my_neg = (n_is_neg && (iszero() == false));
+    }
+
+    // Constructors from built-in floating-point types.
+    template<typename FloatingPointType,
+             typename std::enable_if<std::is_floating_point<FloatingPointType>::value == true>::type const* = nullptr>
+    decwide_dynamic_t(const FloatingPointType f,
+                      const std::int32_t prec_digits10 = default_digits10())
+      : my_data    (elem_number(prec_digits10)),
+        my_exp     (static_cast<exponent_type>(0)),
+        my_neg     (false),
+        my_fpclass (decwide_t_finite),
+        my_digits10((std::max)(prec_digits10, static_cast<std::int32_t>(1)))
+    {
+      from_double(static_cast<double>(f));
+    }
+
+    // Constructors from character representations.
+    decwide_dynamic_t(const char* const s,
+                      const std::int32_t prec_digits10 = default_digits10())
+      : my_data    (elem_number(prec_digits10)),
+        my_exp     (static_cast<exponent_type>(0)),
+        my_neg     (false),
+        my_fpclass (decwide_t_finite),
+        my_digits10((std::max)(prec_digits10, static_cast<std::int32_t>(1)))
+    {
+      if(rd_string(s) == false)
+      {
+        set_zero();
+      }
+    }
+
+    decwide_dynamic_t(const std::string& str,
+                      const std::int32_t prec_digits10 = default_digits10())
+      : decwide_dynamic_t(str.c_str(), prec_digits10) { }
+
+    // Copy constructor with change of precision. The value
+    // is truncated to, or extended with zeros to, the new precision.
+    decwide_dynamic_t(const decwide_dynamic_t& other,
+                      const std::int32_t prec_digits10)
+      : my_data    (elem_number(prec_digits10)),
+        my_exp     (other.my_exp),
+        my_neg     (other.my_neg),
+        my_fpclass (other.my_fpclass),
+        my_digits10((std::max)(prec_digits10, static_cast<std::int32_t>(1)))
+    {
+      const std::size_t count = (std::min)(my_data.size(), other.my_data.size());
+
+      std::copy(other.my_data.cbegin(), other.my_data.cbegin() + static_cast<std::ptrdiff_t>(count), my_data.begin());
+    }
+
+    // Constructor from decwide_t having the same limb type, with
+    // the (compile-time) precision of the decwide_t.
+    template<const std::int32_t MyDigits10, typename OtherAllocatorType, typename InternalFloatType, typename ExponentType>
+    explicit decwide_dynamic_t(const decwide_t<MyDigits10, LimbType, OtherAllocatorType, InternalFloatType, ExponentType>& x)
+      : my_data    (elem_number(MyDigits10)),
+        my_exp     (static_cast<exponent_type>(x.exponent())),
+        my_neg     (x.isneg()),
+        my_fpclass (decwide_t_finite),
+        my_digits10(MyDigits10)
+    {
+      const std::size_t count = (std::min)(my_data.size(), static_cast<std::size_t>(x.crepresentation().size()));
+
+      std::copy(x.crepresentation().cbegin(), x.crepresentation().cbegin() + static_cast<std::ptrdiff_t>(count), my_data.begin());
+
+      if(my_data[0U] == static_cast<limb_type>(0U))
+      {
+        set_zero();
+      }
+    }
+
+    decwide_dynamic_t(const decwide_dynamic_t&) = default;
+    decwide_dynamic_t(decwide_dynamic_t&&)      = default;
+
+    ~decwide_dynamic_t() = default;
+
+    decwide_dynamic_t& operator=(const decwide_dynamic_t&) = default;
+    decwide_dynamic_t& operator=(decwide_dynamic_t&&)      = default;
+
+    // Conversion to decwide_t having the same limb type.
+    template<const std::int32_t MyDigits10, typename OtherAllocatorType, typename InternalFloatType, typename ExponentType>
+    explicit operator decwide_t<MyDigits10, LimbType, OtherAllocatorType, InternalFloatType, ExponentType>() const
+    {
+      using other_decwide_type = decwide_t<MyDigits10, LimbType, OtherAllocatorType, InternalFloatType, ExponentType>;
+
+      if(my_fpclass == decwide_t_NaN)
+      {
+        return std::numeric_limits<other_decwide_type>::quiet_NaN();
+      }
+
+      if(my_fpclass == decwide_t_inf)
+      {
+        return ((!my_neg) ? std::numeric_limits<other_decwide_type>::infinity() : -std::numeric_limits<other_decwide_type>::infinity());
+      }
+
+      return other_decwide_type(my_data.data(),
+                                static_cast<std::uint_fast32_t>(my_data.size()),
+                                static_cast<ExponentType>(my_exp),
+                                my_neg);
+    }
+
+    explicit operator double() const { return extract_double(); }
+
+    // The precision (in decimal digits).
+    std::int32_t precision() const { return my_digits10; }
+
+    // Change the precision. The value is truncated to,
+    // or extended with zeros to, the new precision.
+    void precision(const std::int32_t prec_digits10)
+    {
+      my_digits10 = (std::max)(prec_digits10, static_cast<std::int32_t>(1));
+
+      my_data.resize(static_cast<typename representation_type::size_type>(elem_number(my_digits10)), static_cast<limb_type>(0U));
+    }
+
+    // The limbs (the most significant one first) and the exponent
+    // (normed to limb granularity) of the first limb.
+    const limb_type* crepresentation() const { return my_data.data(); }
+
+    std::uint32_t size() const { return static_cast<std::uint32_t>(my_data.size()); }
+
+    exponent_type exponent() const { return my_exp; }
+
+    bool iszero  () const { return ((my_fpclass == decwide_t_finite) && (my_data[0U] == static_cast<limb_type>(0U))); }
+    bool isneg   () const { return my_neg; }
+    bool (isnan) () const { return (my_fpclass == decwide_t_NaN); }
+    bool (isinf) () const { return (my_fpclass == decwide_t_inf); }
+    bool (isfinite)() const { return (my_fpclass == decwide_t_finite); }
+
+    // Unary operators.
+    decwide_dynamic_t& negate()
+    {
+      if((iszero() == false) && ((isnan)() == false))
+      {
+        my_neg = (!my_neg);
+      }
+
+      return *this;
+    }
+
+    // Binary arithmetic operators.
+    decwide_dynamic_t& operator+=(const decwide_dynamic_t& v) { return add_signed(v, v.my_neg); }
+    decwide_dynamic_t& operator-=(const decwide_dynamic_t& v) { return add_signed(v, (!v.my_neg)); }
+
+    decwide_dynamic_t& operator*=(const decwide_dynamic_t& v)
+    {
+      const bool b_result_is_neg = (my_neg != v.my_neg);
+
+      if(((isnan)() || (v.isnan)()) || (((isinf)() || (v.isinf)()) && (iszero() || v.iszero())))
+      {
+        return set_fpclass(decwide_t_NaN, false);
+      }
+
+      if((isinf)() || (v.isinf)())
+      {
+        return set_fpclass(decwide_t_inf, b_result_is_neg);
+      }
+
+      if(iszero() || v.iszero())
+      {
+        return set_zero();
+      }
+
+      // Multiply the significant limbs (those up to the last
+      // non-zero limb) of both operands. The full product is
+      // rounded by truncation to the precision of *this.
+      std::uint32_t na = size();
+      std::uint32_t nb = (std::min)(size(), v.size());
+
+      while(my_data  [na - 1U] == static_cast<limb_type>(0U)) { --na; }
+      while(v.my_data[nb - 1U] == static_cast<limb_type>(0U)) { --nb; }
+
+      representation_type result(static_cast<typename representation_type::size_type>(na + nb));
+
+      integer_type::mul_dispatch(result.data(), my_data.data(), na, v.my_data.data(), nb);
+
+      // The first limb of the product has the limb exponent
+      // my_exp + v.my_exp + 1, but it might be zero.
+      const std::uint32_t first = ((result[0U] != static_cast<limb_type>(0U)) ? 0U : 1U);
+      const std::uint32_t count = (std::min)(size(), static_cast<std::uint32_t>((na + nb) - first));
+
+      std::copy(result.cbegin() + static_cast<std::ptrdiff_t>(first),
+                result.cbegin() + static_cast<std::ptrdiff_t>(first + count),
+                my_data.begin());
+
+      std::fill(my_data.begin() + static_cast<std::ptrdiff_t>(count), my_data.end(), static_cast<limb_type>(0U));
+
+      my_exp = static_cast<exponent_type>((my_exp + v.my_exp) + ((first == 0U) ? decwide_t_elem_digits10 : 0));
+      my_neg = b_result_is_neg;
+
+      return *this;
+    }
+
+    decwide_dynamic_t& operator/=(const decwide_dynamic_t& v)
+    {
+      if(((isnan)() || (v.isnan)()) || ((isinf)() && (v.isinf)()) || (iszero() && v.iszero()))
+      {
+        return set_fpclass(decwide_t_NaN, false);
+      }
+
+      if((isinf)() || v.iszero())
+      {
+        return set_fpclass(decwide_t_inf, (my_neg != v.my_neg));
+      }
+
+      return operator*=(decwide_dynamic_t(v, my_digits10).calculate_inv());
+    }
+
+    // Binary arithmetic operators with built-in types. Multiplication
+    // and division by integral values up to 32 bits are done limb-by-limb.
+    template<typename ArithmeticType,
+             typename std::enable_if<std::is_arithmetic<ArithmeticType>::value == true>::type const* = nullptr>
+    decwide_dynamic_t& operator+=(const ArithmeticType& n) { return operator+=(decwide_dynamic_t(n, my_digits10)); }
+
+    template<typename ArithmeticType,
+             typename std::enable_if<std::is_arithmetic<ArithmeticType>::value == true>::type const* = nullptr>
+    decwide_dynamic_t& operator-=(const ArithmeticType& n) { return operator-=(decwide_dynamic_t(n, my_digits10)); }
+
+    template<typename ArithmeticType,
+             typename std::enable_if<std::is_arithmetic<ArithmeticType>::value == true>::type const* = nullptr>
+    decwide_dynamic_t& operator*=(const ArithmeticType& n)
+    {
+      bool n_is_neg;
+
+      const unsigned long long u = magnitude(n, n_is_neg);
+
+      if(    (std::is_integral<ArithmeticType>::value == false)
+          || (u > static_cast<unsigned long long>((std::numeric_limits<std::uint32_t>::max)()))
+          || ((isfinite)() == false))
+      {
+        return operator*=(decwide_dynamic_t(n, my_digits10));
+      }
+
+      mul_unsigned(static_cast<std::uint32_t>(u));
+
+      my_neg = ((my_neg != n_is_neg) && (iszero() == false));
+
+      return *this;
+    }
+
+    template<typename ArithmeticType,
+             typename std::enable_if<std::is_arithmetic<ArithmeticType>::value == true>::type const* = nullptr>
+    decwide_dynamic_t& operator/=(const ArithmeticType& n)
+    {
+      bool n_is_neg;
+
+      const unsigned long long u = magnitude(n, n_is_neg);
+
+      if(    (std::is_integral<ArithmeticType>::value == false)
+          || (u > static_cast<unsigned long long>((std::numeric_limits<std::uint32_t>::max)()))
+          || (u == 0U)
+          || ((isfinite)() == false))
+      {
+        return operator/=(decwide_dynamic_t(n, my_digits10));
+      }
+
+      div_unsigned(static_cast<std::uint32_t>(u));
+
+      my_neg = ((my_neg != n_is_neg) && (iszero() == false));
+
+      return *this;
+    }
+
+    // Comparison (-1, 0 or +1) with another value. NaN
+    // is not ordered and compares as being unequal.
+    std::int_fast8_t compare(const decwide_dynamic_t& v) const
+    {
+      if(((isinf)() && (v.isinf)()) && (my_neg == v.my_neg))
+      {
+        return static_cast<std::int_fast8_t>(0);
+      }
+
+      if((isinf)())   { return static_cast<std::int_fast8_t>(my_neg ? -1 : 1); }
+      if((v.isinf)()) { return static_cast<std::int_fast8_t>(v.my_neg ? 1 : -1); }
+
+      if(iszero())
+      {
+        return static_cast<std::int_fast8_t>(v.iszero() ? 0 : (v.my_neg ? 1 : -1));
+      }
+
+      if(v.iszero() || (my_neg != v.my_neg))
+      {
+        return static_cast<std::int_fast8_t>(my_neg ? -1 : 1);
+      }
+
+      std::int_fast8_t cmp_mag;
+
+      if(my_exp != v.my_exp)
+      {
+        cmp_mag = static_cast<std::int_fast8_t>((my_exp > v.my_exp) ? 1 : -1);
+      }
+      else
+      {
+        cmp_mag = static_cast<std::int_fast8_t>(0);
+
+        const std::uint32_t n = (std::max)(size(), v.size());
+
+        for(std::uint32_t i = 0U; ((i < n) && (cmp_mag == static_cast<std::int_fast8_t>(0))); ++i)
+        {
+          const limb_type u_i = ((i <   size()) ?   my_data[i] : static_cast<limb_type>(0U));
+          const limb_type v_i = ((i < v.size()) ? v.my_data[i] : static_cast<limb_type>(0U));
+
+          if(u_i != v_i)
+          {
+            cmp_mag = static_cast<std::int_fast8_t>((u_i > v_i) ? 1 : -1);
+          }
+        }
+      }
+
+      return static_cast<std::int_fast8_t>(my_neg ? -cmp_mag : cmp_mag);
+    }
+
+    // Elementary primitives.
+    decwide_dynamic_t& calculate_inv()
+    {
+      // Compute the inverse of *this.
+
+      if((isnan)())
+      {
+        return *this;
+      }
+
+      if((isinf)())
+      {
+        return set_zero();
+      }
+
+      if(iszero())
+      {
+        return set_fpclass(decwide_t_inf, false);
+      }
+
+      const bool b_neg = my_neg;
+
+      my_neg = false;
+
+      // Use the original value of *this for iteration below.
+      const decwide_dynamic_t x(*this);
+
+      const std::int32_t original_digits10 = my_digits10;
+
+      // Generate the initial estimate using division in double.
+      double        dd;
+      exponent_type ne;
+
+      x.extract_parts(dd, ne);
+
+      *this = decwide_dynamic_t(1.0 / dd, std::numeric_limits<double>::max_digits10);
+
+      mul_pow10(-ne);
+
+      // Compute the inverse of *this. Quadratically convergent Newton-Raphson
+      // iteration is used, with the precision (and thereby the storage)
+      // of the terms limited to the minimum required in each step.
+      for(std::int32_t digits  = static_cast<std::int32_t>(std::numeric_limits<double>::digits10 - 1);
+                       digits  < original_digits10;
+                       digits *= static_cast<std::int32_t>(2))
+      {
+        const std::int32_t new_prec_as_digits10 = newton_step_digits10(digits);
+
+        precision(new_prec_as_digits10);
+
+        decwide_dynamic_t x_times_this(x, new_prec_as_digits10);
+
+        x_times_this *= *this;
+
+        operator*=(decwide_dynamic_t(2U, new_prec_as_digits10) -= x_times_this);
+      }
+
+      precision(original_digits10);
+
+      my_neg = b_neg;
+
+      return *this;
+    }
+
+    decwide_dynamic_t& calculate_sqrt()
+    {
+      // Compute the square root of *this.
+
+      if((isnan)() || (my_neg && (iszero() == false)))
+      {
+        return set_fpclass(decwide_t_NaN, false);
+      }
+
+      if(iszero() || (isinf)())
+      {
+        return *this;
+      }
+
+      // Use the original value of *this for iteration below.
+      const decwide_dynamic_t x(*this);
+
+      const std::int32_t original_digits10 = my_digits10;
+
+      // Generate the initial estimates using double.
+      double        dd;
+      exponent_type ne;
+
+      x.extract_parts(dd, ne);
+
+      // Force the exponent to be an even multiple of two.
+      if((ne % 2) != static_cast<exponent_type>(0))
+      {
+        ++ne;
+        dd /= 10.0;
+      }
+
+      const double sqd = std::sqrt(dd);
+
+      *this = decwide_dynamic_t(sqd, std::numeric_limits<double>::max_digits10);
+
+      mul_pow10(static_cast<exponent_type>(ne / 2));
+
+      // Estimate 1.0 / (2.0 * x0).
+      decwide_dynamic_t vi(0.5 / sqd, std::numeric_limits<double>::max_digits10);
+
+      vi.mul_pow10(-static_cast<exponent_type>(ne / 2));
+
+      // Compute the square root of x. Coupled Newton iteration
+      // as described in "Pi Unleashed" is used (see also decwide_t).
+      for(std::int32_t digits  = static_cast<std::int32_t>(std::numeric_limits<double>::digits10 - 1);
+                       digits  < original_digits10;
+                       digits *= static_cast<std::int32_t>(2))
+      {
+        const std::int32_t new_prec_as_digits10 = newton_step_digits10(digits);
+
+           precision(new_prec_as_digits10);
+        vi.precision(new_prec_as_digits10);
+
+        // Next iteration of vi
+        decwide_dynamic_t this_times_vi(*this);
+
+        this_times_vi *= vi;
+        this_times_vi *= 2U;
+
+        vi += (vi * (decwide_dynamic_t(1U, new_prec_as_digits10) -= this_times_vi));
+
+        // Next iteration of *this
+        decwide_dynamic_t residual(x, new_prec_as_digits10);
+
+        residual -= (*this * *this);
+
+        *this += (vi * residual);
+      }
+
+      precision(original_digits10);
+
+      return *this;
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend std::basic_ostream<char_type, traits_type>& operator<<(std::basic_ostream<char_type, traits_type>& os, const decwide_dynamic_t& f)
+    {
+      // Write f in scientific notation having the
+      // stream's precision as the number of fractional digits.
+      const std::int32_t os_precision = static_cast<std::int32_t>(os.precision());
+
+      const std::string str = f.wr_string_scientific((os_precision > 0) ? os_precision : static_cast<std::int32_t>(6));
+
+      return (os << str.c_str());
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+
+    friend decwide_dynamic_t fabs(const decwide_dynamic_t& x)
+    {
+      decwide_dynamic_t result(x);
+
+      result.my_neg = false;
+
+      return result;
+    }
+
+    friend decwide_dynamic_t sqrt(const decwide_dynamic_t& x)
+    {
+      decwide_dynamic_t result(x);
+
+      return result.calculate_sqrt();
+    }
+
+    friend decwide_dynamic_t exp(const decwide_dynamic_t& x)
+    {
+      if((x.isnan)())
+      {
+        return x;
+      }
+
+      if((x.isinf)())
+      {
+        return ((!x.my_neg) ? x : decwide_dynamic_t(0U, x.my_digits10));
+      }
+
+      if(x.iszero())
+      {
+        return decwide_dynamic_t(1U, x.my_digits10);
+      }
+
+      double        dd;
+      exponent_type ne;
+
+      x.extract_parts(dd, ne);
+
+      if(ne > static_cast<exponent_type>(15))
+      {
+        // The result overflows (or underflows) the exponent range.
+        return ((!x.my_neg) ? decwide_dynamic_t(x).set_fpclass(decwide_t_inf, false) : decwide_dynamic_t(0U, x.my_digits10));
+      }
+
+      // The argument is scaled down by 2^k, such that the Taylor series
+      // of the scaled argument r (with |r| < 2^-m) converges quickly.
+      // The result is then squared k times. With m about the square
+      // root of the number of bits of precision, the count of terms
+      // and the count of squarings are balanced. The squarings
+      // amplify the relative error by 2^k, and the working
+      // precision has guard digits for this.
+      const std::int32_t bits_of_precision = static_cast<std::int32_t>(static_cast<double>(x.my_digits10) * 3.321928094887362);
+
+      const std::int32_t m = (std::max)(static_cast<std::int32_t>(8), static_cast<std::int32_t>(std::sqrt(static_cast<double>(bits_of_precision))));
+
+      const std::int32_t lg2_x = static_cast<std::int32_t>((std::log10(dd) + static_cast<double>(ne)) * 3.321928094887362);
+
+      const std::int32_t k = m + (std::max)(static_cast<std::int32_t>(0), static_cast<std::int32_t>(lg2_x + 1));
+
+      const std::int32_t work_digits10 =
+        static_cast<std::int32_t>((x.my_digits10 + ((k * 3) / 10)) + (decwide_t_elem_digits10 * 2));
+
+      decwide_dynamic_t r(x, work_digits10);
+
+      r.mul_pow2(-k);
+
+      // Compute the series representation of Hypergeometric0F0
+      // (see also decwide_t). The precision of the terms is reduced
+      // along with their magnitude.
+      decwide_dynamic_t h0f0(1U, work_digits10);
+
+      h0f0 += r;
+
+      decwide_dynamic_t x_pow_n_div_n_fact(r);
+
+      for(std::uint32_t n = 2U; n < UINT32_C(10000000); ++n)
+      {
+        x_pow_n_div_n_fact *= r;
+        x_pow_n_div_n_fact.div_unsigned(n);
+
+        const exponent_type term_exp = x_pow_n_div_n_fact.my_exp;
+
+        if(x_pow_n_div_n_fact.iszero() || (term_exp < -static_cast<exponent_type>(work_digits10)))
+        {
+          break;
+        }
+
+        h0f0 += x_pow_n_div_n_fact;
+
+        x_pow_n_div_n_fact.precision(static_cast<std::int32_t>(work_digits10 + term_exp));
+      }
+
+      for(std::int32_t i = 0; i < k; ++i)
+      {
+        h0f0 *= h0f0;
+      }
+
+      h0f0.precision(x.my_digits10);
+
+      return h0f0;
+    }
+
+    friend decwide_dynamic_t log(const decwide_dynamic_t& x)
+    {
+      if((x.isnan)() || (x.my_neg && (x.iszero() == false)))
+      {
+        return decwide_dynamic_t(x).set_fpclass(decwide_t_NaN, false);
+      }
+
+      if(x.iszero())
+      {
+        return decwide_dynamic_t(x).set_fpclass(decwide_t_inf, true);
+      }
+
+      if((x.isinf)())
+      {
+        return x;
+      }
+
+      // Use Newton iteration for the root y of x * exp(-y) - 1,
+      // starting with the logarithm in double. The iteration counts
+      // digits after the decimal point, and the working precision
+      // is extended by the magnitude of the result.
+      double        dd;
+      exponent_type ne;
+
+      x.extract_parts(dd, ne);
+
+      const double y0 = std::log(dd) + (static_cast<double>(ne) * 2.302585092994045684);
+
+      decwide_dynamic_t y(y0, std::numeric_limits<double>::max_digits10);
+
+      const std::int32_t y0_ilog10 =
+        static_cast<std::int32_t>(std::log10((std::max)(std::fabs(y0), 1.0)));
+
+      for(std::int32_t digits  = (std::max)(static_cast<std::int32_t>((std::numeric_limits<double>::digits10 - 1) - y0_ilog10), static_cast<std::int32_t>(1));
+                       digits  < static_cast<std::int32_t>(x.my_digits10 - y.ilog10());
+                       digits *= static_cast<std::int32_t>(2))
+      {
+        const std::int32_t new_prec_as_digits10 = newton_step_digits10(digits);
+
+        y.precision(static_cast<std::int32_t>(new_prec_as_digits10 + (std::max)(static_cast<std::int32_t>(y.ilog10()), static_cast<std::int32_t>(0))));
+
+        decwide_dynamic_t correction = exp(-y);
+
+        correction *= decwide_dynamic_t(x, new_prec_as_digits10);
+        correction -= 1U;
+
+        y += correction;
+      }
+
+      y.precision(x.my_digits10);
+
+      return y;
+    }
+
+    friend decwide_dynamic_t pow(const decwide_dynamic_t& x, const std::int64_t p)
+    {
+      // Calculate (x ^ p) with binary powering.
+      decwide_dynamic_t result(1U, x.my_digits10);
+      decwide_dynamic_t xn    (x);
+
+      for(std::uint64_t pn = ((p < 0) ? static_cast<std::uint64_t>(-p) : static_cast<std::uint64_t>(p)); pn != 0U; pn >>= 1U)
+      {
+        if((pn & 1U) != 0U)
+        {
+          result *= xn;
+        }
+
+        if(pn > 1U)
+        {
+          xn *= xn;
+        }
+      }
+
+      return ((p < 0) ? result.calculate_inv() : result);
+    }
+
+    friend decwide_dynamic_t pow(const decwide_dynamic_t& x, const decwide_dynamic_t& a)
+    {
+      return exp(a * log(x));
+    }
+
+  private:
+    using limb_allocator_type =
+      typename std::allocator_traits<AllocatorType>::template rebind_alloc<limb_type>;
+
+    using representation_type = std::vector<limb_type, limb_allocator_type>;
+
+    representation_type my_data;
+    exponent_type       my_exp;
+    bool                my_neg;
+    fpclass_type        my_fpclass;
+    std::int32_t        my_digits10;
+
+    static std::int32_t& default_digits10_value()
+    {
+      static std::int32_t the_default_digits10 = static_cast<std::int32_t>(INT32_C(100));
+
+      return the_default_digits10;
+    }
+
+    // The working precision of a Newton step that
+    // doubles the digits (see also decwide_t).
+    static std::int32_t newton_step_digits10(const std::int32_t digits)
+    {
+      return static_cast<std::int32_t>(  static_cast<std::int32_t>(digits * 2)
+                                       + (std::max)(static_cast<std::int32_t>(decwide_t_elem_digits10 + 1), static_cast<std::int32_t>(9)));
+    }
+
+    template<typename UnsignedIntegralType>
+    static typename std::enable_if<(std::is_unsigned<UnsignedIntegralType>::value == true), unsigned long long>::type
+    magnitude(const UnsignedIntegralType u, bool& is_neg)
+    {
+      is_neg = false;
+
+      return static_cast<unsigned long long>(u);
+    }
+
+    template<typename SignedType>
+    static typename std::enable_if<(std::is_signed<SignedType>::value == true), unsigned long long>::type
+    magnitude(const SignedType n, bool& is_neg)
+    {
+      is_neg = (n < static_cast<SignedType>(0));
+
+      // Non-integral values are handled by the caller, and they
+      // only need to have a magnitude that is not 32-bit.
+      if(std::is_integral<SignedType>::value == false)
+      {
+        return static_cast<unsigned long long>((std::numeric_limits<unsigned long long>::max)());
+      }
+
+      return ((!is_neg) ? static_cast<unsigned long long>(n)
+                        : static_cast<unsigned long long>(-static_cast<signed long long>(n)));
+    }
+
+    decwide_dynamic_t& set_zero()
+    {
+      std::fill(my_data.begin(), my_data.end(), static_cast<limb_type>(0U));
+
+      my_exp     = static_cast<exponent_type>(0);
+      my_neg     = false;
+      my_fpclass = decwide_t_finite;
+
+      return *this;
+    }
+
+    decwide_dynamic_t& set_fpclass(const fpclass_type fpc, const bool is_neg)
+    {
+      set_zero();
+
+      my_fpclass = fpc;
+      my_neg     = is_neg;
+
+      return *this;
+    }
+
+    // The decimal exponent of the first digit.
+    exponent_type ilog10() const
+    {
+      exponent_type e10 = my_exp;
+
+      for(limb_type d = my_data[0U]; d >= static_cast<limb_type>(10U); d = static_cast<limb_type>(d / 10U))
+      {
+        ++e10;
+      }
+
+      return e10;
+    }
+
+    void from_unsigned_long_long(unsigned long long u)
+    {
+      set_zero();
+
+      // Get the limbs (the least significant one first).
+      limb_type     temp[20U];
+      std::uint32_t n = 0U;
+
+      for( ; u != 0U; u /= decwide_t_elem_mask)
+      {
+        temp[n] = static_cast<limb_type>(u % decwide_t_elem_mask);
+
+        ++n;
+      }
+
+      for(std::uint32_t i = 0U; i < (std::min)(n, size()); ++i)
+      {
+        my_data[i] = temp[(n - 1U) - i];
+      }
+
+      my_exp = static_cast<exponent_type>(static_cast<exponent_type>((n != 0U) ? (n - 1U) : 0U) * decwide_t_elem_digits10);
+    }
+
+    void from_double(const double f)
+    {
+      set_zero();
+
+      if((std::isnan)(f))
+      {
+        set_fpclass(decwide_t_NaN, false);
+      }
+      else if((f > (std::numeric_limits<double>::max)()) || (f < -(std::numeric_limits<double>::max)()))
+      {
+        set_fpclass(decwide_t_inf, (f < 0.0));
+      }
+      else if(std::fpclassify(f) != FP_ZERO)
+      {
+        // Set the 53-bit integer mantissa of f, and scale it by
+        // the power of two. Both of these steps are exact, apart
+        // from the truncation to the precision of *this.
+        int e2;
+
+        const double fm = std::frexp(std::fabs(f), &e2);
+
+        from_unsigned_long_long(static_cast<unsigned long long>(std::ldexp(fm, std::numeric_limits<double>::digits)));
+
+        mul_pow2(static_cast<std::int32_t>(e2 - std::numeric_limits<double>::digits));
+
+        my_neg = (f < 0.0);
+      }
+    }
+
+    // Get the mantissa (in [1, 10)) and the decimal exponent in double.
+    void extract_parts(double& mantissa, exponent_type& exponent) const
+    {
+      mantissa = 0.0;
+      exponent = my_exp;
+
+      double scale = 1.0;
+
+      const std::uint32_t n = (std::min)(size(), static_cast<std::uint32_t>((24 / decwide_t_elem_digits10) + 1));
+
+      for(std::uint32_t i = 0U; i < n; ++i)
+      {
+        mantissa += (static_cast<double>(my_data[i]) * scale);
+
+        scale /= static_cast<double>(decwide_t_elem_mask);
+      }
+
+      while(mantissa >= 10.0)
+      {
+        mantissa /= 10.0;
+
+        ++exponent;
+      }
+    }
+
+    double extract_double() const
+    {
+      if((isnan)())
+      {
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+
+      if((isinf)())
+      {
+        return ((!my_neg) ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity());
+      }
+
+      if(iszero())
+      {
+        return 0.0;
+      }
+
+      double        mantissa;
+      exponent_type e10;
+
+      extract_parts(mantissa, e10);
+
+      double d;
+
+      if(e10 > static_cast<exponent_type>(std::numeric_limits<double>::max_exponent10))
+      {
+        d = std::numeric_limits<double>::infinity();
+      }
+      else if(e10 < static_cast<exponent_type>(std::numeric_limits<double>::min_exponent10 - std::numeric_limits<double>::digits10))
+      {
+        d = 0.0;
+      }
+      else
+      {
+        d = mantissa * std::pow(10.0, static_cast<double>(e10));
+      }
+
+      return ((!my_neg) ? d : -d);
+    }
+
+    decwide_dynamic_t& add_signed(const decwide_dynamic_t& v, const bool v_is_neg)
+    {
+      if((isnan)() || (v.isnan)())
+      {
+        return set_fpclass(decwide_t_NaN, false);
+      }
+
+      if((isinf)())
+      {
+        return (((v.isinf)() && (my_neg != v_is_neg)) ? set_fpclass(decwide_t_NaN, false) : *this);
+      }
+
+      if((v.isinf)())
+      {
+        return set_fpclass(decwide_t_inf, v_is_neg);
+      }
+
+      if(v.iszero())
+      {
+        return *this;
+      }
+
+      const std::uint32_t n = size();
+
+      const exponent_type max_delta_exp = static_cast<exponent_type>(static_cast<exponent_type>(n - 1U) * decwide_t_elem_digits10);
+
+      const exponent_type ofs_exp = static_cast<exponent_type>(my_exp - v.my_exp);
+
+      if(iszero() || (ofs_exp < -max_delta_exp))
+      {
+        // *this is zero or negligible compared to v.
+        assign_value(v);
+
+        my_neg = v_is_neg;
+
+        return *this;
+      }
+
+      if(ofs_exp > max_delta_exp)
+      {
+        // v is negligible compared to *this.
+        return *this;
+      }
+
+      // Align the operands at the larger of the two exponents.
+      // The data of v are stored (shifted and truncated) in v_data.
+      // The data of *this are shifted in place if necessary.
+      const std::uint32_t ofs = static_cast<std::uint32_t>(((ofs_exp >= 0) ? ofs_exp : -ofs_exp) / decwide_t_elem_digits10);
+
+      representation_type v_data(static_cast<typename representation_type::size_type>(n));
+
+      if(ofs_exp >= 0)
+      {
+        const std::uint32_t count = (std::min)(v.size(), static_cast<std::uint32_t>(n - ofs));
+
+        std::copy(v.my_data.cbegin(),
+                  v.my_data.cbegin() + static_cast<std::ptrdiff_t>(count),
+                  v_data.begin() + static_cast<std::ptrdiff_t>(ofs));
+      }
+      else
+      {
+        std::copy_backward(my_data.cbegin(),
+                           my_data.cend() - static_cast<std::ptrdiff_t>(ofs),
+                           my_data.end());
+
+        std::fill(my_data.begin(), my_data.begin() + static_cast<std::ptrdiff_t>(ofs), static_cast<limb_type>(0U));
+
+        const std::uint32_t count = (std::min)(v.size(), n);
+
+        std::copy(v.my_data.cbegin(),
+                  v.my_data.cbegin() + static_cast<std::ptrdiff_t>(count),
+                  v_data.begin());
+
+        my_exp = v.my_exp;
+      }
+
+      if(my_neg == v_is_neg)
+      {
+        // Add the aligned data, one limb at a time with carry.
+        std::uint32_t carry = 0U;
+
+        for(std::uint32_t i = n; i-- > 0U; )
+        {
+          const std::uint32_t sum = static_cast<std::uint32_t>((static_cast<std::uint32_t>(my_data[i]) + v_data[i]) + carry);
+
+          carry      = ((sum >= decwide_t_elem_mask) ? 1U : 0U);
+          my_data[i] = static_cast<limb_type>(sum - (carry * decwide_t_elem_mask));
+        }
+
+        if(carry != 0U)
+        {
+          std::copy_backward(my_data.cbegin(), my_data.cend() - 1, my_data.end());
+
+          my_data[0U] = static_cast<limb_type>(carry);
+
+          my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+        }
+      }
+      else
+      {
+        // Subtract the smaller of the aligned data from the larger.
+        const std::pair<typename representation_type::const_iterator, typename representation_type::const_iterator> mismatch_point =
+          std::mismatch(my_data.cbegin(), my_data.cend(), v_data.cbegin());
+
+        if(mismatch_point.first == my_data.cend())
+        {
+          return set_zero();
+        }
+
+        const bool this_is_larger = (*mismatch_point.first > *mismatch_point.second);
+
+        const representation_type& larger  = (this_is_larger ? my_data : v_data);
+        const representation_type& smaller = (this_is_larger ? v_data  : my_data);
+
+        std::uint32_t borrow = 0U;
+
+        for(std::uint32_t i = n; i-- > 0U; )
+        {
+          const std::uint32_t subtrahend = static_cast<std::uint32_t>(static_cast<std::uint32_t>(smaller[i]) + borrow);
+
+          borrow = ((larger[i] < subtrahend) ? 1U : 0U);
+
+          my_data[i] = static_cast<limb_type>((static_cast<std::uint32_t>(larger[i]) + (borrow * decwide_t_elem_mask)) - subtrahend);
+        }
+
+        my_neg = (this_is_larger ? my_neg : v_is_neg);
+
+        // Justify the data.
+        const typename representation_type::const_iterator first_nonzero_elem =
+          std::find_if(my_data.cbegin(),
+                       my_data.cend(),
+                       [](const limb_type& d) -> bool
+                       {
+                         return (d != static_cast<limb_type>(0U));
+                       });
+
+        const std::ptrdiff_t sj = static_cast<std::ptrdiff_t>(first_nonzero_elem - my_data.cbegin());
+
+        if(sj != static_cast<std::ptrdiff_t>(0))
+        {
+          std::copy(my_data.cbegin() + sj, my_data.cend(), my_data.begin());
+
+          std::fill(my_data.end() - sj, my_data.end(), static_cast<limb_type>(0U));
+
+          my_exp -= static_cast<exponent_type>(static_cast<exponent_type>(sj) * decwide_t_elem_digits10);
+        }
+      }
+
+      return *this;
+    }
+
+    // Take over the value of v at the precision of *this.
+    void assign_value(const decwide_dynamic_t& v)
+    {
+      const std::size_t count = (std::min)(my_data.size(), v.my_data.size());
+
+      std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(count), my_data.begin());
+
+      std::fill(my_data.begin() + static_cast<std::ptrdiff_t>(count), my_data.end(), static_cast<limb_type>(0U));
+
+      my_exp     = v.my_exp;
+      my_neg     = v.my_neg;
+      my_fpclass = v.my_fpclass;
+    }
+
+    void mul_unsigned(const std::uint32_t m)
+    {
+      // Multiply *this by a 32-bit unsigned integer, one limb at a time.
+      // The intermediate results fit in 64 bits for all limb types.
+      if(m == 0U)
+      {
+        set_zero();
+      }
+      else if((iszero() == false) && (m != 1U))
+      {
+        std::uint64_t carry = 0U;
+
+        for(std::uint32_t i = size(); i-- > 0U; )
+        {
+          const std::uint64_t t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_data[i]) * m) + carry);
+
+          carry      = static_cast<std::uint64_t>(t / decwide_t_elem_mask);
+          my_data[i] = static_cast<limb_type>(t - static_cast<std::uint64_t>(carry * decwide_t_elem_mask));
+        }
+
+        for( ; carry != 0U; carry /= decwide_t_elem_mask)
+        {
+          std::copy_backward(my_data.cbegin(), my_data.cend() - 1, my_data.end());
+
+          my_data[0U] = static_cast<limb_type>(carry % decwide_t_elem_mask);
+
+          my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+        }
+      }
+    }
+
+    void div_unsigned(const std::uint32_t d)
+    {
+      // Divide *this by a non-zero 32-bit unsigned integer,
+      // one limb at a time.
+      if((iszero() == false) && (d != 1U))
+      {
+        std::uint64_t rem = 0U;
+
+        for(std::uint32_t i = 0U; i < size(); ++i)
+        {
+          const std::uint64_t t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem * decwide_t_elem_mask) + my_data[i]);
+
+          my_data[i] = static_cast<limb_type>(t / d);
+          rem        = static_cast<std::uint64_t>(t % d);
+        }
+
+        // Justify the data, and continue the division
+        // of the remainder into the vacated limbs.
+        std::uint32_t sj = 0U;
+
+        while(my_data[sj] == static_cast<limb_type>(0U)) { ++sj; }
+
+        if(sj != 0U)
+        {
+          std::copy(my_data.cbegin() + static_cast<std::ptrdiff_t>(sj), my_data.cend(), my_data.begin());
+
+          for(std::uint32_t i = static_cast<std::uint32_t>(size() - sj); i < size(); ++i)
+          {
+            const std::uint64_t t = static_cast<std::uint64_t>(rem * decwide_t_elem_mask);
+
+            my_data[i] = static_cast<limb_type>(t / d);
+            rem        = static_cast<std::uint64_t>(t % d);
+          }
+
+          my_exp -= static_cast<exponent_type>(static_cast<exponent_type>(sj) * decwide_t_elem_digits10);
+        }
+      }
+    }
+
+    // Multiply *this by 2^p.
+    void mul_pow2(std::int32_t p)
+    {
+      for( ; p >=  30; p -= 30) { mul_unsigned(UINT32_C(1) << 30U); }
+      for( ; p <= -30; p += 30) { div_unsigned(UINT32_C(1) << 30U); }
+
+      if(p > 0) { mul_unsigned(UINT32_C(1) << static_cast<unsigned>( p)); }
+      if(p < 0) { div_unsigned(UINT32_C(1) << static_cast<unsigned>(-p)); }
+    }
+
+    // Multiply *this by 10^p.
+    void mul_pow10(const exponent_type p)
+    {
+      // Split p into a multiple of the limb digits (which goes
+      // into the exponent) and a non-negative remainder.
+      exponent_type p_limb = static_cast<exponent_type>(p / decwide_t_elem_digits10);
+
+      if((p_limb * decwide_t_elem_digits10) > p)
+      {
+        --p_limb;
+      }
+
+      const std::int32_t p_rem = static_cast<std::int32_t>(p - (p_limb * decwide_t_elem_digits10));
+
+      if(iszero() == false)
+      {
+        my_exp += static_cast<exponent_type>(p_limb * decwide_t_elem_digits10);
+      }
+
+      std::uint32_t pow10 = 1U;
+
+      for(std::int32_t i = 0; i < p_rem; ++i)
+      {
+        pow10 *= 10U;
+      }
+
+      mul_unsigned(pow10);
+    }
+
+    bool rd_string(const char* const s)
+    {
+      // Read a decimal number with optional sign, decimal
+      // point and exponent (such as "-1.2345e-67").
+      const char* p = s;
+
+      const bool is_neg = (*p == '-');
+
+      if((*p == '-') || (*p == '+')) { ++p; }
+
+      std::string   digits;
+      exponent_type e10          = static_cast<exponent_type>(-1);
+      bool          has_digit    = false;
+      bool          after_point  = false;
+
+      for( ; ((*p >= '0') && (*p <= '9')) || ((*p == '.') && (after_point == false)); ++p)
+      {
+        if(*p == '.')
+        {
+          after_point = true;
+        }
+        else
+        {
+          has_digit = true;
+
+          if(digits.empty() && (*p == '0'))
+          {
+            // Leading zeros only affect the exponent.
+            if(after_point) { --e10; }
+          }
+          else
+          {
+            digits.push_back(*p);
+
+            if(after_point == false) { ++e10; }
+          }
+        }
+      }
+
+      if((*p == 'e') || (*p == 'E'))
+      {
+        ++p;
+
+        const bool exp_is_neg = (*p == '-');
+
+        if((*p == '-') || (*p == '+')) { ++p; }
+
+        exponent_type e_part = static_cast<exponent_type>(0);
+
+        if((*p < '0') || (*p > '9')) { return false; }
+
+        for( ; (*p >= '0') && (*p <= '9'); ++p)
+        {
+          e_part = static_cast<exponent_type>((e_part * 10) + static_cast<exponent_type>(*p - '0'));
+        }
+
+        e10 += ((!exp_is_neg) ? e_part : -e_part);
+      }
+
+      if((has_digit == false) || (*p != '\0'))
+      {
+        return false;
+      }
+
+      set_zero();
+
+      if(digits.empty() == false)
+      {
+        // The first limb takes the digits up to the limb
+        // boundary, and each further limb takes a full limb.
+        exponent_type e_limb = static_cast<exponent_type>(e10 / decwide_t_elem_digits10);
+
+        if((e_limb * decwide_t_elem_digits10) > e10)
+        {
+          --e_limb;
+        }
+
+        const std::uint32_t first_limb_digits = static_cast<std::uint32_t>((e10 - (e_limb * decwide_t_elem_digits10)) + 1);
+
+        std::uint32_t digit_index = 0U;
+
+        for(std::uint32_t i = 0U; (i < size()) && (digit_index < digits.size()); ++i)
+        {
+          const std::uint32_t limb_digits = ((i == 0U) ? first_limb_digits : static_cast<std::uint32_t>(decwide_t_elem_digits10));
+
+          std::uint32_t limb_value = 0U;
+
+          for(std::uint32_t j = 0U; j < limb_digits; ++j, ++digit_index)
+          {
+            limb_value *= 10U;
+
+            if(digit_index < digits.size())
+            {
+              limb_value += static_cast<std::uint32_t>(digits[digit_index] - '0');
+            }
+          }
+
+          my_data[i] = static_cast<limb_type>(limb_value);
+        }
+
+        my_exp = static_cast<exponent_type>(e_limb * decwide_t_elem_digits10);
+        my_neg = is_neg;
+      }
+
+      return true;
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+    std::string wr_string_scientific(const std::int32_t fractional_digits) const
+    {
+      if((isnan)()) { return "nan"; }
+      if((isinf)()) { return ((!my_neg) ? "inf" : "-inf"); }
+
+      // Get the significant digits (one more than needed for rounding).
+      const std::uint32_t digit_count = static_cast<std::uint32_t>(fractional_digits + 2);
+
+      std::string digits;
+
+      exponent_type e10 = static_cast<exponent_type>(0);
+
+      if(iszero())
+      {
+        digits.assign(static_cast<std::string::size_type>(digit_count), '0');
+      }
+      else
+      {
+        digits = std::to_string(static_cast<std::uint32_t>(my_data[0U]));
+
+        e10 = ilog10();
+
+        for(std::uint32_t i = 1U; (i < size()) && (digits.size() < digit_count); ++i)
+        {
+          const std::string limb_str = std::to_string(static_cast<std::uint32_t>(my_data[i]));
+
+          digits += std::string(static_cast<std::string::size_type>(static_cast<std::uint32_t>(decwide_t_elem_digits10) - limb_str.size()), '0');
+          digits += limb_str;
+        }
+
+        digits.resize(static_cast<std::string::size_type>(digit_count), '0');
+
+        // Round to nearest, with ties away from zero.
+        const bool round_up = (digits.back() >= '5');
+
+        digits.pop_back();
+
+        if(round_up)
+        {
+          std::string::size_type i = digits.size();
+
+          for( ; (i > 0U) && (digits[i - 1U] == '9'); --i)
+          {
+            digits[i - 1U] = '0';
+          }
+
+          if(i > 0U)
+          {
+            ++digits[i - 1U];
+          }
+          else
+          {
+            digits.insert(digits.begin(), '1');
+            digits.pop_back();
+
+            ++e10;
+          }
+        }
+      }
+
+      digits.resize(static_cast<std::string::size_type>(fractional_digits + 1));
+
+      std::string str((my_neg ? "-" : ""));
+
+      str += digits.substr(0U, 1U);
+      str += ".";
+      str += digits.substr(1U);
+      str += ((e10 < 0) ? "e-" : "e+");
+
+      const std::string exp_str = std::to_string((e10 < 0) ? -e10 : e10);
+
+      str += ((exp_str.size() < 2U) ? ("0" + exp_str) : exp_str);
+
+      return str;
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+  };
+
+  // Global unary operators.
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator+(const decwide_dynamic_t<LimbType, AllocatorType>& self) { return self; }
+
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator-(const decwide_dynamic_t<LimbType, AllocatorType>& self) { decwide_dynamic_t<LimbType, AllocatorType> tmp(self); return tmp.negate(); }
+
+  // Global binary operators.
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator+(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return decwide_dynamic_t<LimbType, AllocatorType>(u) += v; }
+
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator-(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return decwide_dynamic_t<LimbType, AllocatorType>(u) -= v; }
+
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator*(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return decwide_dynamic_t<LimbType, AllocatorType>(u) *= v; }
+
+  template<typename LimbType, typename AllocatorType>
+  decwide_dynamic_t<LimbType, AllocatorType> operator/(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return decwide_dynamic_t<LimbType, AllocatorType>(u) /= v; }
+
+  // Global binary operators with built-in types.
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator+(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return decwide_dynamic_t<LimbType, AllocatorType>(u) += n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator+(const ArithmeticType& n, const decwide_dynamic_t<LimbType, AllocatorType>& u) { return decwide_dynamic_t<LimbType, AllocatorType>(u) += n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator-(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return decwide_dynamic_t<LimbType, AllocatorType>(u) -= n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator-(const ArithmeticType& n, const decwide_dynamic_t<LimbType, AllocatorType>& u) { return decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision()) -= u; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator*(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return decwide_dynamic_t<LimbType, AllocatorType>(u) *= n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator*(const ArithmeticType& n, const decwide_dynamic_t<LimbType, AllocatorType>& u) { return decwide_dynamic_t<LimbType, AllocatorType>(u) *= n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator/(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return decwide_dynamic_t<LimbType, AllocatorType>(u) /= n; }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), decwide_dynamic_t<LimbType, AllocatorType>>::type
+  operator/(const ArithmeticType& n, const decwide_dynamic_t<LimbType, AllocatorType>& u) { return decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision()) /= u; }
+
+  // Global comparison operators. Comparisons with NaN are false
+  // (apart from inequality).
+  template<typename LimbType, typename AllocatorType>
+  bool operator< (const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return (((u.isnan)() == false) && ((v.isnan)() == false) && (u.compare(v) <  static_cast<std::int_fast8_t>(0))); }
+
+  template<typename LimbType, typename AllocatorType>
+  bool operator<=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return (((u.isnan)() == false) && ((v.isnan)() == false) && (u.compare(v) <= static_cast<std::int_fast8_t>(0))); }
+
+  template<typename LimbType, typename AllocatorType>
+  bool operator==(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return (((u.isnan)() == false) && ((v.isnan)() == false) && (u.compare(v) == static_cast<std::int_fast8_t>(0))); }
+
+  template<typename LimbType, typename AllocatorType>
+  bool operator!=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return ((u == v) == false); }
+
+  template<typename LimbType, typename AllocatorType>
+  bool operator>=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return (v <= u); }
+
+  template<typename LimbType, typename AllocatorType>
+  bool operator> (const decwide_dynamic_t<LimbType, AllocatorType>& u, const decwide_dynamic_t<LimbType, AllocatorType>& v) { return (v < u); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator< (const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u <  decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator<=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u <= decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator==(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u == decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator!=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u != decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator>=(const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u >= decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  template<typename LimbType, typename AllocatorType, typename ArithmeticType>
+  typename std::enable_if<(std::is_arithmetic<ArithmeticType>::value == true), bool>::type
+  operator> (const decwide_dynamic_t<LimbType, AllocatorType>& u, const ArithmeticType& n) { return (u >  decwide_dynamic_t<LimbType, AllocatorType>(n, u.precision())); }
+
+  } } // namespace math::wide_decimal
+
+#endif // DECWIDE_DYNAMIC_T_2026_10_18_H_
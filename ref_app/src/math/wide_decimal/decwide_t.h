@@ -16,6 +16,7 @@
   //#define WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
   //#define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
   //#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
+  //#define WIDE_DECIMAL_ENABLE_THREADS
 
   #include <algorithm>
   #include <cmath>
@@ -34,9 +35,13 @@
   #endif
   #include <type_traits>
 
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  #include <math/wide_decimal/decwide_t_detail_dynamic_integer.h>
+  #endif
   #include <math/wide_decimal/decwide_t_detail_fft.h>
   #include <math/wide_decimal/decwide_t_detail_helper.h>
   #include <math/wide_decimal/decwide_t_detail_karatsuba.h>
+  #include <math/wide_decimal/decwide_t_detail_ntt.h>
 
   #include <util/utility/util_baselexical_cast.h>
   #include <util/utility/util_dynamic_array.h>
@@ -167,6 +172,28 @@
            typename ExponentType = std::int64_t>
   decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr);
 
+  // The integer type of the binary splitting sums of calc_pi_chudnovsky
+  // can be selected per call. It is the dynamic integer by default,
+  // and it must be given explicitly (for instance as a sufficiently
+  // wide uintwide_t) when dynamic memory allocation is disabled.
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  template<const std::int32_t MyDigits10,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType = std::int64_t,
+           typename BinarySplittingIntegerType = detail::dynamic_integer<LimbType, AllocatorType>>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi_chudnovsky(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr);
+  #else
+  template<const std::int32_t MyDigits10,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType = std::int64_t,
+           typename BinarySplittingIntegerType = void>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi_chudnovsky(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr);
+  #endif
+
   template<const std::int32_t MyDigits10,
            typename LimbType = std::uint32_t,
            typename AllocatorType = std::allocator<void>,
@@ -200,6 +227,10 @@
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> rootn_inverse(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x, std::int32_t p);
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> log          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> exp          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> sin          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> cos          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> tan          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> atan         (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x);
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> pow          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x, const std::int64_t n);
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> pow          (decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x,
                                                                                                                                                                                                                                       decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> a);
@@ -432,6 +463,14 @@
     static constexpr std::int32_t decwide_t_elems_for_fft =
       ((std::is_same<limb_type, std::uint8_t>::value == true) ? 32 : 128);
 
+    // Above this element count, the exact number-theoretic transform
+    // is used for multiplication instead of the floating-point FFT.
+    // The FFT splits the limbs into halves and rounds its results,
+    // and its worst-case rounding error bound approaches one half
+    // (in units of the half-limbs) at a few million decimal digits.
+    static constexpr std::int32_t decwide_t_elems_for_ntt =
+      static_cast<std::int32_t>(INT32_C(2000000) / decwide_t_elem_digits10);
+
     typedef enum fpclass_type
     {
       decwide_t_finite
@@ -653,6 +692,31 @@
         my_fpclass  (decwide_t_finite),
         my_prec_elem(decwide_t_elem_number) { }
 
+    // Constructor from a range of limbs (the most significant
+    // limb first), exponent value (normed to limb granularity)
+    // and optional sign flag. Limbs beyond the internal
+    // representation are truncated.
+    decwide_t(const limb_type*         p_limbs,
+              const std::uint_fast32_t limb_count,
+              const exponent_type      e = 0,
+              const bool               is_neg = false)
+      : my_data     (),
+        my_exp      (e),
+        my_neg      (is_neg),
+        my_fpclass  (decwide_t_finite),
+        my_prec_elem(decwide_t_elem_number)
+    {
+      std::copy(p_limbs,
+                p_limbs + (std::min)(limb_count, static_cast<std::uint_fast32_t>(decwide_t_elem_number)),
+                my_data.begin());
+
+      if(limb_count == static_cast<std::uint_fast32_t>(0U))
+      {
+        my_exp = static_cast<exponent_type>(0);
+        my_neg = false;
+      }
+    }
+
   private:
     // Constructor from mantissa and exponent.
     explicit decwide_t(const InternalFloatType mantissa,
@@ -751,11 +815,12 @@
     const array_type&  representation() const { return my_data; }
     const array_type& crepresentation() const { return my_data; }
 
+    // The exponent (normed to limb granularity) of the first limb.
+    exponent_type exponent() const { return my_exp; }
+
     // Binary arithmetic operators.
     decwide_t& operator+=(const decwide_t& v)
     {
-      // TBD: Eliminate the temporary storage array my_n_data_for_add_sub.
-
       // TBD: Limit the length of add/sub to only those ranges needed,
       // whereby propagate borrow/carry may be necessary as well.
 
@@ -781,60 +846,30 @@
         return operator=(v);
       }
 
-      // Do the add/sub operation.
+      // Do the add/sub operation. This is done in-place in the data
+      // array of *this, without any temporary storage. If necessary,
+      // the data of *this are shifted down to align with those of v.
 
-      typename array_type::pointer        p_u    =   my_data.data();
-      typename array_type::const_pointer  p_v    = v.my_data.data();
-      bool                                b_copy = false;
-      const std::int32_t                  ofs    = static_cast<std::int32_t>(static_cast<std::int32_t>(ofs_exp) / decwide_t_elem_digits10);
-
-      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      detail::fixed_dynamic_array<limb_type,
-                                  static_cast<std::uint_fast32_t>(decwide_t_elem_number),
-                                  std::allocator<limb_type>>
-      my_n_data_for_add_sub;
-      #endif
+      const std::int32_t ofs = static_cast<std::int32_t>(static_cast<std::int32_t>(ofs_exp) / decwide_t_elem_digits10);
 
       if(my_neg == v.my_neg)
       {
-        // Add v to *this, where the data array of either *this or v
-        // might have to be treated with a positive, negative or zero offset.
-        // The result is stored in *this. The data are added one element
-        // at a time, each element with carry.
-        if(ofs >= static_cast<std::int32_t>(0))
-        {
-          std::copy(v.my_data.cbegin(),
-                    v.my_data.cend() - static_cast<std::ptrdiff_t>(ofs),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs));
-
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs),
-                    static_cast<limb_type>(0));
-
-          p_v = my_n_data_for_add_sub.data();
-        }
-        else
+        // Add v to *this, where the data array of v is treated
+        // with a positive offset, or the data array of *this is
+        // shifted down if the offset is negative. The data are
+        // added one element at a time, each element with carry.
+        if(ofs < static_cast<std::int32_t>(0))
         {
-          std::copy(my_data.cbegin(),
-                    my_data.cend()     - static_cast<std::ptrdiff_t>(-ofs),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(-ofs));
-
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(-ofs),
-                    static_cast<limb_type>(0));
+          shift_data_down(-ofs);
 
-          p_u = my_n_data_for_add_sub.data();
-          b_copy = true;
+          my_exp = v.my_exp;
         }
 
         // Addition.
-        const limb_type carry = add_loop_uv(p_u, p_v, decwide_t_elem_number);
-
-        if(b_copy)
-        {
-          std::copy(my_n_data_for_add_sub.cbegin(), my_n_data_for_add_sub.cend(), my_data.begin());
-          my_exp  = v.my_exp;
-        }
+        const limb_type carry = add_loop_uv(my_data.data(),
+                                            v.my_data.data(),
+                                            decwide_t_elem_number,
+                                            (std::max)(ofs, static_cast<std::int32_t>(0)));
 
         // There needs to be a carry into the element -1 of the array data
         if(carry != static_cast<limb_type>(0U))
@@ -856,53 +891,27 @@
            || (   (ofs == static_cast<std::int32_t>(0))
                && (cmp_data(v.my_data) > static_cast<std::int32_t>(0))))
         {
-          // In this case, |u| > |v| and ofs is positive.
-          // Copy the data of v, shifted down to a lower value
-          // into the data array m_n. Set the operand pointer p_v
-          // to point to the copied, shifted data m_n.
-          std::copy(v.my_data.cbegin(),
-                    v.my_data.cend()  - static_cast<std::ptrdiff_t>(ofs),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs));
+          // In this case, |u| > |v| and ofs is positive (or zero).
+          // Subtract the data of v, shifted down to a lower value
+          // by the offset, from the data of u.
+          const signed_limb_type borrow = sub_loop_uv(my_data.data(), v.my_data.data(), decwide_t_elem_number, ofs);
 
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs),
-                    static_cast<limb_type>(0));
-
-          p_v = my_n_data_for_add_sub.data();
+          static_cast<void>(borrow);
         }
         else
         {
+          // In this case, |u| <= |v| and ofs is negative (or zero).
+          // Shift the data of u down to a lower value and subtract
+          // it from the data of v, storing the result in u.
           if(ofs != static_cast<std::int32_t>(0))
           {
-            // In this case, |u| < |v| and ofs is negative.
-            // Shift the data of u down to a lower value.
-            std::copy_backward(my_data.cbegin(),
-                               my_data.cend() - static_cast<std::ptrdiff_t>(-ofs),
-                               my_data.end());
-
-            std::fill(my_data.begin(),
-                      my_data.begin() + static_cast<std::ptrdiff_t>(-ofs),
-                      static_cast<limb_type>(0));
+            shift_data_down(-ofs);
           }
 
-          // Copy the data of v into the data array my_n_data_for_add_sub.
-          // Set the u-pointer p_u to point to m_n and the
-          // operand pointer p_v to point to the shifted
-          // data m_data.
-          std::copy(v.my_data.cbegin(), v.my_data.cend(), my_n_data_for_add_sub.begin());
-          p_u    = my_n_data_for_add_sub.data();
-          p_v    = my_data.data();
-          b_copy = true;
-        }
-
-        // Subtraction.
-        const signed_limb_type borrow = sub_loop_uv(p_u, p_v, decwide_t_elem_number);
+          const signed_limb_type borrow = sub_loop_vu(my_data.data(), v.my_data.data(), decwide_t_elem_number);
 
-        static_cast<void>(borrow);
+          static_cast<void>(borrow);
 
-        if(b_copy)
-        {
-          std::copy(my_n_data_for_add_sub.cbegin(), my_n_data_for_add_sub.cend(), my_data.begin());
           my_exp  = v.my_exp;
           my_neg  = v.my_neg;
         }
@@ -1010,6 +1019,40 @@
       return *this;
     }
 
+    // In-place operations. These are composed of the in-place
+    // operators and avoid the temporaries of the equivalent binary
+    // expressions. They are used in the iteration loops of the
+    // elementary functions. The operations are not fused: the
+    // product is truncated to the precision of *this (as in
+    // operator*=) before the addition or subtraction.
+
+    // Compute *this = (*this * a) + b.
+    decwide_t& mul_add(const decwide_t& a, const decwide_t& b)
+    {
+      return operator*=(a).operator+=(b);
+    }
+
+    // Compute *this = (*this * a) - b.
+    decwide_t& mul_sub(const decwide_t& a, const decwide_t& b)
+    {
+      return operator*=(a).operator-=(b);
+    }
+
+    // Compute *this = *this * *this. The multiplication methods
+    // recognize the squaring and need only about half of the
+    // work of a general multiplication.
+    decwide_t& square_in_place()
+    {
+      return operator*=(*this);
+    }
+
+    // Compute *this = (*this * n) + b, where n is a limb-sized
+    // (or larger) unsigned integer.
+    decwide_t& mul_by_limb_add(const unsigned long long n, const decwide_t& b)
+    {
+      return mul_unsigned_long_long(n).operator+=(b);
+    }
+
     // Arithmetic operators with unsigned long long.
     decwide_t& add_unsigned_long_long(const unsigned long long n)
     {
@@ -1373,22 +1416,33 @@
 
       // Compute the inverse of *this. Quadratically convergent Newton-Raphson iteration
       // is used. During the iterative steps, the precision of the calculation is limited
-      // to the minimum required in order to minimize the run-time.
+      // to the minimum required in order to minimize the run-time. The iteration is
+      // done in-place with the fixed working values below.
+
+      const decwide_t one_val(one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
+
+      decwide_t t;
 
       for(std::int32_t digits  = (std::int32_t) (std::numeric_limits<InternalFloatType>::digits10 - 1);
                        digits  < (std::int32_t) (original_prec_elem * decwide_t_elem_digits10);
                        digits *= static_cast<std::int32_t>(2))
       {
-        // Adjust precision of the terms.
+        // Adjust precision of the terms. The margin covers the leading
+        // limb (which may hold only one digit) and the last limbs of the
+        // truncated products of the school multiplication.
         const std::int32_t new_prec_as_digits10 =
             (std::int32_t) (digits * 2)
-          + (std::max)((std::int32_t) (decwide_t_elem_digits10  + 1), (std::int32_t) 9);
+          + (std::max)((std::int32_t) (decwide_t_elem_digits10 * 3), (std::int32_t) 9);
 
           precision(new_prec_as_digits10);
         x.precision(new_prec_as_digits10);
 
-        // Next iteration.
-        operator=(*this * (two<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>() - (*this * x)));
+        // Next iteration: *this = *this - (*this * ((*this * x) - 1)).
+        t = *this;
+        t.mul_sub(x, one_val);
+        t *= *this;
+
+        operator-=(t);
       }
 
       my_neg = b_neg;
@@ -1453,24 +1507,44 @@
       // http://www.jjj.de/pibook/pibook.html
       // http://www.springer.com/gp/book/9783642567353
 
+      // The iteration is done in-place with the fixed
+      // working values below.
+
+      const decwide_t one_val(one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
+
+      decwide_t t;
+
       for(std::int32_t digits  = (std::int32_t) (std::numeric_limits<InternalFloatType>::digits10 - 1);
                        digits  < (std::int32_t) (original_prec_elem * decwide_t_elem_digits10);
                        digits *= static_cast<std::int32_t>(2))
       {
-        // Adjust precision of the terms.
+        // Adjust precision of the terms. The margin covers the leading
+        // limb (which may hold only one digit) and the last limbs of the
+        // truncated products of the school multiplication.
         const std::int32_t new_prec_as_digits10 =
             (std::int32_t) (digits * 2)
-          + (std::max)((std::int32_t) (decwide_t_elem_digits10  + 1), (std::int32_t) 9);
+          + (std::max)((std::int32_t) (decwide_t_elem_digits10 * 3), (std::int32_t) 9);
 
            precision(new_prec_as_digits10);
         vi.precision(new_prec_as_digits10);
          x.precision(new_prec_as_digits10);
 
-        // Next iteration of vi
-        vi += vi * (-((*this * vi) * static_cast<std::int32_t>(2)) + one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
+        // Next iteration of vi: vi = vi + (vi * (1 - (2 * *this * vi))).
+        t = *this;
+        t *= vi;
+        t.negate();
+        t.mul_by_limb_add(2U, one_val);
+        t *= vi;
 
-        // Next iteration of *this
-        *this += (vi * (-((*this) * (*this)) + x));
+        vi += t;
+
+        // Next iteration of *this: *this = *this + (vi * (x - (*this * *this))).
+        t = *this;
+        t.negate();
+        t.mul_add(*this, x);
+        t *= vi;
+
+        operator+=(t);
       }
 
       my_prec_elem = original_prec_elem;
@@ -1541,25 +1615,33 @@
         // Set the result equal to the initial guess.
         result = decwide_t(one_over_rtn_d, static_cast<exponent_type>(-ne / p));
 
+        const decwide_t one_val(one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
+
+        decwide_t t;
+
         for(std::int32_t digits  = (std::int32_t) (std::numeric_limits<InternalFloatType>::digits10 - 1);
                          digits  < (std::int32_t) (original_prec_elem * decwide_t_elem_digits10);
                          digits *= static_cast<std::int32_t>(2))
         {
-          // Adjust precision of the terms.
+          // Adjust precision of the terms. The margin covers the leading
+          // limb (which may hold only one digit) and the last limbs of the
+          // truncated products of the school multiplication.
           const std::int32_t new_prec_as_digits10 =
               (std::int32_t) (digits * 2)
-            + (std::max)((std::int32_t) (decwide_t_elem_digits10  + 1), (std::int32_t) 9);
+            + (std::max)((std::int32_t) (decwide_t_elem_digits10 * 3), (std::int32_t) 9);
 
           result.precision(new_prec_as_digits10);
 
-          // Perform the next iteration.
-          decwide_t term =
-              (((-pow(result, p) * x) + one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>()) / p)
-            + one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>();
+          // Perform the next iteration:
+          // result = result + ((result * (1 - (result^p * x))) / p).
+          t = pow(result, p);
+          t.precision(new_prec_as_digits10);
+          t.negate();
+          t.mul_add(x, one_val);
+          t /= p;
+          t *= result;
 
-          term.precision(new_prec_as_digits10);
-
-          result *= term;
+          result += t;
         }
 
         result.my_prec_elem = original_prec_elem;
@@ -1793,6 +1875,14 @@
             ld += (long double) my_data[i / decwide_t_elem_digits10] * scale;
           }
 
+          // Scale with the (limb-granular) exponent.
+          if(my_exp != static_cast<exponent_type>(0))
+          {
+            using std::pow;
+
+            ld *= pow(10.0L, (long double) my_exp);
+          }
+
           if(my_neg) { ld = -ld; }
         }
       }
@@ -1901,10 +1991,26 @@
     explicit operator unsigned long long() const { return extract_unsigned_long_long(); }
 
   private:
+    // The scratch memory (working arrays and twiddle table)
+    // of the FFT multiplication persists across calls.
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    using fft_scratch_type = detail::fft::fft_scratch_pool<fft_float_type, AllocatorType>;
+    #else
+    using fft_scratch_type = detail::fft::fft_scratch_array<fft_float_type, detail::decwide_t_helper<MyDigits10, LimbType>::pow2_maker_of_upper_limit(decwide_t_elem_number) * 4UL>;
+    #endif
+
     #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    using ntt_scratch_type = detail::ntt::ntt_scratch_pool<AllocatorType>;
+    #else
+    using ntt_scratch_type = detail::ntt::ntt_scratch_array<((decwide_t_elem_number >= decwide_t_elems_for_ntt) ? ((detail::decwide_t_helper<MyDigits10, LimbType>::pow2_maker_of_upper_limit(decwide_t_elem_number) * 2UL) < detail::ntt::ntt_max_transform_length) ? (detail::decwide_t_helper<MyDigits10, LimbType>::pow2_maker_of_upper_limit(decwide_t_elem_number) * 2UL) : detail::ntt::ntt_max_transform_length : 2UL)>;
+    #endif
+
+    #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+    static thread_local fft_scratch_type my_fft_scratch;
+    static thread_local ntt_scratch_type my_ntt_scratch;
     #else
-    static fft_float_type my_af_bf_fft_mul_pool[detail::decwide_t_helper<MyDigits10, LimbType>::pow2_maker_of_upper_limit(decwide_t_elem_number) * 8UL];
-    static array_type     my_n_data_for_add_sub;
+    static fft_scratch_type my_fft_scratch;
+    static ntt_scratch_type my_ntt_scratch;
     #endif
 
     array_type    my_data;
@@ -2004,29 +2110,96 @@
       return n_return;
     }
 
-    static limb_type add_loop_uv(limb_type* const u, const limb_type* const v, const std::int32_t p)
+    void shift_data_down(const std::int32_t n)
     {
-      // Addition algorithm
+      // Shift the data of *this down by n elements (toward the
+      // less significant elements), filling in zeros at the top.
+      std::copy_backward(my_data.cbegin(),
+                         my_data.cend() - static_cast<std::ptrdiff_t>(n),
+                         my_data.end());
+
+      std::fill(my_data.begin(),
+                my_data.begin() + static_cast<std::ptrdiff_t>(n),
+                static_cast<limb_type>(0));
+    }
+
+    static limb_type add_loop_uv(limb_type* const u, const limb_type* const v, const std::int32_t p, const std::int32_t ofs = 0)
+    {
+      // Addition algorithm, where v is shifted down by ofs elements.
       limb_type carry = 0U;
 
-      for(std::int32_t j = static_cast<std::int32_t>(p - static_cast<std::int32_t>(1)); j >= static_cast<std::int32_t>(0); j--)
+      std::int32_t j = static_cast<std::int32_t>(p - static_cast<std::int32_t>(1));
+
+      for( ; j >= ofs; j--)
+      {
+        const limb_type t = static_cast<limb_type>(static_cast<limb_type>(u[j] + v[j - ofs]) + carry);
+        carry             = ((t >= static_cast<limb_type>(decwide_t_elem_mask)) ? 1U : 0U);
+        u[j]              = static_cast<limb_type>(t - ((carry != 0U) ? static_cast<limb_type>(decwide_t_elem_mask) : static_cast<limb_type>(0U)));
+      }
+
+      // Propagate the carry through the upper elements of u.
+      for( ; (j >= static_cast<std::int32_t>(0)) && (carry != 0U); j--)
       {
-        const limb_type t = static_cast<limb_type>(static_cast<limb_type>(u[j] + v[j]) + carry);
-        carry             = ((t > static_cast<limb_type>(decwide_t_elem_mask)) ? 1U : 0U);
+        const limb_type t = static_cast<limb_type>(u[j] + carry);
+        carry             = ((t >= static_cast<limb_type>(decwide_t_elem_mask)) ? 1U : 0U);
         u[j]              = static_cast<limb_type>(t - ((carry != 0U) ? static_cast<limb_type>(decwide_t_elem_mask) : static_cast<limb_type>(0U)));
       }
 
       return carry;
     }
 
-    static signed_limb_type sub_loop_uv(limb_type* const u, const limb_type* const v, const std::int32_t p)
+    static signed_limb_type sub_loop_uv(limb_type* const u, const limb_type* const v, const std::int32_t p, const std::int32_t ofs = 0)
+    {
+      // Subtraction algorithm, where v is shifted down by ofs elements.
+      signed_limb_type borrow = static_cast<std::int32_t>(0);
+
+      std::int32_t j = static_cast<std::int32_t>(p - static_cast<std::int32_t>(1));
+
+      for( ; j >= ofs; j--)
+      {
+        signed_limb_type t = static_cast<signed_limb_type>(static_cast<signed_limb_type>(u[j] - v[j - ofs]) - borrow);
+
+        // Underflow? Borrow?
+        if(t < 0)
+        {
+          // Yes, underflow and borrow
+          t     += static_cast<signed_limb_type>(decwide_t_elem_mask);
+          borrow = static_cast<signed_limb_type>(1);
+        }
+        else
+        {
+          borrow = static_cast<signed_limb_type>(0);
+        }
+
+        u[j] = static_cast<limb_type>(t);
+      }
+
+      // Propagate the borrow through the upper elements of u.
+      for( ; (j >= static_cast<std::int32_t>(0)) && (borrow != static_cast<signed_limb_type>(0)); j--)
+      {
+        if(u[j] == static_cast<limb_type>(0U))
+        {
+          u[j] = static_cast<limb_type>(decwide_t_elem_mask - 1);
+        }
+        else
+        {
+          --u[j];
+
+          borrow = static_cast<signed_limb_type>(0);
+        }
+      }
+
+      return borrow;
+    }
+
+    static signed_limb_type sub_loop_vu(limb_type* const u, const limb_type* const v, const std::int32_t p)
     {
-      // Subtraction algorithm
+      // Reverse subtraction algorithm, storing (v - u) in u.
       signed_limb_type borrow = static_cast<std::int32_t>(0);
 
-      for(std::uint32_t j = static_cast<std::uint32_t>(p - static_cast<std::int32_t>(1)); static_cast<std::int32_t>(j) >= static_cast<std::int32_t>(0); --j)
+      for(std::int32_t j = static_cast<std::int32_t>(p - static_cast<std::int32_t>(1)); j >= static_cast<std::int32_t>(0); j--)
       {
-        signed_limb_type t = static_cast<signed_limb_type>(static_cast<signed_limb_type>(u[j] - v[j]) - borrow);
+        signed_limb_type t = static_cast<signed_limb_type>(static_cast<signed_limb_type>(v[j] - u[j]) - borrow);
 
         // Underflow? Borrow?
         if(t < 0)
@@ -2048,19 +2221,48 @@
 
     static limb_type mul_loop_uv(limb_type* const u, const limb_type* const v, const std::int32_t p)
     {
-      double_limb_type carry = static_cast<double_limb_type>(0U);
+      // The column sums of (up to decwide_t_elems_for_fft) products
+      // exceed the range of double_limb_type for the small limbs.
+      using sum_type = typename std::conditional<(std::is_same<limb_type, std::uint8_t>::value == true),
+                                                 std::uint32_t,
+                                                 std::uint64_t>::type;
+
+      sum_type carry = static_cast<sum_type>(0U);
+
+      // For squaring (with u and v being the same array), the symmetric
+      // products in each column are only computed once.
+      const bool is_square = (u == v);
 
       for(std::int32_t j = static_cast<std::int32_t>(p - 1); j >= static_cast<std::int32_t>(0); j--)
       {
-        double_limb_type sum = carry;
+        sum_type sum = carry;
+
+        if(is_square)
+        {
+          sum_type sum_half = static_cast<sum_type>(0U);
+
+          for(std::int32_t i = static_cast<std::int32_t>(0); i < static_cast<std::int32_t>(j - i); i++)
+          {
+            sum_half += static_cast<sum_type>(u[j - i] * static_cast<sum_type>(u[i]));
+          }
 
-        for(std::int32_t i = j; i >= static_cast<std::int32_t>(0); i--)
+          sum += static_cast<sum_type>(sum_half * 2U);
+
+          if((j % 2) == 0)
+          {
+            sum += static_cast<sum_type>(u[j / 2] * static_cast<sum_type>(u[j / 2]));
+          }
+        }
+        else
         {
-          sum += static_cast<double_limb_type>(u[j - i] * static_cast<double_limb_type>(v[i]));
+          for(std::int32_t i = j; i >= static_cast<std::int32_t>(0); i--)
+          {
+            sum += static_cast<sum_type>(u[j - i] * static_cast<sum_type>(v[i]));
+          }
         }
 
         u[j]  = static_cast<limb_type>(sum % static_cast<limb_type>(decwide_t_elem_mask));
-        carry = static_cast<double_limb_type>(sum / static_cast<limb_type>(decwide_t_elem_mask));
+        carry = static_cast<sum_type>(sum / static_cast<limb_type>(decwide_t_elem_mask));
       }
 
       return static_cast<limb_type>(carry);
@@ -2179,68 +2381,113 @@
 
       // We now have the needed FFT size doubled (and doubled again).
 
-      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      fft_float_type* my_af_bf_fft_mul_pool = new fft_float_type[n_fft * 2U];
-      #endif
+      // Obtain the (persistent) scratch memory. Allocation and the
+      // computation of the twiddle table only take place when
+      // a larger FFT size is encountered for the first time.
+      fft_float_type*       af_bf = my_fft_scratch.work(static_cast<std::uint32_t>(n_fft * 2U));
+      const fft_float_type* tw    = my_fft_scratch.twiddles(n_fft);
 
-      std::fill(my_af_bf_fft_mul_pool, my_af_bf_fft_mul_pool + (n_fft * 2U), fft_float_type(0));
+      // For squaring (with u and v being the same array),
+      // only one forward FFT is needed.
+      const bool is_square = (u == v);
 
-      fft_float_type* af = my_af_bf_fft_mul_pool + (0U * n_fft);
-      fft_float_type* bf = my_af_bf_fft_mul_pool + (1U * n_fft);
+      fft_float_type* af = af_bf + (0U * n_fft);
+      fft_float_type* bf = (is_square ? af : af_bf + (1U * n_fft));
 
       for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < static_cast<std::uint32_t>(prec_elems_for_multiply); ++i)
       {
         af[(i * 2U)]      = fft_float_type(u[i] / decwide_t_elem_mask_half);
         af[(i * 2U) + 1U] = fft_float_type(u[i] % decwide_t_elem_mask_half);
+      }
+
+      // Only the zero-padding needs to be cleared.
+      std::fill(af + (prec_elems_for_multiply * 2L), af + n_fft, fft_float_type(0));
+
+      if(is_square == false)
+      {
+        for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < static_cast<std::uint32_t>(prec_elems_for_multiply); ++i)
+        {
+          bf[(i * 2U)]      = fft_float_type(v[i] / decwide_t_elem_mask_half);
+          bf[(i * 2U) + 1U] = fft_float_type(v[i] % decwide_t_elem_mask_half);
+        }
 
-        bf[(i * 2U)]      = fft_float_type(v[i] / decwide_t_elem_mask_half);
-        bf[(i * 2U) + 1U] = fft_float_type(v[i] % decwide_t_elem_mask_half);
+        std::fill(bf + (prec_elems_for_multiply * 2L), bf + n_fft, fft_float_type(0));
       }
 
-      // Perform forward FFTs on the data arrays a and b.
-      detail::fft::rfft_lanczos_rfft<fft_float_type, true>(n_fft, af);
-      detail::fft::rfft_lanczos_rfft<fft_float_type, true>(n_fft, bf);
+      // The real data arrays a and b (of length n_fft) are treated
+      // as complex data arrays of length n_fft / 2.
+      const std::uint32_t n_cplx = static_cast<std::uint32_t>(n_fft / 2U);
 
-      // Perform the convolution of a and b in the transform space.
-      // This does, in fact, execute the actual multiplication of (a * b).
-      af[0U] *= bf[0U];
-      af[1U] *= bf[1U];
+      // Perform forward FFTs on the data arrays a and b.
+      detail::fft::fft_forward(n_cplx, af, tw);
 
-      for(std::uint32_t j = static_cast<std::uint32_t>(2U); j < n_fft; j += 2U)
+      if(is_square == false)
       {
-        const fft_float_type tmp_aj = af[j];
-
-        af[j + 0U] = (tmp_aj * bf[j + 0U]) - (af[j + 1U] * bf[j + 1U]);
-        af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
+        detail::fft::fft_forward(n_cplx, bf, tw);
       }
 
+      // Perform the convolution of a and b in the transform space.
+      // This does, in fact, execute the actual multiplication of (a * b).
+      detail::fft::convolve_real_spectra(n_cplx, af, bf, tw);
+
       // Perform the reverse FFT on the result of the convolution.
-      detail::fft::rfft_lanczos_rfft<fft_float_type, false>(n_fft, af);
+      detail::fft::fft_inverse(n_cplx, af, tw);
 
       // Release the carries and re-combine the low and high parts.
       // This sets the integral data elements in the big number
-      // to the result of multiplication.
-      double_limb_type carry = static_cast<double_limb_type>(0U);
+      // to the result of multiplication. The convolution sums
+      // can exceed the range of double_limb_type for small limbs,
+      // so the carries are released in a 64-bit type.
+      std::uint64_t carry = static_cast<std::uint64_t>(0U);
 
       for(std::uint32_t j = static_cast<std::uint32_t>((prec_elems_for_multiply * 2L) - 2L); static_cast<std::int32_t>(j) >= 0; j -= 2U)
       {
         fft_float_type         xaj = af[j] / (n_fft / 2U);
-        const double_limb_type xlo = static_cast<double_limb_type>(xaj + detail::fft::template_half<fft_float_type>()) + carry;
-        carry                      = static_cast<double_limb_type>(xlo / static_cast<limb_type>(decwide_t_elem_mask_half));
-        const limb_type        nlo = static_cast<limb_type>       (xlo - static_cast<double_limb_type>(carry * static_cast<limb_type>(decwide_t_elem_mask_half)));
+        const std::uint64_t    xlo = static_cast<std::uint64_t>(xaj + detail::fft::template_half<fft_float_type>()) + carry;
+        carry                      = static_cast<std::uint64_t>(xlo / static_cast<limb_type>(decwide_t_elem_mask_half));
+        const limb_type        nlo = static_cast<limb_type>       (xlo - static_cast<std::uint64_t>(carry * static_cast<limb_type>(decwide_t_elem_mask_half)));
 
                                xaj = ((j != 0) ? (af[j - 1U] / (n_fft / 2U)) : fft_float_type(0));
-        const double_limb_type xhi = static_cast<double_limb_type>(xaj + detail::fft::template_half<fft_float_type>()) + carry;
-        carry                      = static_cast<double_limb_type>(xhi / static_cast<limb_type>(decwide_t_elem_mask_half));
-        const limb_type        nhi = static_cast<limb_type>       (xhi - static_cast<double_limb_type>(carry * static_cast<limb_type>(decwide_t_elem_mask_half)));
+        const std::uint64_t    xhi = static_cast<std::uint64_t>(xaj + detail::fft::template_half<fft_float_type>()) + carry;
+        carry                      = static_cast<std::uint64_t>(xhi / static_cast<limb_type>(decwide_t_elem_mask_half));
+        const limb_type        nhi = static_cast<limb_type>       (xhi - static_cast<std::uint64_t>(carry * static_cast<limb_type>(decwide_t_elem_mask_half)));
 
         u[(j / 2U)] = static_cast<limb_type>(static_cast<limb_type>(nhi * static_cast<limb_type>(decwide_t_elem_mask_half)) + nlo);
       }
 
-      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      // De-allocate the dynamic memory for the FFT result arrays.
-      delete [] my_af_bf_fft_mul_pool;
-      #endif
+    }
+
+    static bool mul_loop_ntt(limb_type* const u, const limb_type* const v, const std::int32_t prec_elems_for_multiply)
+    {
+      // Determine the transform length, which is the smallest
+      // power of two holding the (2n - 1) convolution sums.
+      std::uint32_t n_ntt = static_cast<std::uint32_t>(1U);
+
+      while(n_ntt < static_cast<std::uint32_t>(prec_elems_for_multiply * 2L))
+      {
+        n_ntt <<= 1U;
+      }
+
+      const bool ntt_is_available = (n_ntt <= detail::ntt::ntt_max_transform_length);
+
+      if(ntt_is_available)
+      {
+        std::uint32_t*       work = my_ntt_scratch.work(n_ntt);
+        const std::uint32_t* tw   = my_ntt_scratch.twiddles(n_ntt);
+
+        detail::ntt::mul_loop_ntt<static_cast<std::uint32_t>(decwide_t_elem_mask)>(u,
+                                                                                   static_cast<std::uint32_t>(prec_elems_for_multiply),
+                                                                                   u,
+                                                                                   static_cast<std::uint32_t>(prec_elems_for_multiply),
+                                                                                   v,
+                                                                                   static_cast<std::uint32_t>(prec_elems_for_multiply),
+                                                                                   n_ntt,
+                                                                                   work,
+                                                                                   tw,
+                                                                                   my_ntt_scratch.tw_length());
+      }
+
+      return ntt_is_available;
     }
 
     template<const std::int32_t ElemsForFftThreshold>
@@ -2295,12 +2542,22 @@
       }
       else
       {
-        // Use FFT-based multiplication.
-        mul_loop_fft(my_data.data(), v.my_data.data(), static_cast<std::int32_t>(prec_elems_for_multiply));
+        // Use NTT-based multiplication for very high precision, and
+        // FFT-based multiplication otherwise (or if the precision exceeds
+        // the maximum NTT length). Both store the carry out of the highest
+        // product limb in the first element of the result.
+        const bool is_mul_by_ntt =
+             (prec_elems_for_multiply >= decwide_t_elems_for_ntt)
+          && mul_loop_ntt(my_data.data(), v.my_data.data(), static_cast<std::int32_t>(prec_elems_for_multiply));
+
+        if(is_mul_by_ntt == false)
+        {
+          mul_loop_fft(my_data.data(), v.my_data.data(), static_cast<std::int32_t>(prec_elems_for_multiply));
+        }
 
         if(my_data.front() != static_cast<limb_type>(0U))
         {
-          // Adjust the exponent because of the internal scaling of the FFT multiplication.
+          // Adjust the exponent because of the internal scaling of the transform multiplication.
           my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
         }
         else
@@ -3085,13 +3342,18 @@
   typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::initializer decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::init;
   #endif
 
-  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  thread_local typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::fft_scratch_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_fft_scratch;
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  thread_local typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::ntt_scratch_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_ntt_scratch;
   #else
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
-  typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::fft_float_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_af_bf_fft_mul_pool[detail::decwide_t_helper<MyDigits10, LimbType>::pow2_maker_of_upper_limit(decwide_t_elem_number) * 8UL];
+  typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::fft_scratch_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_fft_scratch;
 
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
-  typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::array_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_n_data_for_add_sub;
+  typename decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::ntt_scratch_type decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>::my_ntt_scratch;
   #endif
 
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
@@ -3132,43 +3394,57 @@
            );
   }
 
-  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
-  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t))
+  // The state of the AGM iteration of calc_pi (see below). The
+  // iteration can be interrupted after any step and be resumed
+  // later from the state, which only consists of the four values
+  // a, b, t, s and the iteration index k. This is used for saving
+  // checkpoints during very long calculations of pi.
+  template<const std::int32_t MyDigits10,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType = std::int64_t>
+  struct calc_pi_state
   {
-    // Description : Compute pi using the quadratically convergent Gauss AGM,
-    //               in particular the Schoenhage variant.
-    //               For a description of the algorithm see the book "Pi Unleashed":
-    //               If the input b_trace = true, then the calculation progress
-    //               will be output to cout.
-    //
-    //               Book reference:
-    //               http://www.jjj.de/pibook/pibook.html
-    //               http://www.springer.com/gp/book/9783642567353
-
-    if(pfn_callback_to_report_digits10 != nullptr)
-    {
-      pfn_callback_to_report_digits10((std::uint32_t) 0U);
-    }
-
     using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
 
-    floating_point_type val_pi;
-
-    floating_point_type a(1U);
-
-    // Initialize bB to 0.5.
-    floating_point_type bB(half<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
-
-    // Initialize t to 0.375.
-    floating_point_type t(floating_point_type(3U) / 8U);
+    floating_point_type a;
+    floating_point_type bB;
+    floating_point_type t;
+    floating_point_type s;
+    std::uint32_t       k;
+    bool                is_converged;
+
+    // The initial state has a = 1, bB = 1/2, t = 3/8 and s = 1/2.
+    calc_pi_state() : a           (1U),
+                      bB          (half<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>()),
+                      t           (floating_point_type(3U) / 8U),
+                      s           (half<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>()),
+                      k           (0U),
+                      is_converged(false) { }
+  };
 
-    floating_point_type s(bB);
+  // Perform one iteration of the AGM of calc_pi. The return value
+  // is true if the iteration has converged, after which the value
+  // of pi is obtained from calc_pi_result.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  bool calc_pi_iterate(calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& state,
+                       void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
 
     // This loop is designed for a maximum of several million
     // decimal digits of pi. The index k should reach no higher
     // than about 25 or 30. After about 20 iterations, the precision
     // is about one million decimal digits.
 
+    if(state.is_converged || (state.k >= 48U))
+    {
+      state.is_converged = true;
+
+      return true;
+    }
+
     const std::uint32_t digits10_iteration_goal =
         (std::uint32_t) (std::numeric_limits<floating_point_type>::digits10 / 2)
       + (std::max)((std::uint32_t) (floating_point_type::decwide_t_elem_digits10  + 1), (std::uint32_t) 9U);
@@ -3178,79 +3454,663 @@
     const std::uint32_t digits10_scale =
       (std::uint32_t) (0.5F + (1000.0F * log((float) std::numeric_limits<floating_point_type>::radix)) / log(10.0F));
 
-    for(unsigned k = 0U; k < 48U; ++k)
-    {
-      using std::sqrt;
-
-      a      += sqrt(bB);
-      a      /= 2U;
-      val_pi  = a;
-      val_pi *= a;
-      bB      = val_pi;
-      bB     -= t;
-      bB     *= 2U;
-
-      floating_point_type iterate_term(bB);
+    using std::sqrt;
 
-      iterate_term -= val_pi;
-      iterate_term *= (unsigned long long) (1ULL << (k + 1U));
+    floating_point_type val_pi;
 
-      s += iterate_term;
+    state.a  += sqrt(state.bB);
+    state.a  /= 2U;
+    val_pi    = state.a;
+    val_pi.square_in_place();
+    state.bB  = val_pi;
+    state.bB -= state.t;
+    state.bB *= 2U;
 
-      // Test the number of precise digits from this iteration.
-      // If it is there are enough precise digits, then the calculation
-      // is finished.
-      const std::int32_t ib = (std::max)(std::int32_t(0), -ilogb(iterate_term));
+    floating_point_type iterate_term(state.bB);
 
-      const std::uint32_t digits10_of_iteration =
-        (std::uint32_t) ((std::uint64_t) ((std::uint64_t) ib * digits10_scale) / 1000U);
+    iterate_term -= val_pi;
+    iterate_term *= (unsigned long long) (1ULL << (state.k + 1U));
 
-      if(pfn_callback_to_report_digits10 != nullptr)
-      {
-        pfn_callback_to_report_digits10(digits10_of_iteration);
-      }
+    state.s += iterate_term;
 
-      // Estimate the approximate decimal digits of this iteration term.
-      // If we have attained about half of the total desired digits
-      // with this iteration term, then the calculation is finished
-      // because the change from the next iteration will be
-      // insignificantly small.
+    // Test the number of precise digits from this iteration.
+    // If it is there are enough precise digits, then the calculation
+    // is finished.
+    const std::int32_t ib = (std::max)(std::int32_t(0), -ilogb(iterate_term));
 
-      if(digits10_of_iteration > digits10_iteration_goal)
-      {
-        break;
-      }
+    const std::uint32_t digits10_of_iteration =
+      (std::uint32_t) ((std::uint64_t) ((std::uint64_t) ib * digits10_scale) / 1000U);
 
-      t  = val_pi;
-      t += bB;
-      t /= 4U;
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10(digits10_of_iteration);
     }
 
-    val_pi += bB;
-    val_pi /= s;
+    // Estimate the approximate decimal digits of this iteration term.
+    // If we have attained about half of the total desired digits
+    // with this iteration term, then the calculation is finished
+    // because the change from the next iteration will be
+    // insignificantly small.
 
-    if(pfn_callback_to_report_digits10 != nullptr)
+    if(digits10_of_iteration > digits10_iteration_goal)
     {
-      pfn_callback_to_report_digits10((std::uint32_t) std::numeric_limits<floating_point_type>::digits10);
+      state.is_converged = true;
     }
+    else
+    {
+      state.t  = val_pi;
+      state.t += state.bB;
+      state.t /= 4U;
 
-    return val_pi;
+      ++state.k;
+    }
+
+    return state.is_converged;
   }
 
-  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_ln_two()
+  // The value of pi from the converged state of the AGM.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi_result(const calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& state)
   {
     using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
 
-    // Use an AGM method to compute log(2).
+    floating_point_type val_pi(state.a);
 
-    // Set a0 = 1
-    // Set b0 = 1 / (2^(m-2))
+    val_pi.square_in_place();
+    val_pi += state.bB;
+    val_pi /= state.s;
 
-    floating_point_type ak(1U);
+    return val_pi;
+  }
 
-    using std::log;
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t))
+  {
+    // Description : Compute pi using the quadratically convergent Gauss AGM,
+    //               in particular the Schoenhage variant.
+    //               For a description of the algorithm see the book "Pi Unleashed":
+    //               If the input b_trace = true, then the calculation progress
+    //               will be output to cout.
+    //
+    //               Book reference:
+    //               http://www.jjj.de/pibook/pibook.html
+    //               http://www.springer.com/gp/book/9783642567353
 
-    const float n_times_factor = ((float) std::numeric_limits<floating_point_type>::digits10) * 1.67F;
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) 0U);
+    }
+
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> state;
+
+    while(calc_pi_iterate(state, pfn_callback_to_report_digits10) == false) { ; }
+
+    const floating_point_type val_pi = calc_pi_result(state);
+
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) std::numeric_limits<floating_point_type>::digits10);
+    }
+
+    return val_pi;
+  }
+
+  namespace detail {
+
+  // The binary splitting of the Chudnovsky series
+  //   1 / pi = 12 / 640320^(3/2) * sum_k (-1)^k (6k)! (13591409 + 545140134 k) / ((3k)! (k!)^3 640320^(3k)),
+  // in which P, Q and T of the terms [a, b) are computed exactly.
+  // P is only needed for the left halves (and for the caller).
+  // See also Sect. 4.9 in R.P. Brent and P. Zimmermann, "Modern
+  // Computer Arithmetic", Cambridge University Press (2011), and
+  // B. Haible and T. Papanikolaou, "Fast multiprecision evaluation of
+  // series of rational numbers", Technical Report TI-7/97 (1997).
+  template<typename IntegerType>
+  void chudnovsky_binary_splitting(const std::uint32_t a,
+                                   const std::uint32_t b,
+                                         IntegerType&  p,
+                                         IntegerType&  q,
+                                         IntegerType&  t,
+                                   const bool          p_is_needed)
+  {
+    if(static_cast<std::uint32_t>(b - a) == static_cast<std::uint32_t>(1U))
+    {
+      if(a == static_cast<std::uint32_t>(0U))
+      {
+        p = IntegerType(static_cast<std::uint64_t>(1U));
+        q = IntegerType(static_cast<std::uint64_t>(1U));
+        t = IntegerType(static_cast<std::uint64_t>(UINT64_C(13591409)));
+      }
+      else
+      {
+        const std::uint64_t k = a;
+
+        // p = (6k - 5)(2k - 1)(6k - 1), q = k^3 * 640320^3 / 24.
+        p  = IntegerType(static_cast<std::uint64_t>((k * 6U) - 5U));
+        p *= IntegerType(static_cast<std::uint64_t>(((k * 2U) - 1U) * ((k * 6U) - 1U)));
+
+        q  = IntegerType(static_cast<std::uint64_t>(k * k));
+        q *= IntegerType(k);
+        q *= IntegerType(static_cast<std::uint64_t>(UINT64_C(10939058860032000)));
+
+        t  = p;
+        t *= IntegerType(static_cast<std::uint64_t>(UINT64_C(13591409) + (UINT64_C(545140134) * k)));
+
+        // For an unsigned integer type (such as uintwide_t) the negation
+        // wraps around. This is harmless, since the arithmetic is then
+        // modulo 2^N, and the final T is positive (provided it fits).
+        if((a & 1U) != static_cast<std::uint32_t>(0U))
+        {
+          t = IntegerType(static_cast<std::uint64_t>(0U)) - t;
+        }
+      }
+    }
+    else
+    {
+      const std::uint32_t m = static_cast<std::uint32_t>(a + ((b - a) / 2U));
+
+      IntegerType p_right;
+      IntegerType q_right;
+      IntegerType t_right;
+
+      chudnovsky_binary_splitting(a, m, p,       q,       t,       true);
+      chudnovsky_binary_splitting(m, b, p_right, q_right, t_right, p_is_needed);
+
+      // T = T_left * Q_right + P_left * T_right.
+      t *= q_right;
+      t += (p * t_right);
+
+      q *= q_right;
+
+      if(p_is_needed)
+      {
+        p *= p_right;
+      }
+    }
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  // Conversion of the (exact) dynamic integer to decwide_t,
+  // which simply copies (and truncates) the limbs. The result
+  // is optionally divided by the limb radix raised to the
+  // power limb_offset.
+  template<typename DecwideType,
+           typename LimbType,
+           typename AllocatorType>
+  DecwideType binary_splitting_integer_to_decwide(const dynamic_integer<LimbType, AllocatorType>& n,
+                                                  const std::int64_t limb_offset = INT64_C(0))
+  {
+    using exponent_type = typename DecwideType::exponent_type;
+
+    return (n.iszero() ? DecwideType(0U)
+                       : DecwideType(n.crepresentation(),
+                                     static_cast<std::uint_fast32_t>(n.size()),
+                                     static_cast<exponent_type>(static_cast<exponent_type>(static_cast<std::int64_t>(n.size() - 1U) - limb_offset) * DecwideType::decwide_t_elem_digits10),
+                                     n.isneg()));
+  }
+  #endif
+
+  // Conversion of a non-negative integer of any other type (such as
+  // uintwide_t) to decwide_t. The limbs are obtained by division by
+  // the limb radix, and only the most significant ones are kept.
+  template<typename DecwideType,
+           typename IntegerType>
+  DecwideType binary_splitting_integer_to_decwide(const IntegerType& n)
+  {
+    using limb_type     = typename DecwideType::limb_type;
+    using exponent_type = typename DecwideType::exponent_type;
+
+    constexpr std::uint_fast32_t elem_number = static_cast<std::uint_fast32_t>(DecwideType::decwide_t_elem_number);
+
+    typename DecwideType::array_type ring;
+
+    IntegerType x(n);
+
+    std::uint_fast32_t count = 0U;
+
+    for( ; x != IntegerType(static_cast<std::uint64_t>(0U)); ++count)
+    {
+      ring[count % elem_number] = static_cast<limb_type>(x % static_cast<std::uint32_t>(DecwideType::decwide_t_elem_mask));
+
+      x /= static_cast<std::uint32_t>(DecwideType::decwide_t_elem_mask);
+    }
+
+    // Bring the most significant limb to the front.
+    const std::uint_fast32_t kept = (std::min)(count, elem_number);
+
+    typename DecwideType::array_type limbs;
+
+    for(std::uint_fast32_t i = 0U; i < kept; ++i)
+    {
+      limbs[i] = ring[(count - 1U - i) % elem_number];
+    }
+
+    return ((count == 0U) ? DecwideType(0U)
+                          : DecwideType(limbs.data(),
+                                        kept,
+                                        static_cast<exponent_type>(static_cast<exponent_type>(count - 1U) * DecwideType::decwide_t_elem_digits10)));
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  // Above this precision, exp, sin, cos and atan sum their series
+  // with binary splitting (see below). Below it, the direct series
+  // in decwide_t arithmetic are faster.
+  constexpr std::int32_t decwide_t_binary_splitting_digits10 = static_cast<std::int32_t>(INT32_C(400));
+
+  // A series with rational terms of the form
+  //   S = sum_{n >= 0} (1 / b(n)) prod_{k = 1}^{n} p / (c(k) radix^s),
+  // having a common exact numerator p, small integral denominators c(k),
+  // a power s of the limb radix and optional small integral divisors b(n)
+  // with b(0) = 1. The series of exp, sin, cos, atan and log(2) all have
+  // this form. See also Sect. 4.9 in Brent and Zimmermann (2011) and
+  // Haible and Papanikolaou (1997), which are cited above.
+  template<typename LimbType,
+           typename AllocatorType>
+  struct rational_series
+  {
+    dynamic_integer<LimbType, AllocatorType> p;
+
+    std::uint32_t s;
+
+    std::uint64_t(*pfn_c)(const std::uint32_t);
+    std::uint64_t(*pfn_b)(const std::uint32_t);
+  };
+
+  inline std::uint64_t rational_series_c_exp (const std::uint32_t k) { return static_cast<std::uint64_t>(k); }
+  inline std::uint64_t rational_series_c_sin (const std::uint32_t k) { return static_cast<std::uint64_t>(static_cast<std::uint64_t>(k) * 2U) * static_cast<std::uint64_t>((static_cast<std::uint64_t>(k) * 2U) + 1U); }
+  inline std::uint64_t rational_series_c_cos (const std::uint32_t k) { return static_cast<std::uint64_t>(static_cast<std::uint64_t>(k) * 2U) * static_cast<std::uint64_t>((static_cast<std::uint64_t>(k) * 2U) - 1U); }
+  inline std::uint64_t rational_series_c_one (const std::uint32_t)   { return static_cast<std::uint64_t>(1U); }
+  inline std::uint64_t rational_series_c_nine(const std::uint32_t)   { return static_cast<std::uint64_t>(9U); }
+  inline std::uint64_t rational_series_b_odd (const std::uint32_t k) { return static_cast<std::uint64_t>((static_cast<std::uint64_t>(k) * 2U) + 1U); }
+
+  // The binary splitting of the terms [a, b) of a rational series,
+  // in which P, Q (the product of the c(k)), B and T are computed
+  // exactly, such that S(a, b) = T / (B Q radix^(s (b - a))) for a > 0
+  // (and with the exponent s (b - 1) for a = 0). As in the Chudnovsky
+  // series, P is only needed for the left halves.
+  template<typename LimbType,
+           typename AllocatorType>
+  void rational_series_binary_splitting(const rational_series<LimbType, AllocatorType>& series,
+                                        const std::uint32_t                              a,
+                                        const std::uint32_t                              b,
+                                              dynamic_integer<LimbType, AllocatorType>&  p,
+                                              dynamic_integer<LimbType, AllocatorType>&  q,
+                                              dynamic_integer<LimbType, AllocatorType>&  d,
+                                              dynamic_integer<LimbType, AllocatorType>&  t,
+                                        const bool                                       p_is_needed)
+  {
+    using integer_type = dynamic_integer<LimbType, AllocatorType>;
+
+    if(static_cast<std::uint32_t>(b - a) == static_cast<std::uint32_t>(1U))
+    {
+      if(a == static_cast<std::uint32_t>(0U))
+      {
+        p = integer_type(static_cast<std::uint64_t>(1U));
+        q = integer_type(static_cast<std::uint64_t>(1U));
+        d = integer_type(static_cast<std::uint64_t>(1U));
+        t = integer_type(static_cast<std::uint64_t>(1U));
+      }
+      else
+      {
+        p = series.p;
+        q = integer_type(series.pfn_c(a));
+        d = integer_type((series.pfn_b != nullptr) ? series.pfn_b(a) : static_cast<std::uint64_t>(1U));
+        t = p;
+      }
+    }
+    else
+    {
+      const std::uint32_t m = static_cast<std::uint32_t>(a + ((b - a) / 2U));
+
+      integer_type p_right;
+      integer_type q_right;
+      integer_type d_right;
+      integer_type t_right;
+
+      rational_series_binary_splitting(series, a, m, p,       q,       d,       t,       true);
+      rational_series_binary_splitting(series, m, b, p_right, q_right, d_right, t_right, p_is_needed);
+
+      // T = B_right * Q_right * T_left * radix^(s (b - m)) + B_left * P_left * T_right.
+      const bool has_divisors = (series.pfn_b != nullptr);
+
+      if(has_divisors)
+      {
+        t *= d_right;
+      }
+
+      t *= q_right;
+      t.shift_left_limbs(static_cast<std::uint32_t>(series.s * (b - m)));
+
+      integer_type p_times_t_right(p);
+
+      p_times_t_right *= t_right;
+
+      if(has_divisors)
+      {
+        p_times_t_right *= d;
+        d               *= d_right;
+      }
+
+      t += p_times_t_right;
+      q *= q_right;
+
+      if(p_is_needed)
+      {
+        p *= p_right;
+      }
+    }
+  }
+
+  // The number of terms [0, n) of a rational series, for which the
+  // last term is below 10^-digits10. Here lg_ratio is an upper bound
+  // of the decimal logarithm of |p / radix^s|.
+  inline std::uint32_t rational_series_term_count(const double lg_ratio,
+                                                   std::uint64_t(*pfn_c)(const std::uint32_t),
+                                                   const std::int32_t digits10)
+  {
+    double lg_term = 0.0;
+
+    std::uint32_t n = 1U;
+
+    for( ; (lg_term > -static_cast<double>(digits10)) && (n < UINT32_C(0x10000000)); ++n)
+    {
+      lg_term += (lg_ratio - std::log10(static_cast<double>(pfn_c(n))));
+    }
+
+    return n;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> rational_series_sum(const rational_series<LimbType, AllocatorType>& series)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using integer_type        = dynamic_integer<LimbType, AllocatorType>;
+    using limb_type           = typename floating_point_type::limb_type;
+
+    // The upper bound of the decimal logarithm of |p| is obtained
+    // from its (at most) two leading limbs and its count of limbs.
+    const limb_type* p_limbs = series.p.crepresentation();
+
+    const double lg_p =
+      ((series.p.size() == 1U)
+        ? std::log10(static_cast<double>(p_limbs[0U]))
+        :   std::log10((static_cast<double>(p_limbs[0U]) * static_cast<double>(floating_point_type::decwide_t_elem_mask)) + static_cast<double>(p_limbs[1U] + 1U))
+          + static_cast<double>(static_cast<std::int32_t>(series.p.size() - 2U) * floating_point_type::decwide_t_elem_digits10));
+
+    const double lg_ratio =
+      lg_p - static_cast<double>(static_cast<std::int32_t>(series.s) * floating_point_type::decwide_t_elem_digits10);
+
+    const std::uint32_t term_count =
+      rational_series_term_count(lg_ratio, series.pfn_c, std::numeric_limits<floating_point_type>::digits10 + floating_point_type::decwide_t_elem_digits10);
+
+    integer_type p;
+    integer_type q;
+    integer_type d;
+    integer_type t;
+
+    rational_series_binary_splitting(series, static_cast<std::uint32_t>(0U), term_count, p, q, d, t, false);
+
+    q *= d;
+
+    floating_point_type result =
+      binary_splitting_integer_to_decwide<floating_point_type>(t, static_cast<std::int64_t>(static_cast<std::int64_t>(series.s) * static_cast<std::int64_t>(term_count - 1U)));
+
+    result /= binary_splitting_integer_to_decwide<floating_point_type>(q);
+
+    return result;
+  }
+
+  // The limbs of x (with |x| < 1) at the limb positions (lo, hi] after
+  // the decimal point as a signed integer u, such that u / radix^hi is
+  // the part of x at these positions. For the bit-burst algorithm, x is
+  // cut into the chunks (0, 1], (1, 2], (2, 4], (4, 8], ..., in which
+  // the count of limbs doubles, and the chunks get smaller in magnitude
+  // by the same count of limbs. See Sect. 4.9.1 in Brent and Zimmermann.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  dynamic_integer<LimbType, AllocatorType> bit_burst_chunk(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x,
+                                                          const std::uint32_t lo,
+                                                          const std::uint32_t hi)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using integer_type        = dynamic_integer<LimbType, AllocatorType>;
+
+    // The position of the first limb.
+    const std::int64_t first_pos = static_cast<std::int64_t>(-x.exponent() / floating_point_type::decwide_t_elem_digits10);
+
+    const std::int64_t i_begin = (std::max)(static_cast<std::int64_t>((static_cast<std::int64_t>(lo) + 1) - first_pos), static_cast<std::int64_t>(0));
+    const std::int64_t i_hi    = static_cast<std::int64_t>((static_cast<std::int64_t>(hi) + 1) - first_pos);
+    const std::int64_t i_end   = (std::min)(i_hi, static_cast<std::int64_t>(floating_point_type::decwide_t_elem_number));
+
+    if(x.iszero() || (i_begin >= i_end))
+    {
+      return integer_type();
+    }
+
+    integer_type u(x.crepresentation().data() + i_begin, static_cast<std::uint32_t>(i_end - i_begin), x.isneg());
+
+    // The chunk beyond the end of the mantissa is padded with zeros.
+    u.shift_left_limbs(static_cast<std::uint32_t>(i_hi - i_end));
+
+    return u;
+  }
+
+  // The position of the last limb of x (see above).
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  std::uint32_t bit_burst_last_pos(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    return static_cast<std::uint32_t>((-x.exponent() / floating_point_type::decwide_t_elem_digits10) + (floating_point_type::decwide_t_elem_number - 1));
+  }
+
+  // exp(x) for |x| < 1 as the product of the exp(u / radix^hi)
+  // of the bit-burst chunks of x.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> exp_bit_burst(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    floating_point_type result(1U);
+
+    const std::uint32_t last_pos = bit_burst_last_pos(x);
+
+    for(std::uint32_t lo = 0U, hi = 1U; lo < last_pos; lo = hi, hi *= 2U)
+    {
+      rational_series<LimbType, AllocatorType> series;
+
+      series.p     = bit_burst_chunk(x, lo, hi);
+      series.s     = hi;
+      series.pfn_c = rational_series_c_exp;
+      series.pfn_b = nullptr;
+
+      if(series.p.iszero() == false)
+      {
+        result *= rational_series_sum<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>(series);
+      }
+    }
+
+    return result;
+  }
+
+  // sin(x) and cos(x) for |x| < 1 from the sines and cosines of the
+  // bit-burst chunks of x, which are combined with the addition theorems.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  void sin_cos_bit_burst(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x,
+                               decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& sin_x,
+                               decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& cos_x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using integer_type        = dynamic_integer<LimbType, AllocatorType>;
+
+    sin_x = floating_point_type(0U);
+    cos_x = floating_point_type(1U);
+
+    const std::uint32_t last_pos = bit_burst_last_pos(x);
+
+    for(std::uint32_t lo = 0U, hi = 1U; lo < last_pos; lo = hi, hi *= 2U)
+    {
+      const integer_type u = bit_burst_chunk(x, lo, hi);
+
+      if(u.iszero() == false)
+      {
+        // sin(r) = r * sum_n (-r^2)^n / (2n + 1)!
+        // cos(r) =     sum_n (-r^2)^n / (2n)!
+        rational_series<LimbType, AllocatorType> series;
+
+        series.p    -= (integer_type(u) *= u);
+        series.s     = static_cast<std::uint32_t>(hi * 2U);
+        series.pfn_c = rational_series_c_sin;
+        series.pfn_b = nullptr;
+
+        floating_point_type sin_r = rational_series_sum<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>(series);
+
+        sin_r *= binary_splitting_integer_to_decwide<floating_point_type>(u, static_cast<std::int64_t>(hi));
+
+        series.pfn_c = rational_series_c_cos;
+
+        const floating_point_type cos_r = rational_series_sum<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>(series);
+
+        const floating_point_type sin_tmp(sin_x);
+
+        sin_x *= cos_r;
+        sin_x += (cos_x * sin_r);
+
+        cos_x *= cos_r;
+        cos_x -= (sin_tmp * sin_r);
+      }
+    }
+  }
+
+  // atan(x) for 0 <= x < 1/10 as the sum of the atan(u / radix^hi) of the
+  // bit-burst chunks. The chunks are taken from the successive remainders
+  //   y_next = (y - r) / (1 + y r),
+  // for which atan(y) = atan(r) + atan(y_next).
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> atan_bit_burst(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using integer_type        = dynamic_integer<LimbType, AllocatorType>;
+
+    floating_point_type result(0U);
+    floating_point_type y     (x);
+
+    for(std::uint32_t lo = 0U, hi = 1U; (y.iszero() == false); lo = hi, hi *= 2U)
+    {
+      using std::ilogb;
+
+      if(ilogb(y) < -std::numeric_limits<floating_point_type>::digits10)
+      {
+        // The remaining atan(y) is y itself.
+        result += y;
+
+        break;
+      }
+
+      const integer_type u = bit_burst_chunk(y, lo, hi);
+
+      if(u.iszero() == false)
+      {
+        // atan(r) = r * sum_n (-r^2)^n / (2n + 1)
+        rational_series<LimbType, AllocatorType> series;
+
+        series.p    -= (integer_type(u) *= u);
+        series.s     = static_cast<std::uint32_t>(hi * 2U);
+        series.pfn_c = rational_series_c_one;
+        series.pfn_b = rational_series_b_odd;
+
+        const floating_point_type r = binary_splitting_integer_to_decwide<floating_point_type>(u, static_cast<std::int64_t>(hi));
+
+        result += (r * rational_series_sum<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>(series));
+
+        y = (y - r) / (1 + (y * r));
+      }
+    }
+
+    return result;
+  }
+  #endif // !WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+
+  } // namespace detail
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename BinarySplittingIntegerType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi_chudnovsky(void(*pfn_callback_to_report_digits10)(const std::uint32_t))
+  {
+    // Description : Compute pi using the Chudnovsky series, whose terms
+    //               are summed exactly with binary splitting (see above).
+    //               Each term adds about 14.18 decimal digits. In contrast
+    //               to the AGM in calc_pi, there is only one square root
+    //               and one division at full precision, and the rest of
+    //               the work consists of exact integer multiplications.
+
+    static_assert(std::is_void<BinarySplittingIntegerType>::value == false,
+                  "Error: calc_pi_chudnovsky needs an explicit integer type when dynamic memory allocation is disabled");
+
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) 0U);
+    }
+
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    const std::uint32_t term_count =
+      static_cast<std::uint32_t>((static_cast<std::uint32_t>(std::numeric_limits<floating_point_type>::digits10) / 14U) + 2U);
+
+    BinarySplittingIntegerType p;
+    BinarySplittingIntegerType q;
+    BinarySplittingIntegerType t;
+
+    detail::chudnovsky_binary_splitting(static_cast<std::uint32_t>(0U), term_count, p, q, t, false);
+
+    // pi = (426880 * sqrt(10005) * Q) / T
+    using std::sqrt;
+
+    floating_point_type val_pi = sqrt(floating_point_type(10005U));
+
+    val_pi *= 426880U;
+    val_pi *= detail::binary_splitting_integer_to_decwide<floating_point_type>(q);
+    val_pi /= detail::binary_splitting_integer_to_decwide<floating_point_type>(t);
+
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) std::numeric_limits<floating_point_type>::digits10);
+    }
+
+    return val_pi;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_ln_two()
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    // Use the series log(2) = 2 atanh(1/3) = (2/3) sum_n 1 / ((2n + 1) 9^n),
+    // which is summed with binary splitting.
+    detail::rational_series<LimbType, AllocatorType> series;
+
+    series.p     = detail::dynamic_integer<LimbType, AllocatorType>(static_cast<std::uint64_t>(1U));
+    series.s     = static_cast<std::uint32_t>(0U);
+    series.pfn_c = detail::rational_series_c_nine;
+    series.pfn_b = detail::rational_series_b_odd;
+
+    floating_point_type result = detail::rational_series_sum<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>(series);
+
+    result *= 2U;
+    result /= 3U;
+
+    return result;
+    #else
+    // Use an AGM method to compute log(2).
+
+    // Set a0 = 1
+    // Set b0 = 1 / (2^(m-2))
+
+    floating_point_type ak(1U);
+
+    using std::log;
+
+    const float n_times_factor = ((float) std::numeric_limits<floating_point_type>::digits10) * 1.67F;
 
     // Ensure that the resulting power is non-negative.
     // Also enforce that m >= 3.
@@ -3305,6 +4165,7 @@
          pi<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>() / (ak * (2 * m));
 
     return result;
+    #endif
   }
 
   #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
@@ -3859,6 +4720,38 @@
     {
       exp_result = floating_point_type(1U);
     }
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    else if(std::numeric_limits<floating_point_type>::digits10 >= detail::decwide_t_binary_splitting_digits10)
+    {
+      using std::ilogb;
+
+      if(ilogb(x) < -std::numeric_limits<floating_point_type>::digits10)
+      {
+        exp_result = 1 + x;
+      }
+      else
+      {
+        // Halve the argument s times such that |x / 2^s| < 1, compute
+        // the exponential function of it with the bit-burst algorithm
+        // and square the result s times. The squaring amplifies the
+        // relative error by 2^s, which is about |x|. This is the
+        // inherent condition of exp(x).
+        using std::fabs;
+        using std::log2;
+
+        const double xd = fabs(static_cast<double>(x));
+
+        const int s = ((xd < 1.0) ? 0 : static_cast<int>(static_cast<int>(log2(xd)) + 1));
+
+        exp_result = detail::exp_bit_burst(ldexp(x, -s));
+
+        for(int i = 0; i < s; ++i)
+        {
+          exp_result *= exp_result;
+        }
+      }
+    }
+    #endif
     else
     {
       const bool b_neg = (x < 0);
@@ -3921,6 +4814,253 @@
     return exp_result;
   }
 
+  namespace detail {
+
+  // The count of guard limbs of the argument reduction in sin_cos.
+  constexpr std::int32_t decwide_t_sin_cos_guard_limbs = static_cast<std::int32_t>(INT32_C(4));
+
+  // The direct series of sin(x) and cos(x) for |x| <= pi/4.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  void sin_cos_series(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x,
+                            decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& sin_x,
+                            decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& cos_x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    using std::fabs;
+
+    const floating_point_type minus_x_squared = -(x * x);
+
+    // The terms are compared with the leading terms 1 and x,
+    // so that the series of sin(x) is truncated relative to
+    // its result, also for small x.
+    const floating_point_type tol_cos = std::numeric_limits<floating_point_type>::epsilon();
+    const floating_point_type tol_sin = tol_cos * fabs(x);
+
+    floating_point_type sin_term(x);
+    floating_point_type cos_term(1U);
+
+    sin_x = sin_term;
+    cos_x = cos_term;
+
+    for(std::uint32_t n = 1U; n < UINT32_C(10000000); ++n)
+    {
+      cos_term *= minus_x_squared;
+      cos_term /= static_cast<std::uint64_t>(static_cast<std::uint64_t>(n * 2U) * ((n * 2U) - 1U));
+
+      sin_term *= minus_x_squared;
+      sin_term /= static_cast<std::uint64_t>(static_cast<std::uint64_t>(n * 2U) * ((n * 2U) + 1U));
+
+      if((fabs(cos_term) < tol_cos) && (fabs(sin_term) < tol_sin))
+      {
+        break;
+      }
+
+      cos_x += cos_term;
+      sin_x += sin_term;
+    }
+  }
+
+  // The direct series of atan(x) for |x| < 1/10.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> atan_series(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    using std::fabs;
+
+    const floating_point_type minus_x_squared = -(x * x);
+
+    // The terms are compared with the leading term x,
+    // so that the series is truncated relative to its
+    // result, also for small x.
+    const floating_point_type tol = std::numeric_limits<floating_point_type>::epsilon() * fabs(x);
+
+    floating_point_type x_pow_n(x);
+    floating_point_type result (x);
+
+    for(std::uint32_t n = 1U; n < UINT32_C(10000000); ++n)
+    {
+      x_pow_n *= minus_x_squared;
+
+      const floating_point_type term = x_pow_n / static_cast<std::uint32_t>((n * 2U) + 1U);
+
+      if(fabs(term) < tol)
+      {
+        break;
+      }
+
+      result += term;
+    }
+
+    return result;
+  }
+
+  // sin(x) and cos(x) with the reduction of the argument to |r| <= pi/4,
+  // where x = r + (k * pi/2) and the quadrant k (modulo 4) selects
+  // the signs and the order of sin(r) and cos(r).
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  void sin_cos(const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x,
+                     decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& sin_x,
+                     decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& cos_x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    using std::floor;
+    using std::ilogb;
+
+    // The reduction is done with guard limbs. The subtraction of k * pi/2
+    // cancels the leading digits of x when x is large or close to
+    // a multiple of pi/2, and the guard limbs of pi/2 fill these in.
+    constexpr std::int32_t guard_digits10 =
+      static_cast<std::int32_t>(decwide_t_sin_cos_guard_limbs * floating_point_type::decwide_t_elem_digits10);
+
+    using guard_type = decwide_t<MyDigits10 + guard_digits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    const guard_type x_guard(x.crepresentation().data(),
+                             static_cast<std::uint_fast32_t>(floating_point_type::decwide_t_elem_number),
+                             static_cast<typename guard_type::exponent_type>(x.exponent()),
+                             x.isneg());
+
+    const guard_type half_pi = pi<MyDigits10 + guard_digits10, LimbType, AllocatorType, InternalFloatType, ExponentType>() / 2;
+
+    const guard_type k = floor((x_guard / half_pi) + half<MyDigits10 + guard_digits10, LimbType, AllocatorType, InternalFloatType, ExponentType>());
+
+    const guard_type r_guard = x_guard - (k * half_pi);
+
+    const floating_point_type r =
+      (r_guard.iszero() ? floating_point_type(0U)
+                        : floating_point_type(r_guard.crepresentation().data(),
+                                              static_cast<std::uint_fast32_t>(guard_type::decwide_t_elem_number),
+                                              static_cast<typename floating_point_type::exponent_type>(r_guard.exponent()),
+                                              r_guard.isneg()));
+
+    const std::uint32_t quadrant = static_cast<std::uint32_t>(static_cast<double>(k - (floor(k / 4) * 4)));
+
+    floating_point_type sin_r;
+    floating_point_type cos_r;
+
+    if(ilogb(r) < -std::numeric_limits<floating_point_type>::digits10)
+    {
+      sin_r = r;
+      cos_r = one<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>();
+    }
+    else
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      if(std::numeric_limits<floating_point_type>::digits10 >= decwide_t_binary_splitting_digits10)
+      {
+        sin_cos_bit_burst(r, sin_r, cos_r);
+      }
+      else
+      #endif
+      {
+        sin_cos_series(r, sin_r, cos_r);
+      }
+    }
+
+    switch(quadrant)
+    {
+      case 1U:  sin_x =  cos_r; cos_x = -sin_r; break;
+      case 2U:  sin_x = -sin_r; cos_x = -cos_r; break;
+      case 3U:  sin_x = -cos_r; cos_x =  sin_r; break;
+      default:  sin_x =  sin_r; cos_x =  cos_r; break;
+    }
+  }
+
+  } // namespace detail
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> sin(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    floating_point_type sin_x;
+    floating_point_type cos_x;
+
+    detail::sin_cos(x, sin_x, cos_x);
+
+    return sin_x;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> cos(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    floating_point_type sin_x;
+    floating_point_type cos_x;
+
+    detail::sin_cos(x, sin_x, cos_x);
+
+    return cos_x;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> tan(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    floating_point_type sin_x;
+    floating_point_type cos_x;
+
+    detail::sin_cos(x, sin_x, cos_x);
+
+    return sin_x / cos_x;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> atan(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    using std::ilogb;
+
+    if(x.iszero() || (ilogb(x) < -std::numeric_limits<floating_point_type>::digits10))
+    {
+      return x;
+    }
+
+    const bool b_neg = (x < 0);
+
+    floating_point_type xx((b_neg == false) ? x : -x);
+
+    // Use atan(x) = pi/2 - atan(1/x) for x > 1.
+    const bool b_invert = (xx > 1);
+
+    if(b_invert)
+    {
+      xx = 1 / xx;
+    }
+
+    // Reduce the argument below 1/10 by halving the angle three times,
+    // with atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))).
+    for(std::uint_fast8_t i = 0U; i < 3U; ++i)
+    {
+      using std::sqrt;
+
+      xx /= (1 + sqrt(1 + (xx * xx)));
+    }
+
+    floating_point_type result;
+
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    if(std::numeric_limits<floating_point_type>::digits10 >= detail::decwide_t_binary_splitting_digits10)
+    {
+      result = detail::atan_bit_burst(xx);
+    }
+    else
+    #endif
+    {
+      result = detail::atan_series(xx);
+    }
+
+    result *= 8U;
+
+    if(b_invert)
+    {
+      result = (pi<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>() / 2) - result;
+    }
+
+    return ((b_neg == false) ? result : -result);
+  }
+
   template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType> decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> pow(decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> b, const std::int64_t p)
   {
     // Calculate (b ^ p).
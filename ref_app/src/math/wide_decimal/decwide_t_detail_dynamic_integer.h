@@ -0,0 +1,428 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef DECWIDE_T_DETAIL_DYNAMIC_INTEGER_2026_10_18_H_
+  #define DECWIDE_T_DETAIL_DYNAMIC_INTEGER_2026_10_18_H_
+
+  #include <algorithm>
+  #include <cstdint>
+  #include <limits>
+  #include <memory>
+  #include <type_traits>
+  #include <utility>
+  #include <vector>
+
+  #include <math/wide_decimal/decwide_t_detail_fft.h>
+  #include <math/wide_decimal/decwide_t_detail_ntt.h>
+
+  // A signed integer of dynamic size, stored in the limbs of decwide_t
+  // (base 10^8, 10^4 or 10^2 with the most significant limb first).
+  // It is intended for the exact sums of binary splitting, whose
+  // sizes range from a single limb up to the full precision. The
+  // storage grows as needed, and the results can be converted to
+  // decwide_t by simply copying the limbs.
+
+  // Multiplication uses the school method for small operands, and
+  // the FFT and NTT engines of decwide_t (with full-length products)
+  // for large ones.
+
+  namespace math { namespace wide_decimal { namespace detail {
+
+  template<typename LimbType,
+           typename AllocatorType = std::allocator<void>>
+  class dynamic_integer final
+  {
+  public:
+    using limb_type = LimbType;
+
+    using double_limb_type =
+      typename std::conditional<(std::is_same<limb_type, std::uint32_t>::value == true),
+                                 std::uint64_t,
+                                 std::uint32_t>::type;
+
+    static_assert((   (std::is_same<std::uint8_t,  limb_type>::value == true)
+                   || (std::is_same<std::uint16_t, limb_type>::value == true)
+                   || (std::is_same<std::uint32_t, limb_type>::value == true)),
+                   "Error: limb_type must be one of uint8_t, uint16_t or uint32_t.");
+
+    static constexpr std::uint32_t limb_digits10 =
+      ((std::numeric_limits<limb_type>::digits == 32) ? 8U : ((std::numeric_limits<limb_type>::digits == 16) ? 4U : 2U));
+
+    static constexpr std::uint32_t limb_radix =
+      ((limb_digits10 == 8U) ? UINT32_C(100000000) : ((limb_digits10 == 4U) ? UINT32_C(10000) : UINT32_C(100)));
+
+    static constexpr std::uint32_t limb_radix_half =
+      ((limb_digits10 == 8U) ? UINT32_C(10000) : ((limb_digits10 == 4U) ? UINT32_C(100) : UINT32_C(10)));
+
+    // Products having fewer limbs in the shorter operand than this
+    // use the school method. Those having more limbs in the longer
+    // operand than limbs_for_ntt use the exact NTT (see also the
+    // corresponding thresholds in decwide_t).
+    static constexpr std::uint32_t limbs_for_fft = ((limb_digits10 == 2U) ? 32U : 128U);
+    static constexpr std::uint32_t limbs_for_ntt = UINT32_C(2000000) / limb_digits10;
+
+    dynamic_integer() : my_data(), my_neg(false) { }
+
+    dynamic_integer(const std::uint64_t u, const bool is_neg = false) : my_data(), my_neg(is_neg)
+    {
+      for(std::uint64_t value = u; value != 0U; value /= limb_radix)
+      {
+        my_data.insert(my_data.begin(), static_cast<limb_type>(value % limb_radix));
+      }
+
+      if(my_data.empty()) { my_neg = false; }
+    }
+
+    // Constructor from a range of limbs (the most significant limb first).
+    dynamic_integer(const limb_type* p_limbs, const std::uint32_t limb_count, const bool is_neg = false)
+      : my_data(p_limbs, p_limbs + limb_count),
+        my_neg (is_neg)
+    {
+      normalize();
+    }
+
+    dynamic_integer(const dynamic_integer&) = default;
+    dynamic_integer(dynamic_integer&&)      = default;
+
+    dynamic_integer& operator=(const dynamic_integer&) = default;
+    dynamic_integer& operator=(dynamic_integer&&)      = default;
+
+    ~dynamic_integer() = default;
+
+    bool iszero() const { return my_data.empty(); }
+    bool isneg () const { return my_neg; }
+
+    // The limbs, the most significant one first.
+    const limb_type* crepresentation() const { return my_data.data(); }
+
+    std::uint32_t size() const { return static_cast<std::uint32_t>(my_data.size()); }
+
+    dynamic_integer& operator+=(const dynamic_integer& other) { return add_signed(other, other.my_neg); }
+    dynamic_integer& operator-=(const dynamic_integer& other) { return add_signed(other, (!other.my_neg)); }
+
+    dynamic_integer& operator*=(const dynamic_integer& other)
+    {
+      if(iszero() || other.iszero())
+      {
+        my_data.clear();
+        my_neg = false;
+      }
+      else
+      {
+        representation_type result(static_cast<typename representation_type::size_type>(my_data.size() + other.my_data.size()));
+
+        mul_dispatch(result.data(), my_data.data(), size(), other.my_data.data(), other.size());
+
+        my_data.swap(result);
+        my_neg = (my_neg != other.my_neg);
+
+        normalize();
+      }
+
+      return *this;
+    }
+
+    // Multiply by the limb radix raised to the power n.
+    dynamic_integer& shift_left_limbs(const std::uint32_t n)
+    {
+      if(iszero() == false)
+      {
+        my_data.insert(my_data.end(), static_cast<typename representation_type::size_type>(n), static_cast<limb_type>(0U));
+      }
+
+      return *this;
+    }
+
+  private:
+    using limb_allocator_type =
+      typename std::allocator_traits<AllocatorType>::template rebind_alloc<limb_type>;
+
+    using representation_type = std::vector<limb_type, limb_allocator_type>;
+
+    using fft_scratch_type = fft::fft_scratch_pool<double, AllocatorType>;
+    using ntt_scratch_type = ntt::ntt_scratch_pool<AllocatorType>;
+
+    representation_type my_data;
+    bool                my_neg;
+
+    static fft_scratch_type& fft_scratch()
+    {
+      #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+      static thread_local fft_scratch_type the_scratch;
+      #else
+      static fft_scratch_type the_scratch;
+      #endif
+
+      return the_scratch;
+    }
+
+    static ntt_scratch_type& ntt_scratch()
+    {
+      #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+      static thread_local ntt_scratch_type the_scratch;
+      #else
+      static ntt_scratch_type the_scratch;
+      #endif
+
+      return the_scratch;
+    }
+
+    void normalize()
+    {
+      const typename representation_type::iterator it_non_zero =
+        std::find_if(my_data.begin(),
+                     my_data.end(),
+                     [](const limb_type& limb) -> bool { return (limb != static_cast<limb_type>(0U)); });
+
+      my_data.erase(my_data.begin(), it_non_zero);
+
+      if(my_data.empty()) { my_neg = false; }
+    }
+
+    static std::int_fast8_t compare_magnitude(const representation_type& a, const representation_type& b)
+    {
+      if(a.size() != b.size())
+      {
+        return ((a.size() > b.size()) ? std::int_fast8_t(1) : std::int_fast8_t(-1));
+      }
+
+      const std::pair<typename representation_type::const_iterator, typename representation_type::const_iterator> mismatch_point =
+        std::mismatch(a.cbegin(), a.cend(), b.cbegin());
+
+      return ((mismatch_point.first == a.cend()) ? std::int_fast8_t(0)
+                                                 : ((*mismatch_point.first > *mismatch_point.second) ? std::int_fast8_t(1) : std::int_fast8_t(-1)));
+    }
+
+    dynamic_integer& add_signed(const dynamic_integer& other, const bool other_is_neg)
+    {
+      if(other.iszero())
+      {
+        return *this;
+      }
+
+      if(iszero())
+      {
+        my_data = other.my_data;
+        my_neg  = other_is_neg;
+
+        return *this;
+      }
+
+      if(my_neg == other_is_neg)
+      {
+        // Add the magnitudes, aligned at the least significant limb.
+        if(my_data.size() < other.my_data.size())
+        {
+          my_data.insert(my_data.begin(), other.my_data.size() - my_data.size(), static_cast<limb_type>(0U));
+        }
+
+        std::uint32_t carry = 0U;
+
+        typename representation_type::reverse_iterator it_this = my_data.rbegin();
+
+        for(typename representation_type::const_reverse_iterator it_other = other.my_data.crbegin(); it_other != other.my_data.crend(); ++it_other, ++it_this)
+        {
+          const std::uint32_t sum = static_cast<std::uint32_t>((static_cast<std::uint32_t>(*it_this) + *it_other) + carry);
+
+          carry    = ((sum >= limb_radix) ? 1U : 0U);
+          *it_this = static_cast<limb_type>(sum - (carry * limb_radix));
+        }
+
+        for( ; (carry != 0U) && (it_this != my_data.rend()); ++it_this)
+        {
+          const std::uint32_t sum = static_cast<std::uint32_t>(static_cast<std::uint32_t>(*it_this) + carry);
+
+          carry    = ((sum >= limb_radix) ? 1U : 0U);
+          *it_this = static_cast<limb_type>(sum - (carry * limb_radix));
+        }
+
+        if(carry != 0U)
+        {
+          my_data.insert(my_data.begin(), static_cast<limb_type>(carry));
+        }
+      }
+      else
+      {
+        // Subtract the smaller magnitude from the larger one.
+        const std::int_fast8_t cmp = compare_magnitude(my_data, other.my_data);
+
+        if(cmp == 0)
+        {
+          my_data.clear();
+          my_neg = false;
+
+          return *this;
+        }
+
+        const representation_type& larger  = ((cmp > 0) ? my_data : other.my_data);
+        const representation_type& smaller = ((cmp > 0) ? other.my_data : my_data);
+
+        representation_type result(larger);
+
+        std::uint32_t borrow = 0U;
+
+        typename representation_type::reverse_iterator it_result = result.rbegin();
+
+        for(typename representation_type::const_reverse_iterator it_smaller = smaller.crbegin(); it_smaller != smaller.crend(); ++it_smaller, ++it_result)
+        {
+          const std::uint32_t subtrahend = static_cast<std::uint32_t>(static_cast<std::uint32_t>(*it_smaller) + borrow);
+
+          borrow     = ((*it_result < subtrahend) ? 1U : 0U);
+          *it_result = static_cast<limb_type>((static_cast<std::uint32_t>(*it_result) + (borrow * limb_radix)) - subtrahend);
+        }
+
+        for( ; (borrow != 0U); ++it_result)
+        {
+          borrow     = ((*it_result == 0U) ? 1U : 0U);
+          *it_result = static_cast<limb_type>((static_cast<std::uint32_t>(*it_result) + (borrow * limb_radix)) - 1U);
+        }
+
+        my_data.swap(result);
+        my_neg = ((cmp > 0) ? my_neg : other_is_neg);
+
+        normalize();
+      }
+
+      return *this;
+    }
+
+  public:
+    // The full product of the limbs a[0, na) and b[0, nb), which
+    // has na + nb limbs (the first of which may be zero).
+    static void mul_dispatch(limb_type* r, const limb_type* a, const std::uint32_t na, const limb_type* b, const std::uint32_t nb)
+    {
+      if((std::min)(na, nb) < limbs_for_fft)
+      {
+        mul_loop_school(r, a, na, b, nb);
+      }
+      else if(((std::max)(na, nb) < limbs_for_ntt) || (mul_loop_ntt(r, a, na, b, nb) == false))
+      {
+        mul_loop_fft(r, a, na, b, nb);
+      }
+    }
+
+  private:
+    static void mul_loop_school(limb_type* r, const limb_type* a, const std::uint32_t na, const limb_type* b, const std::uint32_t nb)
+    {
+      // The product of na and nb limbs has na + nb limbs. Each row
+      // of the school multiplication is added in with its carry.
+      std::fill(r, r + (na + nb), static_cast<limb_type>(0U));
+
+      for(std::uint32_t i = na; i-- > 0U; )
+      {
+        double_limb_type carry = 0U;
+
+        for(std::uint32_t j = nb; j-- > 0U; )
+        {
+          const double_limb_type t =
+            static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(a[i]) * b[j]) + r[i + j + 1U]) + carry;
+
+          carry          = static_cast<double_limb_type>(t / limb_radix);
+          r[i + j + 1U]  = static_cast<limb_type>(t - static_cast<double_limb_type>(carry * limb_radix));
+        }
+
+        r[i] = static_cast<limb_type>(carry);
+      }
+    }
+
+    static void mul_loop_fft(limb_type* r, const limb_type* a, const std::uint32_t na, const limb_type* b, const std::uint32_t nb)
+    {
+      // This is the full-length counterpart of decwide_t::mul_loop_fft,
+      // with half-limbs as the data points of the real transforms.
+      std::uint32_t n_fft = 2U;
+
+      while(n_fft < static_cast<std::uint32_t>((na + nb) * 2U))
+      {
+        n_fft <<= 1U;
+      }
+
+      double*       af_bf = fft_scratch().work(static_cast<std::uint32_t>(n_fft * 2U));
+      const double* tw    = fft_scratch().twiddles(n_fft);
+
+      double* af = af_bf + (0U * n_fft);
+      double* bf = af_bf + (1U * n_fft);
+
+      for(std::uint32_t i = 0U; i < na; ++i)
+      {
+        af[(i * 2U)]      = double(a[i] / limb_radix_half);
+        af[(i * 2U) + 1U] = double(a[i] % limb_radix_half);
+      }
+
+      for(std::uint32_t i = 0U; i < nb; ++i)
+      {
+        bf[(i * 2U)]      = double(b[i] / limb_radix_half);
+        bf[(i * 2U) + 1U] = double(b[i] % limb_radix_half);
+      }
+
+      std::fill(af + (na * 2U), af + n_fft, double(0));
+      std::fill(bf + (nb * 2U), bf + n_fft, double(0));
+
+      const std::uint32_t n_cplx = static_cast<std::uint32_t>(n_fft / 2U);
+
+      fft::fft_forward(n_cplx, af, tw);
+      fft::fft_forward(n_cplx, bf, tw);
+
+      fft::convolve_real_spectra(n_cplx, af, bf, tw);
+
+      fft::fft_inverse(n_cplx, af, tw);
+
+      // The convolution sum j belongs to the half-limb j + 1 of the
+      // product, and the half-limb 0 receives the final carry.
+      std::uint64_t carry = 0U;
+
+      for(std::uint32_t i = (na + nb); i-- > 0U; )
+      {
+        const std::uint32_t j = static_cast<std::uint32_t>(i * 2U);
+
+        const std::uint64_t xlo = static_cast<std::uint64_t>((af[j] / n_cplx) + fft::template_half<double>()) + carry;
+        carry                   = static_cast<std::uint64_t>(xlo / limb_radix_half);
+        const std::uint32_t nlo = static_cast<std::uint32_t>(xlo - (carry * limb_radix_half));
+
+        const double        xaj = ((j != 0U) ? (af[j - 1U] / n_cplx) : double(0));
+        const std::uint64_t xhi = static_cast<std::uint64_t>(xaj + fft::template_half<double>()) + carry;
+        carry                   = static_cast<std::uint64_t>(xhi / limb_radix_half);
+        const std::uint32_t nhi = static_cast<std::uint32_t>(xhi - (carry * limb_radix_half));
+
+        r[i] = static_cast<limb_type>((nhi * limb_radix_half) + nlo);
+      }
+    }
+
+    static bool mul_loop_ntt(limb_type* r, const limb_type* a, const std::uint32_t na, const limb_type* b, const std::uint32_t nb)
+    {
+      std::uint32_t n_ntt = 1U;
+
+      while(n_ntt < static_cast<std::uint32_t>(na + nb))
+      {
+        n_ntt <<= 1U;
+      }
+
+      const bool ntt_is_available = (n_ntt <= ntt::ntt_max_transform_length);
+
+      if(ntt_is_available)
+      {
+        std::uint32_t*       work = ntt_scratch().work(n_ntt);
+        const std::uint32_t* tw   = ntt_scratch().twiddles(n_ntt);
+
+        ntt::mul_loop_ntt<limb_radix>(r, static_cast<std::uint32_t>(na + nb), a, na, b, nb, n_ntt, work, tw, ntt_scratch().tw_length());
+      }
+
+      return ntt_is_available;
+    }
+  };
+
+  template<typename LimbType, typename AllocatorType>
+  dynamic_integer<LimbType, AllocatorType> operator*(const dynamic_integer<LimbType, AllocatorType>& u, const dynamic_integer<LimbType, AllocatorType>& v) { return dynamic_integer<LimbType, AllocatorType>(u) *= v; }
+
+  template<typename LimbType, typename AllocatorType>
+  dynamic_integer<LimbType, AllocatorType> operator+(const dynamic_integer<LimbType, AllocatorType>& u, const dynamic_integer<LimbType, AllocatorType>& v) { return dynamic_integer<LimbType, AllocatorType>(u) += v; }
+
+  template<typename LimbType, typename AllocatorType>
+  dynamic_integer<LimbType, AllocatorType> operator-(const dynamic_integer<LimbType, AllocatorType>& u, const dynamic_integer<LimbType, AllocatorType>& v) { return dynamic_integer<LimbType, AllocatorType>(u) -= v; }
+
+  } } } // namespace math::wide_decimal::detail
+
+#endif // DECWIDE_T_DETAIL_DYNAMIC_INTEGER_2026_10_18_H_
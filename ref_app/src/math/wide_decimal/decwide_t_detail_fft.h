@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2013 - 2020.                 //
+//  Copyright Christopher Kormanyos 2013 - 2021.                 //
 //  Distributed under the Boost Software License,                //
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
@@ -13,7 +13,43 @@
   #define DECWIDE_T_DETAIL_FFT_2013_01_08_H_
 
   #include <array>
+  #include <cmath>
   #include <cstdint>
+  #include <memory>
+  #include <type_traits>
+
+  #if defined(__AVX2__)
+  #include <immintrin.h>
+  #endif
+
+  #include <math/wide_decimal/decwide_t_detail_parallel.h>
+
+  // The FFT engine used for decwide_t multiplication.
+
+  // The complex transforms are iterative radix-4 Cooley-Tukey (forward)
+  // and Gentleman-Sande (inverse) passes that use a single twiddle factor
+  // per butterfly block. The forward transform takes natural-order
+  // input and delivers its spectrum in bit-reversed order, and the
+  // inverse transform consumes exactly that order. The convolution
+  // itself (including the real-to-complex pre- and post-processing)
+  // is carried out directly in bit-reversed order, so that no
+  // bit-reversal permutation is ever needed.
+
+  // The twiddle factors are tabulated in bit-reversed order as well.
+  // A table made for one size is a prefix of the table for any larger
+  // size, and all passes read it sequentially.
+
+  // Large transforms are blocked: the passes having a span larger than
+  // fft_block_points sweep the entire array, and the remaining passes
+  // are executed block-by-block while each block resides in cache.
+  // With WIDE_DECIMAL_ENABLE_THREADS, the blocks (or the butterflies
+  // within the blocks of the large spans) are processed in parallel.
+
+  // See also D. J. Bernstein, "Multidigit multiplication for
+  // mathematicians" (2001) for the view of the FFT as a sequence of
+  // polynomial reductions modulo (x^n - w), and R. Crandall and
+  // C. Pomerance, "Prime Numbers, A Computational Perspective",
+  // Chapter 9.5 for the real-signal convolution.
 
   namespace math { namespace wide_decimal { namespace detail { namespace fft {
 
@@ -29,307 +65,673 @@
   template<>
   constexpr long double template_half<long double>() { return (long double) (0.5L); }
 
+  // The number of complex points in one cache block.
+  constexpr std::uint32_t fft_block_points = UINT32_C(4096);
+
+  // Fill the twiddle table for an FFT of (real) size N. The table holds
+  // N/2 complex roots of unity, stored as interleaved pairs, with
+  // tw[2p] + i tw[2p + 1] = exp(i Pi phi(p)). Here phi(p) is the binary
+  // fraction (0.b0 b1 b2 ...) made of the bits of p in reversed order.
+  // Since phi(p) does not depend on N, a table made for N is also
+  // a valid table for every smaller power-of-two size.
   template<typename float_type>
-  float_type template_fast_div_by_two(float_type a);
+  void twiddle_table_fill(const std::uint32_t N, float_type* tw)
+  {
+    const float_type my_pi = float_type(3.1415926535897932384626433832795028841972L);
 
-  template<>
-  inline float template_fast_div_by_two<float>(float a) { return a / 2; }
+    for(std::uint32_t p = static_cast<std::uint32_t>(0U); p < static_cast<std::uint32_t>(N / 2U); ++p)
+    {
+      // Obtain phi(p), which is exact in float_type.
+      float_type phi    = float_type(0);
+      float_type weight = template_half<float_type>();
 
-  template<>
-  inline double template_fast_div_by_two<double>(double a) { return a / 2; }
+      for(std::uint32_t q = p; q != static_cast<std::uint32_t>(0U); q >>= 1U)
+      {
+        if((q & 1U) != static_cast<std::uint32_t>(0U))
+        {
+          phi += weight;
+        }
 
-  template<>
-  inline long double template_fast_div_by_two<long double>(long double a) { return a / 2; }
+        weight *= template_half<float_type>();
+      }
 
-  template<typename float_type>
-  float_type template_sin_order_1(const std::uint32_t NumPoints)
-  {
-    // TBD: Use constexpr functions here, depending on availability.
-    // Mathematica command: Table[N[Sin[Pi / (2^n)], 41], {n, 1, 31, 1}]
-    switch(NumPoints)
-    {
-      default:
-      case 0UL       : return float_type(0.0L);                                            // Pi        : as uint64_t --> UINT64_C(0x0000000000000000)
-      case 2UL       : return float_type(1.0L);                                            // Pi / 2    : as uint64_t --> UINT64_C(0x3FF0000000000000)
-      case 4UL       : return float_type(7.0710678118654752440084436210484903928484E-01L); // Pi / 4    : as uint64_t --> UINT64_C(0x3FE6A09E667F3BCD)
-      case 8UL       : return float_type(3.8268343236508977172845998403039886676134E-01L); // Pi / 8    : as uint64_t --> UINT64_C(0x3FD87DE2A6AEA963)
-      case 16UL      : return float_type(1.9509032201612826784828486847702224092769E-01L); // Pi / 16   : as uint64_t --> UINT64_C(0x3FC8F8B83C69A60B)
-      case 32UL      : return float_type(9.8017140329560601994195563888641845861137E-02L); // Pi / 32   : as uint64_t --> UINT64_C(0x3FB917A6BC29B42C)
-      case 64UL      : return float_type(4.9067674327418014254954976942682658314745E-02L); // Pi / 64   : as uint64_t --> UINT64_C(0x3FA91F65F10DD814)
-      case 128UL     : return float_type(2.4541228522912288031734529459282925065466E-02L); // Pi / 128  : as uint64_t --> UINT64_C(0x3F992155F7A3667E)
-      case 1UL <<  8U: return float_type(1.2271538285719926079408261951003212140372E-02L); // Pi / 2^8  : as uint64_t --> UINT64_C(0x3F8921D1FCDEC784)
-      case 1UL <<  9U: return float_type(6.1358846491544753596402345903725809170579E-03L); // Pi / 2^9  : as uint64_t --> UINT64_C(0x3F7921F0FE670071)
-      case 1UL << 10U: return float_type(3.0679567629659762701453654909198425189446E-03L); // Pi / 2^10 : as uint64_t --> UINT64_C(0x3F6921F8BECCA4BA)
-      case 1UL << 11U: return float_type(1.5339801862847656123036971502640790799549E-03L); // Pi / 2^11 : as uint64_t --> UINT64_C(0x3F5921FAAEE6472E)
-      case 1UL << 12U: return float_type(7.6699031874270452693856835794857664314092E-04L); // Pi / 2^12 : as uint64_t --> UINT64_C(0x3F4921FB2AECB360)
-      case 1UL << 13U: return float_type(3.8349518757139558907246168118138126339503E-04L); // Pi / 2^13 : as uint64_t --> UINT64_C(0x3F3921FB49EE4EA6)
-      case 1UL << 14U: return float_type(1.9174759731070330743990956198900093346887E-04L); // Pi / 2^14 : as uint64_t --> UINT64_C(0x3F2921FB51AEB57C)
-      case 1UL << 15U: return float_type(9.5873799095977345870517210976476351187066E-05L); // Pi / 2^15 : as uint64_t --> UINT64_C(0x3F1921FB539ECF31)
-      case 1UL << 16U: return float_type(4.7936899603066884549003990494658872746867E-05L); // Pi / 2^16 : as uint64_t --> UINT64_C(0x3F0921FB541AD59E)
-      case 1UL << 17U: return float_type(2.3968449808418218729186577165021820094761E-05L); // Pi / 2^17 : as uint64_t --> UINT64_C(0x3EF921FB5439D73A)
-      case 1UL << 18U: return float_type(1.1984224905069706421521561596988984804732E-05L); // Pi / 2^18 : as uint64_t --> UINT64_C(0x3EE921FB544197A1)
-      case 1UL << 19U: return float_type(5.9921124526424278428797118088908617299872E-06L); // Pi / 2^19 : as uint64_t --> UINT64_C(0x3ED921FB544387BA)
-      case 1UL << 20U: return float_type(2.9960562263346607504548128083570598118252E-06L); // Pi / 2^20 : as uint64_t --> UINT64_C(0x3EC921FB544403C1)
-      case 1UL << 21U: return float_type(1.4980281131690112288542788461553611206918E-06L); // Pi / 2^21 : as uint64_t --> UINT64_C(0x3EB921FB544422C2)
-      case 1UL << 22U: return float_type(7.4901405658471572113049856673065563715596E-07L); // Pi / 2^22 : as uint64_t --> UINT64_C(0x3EA921FB54442A83)
-      case 1UL << 23U: return float_type(3.7450702829238412390316917908463317739740E-07L); // Pi / 2^23 : as uint64_t --> UINT64_C(0x3E9921FB54442C73)
-      case 1UL << 24U: return float_type(1.8725351414619534486882457659356361712045E-07L); // Pi / 2^24 : as uint64_t --> UINT64_C(0x3E8921FB54442CEF)
-      case 1UL << 25U: return float_type(9.3626757073098082799067286680885620193237E-08L); // Pi / 2^25 : as uint64_t --> UINT64_C(0x3E7921FB54442D0E)
-      case 1UL << 26U: return float_type(4.6813378536549092695115518138540096959504E-08L); // Pi / 2^26 : as uint64_t --> UINT64_C(0x3E6921FB54442D16)
-      case 1UL << 27U: return float_type(2.3406689268274552759505493419034844037886E-08L); // Pi / 2^27 : as uint64_t --> UINT64_C(0x3E5921FB54442D18)
-      case 1UL << 28U: return float_type(1.1703344634137277181246213503238103798093E-08L); // Pi / 2^28 : as uint64_t --> UINT64_C(0x3E4921FB54442D18)
-      case 1UL << 29U: return float_type(5.8516723170686386908097901008341396943900E-09L); // Pi / 2^29 : as uint64_t --> UINT64_C(0x3E3921FB54442D18)
-      case 1UL << 30U: return float_type(2.9258361585343193579282304690689559020176E-09L); // Pi / 2^30 : as uint64_t --> UINT64_C(0x3E2921FB54442D18)
-      case 1UL << 31U: return float_type(1.4629180792671596805295321618659637103743E-09L); // Pi / 2^31 : as uint64_t --> UINT64_C(0x3E1921FB54442D18)
-    }
-  }
+      // Use the reflection about Pi/2 in order to keep
+      // the argument of the trigonometric functions small.
+      const bool is_upper_half = (phi > template_half<float_type>());
 
-  template<typename float_type>
-  float_type template_sin_order_2(const std::uint32_t NumPoints)
-  {
-    return template_sin_order_1<float_type>(NumPoints / 2U);
-  }
+      const float_type theta = my_pi * (is_upper_half ? (float_type(1) - phi) : phi);
 
-  // TBD: Use constexpr functions here, depending on availability.
-  template<typename float_type,
-           const bool is_forward_fft>
-  float_type const_unique_wp_real_init(const std::uint32_t N,
-                                       const bool = is_forward_fft,
-                                       const typename std::enable_if<(is_forward_fft == true)>::type* = nullptr)
-  {
-    return template_sin_order_1<float_type>(N);
-  }
+      using std::cos;
+      using std::sin;
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  float_type const_unique_wp_real_init(const std::uint32_t N,
-                                       const bool = is_forward_fft,
-                                       const typename std::enable_if<(is_forward_fft == false)>::type* = nullptr)
-  {
-    return -template_sin_order_1<float_type>(N);
+      tw[(p * 2U) + 0U] = (is_upper_half ? -cos(theta) : cos(theta));
+      tw[(p * 2U) + 1U] = sin(theta);
+    }
   }
 
+  // A persistent, size-keyed scratch pool for the FFT multiplication.
+  // It holds the working arrays of the transforms and a cached
+  // twiddle table. Both only grow (when a larger transform is
+  // requested for the first time), so steady-state multiplication
+  // performs neither allocation nor any trigonometric computation.
   template<typename float_type,
-           const bool is_forward_fft>
-  float_type const_unique_wp_imag(const std::uint32_t N,
-                                  const bool = is_forward_fft,
-                                  const typename std::enable_if<(is_forward_fft == true)>::type* = nullptr)
+           typename AllocatorType = std::allocator<float_type>>
+  class fft_scratch_pool final
   {
-    return template_sin_order_2<float_type>(N);
-  }
+  public:
+    constexpr fft_scratch_pool() : my_work(nullptr),
+                                   my_work_size(0U),
+                                   my_twiddles(nullptr),
+                                   my_twiddles_size(0U) { }
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  float_type const_unique_wp_imag(const std::uint32_t N,
-                                  const bool = is_forward_fft,
-                                  const typename std::enable_if<(is_forward_fft == false)>::type* = nullptr)
-  {
-    return -template_sin_order_2<float_type>(N);
-  }
+    fft_scratch_pool(const fft_scratch_pool&) = delete;
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  float_type const_unique_wp_real(const std::uint32_t N) { return float_type(float_type(-2) * (  const_unique_wp_real_init<float_type, is_forward_fft>(N)
-                                                                                               * const_unique_wp_real_init<float_type, is_forward_fft>(N))); }
+    fft_scratch_pool& operator=(const fft_scratch_pool&) = delete;
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  void danielson_lanczos_apply_4_basecase(float_type* data);
+    ~fft_scratch_pool()
+    {
+      release(my_work,     my_work_size);
+      release(my_twiddles, my_twiddles_size);
+    }
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  void danielson_lanczos_apply(const std::uint32_t N,
-                               float_type* data)
-  {
-    if(N == 8U)
+    float_type* work(const std::uint32_t count)
     {
-      danielson_lanczos_apply_4_basecase<float_type, is_forward_fft>(data);
-      danielson_lanczos_apply_4_basecase<float_type, is_forward_fft>(data + N);
+      if(my_work_size < count)
+      {
+        release(my_work, my_work_size);
+
+        my_work      = acquire(count);
+        my_work_size = count;
+      }
+
+      return my_work;
     }
-    else
+
+    const float_type* twiddles(const std::uint32_t N)
     {
-      danielson_lanczos_apply<float_type, is_forward_fft>(N / 2U, data);
-      danielson_lanczos_apply<float_type, is_forward_fft>(N / 2U, data + N);
+      if(my_twiddles_size < N)
+      {
+        release(my_twiddles, my_twiddles_size);
+
+        my_twiddles      = acquire(N);
+        my_twiddles_size = N;
+
+        twiddle_table_fill(my_twiddles_size, my_twiddles);
+      }
+
+      return my_twiddles;
     }
 
-    float_type real_part = float_type(1);
-    float_type imag_part = float_type(0);
+  private:
+    using allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<float_type>;
 
-    for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < N; i += 2U)
-    {
-            float_type tmp_real = (real_part * data[i + (N + 0U)]) - (imag_part * data[i + (N + 1U)]);
-      const float_type tmp_imag = (real_part * data[i + (N + 1U)]) + (imag_part * data[i + (N + 0U)]);
+    float_type*   my_work;
+    std::uint32_t my_work_size;
+    float_type*   my_twiddles;
+    std::uint32_t my_twiddles_size;
 
-      data[i + (N + 0U)] = data[i + 0U] - tmp_real;
-      data[i + (N + 1U)] = data[i + 1U] - tmp_imag;
+    static float_type* acquire(const std::uint32_t count)
+    {
+      allocator_type my_a;
 
-      data[i + 0U] += tmp_real;
-      data[i + 1U] += tmp_imag;
+      return std::allocator_traits<allocator_type>::allocate(my_a, count);
+    }
 
-      tmp_real = real_part;
+    static void release(float_type* p, const std::uint32_t count)
+    {
+      if(p != nullptr)
+      {
+        allocator_type my_a;
 
-      real_part += (((tmp_real  * const_unique_wp_real<float_type, is_forward_fft>(N)) - (imag_part * const_unique_wp_imag<float_type, is_forward_fft>(N))));
-      imag_part += (((imag_part * const_unique_wp_real<float_type, is_forward_fft>(N)) + (tmp_real  * const_unique_wp_imag<float_type, is_forward_fft>(N))));
+        std::allocator_traits<allocator_type>::deallocate(my_a, p, count);
+      }
     }
-  }
+  };
 
+  // The static-memory counterpart of fft_scratch_pool. The capacity
+  // is fixed at compile-time, and the twiddle table is filled once
+  // (for the maximum transform size) upon first use.
   template<typename float_type,
-           const bool is_forward_fft>
-  void danielson_lanczos_apply_4_basecase(float_type* data)
+           const std::uint32_t MaxFftSize>
+  class fft_scratch_array final
   {
-    const float_type tmp_real_2_0 = data[2U]; 
-    const float_type tmp_imag_2_0 = data[3U]; 
+  public:
+    constexpr fft_scratch_array() : my_work(),
+                                    my_twiddles(),
+                                    my_twiddles_are_filled(false) { }
+
+    float_type* work(const std::uint32_t) { return my_work.data(); }
 
-    data[2U]  = data[0U] - tmp_real_2_0;
-    data[3U]  = data[1U] - tmp_imag_2_0;
-    data[0U] += tmp_real_2_0; 
-    data[1U] += tmp_imag_2_0; 
+    const float_type* twiddles(const std::uint32_t)
+    {
+      if(my_twiddles_are_filled == false)
+      {
+        twiddle_table_fill(MaxFftSize, my_twiddles.data());
+
+        my_twiddles_are_filled = true;
+      }
 
-    const float_type tmp_real_2_4 = data[2U + 4U]; 
-    const float_type tmp_imag_2_4 = data[3U + 4U]; 
+      return my_twiddles.data();
+    }
 
-    data[2U + 4U]  = data[0U + 4U] - tmp_real_2_4;
-    data[3U + 4U]  = data[1U + 4U] - tmp_imag_2_4;
-    data[0U + 4U] += tmp_real_2_4; 
-    data[1U + 4U] += tmp_imag_2_4; 
+  private:
+    std::array<float_type, static_cast<std::size_t>(MaxFftSize * 2U)> my_work;
+    std::array<float_type, static_cast<std::size_t>(MaxFftSize)>      my_twiddles;
+    bool                                                              my_twiddles_are_filled;
+  };
 
-    float_type tmp_real = data[4U];
-    float_type tmp_imag = data[5U];
+  // Radix-4 butterflies on one block of 4q complex points, which
+  // perform two consecutive levels of the transform. The block has
+  // twiddle factor w = (wr, wi) in the first level. Its two halves
+  // have the twiddle factors v = (vr, vi) and i*v in the second level.
+  // Of the q butterflies of the block, the first count ones are done
+  // (where x may point into the block's first quarter, and count is
+  // either 1 or even).
 
-    data[4U] = data[0U] - tmp_real;
-    data[5U] = data[1U] - tmp_imag;
+  template<typename float_type>
+  void radix4_forward_block(float_type* x, const std::uint32_t q, const std::uint32_t count,
+                            const float_type wr, const float_type wi,
+                            const float_type vr, const float_type vi)
+  {
+    for(std::uint32_t j = static_cast<std::uint32_t>(0U); j < static_cast<std::uint32_t>(count * 2U); j += 2U)
+    {
+      float_type* x0 = x  + j;
+      float_type* x1 = x0 + (q * 2U);
+      float_type* x2 = x1 + (q * 2U);
+      float_type* x3 = x2 + (q * 2U);
+
+      const float_type t2r = (wr * x2[0U]) - (wi * x2[1U]);
+      const float_type t2i = (wr * x2[1U]) + (wi * x2[0U]);
+      const float_type t3r = (wr * x3[0U]) - (wi * x3[1U]);
+      const float_type t3i = (wr * x3[1U]) + (wi * x3[0U]);
+
+      const float_type a0r = x0[0U] + t2r;
+      const float_type a0i = x0[1U] + t2i;
+      const float_type a2r = x0[0U] - t2r;
+      const float_type a2i = x0[1U] - t2i;
+      const float_type a1r = x1[0U] + t3r;
+      const float_type a1i = x1[1U] + t3i;
+      const float_type a3r = x1[0U] - t3r;
+      const float_type a3i = x1[1U] - t3i;
+
+      const float_type s1r = (vr * a1r) - (vi * a1i);
+      const float_type s1i = (vr * a1i) + (vi * a1r);
+
+      // This is i * v * a3.
+      const float_type s3r = -((vr * a3i) + (vi * a3r));
+      const float_type s3i =   (vr * a3r) - (vi * a3i);
+
+      x0[0U] = a0r + s1r;
+      x0[1U] = a0i + s1i;
+      x1[0U] = a0r - s1r;
+      x1[1U] = a0i - s1i;
+      x2[0U] = a2r + s3r;
+      x2[1U] = a2i + s3i;
+      x3[0U] = a2r - s3r;
+      x3[1U] = a2i - s3i;
+    }
+  }
 
-    data[0U] += tmp_real;
-    data[1U] += tmp_imag;
+  template<typename float_type>
+  void radix4_inverse_block(float_type* x, const std::uint32_t q, const std::uint32_t count,
+                            const float_type wr, const float_type wi,
+                            const float_type vr, const float_type vi)
+  {
+    // The inverse uses the conjugate twiddle factors.
 
-    const float_type real_part(const_unique_wp_real<float_type, is_forward_fft>(4U) + float_type(1));
-    const float_type imag_part(const_unique_wp_imag<float_type, is_forward_fft>(4U));
+    for(std::uint32_t j = static_cast<std::uint32_t>(0U); j < static_cast<std::uint32_t>(count * 2U); j += 2U)
+    {
+      float_type* x0 = x  + j;
+      float_type* x1 = x0 + (q * 2U);
+      float_type* x2 = x1 + (q * 2U);
+      float_type* x3 = x2 + (q * 2U);
+
+      const float_type d1r = x0[0U] - x1[0U];
+      const float_type d1i = x0[1U] - x1[1U];
+
+      // This is -i * (x2 - x3).
+      const float_type d3r =   x2[1U] - x3[1U];
+      const float_type d3i = -(x2[0U] - x3[0U]);
+
+      const float_type a0r = x0[0U] + x1[0U];
+      const float_type a0i = x0[1U] + x1[1U];
+      const float_type a2r = x2[0U] + x3[0U];
+      const float_type a2i = x2[1U] + x3[1U];
+      const float_type a1r = (vr * d1r) + (vi * d1i);
+      const float_type a1i = (vr * d1i) - (vi * d1r);
+      const float_type a3r = (vr * d3r) + (vi * d3i);
+      const float_type a3i = (vr * d3i) - (vi * d3r);
+
+      const float_type e2r = a0r - a2r;
+      const float_type e2i = a0i - a2i;
+      const float_type e3r = a1r - a3r;
+      const float_type e3i = a1i - a3i;
+
+      x0[0U] = a0r + a2r;
+      x0[1U] = a0i + a2i;
+      x1[0U] = a1r + a3r;
+      x1[1U] = a1i + a3i;
+      x2[0U] = (wr * e2r) + (wi * e2i);
+      x2[1U] = (wr * e2i) - (wi * e2r);
+      x3[0U] = (wr * e3r) + (wi * e3i);
+      x3[1U] = (wr * e3i) - (wi * e3r);
+    }
+  }
 
-    tmp_real = (real_part * data[6U]) - (imag_part * data[7U]);
-    tmp_imag = (real_part * data[7U]) + (imag_part * data[6U]);
+  #if defined(__AVX2__)
+  // Vectorized butterflies for double, processing two complex
+  // points per 256-bit register.
 
-    data[6U] = data[2U] - tmp_real;
-    data[7U] = data[3U] - tmp_imag;
+  inline __m256d avx2_cmul(const __m256d x, const __m256d wr, const __m256d wi)
+  {
+    // (x.re * wr - x.im * wi, x.im * wr + x.re * wi)
+    return _mm256_addsub_pd(_mm256_mul_pd(x, wr), _mm256_mul_pd(_mm256_permute_pd(x, 5), wi));
+  }
 
-    data[2U] += tmp_real;
-    data[3U] += tmp_imag;
+  inline __m256d avx2_cmul_conj(const __m256d x, const __m256d wr, const __m256d wi)
+  {
+    // (x.re * wr + x.im * wi, x.im * wr - x.re * wi)
+    return avx2_cmul(x, wr, _mm256_sub_pd(_mm256_setzero_pd(), wi));
   }
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  void fft_lanczos_fft(const std::uint32_t N,
-                       float_type* data)
+  inline __m256d avx2_mul_i(const __m256d x)
   {
-    std::uint32_t j = static_cast<std::uint32_t>(1U);
+    // (-x.im, x.re)
+    return _mm256_addsub_pd(_mm256_setzero_pd(), _mm256_permute_pd(x, 5));
+  }
 
-    for(std::uint32_t i = static_cast<std::uint32_t>(1U); i < static_cast<std::uint32_t>(N << 1U); i += 2U)
+  template<>
+  inline void radix4_forward_block<double>(double* x, const std::uint32_t q, const std::uint32_t count,
+                                           const double wr, const double wi,
+                                           const double vr, const double vi)
+  {
+    if(count == 1U)
     {
-      if(j > i)
+      // The scalar code is used for the smallest blocks.
+      const double t2r = (wr * x[4U]) - (wi * x[5U]);
+      const double t2i = (wr * x[5U]) + (wi * x[4U]);
+      const double t3r = (wr * x[6U]) - (wi * x[7U]);
+      const double t3i = (wr * x[7U]) + (wi * x[6U]);
+
+      const double a0r = x[0U] + t2r;
+      const double a0i = x[1U] + t2i;
+      const double a2r = x[0U] - t2r;
+      const double a2i = x[1U] - t2i;
+      const double a1r = x[2U] + t3r;
+      const double a1i = x[3U] + t3i;
+      const double a3r = x[2U] - t3r;
+      const double a3i = x[3U] - t3i;
+
+      const double s1r = (vr * a1r) - (vi * a1i);
+      const double s1i = (vr * a1i) + (vi * a1r);
+      const double s3r = -((vr * a3i) + (vi * a3r));
+      const double s3i =   (vr * a3r) - (vi * a3i);
+
+      x[0U] = a0r + s1r;
+      x[1U] = a0i + s1i;
+      x[2U] = a0r - s1r;
+      x[3U] = a0i - s1i;
+      x[4U] = a2r + s3r;
+      x[5U] = a2i + s3i;
+      x[6U] = a2r - s3r;
+      x[7U] = a2i - s3i;
+    }
+    else
+    {
+      const __m256d w_re = _mm256_set1_pd(wr);
+      const __m256d w_im = _mm256_set1_pd(wi);
+      const __m256d v_re = _mm256_set1_pd(vr);
+      const __m256d v_im = _mm256_set1_pd(vi);
+
+      for(std::uint32_t j = static_cast<std::uint32_t>(0U); j < static_cast<std::uint32_t>(count * 2U); j += 4U)
       {
-        std::swap(data[j - 1U], data[i - 1U]);
-        std::swap(data[j],      data[i]);
+        double* x0 = x  + j;
+        double* x1 = x0 + (q * 2U);
+        double* x2 = x1 + (q * 2U);
+        double* x3 = x2 + (q * 2U);
+
+        const __m256d y0 = _mm256_loadu_pd(x0);
+        const __m256d y1 = _mm256_loadu_pd(x1);
+        const __m256d t2 = avx2_cmul(_mm256_loadu_pd(x2), w_re, w_im);
+        const __m256d t3 = avx2_cmul(_mm256_loadu_pd(x3), w_re, w_im);
+
+        const __m256d a0 = _mm256_add_pd(y0, t2);
+        const __m256d a2 = _mm256_sub_pd(y0, t2);
+        const __m256d s1 = avx2_cmul(_mm256_add_pd(y1, t3), v_re, v_im);
+        const __m256d s3 = avx2_mul_i(avx2_cmul(_mm256_sub_pd(y1, t3), v_re, v_im));
+
+        _mm256_storeu_pd(x0, _mm256_add_pd(a0, s1));
+        _mm256_storeu_pd(x1, _mm256_sub_pd(a0, s1));
+        _mm256_storeu_pd(x2, _mm256_add_pd(a2, s3));
+        _mm256_storeu_pd(x3, _mm256_sub_pd(a2, s3));
       }
+    }
+  }
 
-      std::uint32_t m = N;
+  template<>
+  inline void radix4_inverse_block<double>(double* x, const std::uint32_t q, const std::uint32_t count,
+                                           const double wr, const double wi,
+                                           const double vr, const double vi)
+  {
+    if(count == 1U)
+    {
+      const double d1r = x[0U] - x[2U];
+      const double d1i = x[1U] - x[3U];
+      const double d3r =   x[5U] - x[7U];
+      const double d3i = -(x[4U] - x[6U]);
+
+      const double a0r = x[0U] + x[2U];
+      const double a0i = x[1U] + x[3U];
+      const double a2r = x[4U] + x[6U];
+      const double a2i = x[5U] + x[7U];
+      const double a1r = (vr * d1r) + (vi * d1i);
+      const double a1i = (vr * d1i) - (vi * d1r);
+      const double a3r = (vr * d3r) + (vi * d3i);
+      const double a3i = (vr * d3i) - (vi * d3r);
+
+      const double e2r = a0r - a2r;
+      const double e2i = a0i - a2i;
+      const double e3r = a1r - a3r;
+      const double e3i = a1i - a3i;
+
+      x[0U] = a0r + a2r;
+      x[1U] = a0i + a2i;
+      x[2U] = a1r + a3r;
+      x[3U] = a1i + a3i;
+      x[4U] = (wr * e2r) + (wi * e2i);
+      x[5U] = (wr * e2i) - (wi * e2r);
+      x[6U] = (wr * e3r) + (wi * e3i);
+      x[7U] = (wr * e3i) - (wi * e3r);
+    }
+    else
+    {
+      const __m256d w_re = _mm256_set1_pd(wr);
+      const __m256d w_im = _mm256_set1_pd(wi);
+      const __m256d v_re = _mm256_set1_pd(vr);
+      const __m256d v_im = _mm256_set1_pd(vi);
+
+      const __m256d minus_i_unit = _mm256_set1_pd(-1.0);
 
-      while((m > static_cast<std::uint32_t>(1U)) && (j > m))
+      for(std::uint32_t j = static_cast<std::uint32_t>(0U); j < static_cast<std::uint32_t>(count * 2U); j += 4U)
       {
-        j  -= m;
-        m >>= 1U;
+        double* x0 = x  + j;
+        double* x1 = x0 + (q * 2U);
+        double* x2 = x1 + (q * 2U);
+        double* x3 = x2 + (q * 2U);
+
+        const __m256d y0 = _mm256_loadu_pd(x0);
+        const __m256d y1 = _mm256_loadu_pd(x1);
+        const __m256d y2 = _mm256_loadu_pd(x2);
+        const __m256d y3 = _mm256_loadu_pd(x3);
+
+        const __m256d a0 = _mm256_add_pd(y0, y1);
+        const __m256d a2 = _mm256_add_pd(y2, y3);
+        const __m256d a1 = avx2_cmul_conj(_mm256_sub_pd(y0, y1), v_re, v_im);
+
+        // This is -i * (y2 - y3) = i * (y3 - y2).
+        const __m256d a3 = avx2_cmul_conj(avx2_mul_i(_mm256_mul_pd(_mm256_sub_pd(y2, y3), minus_i_unit)), v_re, v_im);
+
+        _mm256_storeu_pd(x0, _mm256_add_pd(a0, a2));
+        _mm256_storeu_pd(x1, _mm256_add_pd(a1, a3));
+        _mm256_storeu_pd(x2, avx2_cmul_conj(_mm256_sub_pd(a0, a2), w_re, w_im));
+        _mm256_storeu_pd(x3, avx2_cmul_conj(_mm256_sub_pd(a1, a3), w_re, w_im));
       }
+    }
+  }
+  #endif // __AVX2__
 
-      j += m;
+  // Perform the radix-4 passes with quarter-block sizes in the
+  // range q_first, q_first / 4, ..., q_last on the complex points
+  // [first, last), which is aligned to the block size (4 * q_first).
+  template<typename float_type>
+  void forward_passes(float_type* z,
+                      const std::uint32_t first,
+                      const std::uint32_t last,
+                      const std::uint32_t q_first,
+                      const std::uint32_t q_last,
+                      const float_type* tw)
+  {
+    for(std::uint32_t q = q_first; q >= q_last; q >>= 2U)
+    {
+      for(std::uint32_t start = first; start < last; start += static_cast<std::uint32_t>(q * 4U))
+      {
+        const std::uint32_t b = static_cast<std::uint32_t>(start / (q * 4U));
+
+        radix4_forward_block(z + (start * 2U), q, q,
+                             tw[(b * 2U) + 0U], tw[(b * 2U) + 1U],
+                             tw[(b * 4U) + 0U], tw[(b * 4U) + 1U]);
+      }
+
+      if(q == static_cast<std::uint32_t>(1U)) { break; }
     }
+  }
+
+  template<typename float_type>
+  void inverse_passes(float_type* z,
+                      const std::uint32_t first,
+                      const std::uint32_t last,
+                      const std::uint32_t q_first,
+                      const std::uint32_t q_last,
+                      const float_type* tw)
+  {
+    for(std::uint32_t q = q_first; q <= q_last; q <<= 2U)
+    {
+      for(std::uint32_t start = first; start < last; start += static_cast<std::uint32_t>(q * 4U))
+      {
+        const std::uint32_t b = static_cast<std::uint32_t>(start / (q * 4U));
 
-    danielson_lanczos_apply<float_type, is_forward_fft>(N, data);
+        radix4_inverse_block(z + (start * 2U), q, q,
+                             tw[(b * 2U) + 0U], tw[(b * 2U) + 1U],
+                             tw[(b * 4U) + 0U], tw[(b * 4U) + 1U]);
+      }
+    }
   }
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  void rfft_lanczos_rfft(const std::uint32_t N,
-                         float_type* data,
-                         const bool = is_forward_fft,
-                         const typename std::enable_if<(is_forward_fft == true)>::type* = nullptr)
+  // The radix-4 pass having the quarter-block size q over the entire
+  // array of M complex points. The butterflies are split into parallel
+  // tasks (block-by-block, or within the blocks for the largest spans).
+  template<typename float_type>
+  void forward_pass_full(const std::uint32_t M, float_type* z, const std::uint32_t q, const float_type* tw)
   {
-    fft_lanczos_fft<float_type, true>(N / 2U, data);
+    parallel::parallel_for_blocks(M, static_cast<std::uint32_t>(M / (q * 4U)), q,
+      [z, q, tw](const std::uint32_t b, const std::uint32_t j_first, const std::uint32_t j_count)
+      {
+        radix4_forward_block(z + (((b * (q * 4U)) + j_first) * 2U), q, j_count,
+                             tw[(b * 2U) + 0U], tw[(b * 2U) + 1U],
+                             tw[(b * 4U) + 0U], tw[(b * 4U) + 1U]);
+      });
+  }
 
-    float_type real_part(float_type(1) + const_unique_wp_real<float_type, true>(N));
-    float_type imag_part(                const_unique_wp_imag<float_type, true>(N));
+  template<typename float_type>
+  void inverse_pass_full(const std::uint32_t M, float_type* z, const std::uint32_t q, const float_type* tw)
+  {
+    parallel::parallel_for_blocks(M, static_cast<std::uint32_t>(M / (q * 4U)), q,
+      [z, q, tw](const std::uint32_t b, const std::uint32_t j_first, const std::uint32_t j_count)
+      {
+        radix4_inverse_block(z + (((b * (q * 4U)) + j_first) * 2U), q, j_count,
+                             tw[(b * 2U) + 0U], tw[(b * 2U) + 1U],
+                             tw[(b * 4U) + 0U], tw[(b * 4U) + 1U]);
+      });
+  }
+
+  // The single radix-2 level needed when log2(M) is odd. This is
+  // always the outermost level, in which the twiddle factor is 1.
+  template<typename float_type>
+  void radix2_outermost_pass(const std::uint32_t M, float_type* z)
+  {
+    parallel::parallel_for_blocks(M, static_cast<std::uint32_t>(1U), M,
+      [z, M](const std::uint32_t, const std::uint32_t j_first, const std::uint32_t j_count)
+      {
+        for(std::uint32_t j = j_first; j < static_cast<std::uint32_t>(j_first + j_count); ++j)
+        {
+          const float_type ur = z[j];
+          const float_type vr = z[j + M];
+
+          z[j]     = ur + vr;
+          z[j + M] = ur - vr;
+        }
+      });
+  }
+
+  inline bool log2_is_odd(const std::uint32_t M)
+  {
+    return ((M & UINT32_C(0xAAAAAAAA)) != static_cast<std::uint32_t>(0U));
+  }
 
-    for(std::uint32_t i = static_cast<std::uint32_t>(1U); i < static_cast<std::uint32_t>(N >> 2U); ++i)
+  // Forward complex FFT of M points (M a power of two, M >= 2)
+  // with natural-order input and bit-reversed output.
+  template<typename float_type>
+  void fft_forward(const std::uint32_t M, float_type* z, const float_type* tw)
+  {
+    std::uint32_t q_top = M;
+
+    if(log2_is_odd(M))
     {
-      const std::uint32_t i1 = static_cast<std::uint32_t>(i + i);
-      const std::uint32_t i3 = static_cast<std::uint32_t>(N - i1);
+      radix2_outermost_pass(M, z);
 
-      const std::uint32_t i2 = static_cast<std::uint32_t>(1U + i1);
-      const std::uint32_t i4 = static_cast<std::uint32_t>(1U + i3);
+      q_top /= 2U;
+    }
 
-      {
-        const float_type h1r = template_fast_div_by_two(data[i1] + data[i3]);
-        const float_type h1i = template_fast_div_by_two(data[i2] - data[i4]);
+    q_top /= 4U;
 
-        const float_type h2r = template_fast_div_by_two(data[i2] + data[i4]);
-        const float_type h2i = template_fast_div_by_two(data[i1] - data[i3]);
+    if(q_top == static_cast<std::uint32_t>(0U))
+    {
+      return;
+    }
 
-        data[i1] = (+h1r + (real_part * h2r)) + (imag_part * h2i);
-        data[i2] = (+h1i - (real_part * h2i)) + (imag_part * h2r);
-        data[i3] = (+h1r - (real_part * h2r)) - (imag_part * h2i);
-        data[i4] = (-h1i - (real_part * h2i)) + (imag_part * h2r);
-      }
+    // Sweep the large spans over the entire array,
+    // and then finish the transform block-by-block.
+    std::uint32_t q_blocked = q_top;
 
-      const float_type tmp_real = real_part;
+    while((q_blocked * 4U) > fft_block_points)
+    {
+      q_blocked >>= 2U;
+    }
 
-      real_part += (((tmp_real  * const_unique_wp_real<float_type, true>(N)) - (imag_part * const_unique_wp_imag<float_type, true>(N))));
-      imag_part += (((imag_part * const_unique_wp_real<float_type, true>(N)) + (tmp_real  * const_unique_wp_imag<float_type, true>(N))));
+    for(std::uint32_t q = q_top; q > q_blocked; q >>= 2U)
+    {
+      forward_pass_full(M, z, q, tw);
     }
 
-    const float_type f0_tmp = data[0U];
+    const std::uint32_t block_size = static_cast<std::uint32_t>(q_blocked * 4U);
 
-    data[0U] = f0_tmp + data[1U];
-    data[1U] = f0_tmp - data[1U];
+    parallel::parallel_for(M, static_cast<std::uint32_t>(M / block_size),
+      [z, q_blocked, block_size, tw](const std::uint32_t i)
+      {
+        const std::uint32_t first = static_cast<std::uint32_t>(i * block_size);
+
+        forward_passes(z, first, static_cast<std::uint32_t>(first + block_size), q_blocked, static_cast<std::uint32_t>(1U), tw);
+      });
   }
 
-  template<typename float_type,
-           const bool is_forward_fft>
-  void rfft_lanczos_rfft(const std::uint32_t N,
-                         float_type* data,
-                         const bool = is_forward_fft,
-                         const typename std::enable_if<(is_forward_fft == false)>::type* = nullptr)
+  // Inverse (unscaled) complex FFT of M points with bit-reversed
+  // input and natural-order output. The result is multiplied by M.
+  template<typename float_type>
+  void fft_inverse(const std::uint32_t M, float_type* z, const float_type* tw)
   {
-    float_type real_part(float_type(1) + const_unique_wp_real<float_type, false>(N));
-    float_type imag_part(                const_unique_wp_imag<float_type, false>(N));
+    const bool has_radix2_pass = log2_is_odd(M);
+
+    const std::uint32_t q_top = static_cast<std::uint32_t>((has_radix2_pass ? (M / 2U) : M) / 4U);
 
-    for(std::uint32_t i = static_cast<std::uint32_t>(1U); i < static_cast<std::uint32_t>(N >> 2U); ++i)
+    if(q_top != static_cast<std::uint32_t>(0U))
     {
-      const std::uint32_t i1 = static_cast<std::uint32_t>(i + i);
-      const std::uint32_t i3 = static_cast<std::uint32_t>(N - i1);
+      std::uint32_t q_blocked = q_top;
 
-      const std::uint32_t i2 = static_cast<std::uint32_t>(1U + i1);
-      const std::uint32_t i4 = static_cast<std::uint32_t>(1U + i3);
+      while((q_blocked * 4U) > fft_block_points)
+      {
+        q_blocked >>= 2U;
+      }
 
-      const float_type h1r = template_fast_div_by_two(data[i1] + data[i3]);
-      const float_type h1i = template_fast_div_by_two(data[i2] - data[i4]);
+      const std::uint32_t block_size = static_cast<std::uint32_t>(q_blocked * 4U);
 
-      const float_type h2r = template_fast_div_by_two(data[i2] + data[i4]);
-      const float_type h2i = template_fast_div_by_two(data[i1] - data[i3]);
+      parallel::parallel_for(M, static_cast<std::uint32_t>(M / block_size),
+        [z, q_blocked, block_size, tw](const std::uint32_t i)
+        {
+          const std::uint32_t first = static_cast<std::uint32_t>(i * block_size);
 
-      data[i1] = (+h1r - (real_part * h2r)) - (imag_part * h2i);
-      data[i2] = (+h1i + (real_part * h2i)) - (imag_part * h2r);
-      data[i3] = (+h1r + (real_part * h2r)) + (imag_part * h2i);
-      data[i4] = (-h1i + (real_part * h2i)) - (imag_part * h2r);
+          inverse_passes(z, first, static_cast<std::uint32_t>(first + block_size), static_cast<std::uint32_t>(1U), q_blocked, tw);
+        });
 
-      const float_type tmp_real = real_part;
+      for(std::uint32_t q = static_cast<std::uint32_t>(q_blocked * 4U); q <= q_top; q <<= 2U)
+      {
+        inverse_pass_full(M, z, q, tw);
+      }
+    }
 
-      real_part += (((tmp_real  * const_unique_wp_real<float_type, false>(N)) - (imag_part * const_unique_wp_imag<float_type, false>(N))));
-      imag_part += (((imag_part * const_unique_wp_real<float_type, false>(N)) + (tmp_real  * const_unique_wp_imag<float_type, false>(N))));
+    if(has_radix2_pass)
+    {
+      radix2_outermost_pass(M, z);
     }
+  }
 
-    const float_type f0_tmp = data[0U];
+  // Multiply the spectra of two real signals of length 2M, which have
+  // been packed into the complex signals za and zb of length M and
+  // transformed with fft_forward. The result (the spectrum of the
+  // packed product) is stored in za, ready for fft_inverse.
+  template<typename float_type>
+  void convolve_real_spectra(const std::uint32_t M, float_type* za, const float_type* zb, const float_type* tw)
+  {
+    // In bit-reversed order, the index k and its partner (M - k)
+    // are mirrored within each octave [2^m, 2^(m + 1)), and the
+    // twiddle factor exp(i Pi k / M) is simply tw[p].
 
-    data[0U] = template_fast_div_by_two(f0_tmp + data[1U]);
-    data[1U] = template_fast_div_by_two(f0_tmp - data[1U]);
+    // For the packed signal z = x_even + i x_odd, the even and odd
+    // spectra are E = (Z_k + conj(Z_(M-k))) / 2 and
+    // O = (Z_k - conj(Z_(M-k))) / 2i. The packed product then has
+    // E' = Ea Eb + w^2 Oa Ob and O' = Ea Ob + Oa Eb, and
+    // Z'_k = E' + i O', as well as Z'_(M-k) = conj(E') + i conj(O').
 
-    fft_lanczos_fft<float_type, false>(N / 2U, data);
+    for(std::uint32_t octave = static_cast<std::uint32_t>(1U); octave <= M; octave *= 2U)
+    {
+      const std::uint32_t p_lo = static_cast<std::uint32_t>(octave / 2U);
+      const std::uint32_t p_hi = static_cast<std::uint32_t>(octave - 1U);
+
+      // The number of pairs (p, pp) in this octave.
+      const std::uint32_t pair_count = static_cast<std::uint32_t>(((p_hi - p_lo) / 2U) + 1U);
+
+      parallel::parallel_for_blocks(M, static_cast<std::uint32_t>(1U), pair_count,
+        [za, zb, tw, p_lo, p_hi](const std::uint32_t, const std::uint32_t j_first, const std::uint32_t j_count)
+        {
+          for(std::uint32_t p = static_cast<std::uint32_t>(p_lo + j_first); p < static_cast<std::uint32_t>(p_lo + j_first + j_count); ++p)
+          {
+            const std::uint32_t pp = static_cast<std::uint32_t>(p_hi - (p - p_lo));
+
+            const float_type wr = tw[(p * 2U) + 0U];
+            const float_type wi = tw[(p * 2U) + 1U];
+
+            const float_type w2r = (wr * wr) - (wi * wi);
+            const float_type w2i = (wr * wi) * 2;
+
+            const float_type ear = (za[(p * 2U) + 0U] + za[(pp * 2U) + 0U]) / 2;
+            const float_type eai = (za[(p * 2U) + 1U] - za[(pp * 2U) + 1U]) / 2;
+            const float_type oar = (za[(p * 2U) + 1U] + za[(pp * 2U) + 1U]) / 2;
+            const float_type oai = (za[(pp * 2U) + 0U] - za[(p * 2U) + 0U]) / 2;
+
+            const float_type ebr = (zb[(p * 2U) + 0U] + zb[(pp * 2U) + 0U]) / 2;
+            const float_type ebi = (zb[(p * 2U) + 1U] - zb[(pp * 2U) + 1U]) / 2;
+            const float_type obr = (zb[(p * 2U) + 1U] + zb[(pp * 2U) + 1U]) / 2;
+            const float_type obi = (zb[(pp * 2U) + 0U] - zb[(p * 2U) + 0U]) / 2;
+
+            const float_type oor = (oar * obr) - (oai * obi);
+            const float_type ooi = (oar * obi) + (oai * obr);
+
+            const float_type er = ((ear * ebr) - (eai * ebi)) + ((w2r * oor) - (w2i * ooi));
+            const float_type ei = ((ear * ebi) + (eai * ebr)) + ((w2r * ooi) + (w2i * oor));
+
+            const float_type or_ = ((ear * obr) - (eai * obi)) + ((oar * ebr) - (oai * ebi));
+            const float_type oi  = ((ear * obi) + (eai * obr)) + ((oar * ebi) + (oai * ebr));
+
+            za[(p * 2U) + 0U] = er - oi;
+            za[(p * 2U) + 1U] = ei + or_;
+
+            if(pp != p)
+            {
+              za[(pp * 2U) + 0U] = er + oi;
+              za[(pp * 2U) + 1U] = or_ - ei;
+            }
+          }
+        });
+    }
   }
 
   } } } } // namespace math::wide_decimal::detail::fft
@@ -0,0 +1,649 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef DECWIDE_T_DETAIL_NTT_2026_10_18_H_
+  #define DECWIDE_T_DETAIL_NTT_2026_10_18_H_
+
+  #include <algorithm>
+  #include <array>
+  #include <cstdint>
+  #include <memory>
+
+  #if defined(__AVX2__)
+  #include <immintrin.h>
+  #endif
+
+  #include <math/wide_decimal/decwide_t_detail_parallel.h>
+
+  // The number-theoretic transform (NTT) used for the multiplication
+  // of very large decwide_t. The limbs are convolved exactly, modulo
+  // three primes below 2^31, and the convolution sums are recovered
+  // with Chinese remaindering. In contrast to the floating-point FFT,
+  // there is no rounding and no splitting of the limbs into halves.
+
+  // The transforms have the same structure as those of the FFT
+  // engine in decwide_t_detail_fft.h: forward Cooley-Tukey and inverse
+  // Gentleman-Sande passes with one (bit-reversed order) twiddle factor
+  // per butterfly block, so that no bit-reversal permutation is needed.
+  // They are parallelized in the same way (see decwide_t_detail_parallel.h).
+
+  // See also Sect. 2.3 and "Algorithm 2.4 CRT" in R.P. Brent and
+  // P. Zimmermann, "Modern Computer Arithmetic", Cambridge University
+  // Press (2011).
+
+  namespace math { namespace wide_decimal { namespace detail { namespace ntt {
+
+  // The number of residues in one cache block.
+  constexpr std::uint32_t ntt_block_size = UINT32_C(8192);
+
+  // Arithmetic in the prime field used by one number-theoretic transform.
+  // The modulus is less than 2^31 and has the form k * 2^m + 1, such that
+  // transforms of length up to 2^m exist.
+  template<const std::uint32_t Modulus,
+           const std::uint32_t PrimitiveRoot,
+           const std::uint32_t TwoAdicOrder>
+  struct ntt_prime_field
+  {
+    static constexpr std::uint32_t modulus        = Modulus;
+    static constexpr std::uint32_t two_adic_order = TwoAdicOrder;
+
+    static std::uint32_t add(const std::uint32_t a, const std::uint32_t b)
+    {
+      const std::uint32_t s = a + b;
+
+      return ((s >= Modulus) ? std::uint32_t(s - Modulus) : s);
+    }
+
+    static std::uint32_t sub(const std::uint32_t a, const std::uint32_t b)
+    {
+      return ((a >= b) ? std::uint32_t(a - b) : std::uint32_t((a + Modulus) - b));
+    }
+
+    static std::uint32_t mul(const std::uint32_t a, const std::uint32_t b)
+    {
+      // The modulus is a compile-time constant, so the compiler
+      // replaces the division with multiplication and shifts.
+      return std::uint32_t((std::uint64_t(a) * b) % Modulus);
+    }
+
+    static std::uint32_t pow(std::uint32_t b, std::uint32_t e)
+    {
+      std::uint32_t result = 1U;
+
+      while(e != 0U)
+      {
+        if((e & 1U) != 0U) { result = mul(result, b); }
+
+        b   = mul(b, b);
+        e >>= 1U;
+      }
+
+      return result;
+    }
+
+    static std::uint32_t inv(const std::uint32_t a) { return pow(a, Modulus - 2U); }
+
+    static std::uint32_t shoup_factor(const std::uint32_t w)
+    {
+      return std::uint32_t((std::uint64_t(w) << 32U) / Modulus);
+    }
+
+    static std::uint32_t mul_shoup(const std::uint32_t a, const std::uint32_t w, const std::uint32_t w_shoup)
+    {
+      // Multiply by the fixed factor w using the precomputed
+      // w_shoup = floor(w * 2^32 / Modulus). See also V. Shoup,
+      // "NTL: A Library for doing Number Theory" (MulModPrecon).
+      const std::uint32_t q = std::uint32_t((std::uint64_t(a) * w_shoup) >> 32U);
+      const std::uint32_t r = std::uint32_t(std::uint32_t(a * w) - std::uint32_t(q * Modulus));
+
+      return ((r >= Modulus) ? std::uint32_t(r - Modulus) : r);
+    }
+
+    static void make_twiddles(std::uint32_t* w, const std::uint32_t n, const bool is_inverse)
+    {
+      // Store the n / 2 twiddle factors in bit-reversed order in w,
+      // followed by their Shoup factors. The b'th factor is rho^e,
+      // where rho is the primitive (2^two_adic_order)'th root of unity
+      // and e = phi(b) * 2^(two_adic_order - 1), with phi(b) the binary
+      // fraction made of the reversed bits of b. A table made for n is
+      // a prefix of the table for any larger n.
+      const std::uint32_t half = (n >> 1U);
+
+      std::uint32_t rho = pow(PrimitiveRoot, std::uint32_t((Modulus - 1U) >> TwoAdicOrder));
+
+      if(is_inverse)
+      {
+        rho = inv(rho);
+      }
+
+      w[0U] = 1U;
+
+      // Use w[2^m + t] = w[2^m] * w[t] for t < 2^m,
+      // where w[2^m] is a primitive 2^(m + 2)'th root.
+      for(std::uint32_t m = 0U, octave = 1U; octave < half; ++m, octave <<= 1U)
+      {
+        const std::uint32_t r = pow(rho, std::uint32_t(1UL << (TwoAdicOrder - 2U - m)));
+
+        for(std::uint32_t t = 0U; t < octave; ++t)
+        {
+          w[octave + t] = mul(r, w[t]);
+        }
+      }
+
+      for(std::uint32_t j = 0U; j < half; ++j)
+      {
+        w[half + j] = shoup_factor(w[j]);
+      }
+    }
+
+    #if defined(__AVX2__)
+    // Vectorized butterflies, processing eight residues per 256-bit
+    // register. These return the number of butterflies done, and the
+    // remaining ones (if any) are done by the scalar code.
+
+    static __m256i add_avx2(const __m256i a, const __m256i b)
+    {
+      const __m256i s = _mm256_add_epi32(a, b);
+
+      return _mm256_min_epu32(s, _mm256_sub_epi32(s, _mm256_set1_epi32(std::int32_t(Modulus))));
+    }
+
+    static __m256i sub_avx2(const __m256i a, const __m256i b)
+    {
+      const __m256i d = _mm256_sub_epi32(a, b);
+
+      return _mm256_min_epu32(d, _mm256_add_epi32(d, _mm256_set1_epi32(std::int32_t(Modulus))));
+    }
+
+    static __m256i mul_shoup_avx2(const __m256i a, const __m256i w, const __m256i w_shoup)
+    {
+      // The high halves of the 64-bit products a * w_shoup,
+      // in the even and in the odd lanes.
+      const __m256i q_even = _mm256_srli_epi64(_mm256_mul_epu32(a, w_shoup), 32);
+      const __m256i q_odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), w_shoup);
+      const __m256i q      = _mm256_blend_epi32(q_even, q_odd, 0xAA);
+
+      const __m256i r = _mm256_sub_epi32(_mm256_mullo_epi32(a, w),
+                                         _mm256_mullo_epi32(q, _mm256_set1_epi32(std::int32_t(Modulus))));
+
+      return _mm256_min_epu32(r, _mm256_sub_epi32(r, _mm256_set1_epi32(std::int32_t(Modulus))));
+    }
+
+    static std::uint32_t forward_butterflies_avx2(std::uint32_t* x0, std::uint32_t* x1, const std::uint32_t len, const std::uint32_t wb, const std::uint32_t wb_shoup)
+    {
+      const __m256i w       = _mm256_set1_epi32(std::int32_t(wb));
+      const __m256i w_shoup = _mm256_set1_epi32(std::int32_t(wb_shoup));
+
+      std::uint32_t j = 0U;
+
+      for( ; (j + 8U) <= len; j += 8U)
+      {
+        const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x0 + j));
+        const __m256i v = mul_shoup_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x1 + j)), w, w_shoup);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x0 + j), add_avx2(u, v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x1 + j), sub_avx2(u, v));
+      }
+
+      return j;
+    }
+
+    static std::uint32_t inverse_butterflies_avx2(std::uint32_t* x0, std::uint32_t* x1, const std::uint32_t len, const std::uint32_t wb, const std::uint32_t wb_shoup)
+    {
+      const __m256i w       = _mm256_set1_epi32(std::int32_t(wb));
+      const __m256i w_shoup = _mm256_set1_epi32(std::int32_t(wb_shoup));
+
+      std::uint32_t j = 0U;
+
+      for( ; (j + 8U) <= len; j += 8U)
+      {
+        const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x0 + j));
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x1 + j));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x0 + j), add_avx2(u, v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x1 + j), mul_shoup_avx2(sub_avx2(u, v), w, w_shoup));
+      }
+
+      return j;
+    }
+    #endif // __AVX2__
+
+    static void forward_butterflies(std::uint32_t* x0, std::uint32_t* x1, const std::uint32_t count, const std::uint32_t wb, const std::uint32_t wb_shoup)
+    {
+      // The count Cooley-Tukey butterflies (x0[j], x1[j]) having the twiddle factor wb.
+      std::uint32_t j = 0U;
+
+      #if defined(__AVX2__)
+      j = forward_butterflies_avx2(x0, x1, count, wb, wb_shoup);
+      #endif
+
+      for( ; j < count; ++j)
+      {
+        const std::uint32_t u = x0[j];
+        const std::uint32_t v = mul_shoup(x1[j], wb, wb_shoup);
+
+        x0[j] = add(u, v);
+        x1[j] = sub(u, v);
+      }
+    }
+
+    static void inverse_butterflies(std::uint32_t* x0, std::uint32_t* x1, const std::uint32_t count, const std::uint32_t wb, const std::uint32_t wb_shoup)
+    {
+      // The count Gentleman-Sande butterflies (x0[j], x1[j]) having the twiddle factor wb.
+      std::uint32_t j = 0U;
+
+      #if defined(__AVX2__)
+      j = inverse_butterflies_avx2(x0, x1, count, wb, wb_shoup);
+      #endif
+
+      for( ; j < count; ++j)
+      {
+        const std::uint32_t u = x0[j];
+        const std::uint32_t v = x1[j];
+
+        x0[j] = add(u, v);
+        x1[j] = mul_shoup(sub(u, v), wb, wb_shoup);
+      }
+    }
+
+    static void forward_pass(std::uint32_t* x, const std::uint32_t first, const std::uint32_t last, const std::uint32_t len, const std::uint32_t* w, const std::uint32_t w_half)
+    {
+      // One level of Cooley-Tukey butterflies having the half-span len,
+      // on the elements [first, last) which are aligned to 2 * len.
+      for(std::uint32_t start = first; start < last; start += (len * 2U))
+      {
+        const std::uint32_t b = start / (len * 2U);
+
+        forward_butterflies(x + start, x + (start + len), len, w[b], w[w_half + b]);
+      }
+    }
+
+    static void inverse_pass(std::uint32_t* x, const std::uint32_t first, const std::uint32_t last, const std::uint32_t len, const std::uint32_t* w, const std::uint32_t w_half)
+    {
+      // One level of Gentleman-Sande butterflies having the half-span len.
+      for(std::uint32_t start = first; start < last; start += (len * 2U))
+      {
+        const std::uint32_t b = start / (len * 2U);
+
+        inverse_butterflies(x + start, x + (start + len), len, w[b], w[w_half + b]);
+      }
+    }
+
+    static void forward_pass_full(std::uint32_t* x, const std::uint32_t n, const std::uint32_t len, const std::uint32_t* w, const std::uint32_t w_half)
+    {
+      // One level on the entire array, split into parallel tasks.
+      parallel::parallel_for_blocks(n, n / (len * 2U), len,
+        [x, len, w, w_half](const std::uint32_t b, const std::uint32_t j_first, const std::uint32_t j_count)
+        {
+          std::uint32_t* x0 = x + ((b * (len * 2U)) + j_first);
+
+          forward_butterflies(x0, x0 + len, j_count, w[b], w[w_half + b]);
+        });
+    }
+
+    static void inverse_pass_full(std::uint32_t* x, const std::uint32_t n, const std::uint32_t len, const std::uint32_t* w, const std::uint32_t w_half)
+    {
+      parallel::parallel_for_blocks(n, n / (len * 2U), len,
+        [x, len, w, w_half](const std::uint32_t b, const std::uint32_t j_first, const std::uint32_t j_count)
+        {
+          std::uint32_t* x0 = x + ((b * (len * 2U)) + j_first);
+
+          inverse_butterflies(x0, x0 + len, j_count, w[b], w[w_half + b]);
+        });
+    }
+
+    static void forward_transform(std::uint32_t* x, const std::uint32_t* w, const std::uint32_t w_half, const std::uint32_t n)
+    {
+      // Cyclic transform of length n (a power of 2), taking natural
+      // order input to bit-reversed order output. The table w has
+      // w_half >= n / 2 twiddle factors, followed by their Shoup factors.
+
+      // The levels having a span larger than ntt_block_size sweep
+      // the entire array, and the others are done block-by-block.
+      std::uint32_t len = (n >> 1U);
+
+      for( ; (len * 2U) > ntt_block_size; len >>= 1U)
+      {
+        forward_pass_full(x, n, len, w, w_half);
+      }
+
+      const std::uint32_t block_size = (len * 2U);
+
+      parallel::parallel_for(n, n / block_size,
+        [x, w, w_half, len, block_size](const std::uint32_t i)
+        {
+          const std::uint32_t first = i * block_size;
+
+          for(std::uint32_t len_in_block = len; len_in_block >= 1U; len_in_block >>= 1U)
+          {
+            forward_pass(x, first, first + block_size, len_in_block, w, w_half);
+          }
+        });
+    }
+
+    static void inverse_transform(std::uint32_t* x, const std::uint32_t* w, const std::uint32_t w_half, const std::uint32_t n)
+    {
+      // Inverse (unscaled) cyclic transform of length n, taking bit-reversed
+      // order input to natural order output. The table w holds the inverse
+      // twiddle factors. The result is multiplied by n.
+
+      const std::uint32_t block_size = ((n < ntt_block_size) ? n : ntt_block_size);
+
+      parallel::parallel_for(n, n / block_size,
+        [x, w, w_half, block_size](const std::uint32_t i)
+        {
+          const std::uint32_t first = i * block_size;
+
+          for(std::uint32_t len = 1U; len < block_size; len <<= 1U)
+          {
+            inverse_pass(x, first, first + block_size, len, w, w_half);
+          }
+        });
+
+      for(std::uint32_t len = block_size; len < n; len <<= 1U)
+      {
+        inverse_pass_full(x, n, len, w, w_half);
+      }
+    }
+  };
+
+  // The three primes of the multi-modular transform multiplication.
+  // Their product exceeds 2^89, which holds the convolution sums of
+  // limbs below 10^8 for transform lengths up to 2^23.
+  using ntt_prime_field_1 = ntt_prime_field< 998244353U,  3U, 23U>; // 119 * 2^23 + 1
+  using ntt_prime_field_2 = ntt_prime_field< 469762049U,  3U, 26U>; //   7 * 2^26 + 1
+  using ntt_prime_field_3 = ntt_prime_field<2013265921U, 31U, 27U>; //  15 * 2^27 + 1
+
+  constexpr std::uint32_t ntt_max_transform_length = UINT32_C(1) << 23U;
+
+  // The memory needed for one transform length n: the residues of
+  // the three primes plus one scratch array (4n words), and the forward
+  // and inverse twiddle tables of each prime, including their Shoup
+  // factors (6n words).
+  constexpr std::uint32_t ntt_work_size   (const std::uint32_t n) { return n * 4U; }
+  constexpr std::uint32_t ntt_twiddle_size(const std::uint32_t n) { return n * 6U; }
+
+  inline void ntt_twiddle_tables_fill(const std::uint32_t n, std::uint32_t* tw)
+  {
+    ntt_prime_field_1::make_twiddles(tw + (0U * n), n, false);
+    ntt_prime_field_1::make_twiddles(tw + (1U * n), n, true);
+    ntt_prime_field_2::make_twiddles(tw + (2U * n), n, false);
+    ntt_prime_field_2::make_twiddles(tw + (3U * n), n, true);
+    ntt_prime_field_3::make_twiddles(tw + (4U * n), n, false);
+    ntt_prime_field_3::make_twiddles(tw + (5U * n), n, true);
+  }
+
+  // A persistent, size-keyed scratch pool for the NTT multiplication,
+  // analogous to fft::fft_scratch_pool. The twiddle tables are made for
+  // the largest transform length requested so far (tw_length), and serve
+  // all smaller lengths.
+  template<typename AllocatorType = std::allocator<std::uint32_t>>
+  class ntt_scratch_pool final
+  {
+  public:
+    constexpr ntt_scratch_pool() : my_work(nullptr),
+                                   my_work_length(0U),
+                                   my_twiddles(nullptr),
+                                   my_twiddles_length(0U) { }
+
+    ntt_scratch_pool(const ntt_scratch_pool&) = delete;
+
+    ntt_scratch_pool& operator=(const ntt_scratch_pool&) = delete;
+
+    ~ntt_scratch_pool()
+    {
+      release(my_work,     ntt_work_size   (my_work_length));
+      release(my_twiddles, ntt_twiddle_size(my_twiddles_length));
+    }
+
+    std::uint32_t* work(const std::uint32_t n)
+    {
+      if(my_work_length < n)
+      {
+        release(my_work, ntt_work_size(my_work_length));
+
+        my_work        = acquire(ntt_work_size(n));
+        my_work_length = n;
+      }
+
+      return my_work;
+    }
+
+    const std::uint32_t* twiddles(const std::uint32_t n)
+    {
+      if(my_twiddles_length < n)
+      {
+        release(my_twiddles, ntt_twiddle_size(my_twiddles_length));
+
+        my_twiddles        = acquire(ntt_twiddle_size(n));
+        my_twiddles_length = n;
+
+        ntt_twiddle_tables_fill(my_twiddles_length, my_twiddles);
+      }
+
+      return my_twiddles;
+    }
+
+    std::uint32_t tw_length() const { return my_twiddles_length; }
+
+  private:
+    using allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::uint32_t>;
+
+    std::uint32_t* my_work;
+    std::uint32_t  my_work_length;
+    std::uint32_t* my_twiddles;
+    std::uint32_t  my_twiddles_length;
+
+    static std::uint32_t* acquire(const std::uint32_t count)
+    {
+      allocator_type my_a;
+
+      return std::allocator_traits<allocator_type>::allocate(my_a, count);
+    }
+
+    static void release(std::uint32_t* p, const std::uint32_t count)
+    {
+      if(p != nullptr)
+      {
+        allocator_type my_a;
+
+        std::allocator_traits<allocator_type>::deallocate(my_a, p, count);
+      }
+    }
+  };
+
+  // The static-memory counterpart of ntt_scratch_pool.
+  template<const std::uint32_t MaxTransformLength>
+  class ntt_scratch_array final
+  {
+  public:
+    constexpr ntt_scratch_array() : my_work(),
+                                    my_twiddles(),
+                                    my_twiddles_are_filled(false) { }
+
+    std::uint32_t* work(const std::uint32_t) { return my_work.data(); }
+
+    const std::uint32_t* twiddles(const std::uint32_t)
+    {
+      if(my_twiddles_are_filled == false)
+      {
+        ntt_twiddle_tables_fill(MaxTransformLength, my_twiddles.data());
+
+        my_twiddles_are_filled = true;
+      }
+
+      return my_twiddles.data();
+    }
+
+    constexpr std::uint32_t tw_length() const { return MaxTransformLength; }
+
+  private:
+    std::array<std::uint32_t, static_cast<std::size_t>(ntt_work_size   (MaxTransformLength))> my_work;
+    std::array<std::uint32_t, static_cast<std::size_t>(ntt_twiddle_size(MaxTransformLength))> my_twiddles;
+    bool                                                                                        my_twiddles_are_filled;
+  };
+
+  template<typename NttPrimeFieldType,
+           typename LimbType>
+  void ntt_convolution(      std::uint32_t* x,
+                             std::uint32_t* y,
+                       const std::uint32_t* w_fwd,
+                       const std::uint32_t* w_inv,
+                       const std::uint32_t  w_half,
+                       const LimbType*      a,
+                       const std::uint32_t  na,
+                       const LimbType*      b,
+                       const std::uint32_t  nb,
+                       const std::uint32_t  len)
+  {
+    // Compute the cyclic convolution of the na limbs of a and the nb limbs
+    // of b (zero-padded to the transform length len) modulo one prime.
+    // The result is stored in x. The array y is used as scratch storage.
+    // For squaring (with a and b being the same), the transform of a
+    // is used for both operands.
+
+    const bool is_square = ((a == b) && (na == nb));
+
+    std::copy(a, a + na, x);
+    std::fill(x + na, x + len, std::uint32_t(0U));
+
+    NttPrimeFieldType::forward_transform(x, w_fwd, w_half, len);
+
+    if(is_square)
+    {
+      y = x;
+    }
+    else
+    {
+      std::copy(b, b + nb, y);
+      std::fill(y + nb, y + len, std::uint32_t(0U));
+
+      NttPrimeFieldType::forward_transform(y, w_fwd, w_half, len);
+    }
+
+    // Multiply pointwise, including the scaling by 1/len
+    // of the subsequent inverse transform.
+    const std::uint32_t len_inv       = NttPrimeFieldType::inv(len);
+    const std::uint32_t len_inv_shoup = NttPrimeFieldType::shoup_factor(len_inv);
+
+    parallel::parallel_for_blocks(len, 1U, len,
+      [x, y, len_inv, len_inv_shoup](const std::uint32_t, const std::uint32_t j_first, const std::uint32_t j_count)
+      {
+        for(std::uint32_t i = j_first; i < (j_first + j_count); ++i)
+        {
+          x[i] = NttPrimeFieldType::mul_shoup(NttPrimeFieldType::mul(x[i], y[i]), len_inv, len_inv_shoup);
+        }
+      });
+
+    NttPrimeFieldType::inverse_transform(x, w_inv, w_half, len);
+  }
+
+  // Multiply the na limbs of a with the nb limbs of b (in base LimbRadix,
+  // the most significant limb first) using transforms of length len, where
+  // len >= na + nb - 1. The most significant r_count limbs of the exact
+  // (na + nb)-limb product are stored in r, where r[0] receives the carry
+  // out of the topmost convolution sum. The result may overwrite a or b.
+  template<const std::uint32_t LimbRadix,
+           typename LimbType>
+  void mul_loop_ntt(      LimbType*      r,
+                    const std::uint32_t  r_count,
+                    const LimbType*      a,
+                    const std::uint32_t  na,
+                    const LimbType*      b,
+                    const std::uint32_t  nb,
+                    const std::uint32_t  len,
+                          std::uint32_t* work,
+                    const std::uint32_t* tw,
+                    const std::uint32_t  tw_length)
+  {
+    constexpr std::uint32_t p1 = ntt_prime_field_1::modulus;
+    constexpr std::uint32_t p2 = ntt_prime_field_2::modulus;
+    constexpr std::uint32_t p3 = ntt_prime_field_3::modulus;
+
+    std::uint32_t* x1 = work;
+    std::uint32_t* x2 = x1 + len;
+    std::uint32_t* x3 = x2 + len;
+    std::uint32_t* y  = x3 + len;
+
+    const std::uint32_t w_half = (tw_length >> 1U);
+
+    ntt_convolution<ntt_prime_field_1>(x1, y, tw + (0U * tw_length), tw + (1U * tw_length), w_half, a, na, b, nb, len);
+    ntt_convolution<ntt_prime_field_2>(x2, y, tw + (2U * tw_length), tw + (3U * tw_length), w_half, a, na, b, nb, len);
+    ntt_convolution<ntt_prime_field_3>(x3, y, tw + (4U * tw_length), tw + (5U * tw_length), w_half, a, na, b, nb, len);
+
+    // The constants for Garner's algorithm.
+    const std::uint32_t p1_inv_mod_p2    = ntt_prime_field_2::inv(p1 % p2);
+    const std::uint64_t p1_p2            = std::uint64_t(p1) * p2;
+    const std::uint32_t p1_p2_inv_mod_p3 = ntt_prime_field_3::inv(std::uint32_t(p1_p2 % p3));
+
+    const std::uint64_t p1_p2_lo = std::uint64_t(std::uint32_t(p1_p2));
+    const std::uint64_t p1_p2_hi = (p1_p2 >> 32U);
+
+    // Reconstruct the exact convolution sums
+    // z = x1 + p1 * k2 + (p1 * p2) * k3 (each one independently,
+    // hence in parallel), and store their three 32-bit words
+    // in place of the residues.
+    const std::uint32_t sum_count = std::uint32_t((na + nb) - 1U);
+
+    parallel::parallel_for_blocks(len, 1U, sum_count,
+      [x1, x2, x3, p1_inv_mod_p2, p1_p2_inv_mod_p3, p1_p2_lo, p1_p2_hi](const std::uint32_t, const std::uint32_t j_first, const std::uint32_t j_count)
+      {
+        for(std::uint32_t k = j_first; k < (j_first + j_count); ++k)
+        {
+          const std::uint32_t k2  = ntt_prime_field_2::mul(ntt_prime_field_2::sub(x2[k], std::uint32_t(x1[k] % p2)), p1_inv_mod_p2);
+          const std::uint64_t z12 = x1[k] + (std::uint64_t(p1) * k2);
+          const std::uint32_t k3  = ntt_prime_field_3::mul(ntt_prime_field_3::sub(x3[k], std::uint32_t(z12 % p3)), p1_p2_inv_mod_p3);
+
+          const std::uint64_t m_lo = p1_p2_lo * k3;
+          const std::uint64_t m_hi = p1_p2_hi * k3;
+
+          const std::uint64_t z0 = std::uint64_t(std::uint32_t(z12)) + std::uint32_t(m_lo);
+          const std::uint64_t z1 = ((std::uint64_t(z12 >> 32U) + (m_lo >> 32U)) + std::uint32_t(m_hi)) + (z0 >> 32U);
+          const std::uint64_t z2 = (m_hi >> 32U) + (z1 >> 32U);
+
+          x1[k] = std::uint32_t(z0);
+          x2[k] = std::uint32_t(z1);
+          x3[k] = std::uint32_t(z2);
+        }
+      });
+
+    // The running carry (in units of the limb radix) has up to
+    // three 32-bit words. Release the carries from the least
+    // significant convolution sum (index na + nb - 2) upward.
+    std::uint64_t c0 = 0U;
+    std::uint64_t c1 = 0U;
+    std::uint64_t c2 = 0U;
+
+    for(std::uint32_t k = sum_count; k-- > 0U; )
+    {
+      // Add z to the carry.
+      const std::uint64_t s0 = c0 + x1[k];
+      const std::uint64_t s1 = (c1 + x2[k]) + (s0 >> 32U);
+      const std::uint64_t s2 = (c2 + x3[k]) + (s1 >> 32U);
+
+      // Divide the sum by the limb radix, with the
+      // remainder being the limb and the quotient the carry.
+      std::uint64_t r_digit = std::uint32_t(s2);
+
+      c2      = r_digit / LimbRadix;
+      r_digit = ((r_digit % LimbRadix) << 32U) | std::uint32_t(s1);
+      c1      = r_digit / LimbRadix;
+      r_digit = ((r_digit % LimbRadix) << 32U) | std::uint32_t(s0);
+      c0      = r_digit / LimbRadix;
+
+      if((k + 1U) < r_count)
+      {
+        r[k + 1U] = static_cast<LimbType>(r_digit % LimbRadix);
+      }
+    }
+
+    r[0U] = static_cast<LimbType>(c0);
+  }
+
+  } } } } // namespace math::wide_decimal::detail::ntt
+
+#endif // DECWIDE_T_DETAIL_NTT_2026_10_18_H_
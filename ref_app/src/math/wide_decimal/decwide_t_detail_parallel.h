@@ -0,0 +1,257 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef DECWIDE_T_DETAIL_PARALLEL_2026_10_18_H_
+  #define DECWIDE_T_DETAIL_PARALLEL_2026_10_18_H_
+
+  #include <algorithm>
+  #include <cstdint>
+
+  // The parallel execution of the transform multiplication is optional.
+  // It is enabled by defining WIDE_DECIMAL_ENABLE_THREADS, which requires
+  // <thread>, <mutex> and <condition_variable> from the standard library.
+  // The number of threads (including the calling thread) is taken from
+  // std::thread::hardware_concurrency(), or from WIDE_DECIMAL_THREAD_COUNT
+  // if this is defined. Without WIDE_DECIMAL_ENABLE_THREADS, parallel_for
+  // simply executes its tasks in sequence.
+
+  // The parallelism is that of the individual passes of the transforms:
+  // the butterflies of one pass (and the pointwise steps in between)
+  // are independent of each other, and are split into tasks.
+  #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+  #include <atomic>
+  #include <condition_variable>
+  #include <functional>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+  #endif
+
+  namespace math { namespace wide_decimal { namespace detail { namespace parallel {
+
+  // Transforms having fewer points than this are never split into
+  // parallel tasks, since the work would not outweigh the overhead.
+  constexpr std::uint32_t parallel_min_points = UINT32_C(32768);
+
+  // The smallest number of butterflies (or other elementary
+  // operations) that is given to one task.
+  constexpr std::uint32_t parallel_min_chunk = UINT32_C(1024);
+
+  #if defined(WIDE_DECIMAL_ENABLE_THREADS)
+
+  // A persistent pool of worker threads. The workers sleep until
+  // a job (a number of independent tasks) is posted, and they then
+  // take tasks one-by-one together with the calling thread.
+  class thread_pool final
+  {
+  public:
+    static thread_pool& instance()
+    {
+      static thread_pool the_pool;
+
+      return the_pool;
+    }
+
+    thread_pool(const thread_pool&) = delete;
+
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_stop = true;
+      }
+
+      my_cv_start.notify_all();
+
+      for(std::thread& w : my_workers)
+      {
+        w.join();
+      }
+    }
+
+    std::uint32_t size() const { return static_cast<std::uint32_t>(my_workers.size() + 1U); }
+
+    // Run the tasks 0, 1, ..., task_count - 1 of f on the pool. Only one
+    // job runs at a time, and a call made while the pool is busy (also
+    // a nested call from within a task) executes its tasks in sequence.
+    template<typename FunctionType>
+    void run(const std::uint32_t task_count, FunctionType f)
+    {
+      std::unique_lock<std::mutex> run_lock(my_run_mutex, std::try_to_lock);
+
+      if((my_workers.empty()) || (run_lock.owns_lock() == false) || (task_count < 2U))
+      {
+        for(std::uint32_t i = 0U; i < task_count; ++i) { f(i); }
+
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_job        = f;
+        my_task_count = task_count;
+        my_next_task.store(0U);
+        my_busy_count = static_cast<std::uint32_t>(my_workers.size());
+
+        ++my_generation;
+      }
+
+      my_cv_start.notify_all();
+
+      take_tasks();
+
+      std::unique_lock<std::mutex> lock(my_mutex);
+
+      my_cv_done.wait(lock, [this]() { return (my_busy_count == 0U); });
+
+      my_job = nullptr;
+    }
+
+  private:
+    std::vector<std::thread>            my_workers;
+    std::mutex                          my_run_mutex;
+    std::mutex                          my_mutex;
+    std::condition_variable             my_cv_start;
+    std::condition_variable             my_cv_done;
+    std::function<void(std::uint32_t)>  my_job;
+    std::uint32_t                       my_task_count;
+    std::atomic<std::uint32_t>          my_next_task;
+    std::uint32_t                       my_busy_count;
+    std::uint32_t                       my_generation;
+    bool                                my_stop;
+
+    thread_pool() : my_workers   (),
+                    my_job       (),
+                    my_task_count(0U),
+                    my_next_task (0U),
+                    my_busy_count(0U),
+                    my_generation(0U),
+                    my_stop      (false)
+    {
+      #if defined(WIDE_DECIMAL_THREAD_COUNT)
+      const std::uint32_t thread_count = static_cast<std::uint32_t>(WIDE_DECIMAL_THREAD_COUNT);
+      #else
+      const std::uint32_t thread_count = static_cast<std::uint32_t>(std::thread::hardware_concurrency());
+      #endif
+
+      for(std::uint32_t t = 1U; t < thread_count; ++t)
+      {
+        my_workers.emplace_back([this]() { work(); });
+      }
+    }
+
+    void take_tasks()
+    {
+      for(std::uint32_t i = my_next_task++; i < my_task_count; i = my_next_task++)
+      {
+        my_job(i);
+      }
+    }
+
+    void work()
+    {
+      std::uint32_t generation_seen = 0U;
+
+      for(;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(my_mutex);
+
+          my_cv_start.wait(lock, [this, generation_seen]() { return (my_stop || (my_generation != generation_seen)); });
+
+          if(my_stop) { return; }
+
+          generation_seen = my_generation;
+        }
+
+        take_tasks();
+
+        {
+          std::lock_guard<std::mutex> lock(my_mutex);
+
+          --my_busy_count;
+        }
+
+        my_cv_done.notify_one();
+      }
+    }
+  };
+
+  inline std::uint32_t thread_count() { return thread_pool::instance().size(); }
+
+  template<typename FunctionType>
+  void parallel_for(const std::uint32_t points, const std::uint32_t task_count, FunctionType f)
+  {
+    // Distribute the tasks over the threads only if the work
+    // comprises at least parallel_min_points points.
+    if((points < parallel_min_points) || (task_count < 2U))
+    {
+      for(std::uint32_t i = 0U; i < task_count; ++i) { f(i); }
+    }
+    else
+    {
+      thread_pool::instance().run(task_count, f);
+    }
+  }
+
+  #else
+
+  constexpr std::uint32_t thread_count() { return 1U; }
+
+  template<typename FunctionType>
+  void parallel_for(const std::uint32_t, const std::uint32_t task_count, FunctionType f)
+  {
+    for(std::uint32_t i = 0U; i < task_count; ++i) { f(i); }
+  }
+
+  #endif // WIDE_DECIMAL_ENABLE_THREADS
+
+  // Execute f(b, j_first, j_count) for the blocks b = 0, 1, ...,
+  // block_count - 1 of a transform pass on points elements, where each
+  // block has block_length (independent) butterflies. The blocks are cut
+  // into chunks (each having an equal share of the butterflies)
+  // when there are too few blocks to keep all of the threads busy.
+  template<typename FunctionType>
+  void parallel_for_blocks(const std::uint32_t points,
+                           const std::uint32_t block_count,
+                           const std::uint32_t block_length,
+                           FunctionType f)
+  {
+    const std::uint32_t task_target = ((thread_count() > 1U) ? (thread_count() * 4U) : 1U);
+
+    std::uint32_t chunks = 1U;
+
+    if(points >= parallel_min_points)
+    {
+      while(   ((block_count * chunks) < task_target)
+            && ((block_length / (chunks * 2U)) >= parallel_min_chunk))
+      {
+        chunks *= 2U;
+      }
+    }
+
+    const std::uint32_t chunk_length = ((block_length + (chunks - 1U)) / chunks);
+
+    parallel_for(points, block_count * chunks,
+      [&f, chunks, chunk_length, block_length](const std::uint32_t i)
+      {
+        const std::uint32_t j_first = (i % chunks) * chunk_length;
+
+        if(j_first < block_length)
+        {
+          f(i / chunks, j_first, (std::min)(chunk_length, std::uint32_t(block_length - j_first)));
+        }
+      });
+  }
+
+  } } } } // namespace math::wide_decimal::detail::parallel
+
+#endif // DECWIDE_T_DETAIL_PARALLEL_2026_10_18_H_
@@ -0,0 +1,459 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef DECWIDE_T_PI_CHECKPOINT_2026_10_18_H_
+  #define DECWIDE_T_PI_CHECKPOINT_2026_10_18_H_
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstdio>
+  #include <fstream>
+  #include <istream>
+  #include <limits>
+  #include <ostream>
+  #include <string>
+  #include <vector>
+
+  #include <math/wide_decimal/decwide_t.h>
+
+  // Long calculations of pi (with the AGM of calc_pi) at millions
+  // of decimal digits. The state of the AGM is saved in a compact
+  // binary checkpoint file after each iteration, and an interrupted
+  // calculation resumes from the checkpoint. The decimal digits of
+  // the result are written to a stream in chunks, directly from the
+  // limbs, without building one (huge) string of the whole number.
+
+  // The checkpoint consists of a header (a magic number, the format
+  // version, the size of the limbs, digits10 and the count of limbs
+  // of the type), the iteration index k and the four values a, b,
+  // t and s. Each value is stored with its sign, its exponent and
+  // its limbs. All integers are stored little-endian, independent
+  // of the platform.
+
+  namespace math { namespace wide_decimal {
+
+  namespace detail {
+
+  constexpr std::uint32_t checkpoint_magic   = UINT32_C(0x49505744); // "DWPI"
+  constexpr std::uint8_t  checkpoint_version = UINT8_C(1);
+
+  template<typename UnsignedIntegralType>
+  void checkpoint_write_unsigned(std::ostream& os, const UnsignedIntegralType u)
+  {
+    char buffer[sizeof(UnsignedIntegralType)];
+
+    for(std::size_t i = 0U; i < sizeof(UnsignedIntegralType); ++i)
+    {
+      buffer[i] = static_cast<char>(static_cast<std::uint8_t>(u >> (8U * i)));
+    }
+
+    os.write(buffer, static_cast<std::streamsize>(sizeof(UnsignedIntegralType)));
+  }
+
+  template<typename UnsignedIntegralType>
+  bool checkpoint_read_unsigned(std::istream& is, UnsignedIntegralType& u)
+  {
+    char buffer[sizeof(UnsignedIntegralType)];
+
+    const bool read_is_ok =
+      static_cast<bool>(is.read(buffer, static_cast<std::streamsize>(sizeof(UnsignedIntegralType))));
+
+    u = static_cast<UnsignedIntegralType>(0U);
+
+    for(std::size_t i = 0U; read_is_ok && (i < sizeof(UnsignedIntegralType)); ++i)
+    {
+      u = static_cast<UnsignedIntegralType>(u | static_cast<UnsignedIntegralType>(static_cast<UnsignedIntegralType>(static_cast<std::uint8_t>(buffer[i])) << (8U * i)));
+    }
+
+    return read_is_ok;
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  void checkpoint_write_value(std::ostream& os, const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    checkpoint_write_unsigned(os, static_cast<std::uint8_t>(x.isneg() ? 1U : 0U));
+    checkpoint_write_unsigned(os, static_cast<std::uint64_t>(static_cast<std::int64_t>(x.exponent())));
+
+    for(const LimbType& limb : x.crepresentation())
+    {
+      checkpoint_write_unsigned(os, limb);
+    }
+  }
+
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  bool checkpoint_read_value(std::istream& is, decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using exponent_type       = typename floating_point_type::exponent_type;
+
+    std::uint8_t  is_neg;
+    std::uint64_t e;
+
+    bool read_is_ok = (   checkpoint_read_unsigned(is, is_neg)
+                       && checkpoint_read_unsigned(is, e)
+                       && (is_neg <= 1U));
+
+    std::vector<LimbType> limbs(static_cast<std::size_t>(floating_point_type::decwide_t_elem_number));
+
+    for(std::size_t i = 0U; read_is_ok && (i < limbs.size()); ++i)
+    {
+      read_is_ok = (   checkpoint_read_unsigned(is, limbs[i])
+                    && (limbs[i] < static_cast<LimbType>(floating_point_type::decwide_t_elem_mask)));
+    }
+
+    if(read_is_ok)
+    {
+      x = floating_point_type(limbs.data(),
+                              static_cast<std::uint_fast32_t>(limbs.size()),
+                              static_cast<exponent_type>(static_cast<std::int64_t>(e)),
+                              (is_neg != 0U));
+    }
+
+    return read_is_ok;
+  }
+
+  // A buffer of characters, which is written to the stream when full.
+  class checkpoint_digit_sink
+  {
+  public:
+    checkpoint_digit_sink(std::ostream& os, const std::uint32_t chunk_size)
+      : my_os    (os),
+        my_buffer((std::max)(chunk_size, UINT32_C(1))),
+        my_count (0U) { }
+
+    checkpoint_digit_sink(const checkpoint_digit_sink&) = delete;
+
+    checkpoint_digit_sink& operator=(const checkpoint_digit_sink&) = delete;
+
+    ~checkpoint_digit_sink() { flush(); }
+
+    void put(const char c)
+    {
+      my_buffer[my_count] = c;
+
+      ++my_count;
+
+      if(my_count == my_buffer.size())
+      {
+        flush();
+      }
+    }
+
+    void flush()
+    {
+      if(my_count != 0U)
+      {
+        my_os.write(my_buffer.data(), static_cast<std::streamsize>(my_count));
+
+        my_count = 0U;
+      }
+    }
+
+  private:
+    std::ostream&     my_os;
+    std::vector<char> my_buffer;
+    std::size_t       my_count;
+  };
+
+  } // namespace detail
+
+  // Write the state of the AGM of calc_pi to a (binary) stream.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  bool write_checkpoint(std::ostream& os, const calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& state)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    detail::checkpoint_write_unsigned(os, detail::checkpoint_magic);
+    detail::checkpoint_write_unsigned(os, detail::checkpoint_version);
+    detail::checkpoint_write_unsigned(os, static_cast<std::uint8_t> (sizeof(LimbType)));
+    detail::checkpoint_write_unsigned(os, static_cast<std::uint32_t>(std::numeric_limits<floating_point_type>::digits10));
+    detail::checkpoint_write_unsigned(os, static_cast<std::uint32_t>(floating_point_type::decwide_t_elem_number));
+    detail::checkpoint_write_unsigned(os, state.k);
+    detail::checkpoint_write_unsigned(os, static_cast<std::uint8_t> (state.is_converged ? 1U : 0U));
+
+    detail::checkpoint_write_value(os, state.a);
+    detail::checkpoint_write_value(os, state.bB);
+    detail::checkpoint_write_value(os, state.t);
+    detail::checkpoint_write_value(os, state.s);
+
+    return static_cast<bool>(os.flush());
+  }
+
+  // Read the state of the AGM of calc_pi from a (binary) stream.
+  // The state is left unchanged if the checkpoint is damaged,
+  // or if it has been written for another type.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  bool read_checkpoint(std::istream& is, calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& state)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    std::uint32_t magic;
+    std::uint8_t  version;
+    std::uint8_t  limb_size;
+    std::uint32_t digits10;
+    std::uint32_t elem_number;
+
+    calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> tmp;
+
+    std::uint8_t is_converged;
+
+    const bool read_is_ok =
+         detail::checkpoint_read_unsigned(is, magic)
+      && detail::checkpoint_read_unsigned(is, version)
+      && detail::checkpoint_read_unsigned(is, limb_size)
+      && detail::checkpoint_read_unsigned(is, digits10)
+      && detail::checkpoint_read_unsigned(is, elem_number)
+      && (magic       == detail::checkpoint_magic)
+      && (version     == detail::checkpoint_version)
+      && (limb_size   == static_cast<std::uint8_t> (sizeof(LimbType)))
+      && (digits10    == static_cast<std::uint32_t>(std::numeric_limits<floating_point_type>::digits10))
+      && (elem_number == static_cast<std::uint32_t>(floating_point_type::decwide_t_elem_number))
+      && detail::checkpoint_read_unsigned(is, tmp.k)
+      && detail::checkpoint_read_unsigned(is, is_converged)
+      && detail::checkpoint_read_value(is, tmp.a)
+      && detail::checkpoint_read_value(is, tmp.bB)
+      && detail::checkpoint_read_value(is, tmp.t)
+      && detail::checkpoint_read_value(is, tmp.s);
+
+    if(read_is_ok)
+    {
+      tmp.is_converged = (is_converged != 0U);
+
+      state = tmp;
+    }
+
+    return read_is_ok;
+  }
+
+  // Write x in fixed notation with fraction_digits digits after the
+  // decimal point to a stream. The digits are truncated (not rounded),
+  // and they are written in chunks of chunk_size characters. Digits
+  // beyond the limbs of x are written as zeros.
+  template<const std::int32_t MyDigits10, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType>
+  bool write_digits(std::ostream& os,
+                    const decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>& x,
+                    const std::uint32_t fraction_digits,
+                    const std::uint32_t chunk_size = UINT32_C(65536))
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    constexpr std::int32_t elem_digits10 = floating_point_type::decwide_t_elem_digits10;
+    constexpr std::int32_t elem_number   = floating_point_type::decwide_t_elem_number;
+
+    const auto& limbs = x.crepresentation();
+
+    // The limb i holds the digits of the powers of ten
+    // from (exponent - (i * elem_digits10)) upwards.
+    const std::int64_t e = (x.iszero() ? INT64_C(0) : static_cast<std::int64_t>(x.exponent()));
+
+    {
+      detail::checkpoint_digit_sink sink(os, chunk_size);
+
+      auto put_limb = [&sink](const LimbType limb, const std::int32_t first, const std::int32_t last)
+      {
+        // Put the digits [first, last) of the limb (counting
+        // from the most significant one) zero-padded.
+        char digits[16U];
+
+        LimbType n = limb;
+
+        for(std::int32_t j = static_cast<std::int32_t>(elem_digits10 - 1); j >= 0; --j)
+        {
+          digits[j] = static_cast<char>(static_cast<char>(n % 10U) + '0');
+
+          n = static_cast<LimbType>(n / 10U);
+        }
+
+        for(std::int32_t j = first; j < last; ++j)
+        {
+          sink.put(digits[j]);
+        }
+      };
+
+      auto limb_at = [&limbs](const std::int64_t i) -> LimbType
+      {
+        return (((i >= 0) && (i < static_cast<std::int64_t>(elem_number)))
+                 ? limbs[static_cast<std::size_t>(i)]
+                 : static_cast<LimbType>(0U));
+      };
+
+      if(x.isneg() && (x.iszero() == false))
+      {
+        sink.put('-');
+      }
+
+      // The integer part.
+      std::int64_t i = 0;
+
+      if(e < 0)
+      {
+        sink.put('0');
+      }
+      else
+      {
+        const std::int64_t integer_limbs = static_cast<std::int64_t>((e / elem_digits10) + 1);
+
+        for( ; i < integer_limbs; ++i)
+        {
+          const LimbType limb = limb_at(i);
+
+          std::int32_t first = 0;
+
+          if(i == 0)
+          {
+            // The leading digits of the first limb are not padded.
+            while((first < static_cast<std::int32_t>(elem_digits10 - 1)) && (limb < static_cast<LimbType>(detail::decwide_t_helper<MyDigits10, LimbType>::pow10_maker(static_cast<std::uint32_t>((elem_digits10 - 1) - first)))))
+            {
+              ++first;
+            }
+          }
+
+          put_limb(limb, first, elem_digits10);
+        }
+      }
+
+      if(fraction_digits != 0U)
+      {
+        sink.put('.');
+      }
+
+      // The fraction digits, which begin with the zeros
+      // before the first limb for negative exponents.
+      std::uint64_t fraction_count = 0U;
+
+      if(e < 0)
+      {
+        const std::uint64_t zero_count = static_cast<std::uint64_t>((-e) - elem_digits10);
+
+        for( ; (fraction_count < zero_count) && (fraction_count < fraction_digits); ++fraction_count)
+        {
+          sink.put('0');
+        }
+      }
+
+      for( ; fraction_count < fraction_digits; ++i)
+      {
+        const std::uint64_t remaining = static_cast<std::uint64_t>(fraction_digits - fraction_count);
+
+        const std::int32_t last = static_cast<std::int32_t>((std::min)(remaining, static_cast<std::uint64_t>(elem_digits10)));
+
+        put_limb(limb_at(i), 0, last);
+
+        fraction_count += static_cast<std::uint64_t>(last);
+      }
+    }
+
+    return static_cast<bool>(os.flush());
+  }
+
+  // Compute pi with the AGM of calc_pi and save the state of the AGM
+  // in the checkpoint file after each iteration. If the checkpoint
+  // file exists (and matches the type), the calculation resumes from
+  // it. The checkpoint is written to a temporary file (with the suffix
+  // .tmp) first, which is then renamed to the checkpoint file. The old
+  // checkpoint is not removed before the rename, such that a valid
+  // checkpoint remains if the calculation is interrupted at any point.
+  // The checkpoint files are removed when the calculation is finished.
+  template<const std::int32_t MyDigits10,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType = std::int64_t>
+  decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType> calc_pi_checkpointed(const std::string& checkpoint_file_name,
+                                                                                                     void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr)
+  {
+    using floating_point_type = decwide_t<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+    using state_type          = calc_pi_state<MyDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType>;
+
+    const std::string tmp_file_name = checkpoint_file_name + ".tmp";
+    const std::string old_file_name = checkpoint_file_name + ".old";
+
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) 0U);
+    }
+
+    state_type state;
+
+    {
+      // Resume from the checkpoint. The temporary file and the old
+      // checkpoint are used if the interruption occurred while
+      // replacing the checkpoint.
+      std::ifstream in(checkpoint_file_name, std::ios::in | std::ios::binary);
+
+      bool resume_is_ok = (in.is_open() && read_checkpoint(in, state));
+
+      if(resume_is_ok == false)
+      {
+        std::ifstream in_tmp(tmp_file_name, std::ios::in | std::ios::binary);
+
+        resume_is_ok = (in_tmp.is_open() && read_checkpoint(in_tmp, state));
+      }
+
+      if(resume_is_ok == false)
+      {
+        std::ifstream in_old(old_file_name, std::ios::in | std::ios::binary);
+
+        resume_is_ok = (in_old.is_open() && read_checkpoint(in_old, state));
+      }
+
+      if(resume_is_ok == false)
+      {
+        state = state_type();
+      }
+    }
+
+    while(calc_pi_iterate(state, pfn_callback_to_report_digits10) == false)
+    {
+      bool write_is_ok;
+
+      {
+        std::ofstream out(tmp_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        write_is_ok = (out.is_open() && write_checkpoint(out, state));
+      }
+
+      if(write_is_ok && (std::rename(tmp_file_name.c_str(), checkpoint_file_name.c_str()) != 0))
+      {
+        // The rename does not replace an existing file on some
+        // systems (such as Windows). Then the old checkpoint is
+        // moved aside, and it is only removed after the new one
+        // is in place. It is moved back if the rename fails again.
+        static_cast<void>(std::remove(old_file_name.c_str()));
+
+        if(std::rename(checkpoint_file_name.c_str(), old_file_name.c_str()) == 0)
+        {
+          if(std::rename(tmp_file_name.c_str(), checkpoint_file_name.c_str()) == 0)
+          {
+            static_cast<void>(std::remove(old_file_name.c_str()));
+          }
+          else
+          {
+            static_cast<void>(std::rename(old_file_name.c_str(), checkpoint_file_name.c_str()));
+          }
+        }
+      }
+    }
+
+    const floating_point_type val_pi = calc_pi_result(state);
+
+    static_cast<void>(std::remove(checkpoint_file_name.c_str()));
+    static_cast<void>(std::remove(tmp_file_name.c_str()));
+    static_cast<void>(std::remove(old_file_name.c_str()));
+
+    if(pfn_callback_to_report_digits10 != nullptr)
+    {
+      pfn_callback_to_report_digits10((std::uint32_t) std::numeric_limits<floating_point_type>::digits10);
+    }
+
+    return val_pi;
+  }
+
+  } } // namespace math::wide_decimal
+
+#endif // DECWIDE_T_PI_CHECKPOINT_2026_10_18_H_
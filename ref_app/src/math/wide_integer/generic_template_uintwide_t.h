@@ -26,6 +26,49 @@
   #include <sstream>
   #endif
 
+  // From C++17 on, construction, the arithmetic, bitwise and shift
+  // operators and the comparisons of uintwide_t are constexpr, so that
+  // tables of wide constants can be computed at compile time. C++17 is
+  // needed for the constexpr mutating member functions of std::array,
+  // which is used for the internal representation.
+  #if (   (defined(__cplusplus) && (__cplusplus >= 201703L)) \
+       || (defined(_MSVC_LANG)  && (_MSVC_LANG  >= 201703L)))
+  #define WIDE_INTEGER_CONSTEXPR constexpr
+  #define WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST 1
+  #else
+  #define WIDE_INTEGER_CONSTEXPR
+  #define WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST 0
+  #endif
+
+  // Constant evaluation must bypass non-constexpr kernels,
+  // which requires detecting it within constexpr functions.
+  #if defined(__cpp_lib_is_constant_evaluated)
+  #define WIDE_INTEGER_HAS_IS_CONSTANT_EVALUATED
+  #elif ((defined(__GNUC__) && (__GNUC__ >= 9)) || (defined(__clang__) && (__clang_major__ >= 9)))
+  #define WIDE_INTEGER_HAS_IS_CONSTANT_EVALUATED
+  #endif
+
+  // On x86-64 with GCC or clang, the add, subtract and multiply kernels
+  // for 32-bit limbs process pairs of limbs as 64-bit words. This can be
+  // switched off by defining WIDE_INTEGER_DISABLE_X86_64_LIMB_KERNELS.
+  #if (   !defined(WIDE_INTEGER_DISABLE_X86_64_LIMB_KERNELS)          \
+       &&  defined(__GNUC__)                                         \
+       &&  defined(__x86_64__)                                       \
+       &&  defined(__SIZEOF_INT128__)                                \
+       && (   (WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST == 0)    \
+           ||  defined(WIDE_INTEGER_HAS_IS_CONSTANT_EVALUATED)))
+  #define WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS
+  #include <immintrin.h>
+  #endif
+
+  // Multiplication of types having at least this many binary digits
+  // uses the number-theoretic transform. The default can be changed
+  // by defining WIDE_INTEGER_NTT_DIGITS2_THRESHOLD, for instance in
+  // order to measure the crossover point with Karatsuba multiplication.
+  #if !defined(WIDE_INTEGER_NTT_DIGITS2_THRESHOLD)
+  #define WIDE_INTEGER_NTT_DIGITS2_THRESHOLD (UINT32_C(1) << 17U)
+  #endif
+
   namespace wide_integer { namespace generic_template {
 
   // Forward declaration of the uintwide_t template class.
@@ -34,125 +77,125 @@
   class uintwide_t;
 
   // Forward declarations of non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator+(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator-(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator*(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator/(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator%(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator+(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator-(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator*(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator/(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator%(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
 
   // Forward declarations of non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator+(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator-(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator*(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator/(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == false)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == false)), uintwide_t<Digits2, LimbType>>::type
   operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == true)
-                           && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)), typename uintwide_t<Digits2, LimbType>::limb_type>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == true)
+                                                  && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)), typename uintwide_t<Digits2, LimbType>::limb_type>::type
   operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == true)
-                           && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == true)
+                                                  && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)), uintwide_t<Digits2, LimbType>>::type
   operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   // Forward declarations of non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator+(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator-(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator*(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator/(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator%(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   // Forward declarations of non-member binary logic operations of (uintwide_t op uintwide_t).
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator|(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator^(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator&(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator|(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator^(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator&(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v);
 
   // Forward declarations of non-member binary logic operations of (uintwide_t op IntegralType).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator|(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator^(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator&(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   // Forward declarations of non-member binary binary logic operations of (IntegralType op uintwide_t).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator|(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator^(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator&(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   // Forward declarations of non-member shift functions of (uintwide_t shift IntegralType).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator<<(const uintwide_t<Digits2, LimbType>& u, const IntegralType n);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
   operator>>(const uintwide_t<Digits2, LimbType>& u, const IntegralType n);
 
   // Forward declarations of non-member comparison functions of (uintwide_t cmp uintwide_t).
@@ -165,64 +208,64 @@
 
   // Forward declarations of non-member comparison functions of (uintwide_t cmp IntegralType).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator==(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator!=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator> (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator< (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator>=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator<=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v);
 
   // Forward declarations of non-member comparison functions of (IntegralType cmp uintwide_t).
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator==(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator!=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator> (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator< (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator>=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
   operator<=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v);
 
   #if defined(WIDE_INTEGER_DISABLE_IOSTREAM)
@@ -299,6 +342,11 @@
                            && (std::is_unsigned   <ST>::value == true)), ST>::type
   gcd(const ST& u, const ST& v);
 
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> modinv(const uintwide_t<Digits2, LimbType>& a,
+                                       const uintwide_t<Digits2, LimbType>& m);
+
   template<const std::uint_fast32_t Digits2,
            typename LimbType>
   class default_random_engine;
@@ -307,6 +355,14 @@
            typename LimbType>
   class uniform_int_distribution;
 
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class montgomery_context;
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class barrett_reducer;
+
   template<const std::uint_fast32_t Digits2,
            typename LimbType>
   bool operator==(const uniform_int_distribution<Digits2, LimbType>& lhs,
@@ -391,6 +447,55 @@
   template<const std::uint_fast32_t BitCount> struct int_type_helper<BitCount, typename std::enable_if<(BitCount >= 17U) && (BitCount <= 32U)>::type> { using exact_unsigned_type = std::uint32_t; using exact_signed_type = std::int32_t;   };
   template<const std::uint_fast32_t BitCount> struct int_type_helper<BitCount, typename std::enable_if<(BitCount >= 33U) && (BitCount <= 64U)>::type> { using exact_unsigned_type = std::uint64_t; using exact_signed_type = std::int64_t;   };
 
+  // Determine if the evaluation occurs in a constant expression.
+  // Without support for detecting this, false is returned.
+  inline constexpr bool is_constant_evaluated()
+  {
+    #if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+    #elif defined(WIDE_INTEGER_HAS_IS_CONSTANT_EVALUATED)
+    return __builtin_is_constant_evaluated();
+    #else
+    return false;
+    #endif
+  }
+
+  // Use local implementations of copy and fill, which can be
+  // used in constant expressions prior to C++20.
+  template<typename InputIterator,
+           typename OutputIterator>
+  WIDE_INTEGER_CONSTEXPR OutputIterator copy_unsafe(InputIterator first, InputIterator last, OutputIterator dest)
+  {
+    while(first != last)
+    {
+      *dest++ = *first++;
+    }
+
+    return dest;
+  }
+
+  template<typename BidirectionalIterator1,
+           typename BidirectionalIterator2>
+  WIDE_INTEGER_CONSTEXPR BidirectionalIterator2 copy_backward_unsafe(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 dest_last)
+  {
+    while(first != last)
+    {
+      *(--dest_last) = *(--last);
+    }
+
+    return dest_last;
+  }
+
+  template<typename ForwardIterator,
+           typename ValueType>
+  WIDE_INTEGER_CONSTEXPR void fill_unsafe(ForwardIterator first, ForwardIterator last, const ValueType& value)
+  {
+    while(first != last)
+    {
+      *first++ = value;
+    }
+  }
+
   // Use a local implementation of string copy.
   inline char* strcpy_unsafe(char* dst, const char* src)
   {
@@ -411,7 +516,7 @@
 
   template<typename ST,
            typename LT = typename detail::int_type_helper<std::uint_fast32_t(std::numeric_limits<ST>::digits * 2)>::exact_unsigned_type>
-  ST make_lo(const LT& u)
+  constexpr ST make_lo(const LT& u)
   {
     // From an unsigned integral input parameter of type LT,
     // extract the low part of it. The type of the extracted
@@ -433,7 +538,7 @@
 
   template<typename ST,
            typename LT = typename detail::int_type_helper<std::uint_fast32_t(std::numeric_limits<ST>::digits * 2)>::exact_unsigned_type>
-  ST make_hi(const LT& u)
+  constexpr ST make_hi(const LT& u)
   {
     // From an unsigned integral input parameter of type LT,
     // extract the high part of it. The type of the extracted
@@ -455,7 +560,7 @@
 
   template<typename ST,
            typename LT = typename detail::int_type_helper<std::uint_fast32_t(std::numeric_limits<ST>::digits * 2)>::exact_unsigned_type>
-  LT make_large(const ST& lo, const ST& hi)
+  constexpr LT make_large(const ST& lo, const ST& hi)
   {
     // Create a composite unsigned integral value having type LT.
     // Two constituents are used having type ST, whereby the
@@ -475,2567 +580,4413 @@
     return local_ularge_type(local_ularge_type(static_cast<local_ularge_type>(hi) << std::numeric_limits<ST>::digits) | lo);
   }
 
-  } } } // namespace wide_integer::generic_template::detail
+  // Compute 10^n at compile-time.
+  constexpr std::uintmax_t pow10_helper(const std::uint_fast32_t n)
+  {
+    return ((n == 0U) ? UINTMAX_C(1) : UINTMAX_C(10) * pow10_helper(n - 1U));
+  }
 
-  namespace wide_integer { namespace generic_template {
+  // Compute ceil(log2(n)) at compile-time.
+  constexpr std::uint_fast32_t log2_ceil_helper(const std::uint_fast32_t n)
+  {
+    return ((n <= 1U) ? 0U : 1U + log2_ceil_helper((n + 1U) / 2U));
+  }
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  class uintwide_t
+  template<typename LimbType>
+  void eval_multiply_limbs_lo(      LimbType*          r,
+                              const std::uint_fast32_t count_r,
+                              const LimbType*          a,
+                              const std::uint_fast32_t count_a,
+                              const LimbType*          b,
+                              const std::uint_fast32_t count_b)
   {
-  public:
-    // Class-local type definitions.
-    using limb_type = LimbType;
+    // Multiply a (having count_a limbs) with b (having count_b limbs)
+    // and retain the lowest count_r limbs of the product in r. Using
+    // count_r = count_a + count_b yields the full product.
 
-    using double_limb_type =
-      typename detail::int_type_helper<std::uint_fast32_t(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
+    using local_limb_type        = LimbType;
+    using local_double_limb_type = typename int_type_helper<std::uint_fast32_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
-    // Legacy ularge and ushort types. These are no longer used
-    // in the class, but provided for legacy compatibility.
-    using ushort_type = limb_type;
-    using ularge_type = double_limb_type;
+    std::fill(r, r + count_r, local_limb_type(0U));
 
-    // More compile-time checks.
-    static_assert((    (std::numeric_limits<limb_type>::is_integer == true)
-                   &&  (std::numeric_limits<double_limb_type>::is_integer == true)
-                   &&  (std::numeric_limits<limb_type>::is_signed  == false)
-                   &&  (std::numeric_limits<double_limb_type>::is_signed  == false)
-                   && ((std::numeric_limits<limb_type>::digits * 2) == std::numeric_limits<double_limb_type>::digits)),
-                   "Error: Please check the characteristics of the template parameters ST and LT");
+    for(std::uint_fast32_t i = 0U; ((i < count_a) && (i < count_r)); ++i)
+    {
+      if(a[i] != local_limb_type(0U))
+      {
+        const std::uint_fast32_t j_end = (std::min)(count_b, std::uint_fast32_t(count_r - i));
 
-    // Helper constants for the digit characteristics.
-    static constexpr std::uint_fast32_t my_digits   = Digits2;
-    static constexpr std::uint_fast32_t my_digits10 = static_cast<int>((std::uintmax_t(my_digits) * UINTMAX_C(301)) / 1000U);
+        local_double_limb_type carry = 0U;
 
-    // The number of limbs.
-    static constexpr std::uint_fast32_t number_of_limbs =
-      std::uint_fast32_t(my_digits / std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
+        for(std::uint_fast32_t j = 0U; j < j_end; ++j)
+        {
+          carry += local_double_limb_type(local_double_limb_type(a[i]) * b[j]);
+          carry += r[i + j];
 
-    static constexpr std::uint_fast32_t number_of_limbs_karatsuba_threshold = std::uint_fast32_t(128U + 1U);
+          r[i + j] = local_limb_type(carry);
+          carry    = make_hi<local_limb_type>(carry);
+        }
 
-    // Verify that the Digits2 template parameter (my_digits):
-    //   * Is equal to 2^n times 1...63.
-    //   * And that there are at least 16, 24 or 32 binary digits.
-    //   * And that the number of binary digits is an exact multiple of the number of limbs.
-    static_assert(   (detail::verify_power_of_two_times_granularity_one_sixty_fourth<my_digits>::conditional_value == true)
-                  && ((my_digits >= 16U) || (my_digits >= 24U))
-                  && (my_digits == (number_of_limbs * std::uint_fast32_t(std::numeric_limits<limb_type>::digits))),
-                  "Error: Digits2 must be 2^n times 1...63 (with n >= 3), while being 16, 24, 32 or larger, and exactly divisible by limb count");
+        if((i + j_end) < count_r)
+        {
+          r[i + j_end] = local_limb_type(carry);
+        }
+      }
+    }
+  }
 
-    // The type of the internal data representation.
-    using representation_type = std::array<limb_type, number_of_limbs>;
+  // Query if the x86-64 limb kernels are used for the limb type.
+  template<typename LimbType>
+  struct x86_64_limb_kernels_are_enabled
+  {
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    static constexpr bool value = std::is_same<LimbType, std::uint32_t>::value;
+    #else
+    static constexpr bool value = false;
+    #endif
+  };
 
-    // The iterator types of the internal data representation.
-    using iterator               = typename std::array<limb_type, number_of_limbs>::iterator;
-    using const_iterator         = typename std::array<limb_type, number_of_limbs>::const_iterator;
-    using reverse_iterator       = typename std::array<limb_type, number_of_limbs>::reverse_iterator;
-    using const_reverse_iterator = typename std::array<limb_type, number_of_limbs>::const_reverse_iterator;
+  #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
 
-    // Define a class-local type that has double the width of *this.
-    using double_width_type = uintwide_t<my_digits * 2U, limb_type>;
+  // The x86-64 limb kernels work on arrays of 32-bit limbs, but they
+  // load and store two adjacent limbs at a time as one 64-bit word
+  // (using the little-endian layout). The carry chains use the
+  // add-with-carry and subtract-with-borrow intrinsics. The products
+  // use the 64*64->128-bit multiplication, which the compiler maps
+  // to mul or mulx (when BMI2 is available).
 
-    // Default constructor.
-    uintwide_t() = default;
+  __extension__ typedef unsigned __int128 x86_64_uint128_type;
 
-    // Constructors from built-in unsigned integral types that
-    // are less wide than limb_type or exactly as wide as limb_type.
-    template<typename UnsignedIntegralType>
-    uintwide_t(const UnsignedIntegralType v,
-               typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                                        && (std::is_integral   <UnsignedIntegralType>::value == true)
-                                        && (std::is_unsigned   <UnsignedIntegralType>::value == true)
-                                        && (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<limb_type>::digits))>::type* = nullptr)
-    {
-      values[0U] = limb_type(v);
+  inline std::uint64_t x86_64_load_word(const std::uint32_t* p, const std::uint_fast32_t i, const std::uint_fast32_t count)
+  {
+    // Load the i'th 64-bit word of an array having count limbs.
+    // The upper half of a word past the last limb reads as zero.
+    std::uint64_t w;
 
-      std::fill(values.begin() + 1U, values.end(), limb_type(0U));
-    }
+    if(((2U * i) + 1U) < count) { std::memcpy(&w, p + (2U * i), sizeof(std::uint64_t)); }
+    else                        { w = p[2U * i]; }
 
-    // Constructors from built-in unsigned integral types that
-    // are wider than limb_type, and do not have exactly the
-    // same width as limb_type.
-    template<typename UnsignedIntegralType>
-    uintwide_t(const UnsignedIntegralType v,
-               typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                                        && (std::is_integral   <UnsignedIntegralType>::value == true)
-                                        && (std::is_unsigned   <UnsignedIntegralType>::value == true)
-                                        && (std::numeric_limits<UnsignedIntegralType>::digits > std::numeric_limits<limb_type>::digits))>::type* = nullptr)
-    {
-      std::uint_fast32_t right_shift_amount_v = 0U;
-      std::uint_fast8_t  index_u              = 0U;
+    return w;
+  }
 
-      for( ; (index_u < values.size()) && (right_shift_amount_v < std::uint_fast32_t(std::numeric_limits<UnsignedIntegralType>::digits)); ++index_u)
-      {
-        values[index_u] = limb_type(v >> (int) right_shift_amount_v);
+  inline void x86_64_store_word(std::uint32_t* p, const std::uint_fast32_t i, const std::uint_fast32_t count, const std::uint64_t w)
+  {
+    // Store the i'th 64-bit word of an array having count limbs.
+    // The upper half of a word past the last limb is dropped.
+    if(((2U * i) + 1U) < count) { std::memcpy(p + (2U * i), &w, sizeof(std::uint64_t)); }
+    else                        { p[2U * i] = std::uint32_t(w); }
+  }
 
-        right_shift_amount_v += std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
-      }
+  inline std::uint32_t x86_64_add_n(      std::uint32_t*     r,
+                                    const std::uint32_t*     u,
+                                    const std::uint32_t*     v,
+                                    const std::uint_fast32_t count,
+                                    const std::uint32_t      carry_in)
+  {
+    // The carry-in is expected to be 0 or 1.
+    unsigned char carry = ((carry_in != 0U) ? 1U : 0U);
 
-      std::fill(values.begin() + index_u, values.end(), limb_type(0U));
-    }
+    const std::uint_fast32_t count_words = count / 2U;
 
-    // Constructors from built-in signed integral types.
-    template<typename SignedIntegralType>
-    uintwide_t(const SignedIntegralType v,
-               typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
-                                        && (std::is_integral   <SignedIntegralType>::value == true)
-                                        && (std::is_signed     <SignedIntegralType>::value == true))>::type* = nullptr)
+    for(std::uint_fast32_t i = 0U; i < count_words; ++i)
     {
-      using local_signed_integral_type   = SignedIntegralType;
-      using local_unsigned_integral_type = typename detail::int_type_helper<std::numeric_limits<local_signed_integral_type>::digits + 1>::exact_unsigned_type;
+      unsigned long long uw;
+      unsigned long long vw;
+      unsigned long long rw;
 
-      const bool is_neg = (v < local_signed_integral_type(0));
-
-      const local_unsigned_integral_type u =
-        ((is_neg == false) ? local_unsigned_integral_type(v) : local_unsigned_integral_type(-v));
+      std::memcpy(&uw, u + (2U * i), sizeof(unsigned long long));
+      std::memcpy(&vw, v + (2U * i), sizeof(unsigned long long));
 
-      operator=(uintwide_t(u));
+      carry = _addcarry_u64(carry, uw, vw, &rw);
 
-      if(is_neg) { negate(); }
+      std::memcpy(r + (2U * i), &rw, sizeof(unsigned long long));
     }
 
-    // Constructor from the internal data representation.
-    uintwide_t(const representation_type& other_rep)
+    if((count % 2U) != 0U)
     {
-      std::copy(other_rep.cbegin(), other_rep.cend(), values.begin());
-    }
+      unsigned int rl;
 
-    // Constructor from initializer list of limbs.
-    uintwide_t(std::initializer_list<limb_type> lst)
-    {
-      const std::uint_fast32_t sz = (std::min)(std::uint_fast32_t(lst.size()),
-                                               std::uint_fast32_t(values.size()));
+      carry = _addcarry_u32(carry, u[count - 1U], v[count - 1U], &rl);
 
-      std::copy(lst.begin(), lst.begin() + sz, values.begin());
-      std::fill(values.begin() + sz, values.end(), limb_type(0U));
+      r[count - 1U] = rl;
     }
 
-    // Constructor from a C-style array.
-    template<const std::uint_fast32_t N>
-    uintwide_t(const limb_type(&init)[N])
-    {
-      static_assert(N <= number_of_limbs,
-                    "Error: The initialization list has too many elements.");
+    return std::uint32_t(carry);
+  }
 
-      std::copy(init, init + (std::min)(N, number_of_limbs), values.begin());
-    }
+  inline bool x86_64_subtract_n(      std::uint32_t*     r,
+                                const std::uint32_t*     u,
+                                const std::uint32_t*     v,
+                                const std::uint_fast32_t count,
+                                const bool               has_borrow_in)
+  {
+    unsigned char borrow = (has_borrow_in ? 1U : 0U);
 
-    // Copy constructor.
-    uintwide_t(const uintwide_t& other) : values(other.values) { }
+    const std::uint_fast32_t count_words = count / 2U;
 
-    // Constructor from the double-width type.
-    // This constructor is explicit because it
-    // is a narrowing conversion.
-    template<typename UnknownUnsignedWideIntegralType = double_width_type>
-    explicit uintwide_t(const UnknownUnsignedWideIntegralType& v,
-                        typename std::enable_if<(   (std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value == true)
-                                                 && (128U <= my_digits))>::type* = nullptr)
+    for(std::uint_fast32_t i = 0U; i < count_words; ++i)
     {
-      std::copy(v.crepresentation().cbegin(),
-                v.crepresentation().cbegin() + (v.crepresentation().size() / 2U),
-                values.begin());
-    }
+      unsigned long long uw;
+      unsigned long long vw;
+      unsigned long long rw;
 
-    // Constructor from the another type having a different width but the same limb type.
-    // This constructor is explicit because it is a non-trivial conversion.
-    template<const std::uint_fast32_t OtherDigits2>
-    explicit uintwide_t(const uintwide_t<OtherDigits2, LimbType>& v)
-    {
-      if(v.crepresentation().size() > values.size())
-      {
-        std::copy(v.crepresentation().cbegin(),
-                  v.crepresentation().cbegin() + values.size(),
-                  values.begin());
-      }
-      else if(v.crepresentation().size() <= values.size())
-      {
-        std::copy(v.crepresentation().cbegin(),
-                  v.crepresentation().cend(),
-                  values.begin());
+      std::memcpy(&uw, u + (2U * i), sizeof(unsigned long long));
+      std::memcpy(&vw, v + (2U * i), sizeof(unsigned long long));
 
-        std::fill(values.begin() + v.crepresentation().size(),
-                  values.end(),
-                  limb_type(0U));
-      }
-      else
-      {
-        values.fill(0U);
-      }
+      borrow = _subborrow_u64(borrow, uw, vw, &rw);
+
+      std::memcpy(r + (2U * i), &rw, sizeof(unsigned long long));
     }
 
-    // Constructor from a constant character string.
-    uintwide_t(const char* str_input)
+    if((count % 2U) != 0U)
     {
-      if(rd_string(str_input) == false)
-      {
-        std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
-      }
+      unsigned int rl;
+
+      borrow = _subborrow_u32(borrow, u[count - 1U], v[count - 1U], &rl);
+
+      r[count - 1U] = rl;
     }
 
-    // Move constructor.
-    uintwide_t(uintwide_t&& other) : values(static_cast<representation_type&&>(other.values)) { }
+    return (borrow != 0U);
+  }
 
-    // Default destructor.
-    ~uintwide_t() = default;
+  inline std::uint32_t x86_64_multiply_1d(      std::uint32_t*     r,
+                                          const std::uint32_t*     a,
+                                          const std::uint32_t      b,
+                                          const std::uint_fast32_t count)
+  {
+    // Multiply a (having count limbs) with the single limb b
+    // and return the carry limb.
+    std::uint64_t carry = 0U;
 
-    // Assignment operator.
-    uintwide_t& operator=(const uintwide_t& other)
+    const std::uint_fast32_t count_words = count / 2U;
+
+    for(std::uint_fast32_t i = 0U; i < count_words; ++i)
     {
-      if(this != &other)
-      {
-        std::copy(other.values.cbegin(), other.values.cend(), values.begin());
-      }
+      std::uint64_t aw;
 
-      return *this;
+      std::memcpy(&aw, a + (2U * i), sizeof(std::uint64_t));
+
+      const x86_64_uint128_type t = (x86_64_uint128_type(aw) * b) + carry;
+
+      const std::uint64_t rw = std::uint64_t(t);
+
+      std::memcpy(r + (2U * i), &rw, sizeof(std::uint64_t));
+
+      carry = std::uint64_t(t >> 64U);
     }
 
-    // Trivial move assignment operator.
-    uintwide_t& operator=(uintwide_t&& other)
+    if((count % 2U) != 0U)
     {
-      std::copy(other.values.cbegin(), other.values.cend(), values.begin());
+      const std::uint64_t t = (std::uint64_t(a[count - 1U]) * b) + carry;
 
-      return *this;
+      r[count - 1U] = std::uint32_t(t);
+
+      carry = (t >> 32U);
     }
 
-    // Implement a cast operator that casts to any
-    // built-in signed or unsigned integral type.
-    template<typename UnknownBuiltInIntegralType,
-             typename = typename std::enable_if<
-                          (   (std::is_fundamental<UnknownBuiltInIntegralType>::value == true)
-                           && (std::is_integral   <UnknownBuiltInIntegralType>::value == true))>::type>
-    explicit operator UnknownBuiltInIntegralType() const
-    {
-      using local_unknown_integral_type  = UnknownBuiltInIntegralType;
+    return std::uint32_t(carry);
+  }
 
-      using local_unsigned_integral_type =
-        typename detail::int_type_helper<
-          std::numeric_limits<local_unknown_integral_type>::is_signed
-            ? std::numeric_limits<local_unknown_integral_type>::digits + 1
-            : std::numeric_limits<local_unknown_integral_type>::digits + 0>::exact_unsigned_type;
+  inline void x86_64_multiply_limbs_lo(      std::uint32_t*     r,
+                                       const std::uint_fast32_t count_r,
+                                       const std::uint32_t*     a,
+                                       const std::uint_fast32_t count_a,
+                                       const std::uint32_t*     b,
+                                       const std::uint_fast32_t count_b)
+  {
+    // Schoolbook multiplication on 64-bit words, retaining the lowest
+    // count_r limbs of the product. Odd limb counts are handled by the
+    // partial words at the top of the arrays.
 
-      local_unsigned_integral_type cast_result;
+    const std::uint_fast32_t count_words_a = (count_a + 1U) / 2U;
+    const std::uint_fast32_t count_words_b = (count_b + 1U) / 2U;
+    const std::uint_fast32_t count_words_r = (count_r + 1U) / 2U;
 
-      const std::uint_fast8_t digits_ratio = 
-        std::uint_fast8_t(  std::numeric_limits<local_unsigned_integral_type>::digits
-                          / std::numeric_limits<limb_type>::digits);
+    const std::uint_fast32_t full_words_b = count_b / 2U;
+    const std::uint_fast32_t full_words_r = count_r / 2U;
 
-      switch(digits_ratio)
+    std::fill(r, r + count_r, std::uint32_t(0U));
+
+    for(std::uint_fast32_t i = 0U; ((i < count_words_a) && (i < count_words_r)); ++i)
+    {
+      const std::uint64_t ai = x86_64_load_word(a, i, count_a);
+
+      if(ai != 0U)
       {
-        case 0:
-        case 1:
-          // The input parameter is less wide or equally as wide as the limb width.
-          cast_result = static_cast<local_unsigned_integral_type>(values[0U]);
-          break;
+        const std::uint_fast32_t j_end = (std::min)(count_words_b, std::uint_fast32_t(count_words_r - i));
 
-        default:
-          // The input parameter is wider than the limb width.
-          cast_result = 0U;
+        // In the inner loop, the words of b and r are whole words.
+        const std::uint_fast32_t j_end_full =
+          (std::min)(j_end, (std::min)(full_words_b, std::uint_fast32_t((full_words_r > i) ? (full_words_r - i) : 0U)));
 
-          for(std::uint_fast8_t i = 0U; i < digits_ratio; ++i)
-          {
-            const local_unsigned_integral_type u =
-              ((typename representation_type::size_type(i) < values.size())
-                ? local_unsigned_integral_type(values[i]) << (std::numeric_limits<limb_type>::digits * int(i))
-                : 0U);
+        std::uint64_t carry = 0U;
 
-            cast_result |= u;
-          }
-          break;
-      }
+        std::uint_fast32_t j = 0U;
 
-      return local_unknown_integral_type(cast_result);
-    }
+        for( ; j < j_end_full; ++j)
+        {
+          std::uint64_t bj;
+          std::uint64_t rij;
 
-    // Implement the cast operator that casts to the double-width type.
-    template<typename UnknownUnsignedWideIntegralType = double_width_type,
-             typename = typename std::enable_if<(std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value == true)>::type>
-    operator double_width_type() const
-    {
-      double_width_type local_double_width_instance;
+          std::memcpy(&bj,  b + (2U * j),       sizeof(std::uint64_t));
+          std::memcpy(&rij, r + (2U * (i + j)), sizeof(std::uint64_t));
 
-      std::copy(values.cbegin(),
-                values.cend(),
-                local_double_width_instance.representation().begin());
+          const x86_64_uint128_type t = ((x86_64_uint128_type(ai) * bj) + rij) + carry;
 
-      std::fill(local_double_width_instance.representation().begin() + number_of_limbs,
-                local_double_width_instance.representation().end(),
-                limb_type(0U));
+          rij = std::uint64_t(t);
 
-      return local_double_width_instance;
-    }
+          std::memcpy(r + (2U * (i + j)), &rij, sizeof(std::uint64_t));
 
-    // Provide a user interface to the internal data representation.
-          representation_type&  representation()       { return values; }
-    const representation_type&  representation() const { return values; }
-    const representation_type& crepresentation() const { return values; }
+          carry = std::uint64_t(t >> 64U);
+        }
 
-    // Unary operators: not, plus and minus.
-          uintwide_t& operator~()       { bitwise_not(); return *this; }
-    const uintwide_t& operator+() const { return *this; }
-          uintwide_t  operator-() const { uintwide_t tmp(*this); tmp.negate(); return tmp; }
+        for( ; j < j_end; ++j)
+        {
+          const x86_64_uint128_type t =   ((x86_64_uint128_type(ai) * x86_64_load_word(b, j, count_b))
+                                        + x86_64_load_word(r, i + j, count_r))
+                                        + carry;
 
-    uintwide_t& operator+=(const uintwide_t& other)
-    {
-      if(this == &other)
-      {
-        return operator+=(uintwide_t(other));
-      }
-      else
-      {
-        // Unary addition function.
-        const limb_type carry = eval_add_n(values.data(),
-                                           values.data(),
-                                           other.values.data(),
-                                           number_of_limbs,
-                                           limb_type(0U));
+          x86_64_store_word(r, i + j, count_r, std::uint64_t(t));
 
-        static_cast<void>(carry);
+          carry = std::uint64_t(t >> 64U);
+        }
 
-        return *this;
+        if((i + j_end) < count_words_r)
+        {
+          x86_64_store_word(r, i + j_end, count_r, carry);
+        }
       }
     }
+  }
+
+  inline void x86_64_multiply_n_by_n_to_lo_part(      std::uint32_t*     r,
+                                                const std::uint32_t*     a,
+                                                const std::uint32_t*     b,
+                                                const std::uint_fast32_t count)
+  {
+    // Multiply a and b (each having count limbs) and retain
+    // the lowest count limbs of the product.
 
-    uintwide_t& operator-=(const uintwide_t& other)
+    if((count % 2U) != 0U)
     {
-      if(this == &other)
-      {
-        values.fill(0U);
+      x86_64_multiply_limbs_lo(r, count, a, count, b, count);
+    }
+    else
+    {
+      const std::uint_fast32_t count_words = count / 2U;
 
-        return *this;
-      }
-      else
+      std::fill(r, r + count, std::uint32_t(0U));
+
+      for(std::uint_fast32_t i = 0U; i < count_words; ++i)
       {
-        // Unary subtraction function.
-        const limb_type has_borrow = eval_subtract_n(values.data(),
-                                                       values.data(),
-                                                       other.values.data(),
-                                                       number_of_limbs,
-                                                       false);
+        std::uint64_t ai;
 
-        static_cast<void>(has_borrow);
+        std::memcpy(&ai, a + (2U * i), sizeof(std::uint64_t));
 
-        return *this;
+        if(ai != 0U)
+        {
+          std::uint64_t carry = 0U;
+
+          for(std::uint_fast32_t j = 0U; j < (count_words - i); ++j)
+          {
+            std::uint64_t bj;
+            std::uint64_t rij;
+
+            std::memcpy(&bj,  b + (2U * j),       sizeof(std::uint64_t));
+            std::memcpy(&rij, r + (2U * (i + j)), sizeof(std::uint64_t));
+
+            const x86_64_uint128_type t = ((x86_64_uint128_type(ai) * bj) + rij) + carry;
+
+            rij = std::uint64_t(t);
+
+            std::memcpy(r + (2U * (i + j)), &rij, sizeof(std::uint64_t));
+
+            carry = std::uint64_t(t >> 64U);
+          }
+        }
       }
     }
+  }
+
+  inline void eval_multiply_limbs_lo(      std::uint32_t*     r,
+                                     const std::uint_fast32_t count_r,
+                                     const std::uint32_t*     a,
+                                     const std::uint_fast32_t count_a,
+                                     const std::uint32_t*     b,
+                                     const std::uint_fast32_t count_b)
+  {
+    x86_64_multiply_limbs_lo(r, count_r, a, count_a, b, count_b);
+  }
+
+  #endif // WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS
+
+  // Arithmetic in the prime field used by one number-theoretic transform.
+  // The modulus is less than 2^31 and has the form k * 2^m + 1, such that
+  // transforms of length up to 2^m exist.
+  template<const std::uint32_t Modulus,
+           const std::uint32_t PrimitiveRoot>
+  struct ntt_prime_field
+  {
+    static constexpr std::uint32_t modulus = Modulus;
 
-    uintwide_t& operator*=(const uintwide_t& other)
+    static std::uint32_t add(const std::uint32_t a, const std::uint32_t b)
     {
-      if(this == &other)
-      {
-        return operator*=(uintwide_t(other));
-      }
-      else
-      {
-        eval_mul_unary(*this, other);
+      const std::uint32_t s = a + b;
 
-        return *this;
-      }
+      return ((s >= Modulus) ? std::uint32_t(s - Modulus) : s);
     }
 
-    uintwide_t& mul_by_limb(const limb_type v)
+    static std::uint32_t sub(const std::uint32_t a, const std::uint32_t b)
     {
-      if(v == 0U)
-      {
-        values.fill(0U);
-      }
-      else if(v > 1U)
-      {
-        static_cast<void>(eval_multiply_1d(values.data(),
-                                           values.data(),
-                                           v,
-                                           number_of_limbs));
-      }
-
-      return *this;
+      return ((a >= b) ? std::uint32_t(a - b) : std::uint32_t((a + Modulus) - b));
     }
 
-    uintwide_t& operator/=(const uintwide_t& other)
+    static std::uint32_t mul(const std::uint32_t a, const std::uint32_t b)
     {
-      if(this == &other)
-      {
-        values.front() = 1U;
+      // The modulus is a compile-time constant, so the compiler
+      // replaces the division with multiplication and shifts.
+      return std::uint32_t((std::uint64_t(a) * b) % Modulus);
+    }
 
-        std::fill(values.begin() + 1U, values.end(), limb_type(0U));
+    static std::uint32_t pow(std::uint32_t b, std::uint32_t e)
+    {
+      std::uint32_t result = 1U;
 
-        return *this;
-      }
-      else if(other.is_zero())
+      while(e != 0U)
       {
-        values.fill((std::numeric_limits<limb_type>::max)());
+        if((e & 1U) != 0U) { result = mul(result, b); }
 
-        return *this;
+        b   = mul(b, b);
+        e >>= 1U;
       }
-      else
-      {
-        // Unary division function.
-        eval_divide_knuth(other, nullptr);
 
-        return *this;
-      }
+      return result;
     }
 
-    uintwide_t& operator%=(const uintwide_t& other)
-    {
-      if(this == &other)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-
-        return *this;
-      }
-      else
-      {
-        // Unary modulus function.
-        uintwide_t remainder;
+    static std::uint32_t inv(const std::uint32_t a) { return pow(a, Modulus - 2U); }
 
-        eval_divide_knuth(other, &remainder);
+    static std::uint32_t shoup_factor(const std::uint32_t w)
+    {
+      return std::uint32_t((std::uint64_t(w) << 32U) / Modulus);
+    }
 
-        values = remainder.values;
+    static std::uint32_t mul_shoup(const std::uint32_t a, const std::uint32_t w, const std::uint32_t w_shoup)
+    {
+      // Multiply by the fixed factor w using the precomputed
+      // w_shoup = floor(w * 2^32 / Modulus). See also V. Shoup,
+      // "NTL: A Library for doing Number Theory" (MulModPrecon).
+      const std::uint32_t q = std::uint32_t((std::uint64_t(a) * w_shoup) >> 32U);
+      const std::uint32_t r = std::uint32_t(std::uint32_t(a * w) - std::uint32_t(q * Modulus));
 
-        return *this;
-      }
+      return ((r >= Modulus) ? std::uint32_t(r - Modulus) : r);
     }
 
-    // Operators pre-increment and pre-decrement.
-    uintwide_t& operator++() { preincrement(); return *this; }
-    uintwide_t& operator--() { predecrement(); return *this; }
+    static void make_twiddles(std::uint32_t* w, const std::uint_fast32_t n, const bool is_inverse)
+    {
+      // Store the n / 2 powers of the n'th root of unity (or its inverse)
+      // in w, followed by their Shoup factors. A stage of length len uses
+      // every (n / len)'th entry of this table.
+      const std::uint_fast32_t half = (n >> 1U);
 
-    // Operators post-increment and post-decrement.
-    uintwide_t operator++(int) { const uintwide_t w(*this); preincrement(); return w; }
-    uintwide_t operator--(int) { const uintwide_t w(*this); predecrement(); return w; }
+      std::uint32_t w_n = pow(PrimitiveRoot, std::uint32_t((Modulus - 1U) / n));
 
-    uintwide_t& operator|=(const uintwide_t& other)
-    {
-      if(this == &other)
+      if(is_inverse)
       {
-        return *this;
+        w_n = inv(w_n);
       }
-      else
-      {
-        // Bitwise OR.
-        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
-        {
-          values[i] |= other.values[i];
-        }
 
-        return *this;
-      }
-    }
+      w[0U] = 1U;
 
-    uintwide_t& operator^=(const uintwide_t& other)
-    {
-      if(this == &other)
+      for(std::uint_fast32_t j = 1U; j < half; ++j)
       {
-        values.fill(0U);
-
-        return *this;
+        w[j] = mul(w[j - 1U], w_n);
       }
-      else
-      {
-        // Bitwise XOR.
-        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
-        {
-          values[i] ^= other.values[i];
-        }
 
-        return *this;
+      for(std::uint_fast32_t j = 0U; j < half; ++j)
+      {
+        w[half + j] = shoup_factor(w[j]);
       }
     }
 
-    uintwide_t& operator&=(const uintwide_t& other)
+    static void forward_transform(std::uint32_t* x, const std::uint32_t* w, const std::uint_fast32_t n)
     {
-      if(this == &other)
-      {
-        return *this;
-      }
-      else
+      // Decimation-in-frequency transform of length n (a power of 2),
+      // taking natural order input to bit-reversed order output.
+
+      for(std::uint_fast32_t len = n, stride = 1U; len >= 2U; len >>= 1U, stride <<= 1U)
       {
-        // Bitwise AND.
-        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+        const std::uint_fast32_t half = (len >> 1U);
+
+        for(std::uint_fast32_t i = 0U; i < n; i += len)
         {
-          values[i] &= other.values[i];
-        }
+          for(std::uint_fast32_t j = 0U; j < half; ++j)
+          {
+            const std::uint32_t u = x[i + j];
+            const std::uint32_t v = x[i + j + half];
 
-        return *this;
+            x[i + j]        = add(u, v);
+            x[i + j + half] = mul_shoup(sub(u, v), w[j * stride], w[(n >> 1U) + (j * stride)]);
+          }
+        }
       }
     }
 
-    template<typename SignedIntegralType>
-    typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
-                             && (std::is_integral   <SignedIntegralType>::value == true)
-                             && (std::is_signed     <SignedIntegralType>::value == true)), uintwide_t>::type&
-    operator<<=(const SignedIntegralType n)
+    static void inverse_transform(std::uint32_t* x, const std::uint32_t* w, const std::uint_fast32_t n)
     {
-      // Left-shift operator.
-      if(n <  0)
-      {
-        operator>>=(-n);
-      }
-      else if(n == 0)
-      {
-        ;
-      }
-      else if(std::uint_fast32_t(n) >= my_digits)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-      }
-      else
+      // Decimation-in-time inverse transform of length n (a power of 2),
+      // taking bit-reversed order input to natural order output, including
+      // the scaling by 1/n. The pointwise products of two forward transforms
+      // do not depend on the order, so no bit-reversal permutation is needed.
+
+      for(std::uint_fast32_t len = 2U, stride = (n >> 1U); len <= n; len <<= 1U, stride >>= 1U)
       {
-        const std::uint_fast32_t offset            = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
-        const std::uint_fast32_t left_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+        const std::uint_fast32_t half = (len >> 1U);
 
-        shl(offset, left_shift_amount);
+        for(std::uint_fast32_t i = 0U; i < n; i += len)
+        {
+          for(std::uint_fast32_t j = 0U; j < half; ++j)
+          {
+            const std::uint32_t u = x[i + j];
+            const std::uint32_t v = mul_shoup(x[i + j + half], w[j * stride], w[(n >> 1U) + (j * stride)]);
+
+            x[i + j]        = add(u, v);
+            x[i + j + half] = sub(u, v);
+          }
+        }
       }
 
-      return *this;
-    }
+      const std::uint32_t n_inv       = inv(std::uint32_t(n));
+      const std::uint32_t n_inv_shoup = shoup_factor(n_inv);
 
-    template<typename UnsignedIntegralType>
-    typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                             && (std::is_integral   <UnsignedIntegralType>::value == true)
-                             && (std::is_signed     <UnsignedIntegralType>::value == false)), uintwide_t>::type&
-    operator<<=(const UnsignedIntegralType n)
-    {
-      // Left-shift operator.
-      if(n == 0)
-      {
-        ;
-      }
-      else if(std::uint_fast32_t(n) >= my_digits)
+      for(std::uint_fast32_t i = 0U; i < n; ++i)
       {
-        std::fill(values.begin(), values.end(), limb_type(0U));
+        x[i] = mul_shoup(x[i], n_inv, n_inv_shoup);
       }
-      else
-      {
-        const std::uint_fast32_t offset            = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
-        const std::uint_fast32_t left_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+    }
+  };
 
-        shl(offset, left_shift_amount);
-      }
+  // The three primes of the multi-modular transform multiplication.
+  // Their product exceeds 2^89, which holds the convolution sums of
+  // 32-bit digits for transform lengths up to 2^23.
+  using ntt_prime_field_1 = ntt_prime_field< 998244353U,  3U>; // 119 * 2^23 + 1
+  using ntt_prime_field_2 = ntt_prime_field< 469762049U,  3U>; //   7 * 2^26 + 1
+  using ntt_prime_field_3 = ntt_prime_field<2013265921U, 31U>; //  15 * 2^27 + 1
 
-      return *this;
-    }
+  constexpr std::uint_fast32_t ntt_max_transform_length = std::uint_fast32_t(UINT32_C(1) << 23U);
 
-    template<typename SignedIntegralType>
-    typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
-                             && (std::is_integral   <SignedIntegralType>::value == true)
-                             && (std::is_signed     <SignedIntegralType>::value == true)), uintwide_t>::type&
-    operator>>=(const SignedIntegralType n)
-    {
-      // Right-shift operator.
-      if(n <  0)
-      {
-        operator<<=(-n);
-      }
-      else if(n == 0)
-      {
-        ;
-      }
-      else if(std::uint_fast32_t(n) >= my_digits)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-      }
-      else
-      {
-        const std::uint_fast32_t offset             = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
-        const std::uint_fast32_t right_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+  // The transform length of the multiplication having the digit count n,
+  // which is the smallest power of 2 holding the 2n - 1 product digits.
+  constexpr std::uint_fast32_t ntt_transform_length(const std::uint_fast32_t n)
+  {
+    return std::uint_fast32_t(std::uint_fast32_t(1U) << log2_ceil_helper(2U * n));
+  }
 
-        shr(offset, right_shift_amount);
-      }
+  constexpr bool ntt_multiplication_is_enabled(const std::uint_fast32_t digits2, const std::uint_fast32_t digits2_threshold)
+  {
+    // The transform multiplication works on 32-bit digits and
+    // is limited by the maximum transform length of the primes.
+    return (   (digits2 >= digits2_threshold)
+            && ((digits2 % 32U) == 0U)
+            && (ntt_transform_length(digits2 / 32U) <= ntt_max_transform_length));
+  }
 
-      return *this;
-    }
+  // The memory used by the transform multiplication of a given
+  // transform length. It is intended to be used as a static object,
+  // so that no memory is allocated per multiplication. The twiddle
+  // tables are computed at the first multiplication and then kept.
+  template<const std::uint_fast32_t TransformLength>
+  struct ntt_workspace
+  {
+    // The residues x1, x2, x3 of the three primes and the scratch y.
+    std::array<std::uint32_t, TransformLength * 4U> data;
 
-    template<typename UnsignedIntegralType>
-    typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                             && (std::is_integral   <UnsignedIntegralType>::value == true)
-                             && (std::is_signed     <UnsignedIntegralType>::value == false)), uintwide_t>::type&
-    operator>>=(const UnsignedIntegralType n)
-    {
-      // Right-shift operator.
-      if(n == 0)
-      {
-        ;
-      }
-      else if(std::uint_fast32_t(n) >= my_digits)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-      }
-      else
-      {
-        const std::uint_fast32_t offset             = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
-        const std::uint_fast32_t right_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+    // The forward and inverse twiddle tables of each prime.
+    std::array<std::uint32_t, TransformLength * 6U> twiddles;
 
-        shr(offset, right_shift_amount);
-      }
+    bool twiddles_are_initialized;
+  };
 
-      return *this;
-    }
+  template<typename LimbType>
+  std::uint32_t ntt_get_digit(const LimbType* p, const std::uint_fast32_t i)
+  {
+    // Get the i'th 32-bit digit of an array of limbs.
+    constexpr std::uint_fast32_t limbs_per_digit = std::uint_fast32_t(32 / std::numeric_limits<LimbType>::digits);
 
-    // Implement comparison operators.
-    bool operator==(const uintwide_t& other) const { return (compare(other) == std::int_fast8_t( 0)); }
-    bool operator< (const uintwide_t& other) const { return (compare(other) == std::int_fast8_t(-1)); }
-    bool operator> (const uintwide_t& other) const { return (compare(other) == std::int_fast8_t( 1)); }
-    bool operator!=(const uintwide_t& other) const { return (compare(other) != std::int_fast8_t( 0)); }
-    bool operator<=(const uintwide_t& other) const { return (compare(other) <= std::int_fast8_t( 0)); }
-    bool operator>=(const uintwide_t& other) const { return (compare(other) >= std::int_fast8_t( 0)); }
+    std::uint32_t d = 0U;
 
-    // Helper functions for supporting std::numeric_limits<>.
-    static uintwide_t limits_helper_max()
+    for(std::uint_fast32_t k = 0U; k < limbs_per_digit; ++k)
     {
-      uintwide_t val;
+      d |= std::uint32_t(std::uint32_t(p[(i * limbs_per_digit) + k]) << (k * std::uint_fast32_t(std::numeric_limits<LimbType>::digits)));
+    }
 
-      std::fill(val.values.begin(),
-                val.values.end(),
-                (std::numeric_limits<limb_type>::max)());
+    return d;
+  }
 
-      return val;
-    }
+  template<typename LimbType>
+  void ntt_set_digit(LimbType* p, const std::uint_fast32_t i, const std::uint32_t d)
+  {
+    // Set the i'th 32-bit digit of an array of limbs.
+    constexpr std::uint_fast32_t limbs_per_digit = std::uint_fast32_t(32 / std::numeric_limits<LimbType>::digits);
 
-    static uintwide_t limits_helper_min()
+    for(std::uint_fast32_t k = 0U; k < limbs_per_digit; ++k)
     {
-      return uintwide_t(std::uint8_t(0U));
+      p[(i * limbs_per_digit) + k] = LimbType(d >> (k * std::uint_fast32_t(std::numeric_limits<LimbType>::digits)));
     }
+  }
 
-    // Define the maximum buffer sizes for extracting
-    // octal, decimal and hexadecimal string representations.
-    static constexpr std::uint_fast32_t wr_string_max_buffer_size_oct = (16U + (my_digits / 3U)) + std::uint_fast32_t(((my_digits % 3U) != 0U) ? 1U : 0U) + 1U;
-    static constexpr std::uint_fast32_t wr_string_max_buffer_size_hex = (32U + (my_digits / 4U)) + 1U;
-    static constexpr std::uint_fast32_t wr_string_max_buffer_size_dec = (20U + std::uint_fast32_t((std::uintmax_t(my_digits) * UINTMAX_C(301)) / UINTMAX_C(1000))) + 1U;
+  template<typename NttPrimeFieldType,
+           typename LimbType>
+  void ntt_convolution(      std::uint32_t*     x,
+                             std::uint32_t*     y,
+                       const std::uint32_t*     w_fwd,
+                       const std::uint32_t*     w_inv,
+                       const LimbType*          a,
+                       const LimbType*          b,
+                       const std::uint_fast32_t n,
+                       const std::uint_fast32_t len)
+  {
+    // Compute the cyclic convolution of the n 32-bit digits of a and b
+    // (zero-padded to the transform length len) modulo one prime. The
+    // result is stored in x. The array y is used as scratch storage.
 
-    // Write string function.
-    bool wr_string(      char*              str_result,
-                   const std::uint_fast8_t  base_rep     = 0x10U,
-                   const bool               show_base    = true,
-                   const bool               show_pos     = false,
-                   const bool               is_uppercase = true,
-                         std::uint_fast32_t field_width  = 0U,
-                   const char               fill_char    = char('0')) const
+    for(std::uint_fast32_t i = 0U; i < n; ++i)
     {
-      uintwide_t t(*this);
-
-      bool wr_string_is_ok = true;
+      x[i] = std::uint32_t(ntt_get_digit(a, i) % NttPrimeFieldType::modulus);
+      y[i] = std::uint32_t(ntt_get_digit(b, i) % NttPrimeFieldType::modulus);
+    }
 
-      if(base_rep == 8U)
-      {
-        const limb_type mask(std::uint8_t(0x7U));
+    std::fill(x + n, x + len, std::uint32_t(0U));
+    std::fill(y + n, y + len, std::uint32_t(0U));
 
-        char str_temp[wr_string_max_buffer_size_oct];
+    NttPrimeFieldType::forward_transform(x, w_fwd, len);
+    NttPrimeFieldType::forward_transform(y, w_fwd, len);
 
-        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
+    for(std::uint_fast32_t i = 0U; i < len; ++i)
+    {
+      x[i] = NttPrimeFieldType::mul(x[i], y[i]);
+    }
 
-        if(t.is_zero())
-        {
-          --pos;
+    NttPrimeFieldType::inverse_transform(x, w_inv, len);
+  }
 
-          str_temp[pos] = char('0');
-        }
-        else
-        {
-          while(t.is_zero() == false)
-          {
-            char c = char(t.values[0U] & mask);
+  template<typename LimbType,
+           const std::uint_fast32_t TransformLength>
+  void eval_multiply_ntt_lo(      LimbType*                       r,
+                            const LimbType*                       a,
+                            const LimbType*                       b,
+                            const std::uint_fast32_t              count,
+                                  ntt_workspace<TransformLength>& workspace)
+  {
+    // Multiply a and b (each having count limbs) and retain the lowest
+    // count limbs of the product in r. The product is computed with
+    // transforms modulo three primes, followed by Chinese remaindering
+    // (in the form of Garner's algorithm) and carry propagation on the
+    // 32-bit digits. The arrays r and a may be the same.
 
-            if(c <= 8) { c += char(0x30); }
+    // See also Sect. 2.3 and "Algorithm 2.4 CRT" in
+    // R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+    // Cambridge University Press (2011).
 
-            --pos;
+    constexpr std::uint32_t p1 = ntt_prime_field_1::modulus;
+    constexpr std::uint32_t p2 = ntt_prime_field_2::modulus;
+    constexpr std::uint32_t p3 = ntt_prime_field_3::modulus;
 
-            str_temp[pos] = c;
+    constexpr std::uint_fast32_t len = TransformLength;
 
-            t >>= 3;
-          }
-        }
+    const std::uint_fast32_t n = std::uint_fast32_t((count * std::uint_fast32_t(std::numeric_limits<LimbType>::digits)) / 32U);
 
-        if(show_base)
-        {
-          --pos;
+    std::uint32_t* x1 = workspace.data.data();
+    std::uint32_t* x2 = x1 + len;
+    std::uint32_t* x3 = x2 + len;
+    std::uint32_t* y  = x3 + len;
 
-          str_temp[pos] = char('0');
-        }
+    std::uint32_t* w1 = workspace.twiddles.data();
+    std::uint32_t* w2 = w1 + (2U * len);
+    std::uint32_t* w3 = w2 + (2U * len);
 
-        if(show_pos)
-        {
-          --pos;
+    if(workspace.twiddles_are_initialized == false)
+    {
+      ntt_prime_field_1::make_twiddles(w1,       len, false);
+      ntt_prime_field_1::make_twiddles(w1 + len, len, true);
+      ntt_prime_field_2::make_twiddles(w2,       len, false);
+      ntt_prime_field_2::make_twiddles(w2 + len, len, true);
+      ntt_prime_field_3::make_twiddles(w3,       len, false);
+      ntt_prime_field_3::make_twiddles(w3 + len, len, true);
+
+      workspace.twiddles_are_initialized = true;
+    }
 
-          str_temp[pos] = char('+');
-        }
+    ntt_convolution<ntt_prime_field_1>(x1, y, w1, w1 + len, a, b, n, len);
+    ntt_convolution<ntt_prime_field_2>(x2, y, w2, w2 + len, a, b, n, len);
+    ntt_convolution<ntt_prime_field_3>(x3, y, w3, w3 + len, a, b, n, len);
 
-        if(field_width != 0U)
-        {
-          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
+    // The constants for Garner's algorithm.
+    const std::uint32_t p1_inv_mod_p2    = ntt_prime_field_2::inv(p1 % p2);
+    const std::uint64_t p1_p2            = std::uint64_t(p1) * p2;
+    const std::uint32_t p1_p2_inv_mod_p3 = ntt_prime_field_3::inv(std::uint32_t(p1_p2 % p3));
 
-          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+    const std::uint64_t p1_p2_lo = std::uint64_t(std::uint32_t(p1_p2));
+    const std::uint64_t p1_p2_hi = (p1_p2 >> 32U);
 
-            str_temp[pos] = fill_char;
-          }
-        }
+    // The running carry has up to three 32-bit words.
+    std::uint64_t c0 = 0U;
+    std::uint64_t c1 = 0U;
+    std::uint64_t c2 = 0U;
 
-        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+    for(std::uint_fast32_t i = 0U; i < n; ++i)
+    {
+      // Reconstruct the exact convolution sum
+      // z = x1 + p1 * k2 + (p1 * p2) * k3.
+      const std::uint32_t k2  = ntt_prime_field_2::mul(ntt_prime_field_2::sub(x2[i], std::uint32_t(x1[i] % p2)), p1_inv_mod_p2);
+      const std::uint64_t z12 = x1[i] + (std::uint64_t(p1) * k2);
+      const std::uint32_t k3  = ntt_prime_field_3::mul(ntt_prime_field_3::sub(x3[i], std::uint32_t(z12 % p3)), p1_p2_inv_mod_p3);
 
-        detail::strcpy_unsafe(str_result, str_temp + pos);
-      }
-      else if(base_rep == 10U)
-      {
-        char str_temp[wr_string_max_buffer_size_dec];
+      const std::uint64_t m_lo = p1_p2_lo * k3;
+      const std::uint64_t m_hi = p1_p2_hi * k3;
 
-        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
+      const std::uint64_t z0 = std::uint64_t(std::uint32_t(z12)) + std::uint32_t(m_lo);
+      const std::uint64_t z1 = ((std::uint64_t(z12 >> 32U) + (m_lo >> 32U)) + std::uint32_t(m_hi)) + (z0 >> 32U);
+      const std::uint64_t z2 = (m_hi >> 32U) + (z1 >> 32U);
 
-        if(t.is_zero() == true)
-        {
-          --pos;
+      // Add z to the carry and emit the lowest 32-bit word as the digit.
+      const std::uint64_t s0 = c0 + std::uint32_t(z0);
+      const std::uint64_t s1 = (c1 + std::uint32_t(z1)) + (s0 >> 32U);
+      const std::uint64_t s2 = (c2 + z2) + (s1 >> 32U);
 
-          str_temp[pos] = char('0');
-        }
-        else
-        {
-          while(t.is_zero() == false)
-          {
-            const uintwide_t tmp(t);
+      ntt_set_digit(r, i, std::uint32_t(s0));
 
-            t.eval_divide_by_single_limb(limb_type(10U), 0U, nullptr);
+      c0 = std::uint32_t(s1);
+      c1 = std::uint32_t(s2);
+      c2 = (s2 >> 32U);
+    }
+  }
 
-            --pos;
+  } } } // namespace wide_integer::generic_template::detail
 
-            str_temp[pos] = (char) ((limb_type) (tmp - (uintwide_t(t).mul_by_limb(10U))) + 0x30U);
-          }
-        }
+  namespace wide_integer { namespace generic_template {
 
-        if(show_pos)
-        {
-          --pos;
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class uintwide_t
+  {
+  public:
+    // Class-local type definitions.
+    using limb_type = LimbType;
 
-          str_temp[pos] = char('+');
-        }
+    using double_limb_type =
+      typename detail::int_type_helper<std::uint_fast32_t(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
 
-        if(field_width != 0U)
-        {
-          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
+    // Legacy ularge and ushort types. These are no longer used
+    // in the class, but provided for legacy compatibility.
+    using ushort_type = limb_type;
+    using ularge_type = double_limb_type;
 
-          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+    // More compile-time checks.
+    static_assert((    (std::numeric_limits<limb_type>::is_integer == true)
+                   &&  (std::numeric_limits<double_limb_type>::is_integer == true)
+                   &&  (std::numeric_limits<limb_type>::is_signed  == false)
+                   &&  (std::numeric_limits<double_limb_type>::is_signed  == false)
+                   && ((std::numeric_limits<limb_type>::digits * 2) == std::numeric_limits<double_limb_type>::digits)),
+                   "Error: Please check the characteristics of the template parameters ST and LT");
 
-            str_temp[pos] = fill_char;
-          }
-        }
+    // Helper constants for the digit characteristics.
+    static constexpr std::uint_fast32_t my_digits   = Digits2;
+    static constexpr std::uint_fast32_t my_digits10 = static_cast<int>((std::uintmax_t(my_digits) * UINTMAX_C(301)) / 1000U);
 
-        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+    // The number of limbs.
+    static constexpr std::uint_fast32_t number_of_limbs =
+      std::uint_fast32_t(my_digits / std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
 
-        detail::strcpy_unsafe(str_result, str_temp + pos);
-      }
-      else if(base_rep == 16U)
-      {
-        const limb_type mask(std::uint8_t(0xFU));
+    static constexpr std::uint_fast32_t number_of_limbs_karatsuba_threshold = std::uint_fast32_t(128U + 1U);
 
-        char str_temp[wr_string_max_buffer_size_hex];
+    // Multiplication of types having at least this many binary digits
+    // uses the number-theoretic transform, but only in the range of
+    // Karatsuba multiplication. The crossover point has been found
+    // by benchmarking on the host, see the standalone timing of
+    // app_benchmark_wide_integer_arithmetic.cpp.
+    static constexpr std::uint_fast32_t my_digits_ntt_threshold = std::uint_fast32_t(WIDE_INTEGER_NTT_DIGITS2_THRESHOLD);
+
+    // Decimal string conversion above this limb count uses
+    // divide-and-conquer splitting by cached powers of ten.
+    // The splitting divides with the Knuth long division and
+    // multiplies with the schoolbook limb product, so decimal
+    // conversion remains quadratic in the limb count. Compared
+    // with converting digit by digit, it is faster by a constant
+    // factor, which is measured by the standalone timing of
+    // app_benchmark_wide_integer_arithmetic.cpp. On the host, this
+    // is about 60 for output and 40 for input at 16384 bits and up.
+    static constexpr std::uint_fast32_t number_of_limbs_radix_dc_threshold = std::uint_fast32_t(24U);
 
-        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
+    // Verify that the Digits2 template parameter (my_digits):
+    //   * Is equal to 2^n times 1...63.
+    //   * And that there are at least 16, 24 or 32 binary digits.
+    //   * And that the number of binary digits is an exact multiple of the number of limbs.
+    static_assert(   (detail::verify_power_of_two_times_granularity_one_sixty_fourth<my_digits>::conditional_value == true)
+                  && ((my_digits >= 16U) || (my_digits >= 24U))
+                  && (my_digits == (number_of_limbs * std::uint_fast32_t(std::numeric_limits<limb_type>::digits))),
+                  "Error: Digits2 must be 2^n times 1...63 (with n >= 3), while being 16, 24, 32 or larger, and exactly divisible by limb count");
 
-        if(t.is_zero() == true)
-        {
-          --pos;
+    // The type of the internal data representation.
+    using representation_type = std::array<limb_type, number_of_limbs>;
 
-          str_temp[pos] = char('0');
-        }
-        else
-        {
-          while(t.is_zero() == false)
-          {
-            char c(t.values[0U] & mask);
+    // The iterator types of the internal data representation.
+    using iterator               = typename std::array<limb_type, number_of_limbs>::iterator;
+    using const_iterator         = typename std::array<limb_type, number_of_limbs>::const_iterator;
+    using reverse_iterator       = typename std::array<limb_type, number_of_limbs>::reverse_iterator;
+    using const_reverse_iterator = typename std::array<limb_type, number_of_limbs>::const_reverse_iterator;
 
-            if      (c <= char(  9))                      { c += char(0x30); }
-            else if((c >= char(0xA)) && (c <= char(0xF))) { c += (is_uppercase ? char(55) : char(87)); }
+    // Define a class-local type that has double the width of *this.
+    using double_width_type = uintwide_t<my_digits * 2U, limb_type>;
 
-            --pos;
+    // Default constructor.
+    uintwide_t() = default;
 
-            str_temp[pos] = c;
+    // Constructors from built-in unsigned integral types that
+    // are less wide than limb_type or exactly as wide as limb_type.
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const UnsignedIntegralType v,
+                                      typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                                                               && (std::is_integral   <UnsignedIntegralType>::value == true)
+                                                               && (std::is_unsigned   <UnsignedIntegralType>::value == true)
+                                                               && (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<limb_type>::digits))>::type* = nullptr)
+      : values { }
+    {
+      values[0U] = limb_type(v);
 
-            t >>= 4;
-          }
-        }
+      detail::fill_unsafe(values.begin() + 1U, values.end(), limb_type(0U));
+    }
 
-        if(show_base)
-        {
-          --pos;
+    // Constructors from built-in unsigned integral types that
+    // are wider than limb_type, and do not have exactly the
+    // same width as limb_type.
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const UnsignedIntegralType v,
+                                      typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                                                               && (std::is_integral   <UnsignedIntegralType>::value == true)
+                                                               && (std::is_unsigned   <UnsignedIntegralType>::value == true)
+                                                               && (std::numeric_limits<UnsignedIntegralType>::digits > std::numeric_limits<limb_type>::digits))>::type* = nullptr)
+      : values { }
+    {
+      std::uint_fast32_t right_shift_amount_v = 0U;
+      std::uint_fast8_t  index_u              = 0U;
 
-          str_temp[pos] = (is_uppercase ? char('X') : char('x'));
+      for( ; (index_u < values.size()) && (right_shift_amount_v < std::uint_fast32_t(std::numeric_limits<UnsignedIntegralType>::digits)); ++index_u)
+      {
+        values[index_u] = limb_type(v >> (int) right_shift_amount_v);
 
-          --pos;
+        right_shift_amount_v += std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+      }
 
-          str_temp[pos] = char('0');
-        }
+      detail::fill_unsafe(values.begin() + index_u, values.end(), limb_type(0U));
+    }
 
-        if(show_pos)
-        {
-          --pos;
+    // Constructors from built-in signed integral types.
+    template<typename SignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const SignedIntegralType v,
+                                      typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
+                                                               && (std::is_integral   <SignedIntegralType>::value == true)
+                                                               && (std::is_signed     <SignedIntegralType>::value == true))>::type* = nullptr)
+      : values { }
+    {
+      using local_signed_integral_type   = SignedIntegralType;
+      using local_unsigned_integral_type = typename detail::int_type_helper<std::numeric_limits<local_signed_integral_type>::digits + 1>::exact_unsigned_type;
 
-          str_temp[pos] = char('+');
-        }
+      const bool is_neg = (v < local_signed_integral_type(0));
 
-        if(field_width != 0U)
-        {
-          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
+      const local_unsigned_integral_type u =
+        ((is_neg == false) ? local_unsigned_integral_type(v) : local_unsigned_integral_type(-v));
 
-          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+      operator=(uintwide_t(u));
 
-            str_temp[pos] = fill_char;
-          }
-        }
+      if(is_neg) { negate(); }
+    }
 
-        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+    // Constructor from the internal data representation.
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const representation_type& other_rep) : values(other_rep) { }
 
-        detail::strcpy_unsafe(str_result, str_temp + pos);
-      }
-      else
-      {
-        wr_string_is_ok = false;
-      }
+    // Constructor from initializer list of limbs.
+    WIDE_INTEGER_CONSTEXPR uintwide_t(std::initializer_list<limb_type> lst)
+      : values { }
+    {
+      const std::uint_fast32_t sz = (std::min)(std::uint_fast32_t(lst.size()),
+                                               std::uint_fast32_t(values.size()));
 
-      return wr_string_is_ok;
+      detail::copy_unsafe(lst.begin(), lst.begin() + sz, values.begin());
+      detail::fill_unsafe(values.begin() + sz, values.end(), limb_type(0U));
     }
 
-    std::int_fast8_t compare(const uintwide_t& other) const
+    // Constructor from a C-style array.
+    template<const std::uint_fast32_t N>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const limb_type(&init)[N])
+      : values { }
     {
-      const std::int_fast8_t cmp_result = compare_ranges(values.data(), other.values.data(), number_of_limbs);
+      static_assert(N <= number_of_limbs,
+                    "Error: The initialization list has too many elements.");
 
-      return cmp_result;
+      detail::copy_unsafe(init, init + (std::min)(N, number_of_limbs), values.begin());
     }
 
-    void negate()
-    {
-      bitwise_not();
+    // Copy constructor.
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const uintwide_t& other) : values(other.values) { }
 
-      preincrement();
+    // Constructor from the double-width type.
+    // This constructor is explicit because it
+    // is a narrowing conversion.
+    template<typename UnknownUnsignedWideIntegralType = double_width_type>
+    explicit WIDE_INTEGER_CONSTEXPR uintwide_t(const UnknownUnsignedWideIntegralType& v,
+                                               typename std::enable_if<(   (std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value == true)
+                                                                        && (128U <= my_digits))>::type* = nullptr)
+      : values { }
+    {
+      detail::copy_unsafe(v.crepresentation().cbegin(),
+                          v.crepresentation().cbegin() + (v.crepresentation().size() / 2U),
+                          values.begin());
     }
 
-    void eval_divide_by_single_limb(const limb_type          short_denominator,
-                                    const std::uint_fast32_t u_offset,
-                                          uintwide_t*        remainder)
+    // Constructor from the another type having a different width but the same limb type.
+    // This constructor is explicit because it is a non-trivial conversion.
+    template<const std::uint_fast32_t OtherDigits2>
+    explicit WIDE_INTEGER_CONSTEXPR uintwide_t(const uintwide_t<OtherDigits2, LimbType>& v)
+      : values { }
     {
-      // The denominator has one single limb.
-      // Use a one-dimensional division algorithm.
-
-      double_limb_type long_numerator = double_limb_type(0U);
-
-      limb_type hi_part = limb_type(0U);
-
-      for(std::int_fast32_t i = std::int_fast32_t((number_of_limbs - 1U) - u_offset); std::int_fast32_t(i) >= 0; --i)
-      {
-        long_numerator =
-            double_limb_type(values[std::uint_fast32_t(i)])
-          + ((long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << std::numeric_limits<limb_type>::digits);
-
-        values[std::uint_fast32_t(i)] =
-          detail::make_lo<limb_type>(double_limb_type(long_numerator / short_denominator));
-
-        hi_part = values[std::uint_fast32_t(i)];
-      }
-
-      if(remainder != nullptr)
+      if(v.crepresentation().size() > values.size())
       {
-        long_numerator = double_limb_type(values[0U]) + ((long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << std::numeric_limits<limb_type>::digits);
-
-        *remainder = limb_type(long_numerator >> std::numeric_limits<limb_type>::digits);
+        detail::copy_unsafe(v.crepresentation().cbegin(),
+                            v.crepresentation().cbegin() + values.size(),
+                            values.begin());
       }
-    }
-
-  private:
-    representation_type values;
-
-    static std::int_fast8_t compare_ranges(const limb_type*         a,
-                                           const limb_type*         b,
-                                           const std::uint_fast32_t count)
-    {
-      std::int_fast8_t cmp_result;
-
-      std::int_fast32_t element_index = std::int_fast32_t(count) - 1;
-
-      while((   (element_index >= 0)
-             && (a[(element_index)] == b[(element_index)])))
+      else if(v.crepresentation().size() <= values.size())
       {
-        --element_index;
-      }
+        detail::copy_unsafe(v.crepresentation().cbegin(),
+                            v.crepresentation().cend(),
+                            values.begin());
 
-      if(element_index == std::int_fast32_t(-1))
-      {
-        cmp_result = std::int_fast8_t(0);
+        detail::fill_unsafe(values.begin() + v.crepresentation().size(),
+                            values.end(),
+                            limb_type(0U));
       }
       else
       {
-        const bool left_is_greater_than_right =
-          (a[(element_index)] > b[(element_index)]);
-
-        cmp_result = (left_is_greater_than_right ? std::int_fast8_t(1) : std::int_fast8_t(-1));
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
       }
-
-      return cmp_result;
     }
 
-    template<const std::uint_fast32_t OtherDigits2>
-    static void eval_mul_unary(      uintwide_t<OtherDigits2, LimbType>& u,
-                               const uintwide_t<OtherDigits2, LimbType>& v,
-                               typename std::enable_if<((OtherDigits2 / std::numeric_limits<LimbType>::digits) < uintwide_t::number_of_limbs_karatsuba_threshold)>::type* = nullptr)
+    // Constructor from a constant character string.
+    uintwide_t(const char* str_input)
     {
-      // Unary multiplication function using schoolbook multiplication,
-      // but we only need to retain the low half of the n*n algorithm.
-      // In other words, this is an n*n->n bit multiplication.
+      if(rd_string(str_input) == false)
+      {
+        std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
+      }
+    }
 
-      constexpr std::uint_fast32_t local_number_of_limbs = uintwide_t<OtherDigits2, LimbType>::number_of_limbs;
+    // Move constructor.
+    WIDE_INTEGER_CONSTEXPR uintwide_t(uintwide_t&& other) : values(static_cast<representation_type&&>(other.values)) { }
 
-      std::array<limb_type, local_number_of_limbs> result;
+    // Default destructor.
+    ~uintwide_t() = default;
 
-      eval_multiply_n_by_n_to_lo_part(result.data(),
-                                      u.values.data(),
-                                      v.values.data(),
-                                      local_number_of_limbs);
+    // Assignment operator.
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator=(const uintwide_t& other)
+    {
+      if(this != &other)
+      {
+        detail::copy_unsafe(other.values.cbegin(), other.values.cend(), values.begin());
+      }
 
-      std::copy(result.cbegin(),
-                result.cbegin() + local_number_of_limbs,
-                u.values.begin());
+      return *this;
     }
 
-    template<const std::uint_fast32_t OtherDigits2>
-    static void eval_mul_unary(      uintwide_t<OtherDigits2, LimbType>& u,
-                               const uintwide_t<OtherDigits2, LimbType>& v,
-                               typename std::enable_if<((OtherDigits2 / std::numeric_limits<LimbType>::digits) >= uintwide_t::number_of_limbs_karatsuba_threshold)>::type* = nullptr)
+    // Trivial move assignment operator.
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator=(uintwide_t&& other)
     {
-      // Unary multiplication function using Karatsuba multiplication.
-
-      constexpr std::uint_fast32_t local_number_of_limbs = uintwide_t<OtherDigits2, LimbType>::number_of_limbs;
-
-      // TBD: Can use specialized allocator or memory pool for these arrays.
-      std::array<limb_type, local_number_of_limbs * 2U> result;
-      std::array<limb_type, local_number_of_limbs * 4U> t;
-
-      eval_multiply_kara_n_by_n_to_2n(result.data(),
-                                      u.values.data(),
-                                      v.values.data(),
-                                      local_number_of_limbs,
-                                      t.data());
+      detail::copy_unsafe(other.values.cbegin(), other.values.cend(), values.begin());
 
-      std::copy(result.cbegin(),
-                result.cbegin() + local_number_of_limbs,
-                u.values.begin());
+      return *this;
     }
 
-    static limb_type eval_add_n(      limb_type* r,
-                                  const limb_type* u,
-                                  const limb_type* v,
-                                  const std::uint_fast32_t  count,
-                                  const limb_type  carry_in = 0U)
+    // Implement a cast operator that casts to any
+    // built-in signed or unsigned integral type.
+    template<typename UnknownBuiltInIntegralType,
+             typename = typename std::enable_if<
+                          (   (std::is_fundamental<UnknownBuiltInIntegralType>::value == true)
+                           && (std::is_integral   <UnknownBuiltInIntegralType>::value == true))>::type>
+    explicit WIDE_INTEGER_CONSTEXPR operator UnknownBuiltInIntegralType() const
     {
-      limb_type carry_out = carry_in;
-
-      for(std::uint_fast32_t i = 0U; i < count; ++i)
-      {
-        const double_limb_type uv_as_ularge = double_limb_type(double_limb_type(u[i]) + v[i]) + carry_out;
-
-        carry_out = detail::make_hi<limb_type>(uv_as_ularge);
+      using local_unknown_integral_type  = UnknownBuiltInIntegralType;
 
-        r[i] = limb_type(uv_as_ularge);
-      }
+      using local_unsigned_integral_type =
+        typename detail::int_type_helper<
+          std::numeric_limits<local_unknown_integral_type>::is_signed
+            ? std::numeric_limits<local_unknown_integral_type>::digits + 1
+            : std::numeric_limits<local_unknown_integral_type>::digits + 0>::exact_unsigned_type;
 
-      return carry_out;
-    }
+      local_unsigned_integral_type cast_result { };
 
-    static bool eval_subtract_n(      limb_type*         r,
-                                const limb_type*         u,
-                                const limb_type*         v,
-                                const std::uint_fast32_t count,
-                                const bool               has_borrow_in = false)
-    {
-      bool has_borrow_out = has_borrow_in;
+      const std::uint_fast8_t digits_ratio = 
+        std::uint_fast8_t(  std::numeric_limits<local_unsigned_integral_type>::digits
+                          / std::numeric_limits<limb_type>::digits);
 
-      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      switch(digits_ratio)
       {
-        double_limb_type uv_as_ularge = double_limb_type(u[i]) - v[i];
+        case 0:
+        case 1:
+          // The input parameter is less wide or equally as wide as the limb width.
+          cast_result = static_cast<local_unsigned_integral_type>(values[0U]);
+          break;
 
-        if(has_borrow_out)
-        {
-          --uv_as_ularge;
-        }
+        default:
+          // The input parameter is wider than the limb width.
+          cast_result = 0U;
 
-        has_borrow_out = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
+          for(std::uint_fast8_t i = 0U; i < digits_ratio; ++i)
+          {
+            const local_unsigned_integral_type u =
+              ((typename representation_type::size_type(i) < values.size())
+                ? local_unsigned_integral_type(values[i]) << (std::numeric_limits<limb_type>::digits * int(i))
+                : 0U);
 
-        r[i] = limb_type(uv_as_ularge);
+            cast_result |= u;
+          }
+          break;
       }
 
-      return has_borrow_out;
+      return local_unknown_integral_type(cast_result);
     }
 
-    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
-             typename std::enable_if<(std::numeric_limits<limb_type>::digits * 4 == RePhraseDigits2)>::type const* = nullptr>
-    static void eval_multiply_n_by_n_to_lo_part(      limb_type*         r,
-                                                const limb_type*         a,
-                                                const limb_type*         b,
-                                                const std::uint_fast32_t count)
+    // Implement the cast operator that casts to the double-width type.
+    template<typename UnknownUnsignedWideIntegralType = double_width_type,
+             typename = typename std::enable_if<(std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value == true)>::type>
+    WIDE_INTEGER_CONSTEXPR operator double_width_type() const
     {
-      // The algorithm has been derived from the polynomial multiplication
-      // given by: (D + Cx + Bx^2 + Ax^3) * (d + cx + bx^2 + ax^3).
-      // After the multiplication terms of equal order are grouped
-      // together and retained up to order(3). The carries from the
-      // multiplications are included when adding up the terms.
-      // The results of the intermediate multiplications are stored
-      // in local variables in memory.
+      double_width_type local_double_width_instance { };
 
-      // Performance improvement:
-      //   (old) kops_per_sec: 33173.50
-      //   (new) kops_per_sec: 95069.43
+      detail::copy_unsafe(values.cbegin(),
+                          values.cend(),
+                          local_double_width_instance.representation().begin());
 
-      static_cast<void>(count);
+      detail::fill_unsafe(local_double_width_instance.representation().begin() + number_of_limbs,
+                          local_double_width_instance.representation().end(),
+                          limb_type(0U));
 
-      double_limb_type r1;
-      double_limb_type r2;
+      return local_double_width_instance;
+    }
 
-      const double_limb_type dD = a[0U] * double_limb_type(b[0U]);
-      const double_limb_type Cd = a[0U] * double_limb_type(b[1U]);
-      const double_limb_type cD = a[1U] * double_limb_type(b[0U]);
-      const double_limb_type cC = a[1U] * double_limb_type(b[1U]);
+    // Provide a user interface to the internal data representation.
+    WIDE_INTEGER_CONSTEXPR       representation_type&  representation()       { return values; }
+    WIDE_INTEGER_CONSTEXPR const representation_type&  representation() const { return values; }
+    WIDE_INTEGER_CONSTEXPR const representation_type& crepresentation() const { return values; }
 
-      // One special case is considered, the case of multiplication
-      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
-      // can be significantly simplified by using only the 'lower-halves'
-      // of the data.
-      if(    (a[2U] == 0U)
-          && (b[2U] == 0U)
-          && (a[3U] == 0U)
-          && (b[3U] == 0U))
+    // Unary operators: not, plus and minus.
+    WIDE_INTEGER_CONSTEXPR       uintwide_t& operator~()       { bitwise_not(); return *this; }
+    WIDE_INTEGER_CONSTEXPR const uintwide_t& operator+() const { return *this; }
+    WIDE_INTEGER_CONSTEXPR       uintwide_t  operator-() const { uintwide_t tmp(*this); tmp.negate(); return tmp; }
+
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator+=(const uintwide_t& other)
+    {
+      if(this == &other)
       {
-        r1    = double_limb_type(detail::make_lo<limb_type>(Cd)) + detail::make_lo<limb_type>(cD) + detail::make_hi<limb_type>(dD);
-        r2    = double_limb_type(detail::make_lo<limb_type>(cC)) + detail::make_hi<limb_type>(Cd) + detail::make_hi<limb_type>(cD) + detail::make_hi<limb_type>(r1);
-        r[3U] = detail::make_hi<limb_type>(cC) + detail::make_hi<limb_type>(r2);
+        return operator+=(uintwide_t(other));
       }
       else
       {
-        const double_limb_type Bd =           a[0U] * double_limb_type(b[2U]);
-        const        limb_type Ad = limb_type(a[0U] * b[3U]);
-        const        limb_type Bc = limb_type(a[1U] * b[2U]);
-        const double_limb_type bD =           a[2U] * double_limb_type(b[0U]);
-        const        limb_type bC = limb_type(a[2U] * b[1U]);
-        const        limb_type aD = limb_type(a[3U] * b[0U]);
+        // Unary addition function.
+        const limb_type carry = eval_add_n(values.data(),
+                                           values.data(),
+                                           other.values.data(),
+                                           number_of_limbs,
+                                           limb_type(0U));
 
-        r1    = double_limb_type(detail::make_lo<limb_type>(Cd)) + detail::make_lo<limb_type>(cD) + detail::make_hi<limb_type>(dD);
-        r2    = double_limb_type(detail::make_lo<limb_type>(cC)) + detail::make_lo<limb_type>(Bd) + detail::make_lo<limb_type>(bD) + detail::make_hi<limb_type>(Cd) + detail::make_hi<limb_type>(cD) + detail::make_hi<limb_type>(r1);
-        r[3U] =   limb_type(limb_type(Bc + bC) + limb_type(aD + Ad))
-                + detail::make_hi<limb_type>(cC)
-                + detail::make_hi<limb_type>(Bd)
-                + detail::make_hi<limb_type>(bD)
-                + detail::make_hi<limb_type>(r2);
-      }
+        static_cast<void>(carry);
 
-      r[0U] = limb_type(dD);
-      r[1U] = limb_type(r1);
-      r[2U] = limb_type(r2);
+        return *this;
+      }
     }
 
-    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
-             typename std::enable_if<(std::numeric_limits<limb_type>::digits * 4 != RePhraseDigits2)>::type const* = nullptr>
-    static void eval_multiply_n_by_n_to_lo_part(      limb_type*         r,
-                                                const limb_type*         a,
-                                                const limb_type*         b,
-                                                const std::uint_fast32_t count)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator-=(const uintwide_t& other)
     {
-      std::memset(r, 0, count * sizeof(limb_type));
+      if(this == &other)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
 
-      for(std::uint_fast32_t i = 0U; i < count; ++i)
+        return *this;
+      }
+      else
       {
-        if(a[i] != limb_type(0U))
-        {
-          double_limb_type carry = 0U;
+        // Unary subtraction function.
+        const limb_type has_borrow = eval_subtract_n(values.data(),
+                                                       values.data(),
+                                                       other.values.data(),
+                                                       number_of_limbs,
+                                                       false);
 
-          for(std::uint_fast32_t j = 0U; j < (count - i); ++j)
-          {
-            carry += double_limb_type(double_limb_type(a[i]) * b[j]);
-            carry += r[i + j];
+        static_cast<void>(has_borrow);
 
-            r[i + j] = limb_type(carry);
-            carry    = detail::make_hi<limb_type>(carry);
-          }
-        }
+        return *this;
       }
     }
 
-    static void eval_multiply_n_by_n_to_2n(      limb_type*         r,
-                                           const limb_type*         a,
-                                           const limb_type*         b,
-                                           const std::uint_fast32_t count)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator*=(const uintwide_t& other)
     {
-      std::memset(r, 0, (count * 2U) * sizeof(limb_type));
-
-      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      if(this == &other)
       {
-        if(a[i] != limb_type(0U))
-        {
-          std::uint_fast32_t j = 0U;
+        return operator*=(uintwide_t(other));
+      }
+      else
+      {
+        eval_mul_unary(*this, other);
 
-          double_limb_type carry = 0U;
+        return *this;
+      }
+    }
 
-          for( ; j < count; ++j)
-          {
-            carry += double_limb_type(double_limb_type(a[i]) * b[j]);
-            carry += r[i + j];
-
-            r[i + j] = limb_type(carry);
-            carry    = detail::make_hi<limb_type>(carry);
-          }
-
-          r[i + j] = limb_type(carry);
-        }
+    WIDE_INTEGER_CONSTEXPR uintwide_t& mul_by_limb(const limb_type v)
+    {
+      if(v == 0U)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
+      }
+      else if(v > 1U)
+      {
+        static_cast<void>(eval_multiply_1d(values.data(),
+                                           values.data(),
+                                           v,
+                                           number_of_limbs));
       }
+
+      return *this;
     }
 
-    static limb_type eval_multiply_1d(      limb_type*         r,
-                                      const limb_type*         a,
-                                      const limb_type          b,
-                                      const std::uint_fast32_t count)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator/=(const uintwide_t& other)
     {
-      double_limb_type carry = 0U;
+      if(this == &other)
+      {
+        values.front() = 1U;
 
-      if(b == 0U)
+        detail::fill_unsafe(values.begin() + 1U, values.end(), limb_type(0U));
+
+        return *this;
+      }
+      else if(other.is_zero())
       {
-        std::fill(r, r + count, limb_type(0U));
+        detail::fill_unsafe(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
+
+        return *this;
       }
       else
       {
-        for(std::uint_fast32_t i = 0U ; i < count; ++i)
-        {
-          carry += double_limb_type(double_limb_type(a[i]) * b);
+        // Unary division function.
+        eval_divide_knuth(other, nullptr);
 
-          r[i]  = limb_type(carry);
-          carry = detail::make_hi<limb_type>(carry);
-        }
+        return *this;
       }
-
-      return limb_type(carry);
     }
 
-    static void eval_multiply_kara_propagate_carry(limb_type* t, const std::uint_fast32_t n, const limb_type carry)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator%=(const uintwide_t& other)
     {
-      std::uint_fast32_t i = 0U;
-
-      limb_type carry_out = carry;
+      if(this == &other)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
 
-      while((i < n) && (carry_out != 0U))
+        return *this;
+      }
+      else
       {
-        const double_limb_type uv_as_ularge = double_limb_type(t[i]) + carry_out;
+        // Unary modulus function.
+        uintwide_t remainder { };
 
-        carry_out = detail::make_hi<limb_type>(uv_as_ularge);
+        eval_divide_knuth(other, &remainder);
 
-        t[i] = limb_type(uv_as_ularge);
+        values = remainder.values;
 
-        ++i;
+        return *this;
       }
     }
 
-    static void eval_multiply_kara_propagate_borrow(limb_type* t, const std::uint_fast32_t n, const bool has_borrow)
-    {
-      std::uint_fast32_t i = 0U;
+    // Operators pre-increment and pre-decrement.
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator++() { preincrement(); return *this; }
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator--() { predecrement(); return *this; }
 
-      bool has_borrow_out = has_borrow;
+    // Operators post-increment and post-decrement.
+    WIDE_INTEGER_CONSTEXPR uintwide_t operator++(int) { const uintwide_t w(*this); preincrement(); return w; }
+    WIDE_INTEGER_CONSTEXPR uintwide_t operator--(int) { const uintwide_t w(*this); predecrement(); return w; }
 
-      while((i < n) && (has_borrow_out == true))
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator|=(const uintwide_t& other)
+    {
+      if(this == &other)
       {
-        double_limb_type uv_as_ularge = double_limb_type(t[i]);
-
-        if(has_borrow_out)
+        return *this;
+      }
+      else
+      {
+        // Bitwise OR.
+        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
         {
-          --uv_as_ularge;
+          values[i] |= other.values[i];
         }
 
-        has_borrow_out = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
-
-        t[i] = limb_type(uv_as_ularge);
-
-        ++i;
+        return *this;
       }
     }
 
-    static void eval_multiply_kara_n_by_n_to_2n(      limb_type*         r,
-                                                const limb_type*         a,
-                                                const limb_type*         b,
-                                                const std::uint_fast32_t n,
-                                                      limb_type*         t)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator^=(const uintwide_t& other)
     {
-      if(n <= 32U)
+      if(this == &other)
       {
-        static_cast<void>(t);
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
 
-        eval_multiply_n_by_n_to_2n(r, a, b, n);
+        return *this;
       }
       else
       {
-        // Based on "Algorithm 1.3 KaratsubaMultiply", Sect. 1.3.2, page 5
-        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press (2011).
-
-        // The Karatsuba multipliation computes the product of u*v as:
-        // [b^N + b^(N/2)] a1*b1 + [b^(N/2)](a1 - a0)(b0 - b1) + [b^(N/2) + 1] a0*b0
-
-        // Here we visualize u and v in two components 0,1 corresponding
-        // to the high and low order parts, respectively.
-
-        // Step 1
-        // Calculate a1*b1 and store it in the upper part of r.
-        // Calculate a0*b0 and store it in the lower part of r.
-        // copy r to t0.
-
-        // Step 2
-        // Add a1*b1 (which is t2) to the middle two-quarters of r (which is r1)
-        // Add a0*b0 (which is t0) to the middle two-quarters of r (which is r1)
-
-        // Step 3
-        // Calculate |a1-a0| in t0 and note the sign (i.e., the borrow flag)
-
-        // Step 4
-        // Calculate |b0-b1| in t1 and note the sign (i.e., the borrow flag)
-
-        // Step 5
-        // Call kara mul to calculate |a1-a0|*|b0-b1| in (t2),
-        // while using temporary storage in t4 along the way.
-
-        // Step 6
-        // Check the borrow signs. If a1-a0 and b0-b1 have the same signs,
-        // then add |a1-a0|*|b0-b1| to r1, otherwise subtract it from r1.
-
-        const std::uint_fast32_t  nh = n / 2U;
-
-        const limb_type* a0 = a + 0U;
-        const limb_type* a1 = a + nh;
-
-        const limb_type* b0 = b + 0U;
-        const limb_type* b1 = b + nh;
-
-              limb_type* r0 = r + 0U;
-              limb_type* r1 = r + nh;
-              limb_type* r2 = r + n;
-              limb_type* r3 = r + (n + nh);
-              limb_type* r4 = r + (n + n);
-
-              limb_type* t0 = t + 0U;
-              limb_type* t1 = t + nh;
-              limb_type* t2 = t + n;
-              limb_type* t4 = t + (n + n);
-
-        // Step 1
-        //   a1*b1 -> r2
-        //   a0*b0 -> r0
-        //   r -> t0
-        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0);
-        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0);
-        std::copy(r0, r4, t0);
-
-        // Step 2
-        //   r1 += a1*b1
-        //   r1 += a0*b0
-        limb_type carry;
-        carry = eval_add_n(r1, r1, t2, n);
-        eval_multiply_kara_propagate_carry(r3, nh, carry);
-        carry = eval_add_n(r1, r1, t0, n);
-        eval_multiply_kara_propagate_carry(r3, nh, carry);
-
-        // Step 3
-        //   |a1-a0| -> t0
-        const std::int_fast8_t cmp_result_a1a0 = compare_ranges(a1, a0, nh);
-
-        if(cmp_result_a1a0 == 1)
-        {
-          static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
-        }
-        else if(cmp_result_a1a0 == -1)
-        {
-          static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
-        }
-
-        // Step 4
-        //   |b0-b1| -> t1
-        const std::int_fast8_t cmp_result_b0b1 = compare_ranges(b0, b1, nh);
-
-        if(cmp_result_b0b1 == 1)
-        {
-          static_cast<void>(eval_subtract_n(t1, b0, b1, nh));
-        }
-        else if(cmp_result_b0b1 == -1)
-        {
-          static_cast<void>(eval_subtract_n(t1, b1, b0, nh));
-        }
-
-        // Step 5
-        //   |a1-a0|*|b0-b1| -> t2
-        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
-
-        // Step 6
-        //   either r1 += |a1-a0|*|b0-b1|
-        //   or     r1 -= |a1-a0|*|b0-b1|
-        if((cmp_result_a1a0 * cmp_result_b0b1) == 1)
+        // Bitwise XOR.
+        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
         {
-          carry = eval_add_n(r1, r1, t2, n);
-
-          eval_multiply_kara_propagate_carry(r3, nh, carry);
+          values[i] ^= other.values[i];
         }
-        else if((cmp_result_a1a0 * cmp_result_b0b1) == -1)
-        {
-          const bool has_borrow = eval_subtract_n(r1, r1, t2, n);
 
-          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
-        }
+        return *this;
       }
     }
 
-    static void eval_multiply_toomcook3(      limb_type*         r,
-                                        const limb_type*         u,
-                                        const limb_type*         v,
-                                        const std::uint_fast32_t n,
-                                              limb_type*         t)
+    WIDE_INTEGER_CONSTEXPR uintwide_t& operator&=(const uintwide_t& other)
     {
-      if(n == 3072U)
+      if(this == &other)
       {
-        // TBD: Tune the threshold for the transition
-        // from Toom-Cook3 back to base case Karatsuba.
-
-        // Base case Karatsuba multiplication.
-        eval_multiply_kara_n_by_n_to_2n(r, u, v, n, t);
+        return *this;
       }
       else
       {
-        // Based on "Algorithm 1.4 ToomCook3", Sect. 1.3.3, page 7 of
-        // R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press (2011).
+        // Bitwise AND.
+        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+        {
+          values[i] &= other.values[i];
+        }
 
-        // TBD: Toom-Cook3
+        return *this;
       }
     }
 
-    static void eval_multiply_toomcook4(      limb_type*         r,
-                                        const limb_type*         u,
-                                        const limb_type*         v,
-                                        const std::uint_fast32_t n,
-                                              limb_type*         t)
+    template<typename SignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
+                             && (std::is_integral   <SignedIntegralType>::value == true)
+                             && (std::is_signed     <SignedIntegralType>::value == true)), uintwide_t>::type&
+    operator<<=(const SignedIntegralType n)
     {
-      if(n == 2048U)
+      // Left-shift operator.
+      if(n <  0)
       {
-        // TBD: Tune the threshold for the transition
-        // from Toom-Cook4 back to base case Karatsuba.
-
-        // Base case Karatsuba multiplication.
-        eval_multiply_kara_n_by_n_to_2n(r, u, v, n, t);
+        operator>>=(-n);
+      }
+      else if(n == 0)
+      {
+        ;
+      }
+      else if(std::uint_fast32_t(n) >= my_digits)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
       }
       else
       {
-        // TBD: Toom-Cook4
+        const std::uint_fast32_t offset            = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+        const std::uint_fast32_t left_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+
+        shl(offset, left_shift_amount);
       }
-    }
 
-    void eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder)
+      return *this;
+    }
+
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                             && (std::is_integral   <UnsignedIntegralType>::value == true)
+                             && (std::is_signed     <UnsignedIntegralType>::value == false)), uintwide_t>::type&
+    operator<<=(const UnsignedIntegralType n)
     {
-      // Use Knuth's long division algorithm.
-      // The loop-ordering of indexes in Knuth's original
-      // algorithm has been reversed due to the data format
-      // used here. Several optimizations and combinations
-      // of logic have been carried out in the source code.
+      // Left-shift operator.
+      if(n == 0)
+      {
+        ;
+      }
+      else if(std::uint_fast32_t(n) >= my_digits)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
+      }
+      else
+      {
+        const std::uint_fast32_t offset            = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+        const std::uint_fast32_t left_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
 
-      // See also:
-      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
-      // Seminumerical Algorithms", Addison-Wesley (1998),
-      // Section 4.3.1 Algorithm D and Exercise 16.
+        shl(offset, left_shift_amount);
+      }
 
-      using local_uint_index_type = std::uint_fast32_t;
+      return *this;
+    }
 
-      local_uint_index_type u_offset = local_uint_index_type(0U);
-      local_uint_index_type v_offset = local_uint_index_type(0U);
+    template<typename SignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<SignedIntegralType>::value == true)
+                             && (std::is_integral   <SignedIntegralType>::value == true)
+                             && (std::is_signed     <SignedIntegralType>::value == true)), uintwide_t>::type&
+    operator>>=(const SignedIntegralType n)
+    {
+      // Right-shift operator.
+      if(n <  0)
+      {
+        operator<<=(-n);
+      }
+      else if(n == 0)
+      {
+        ;
+      }
+      else if(std::uint_fast32_t(n) >= my_digits)
+      {
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
+      }
+      else
+      {
+        const std::uint_fast32_t offset             = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+        const std::uint_fast32_t right_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
 
-      // Compute the offsets for u and v.
-      for(local_uint_index_type i = 0U; (i < number_of_limbs) && (      values[(number_of_limbs - 1U) - i] == limb_type(0U)); ++i) { ++u_offset; }
-      for(local_uint_index_type i = 0U; (i < number_of_limbs) && (other.values[(number_of_limbs - 1U) - i] == limb_type(0U)); ++i) { ++v_offset; }
+        shr(offset, right_shift_amount);
+      }
 
-      if(v_offset == local_uint_index_type(number_of_limbs))
-      {
-        // The denominator is zero. Set the maximum value and return.
-        // This also catches (0 / 0) and sets the maximum value for it.
-        operator=(limits_helper_max());
+      return *this;
+    }
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(std::uint8_t(0U));
-        }
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                             && (std::is_integral   <UnsignedIntegralType>::value == true)
+                             && (std::is_signed     <UnsignedIntegralType>::value == false)), uintwide_t>::type&
+    operator>>=(const UnsignedIntegralType n)
+    {
+      // Right-shift operator.
+      if(n == 0)
+      {
+        ;
       }
-      else if(u_offset == local_uint_index_type(number_of_limbs))
+      else if(std::uint_fast32_t(n) >= my_digits)
       {
-        // The numerator is zero. Do nothing and return.
-
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(std::uint8_t(0U));
-        }
+        detail::fill_unsafe(values.begin(), values.end(), limb_type(0U));
       }
       else
       {
-        const int result_of_compare_left_with_right = compare(other);
+        const std::uint_fast32_t offset             = std::uint_fast32_t(n) / std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+        const std::uint_fast32_t right_shift_amount = std::uint_fast32_t(n) % std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
 
-        const bool left_is_less_than_right = (result_of_compare_left_with_right == -1);
-        const bool left_is_equal_to_right  = (result_of_compare_left_with_right ==  0);
+        shr(offset, right_shift_amount);
+      }
 
-        if(left_is_less_than_right)
-        {
-          // If the denominator is larger than the numerator,
-          // then the result of the division is zero.
-          if(remainder != nullptr)
-          {
-            *remainder = *this;
-          }
+      return *this;
+    }
 
-          operator=(std::uint8_t(0U));
-        }
-        else if(left_is_equal_to_right)
-        {
-          // If the denominator is equal to the numerator,
-          // then the result of the division is one.
-          operator=(std::uint8_t(1U));
+    // Implement comparison operators.
+    WIDE_INTEGER_CONSTEXPR bool operator==(const uintwide_t& other) const { return (compare(other) == std::int_fast8_t( 0)); }
+    WIDE_INTEGER_CONSTEXPR bool operator< (const uintwide_t& other) const { return (compare(other) == std::int_fast8_t(-1)); }
+    WIDE_INTEGER_CONSTEXPR bool operator> (const uintwide_t& other) const { return (compare(other) == std::int_fast8_t( 1)); }
+    WIDE_INTEGER_CONSTEXPR bool operator!=(const uintwide_t& other) const { return (compare(other) != std::int_fast8_t( 0)); }
+    WIDE_INTEGER_CONSTEXPR bool operator<=(const uintwide_t& other) const { return (compare(other) <= std::int_fast8_t( 0)); }
+    WIDE_INTEGER_CONSTEXPR bool operator>=(const uintwide_t& other) const { return (compare(other) >= std::int_fast8_t( 0)); }
 
-          if(remainder != nullptr)
-          {
-            *remainder = uintwide_t(std::uint8_t(0U));
-          }
-        }
-        else if(v_offset == local_uint_index_type(number_of_limbs - 1U))
-        {
-          // The denominator has one single limb.
-          // Use a one-dimensional division algorithm.
-          const limb_type short_denominator = other.values[0U];
+    // Helper functions for supporting std::numeric_limits<>.
+    static WIDE_INTEGER_CONSTEXPR uintwide_t limits_helper_max()
+    {
+      uintwide_t val { };
 
-          eval_divide_by_single_limb(short_denominator, u_offset, remainder);
-        }
-        else
-        {
-          // We will now use the Knuth long division algorithm.
+      detail::fill_unsafe(val.values.begin(),
+                          val.values.end(),
+                          (std::numeric_limits<limb_type>::max)());
 
-          // Compute the normalization factor d.
-          const limb_type d =
-            limb_type(double_limb_type(  double_limb_type(double_limb_type(1U) << std::numeric_limits<limb_type>::digits)
-                                       / double_limb_type(double_limb_type(other.values[(number_of_limbs - 1U) - v_offset]) + limb_type(1U))));
+      return val;
+    }
 
-          // Step D1(b), normalize u -> u * d = uu.
-          // Step D1(c): normalize v -> v * d = vv.
+    static WIDE_INTEGER_CONSTEXPR uintwide_t limits_helper_min()
+    {
+      return uintwide_t(std::uint8_t(0U));
+    }
 
-          std::array<limb_type, number_of_limbs + 1U> uu;
-          std::array<limb_type, number_of_limbs>      vv;
+    // Define the maximum buffer sizes for extracting
+    // octal, decimal and hexadecimal string representations.
+    static constexpr std::uint_fast32_t wr_string_max_buffer_size_oct = (16U + (my_digits / 3U)) + std::uint_fast32_t(((my_digits % 3U) != 0U) ? 1U : 0U) + 1U;
+    static constexpr std::uint_fast32_t wr_string_max_buffer_size_hex = (32U + (my_digits / 4U)) + 1U;
+    static constexpr std::uint_fast32_t wr_string_max_buffer_size_dec = (20U + std::uint_fast32_t((std::uintmax_t(my_digits) * UINTMAX_C(301)) / UINTMAX_C(1000))) + 1U;
 
-          if(d > limb_type(1U))
-          {
-            uu[number_of_limbs - u_offset] =
-              eval_multiply_1d(uu.data(), values.data(), d, number_of_limbs - u_offset);
+    // Write string function.
+    bool wr_string(      char*              str_result,
+                   const std::uint_fast8_t  base_rep     = 0x10U,
+                   const bool               show_base    = true,
+                   const bool               show_pos     = false,
+                   const bool               is_uppercase = true,
+                         std::uint_fast32_t field_width  = 0U,
+                   const char               fill_char    = char('0')) const
+    {
+      uintwide_t t(*this);
 
-            static_cast<void>(eval_multiply_1d(vv.data(), other.values.data(), d, number_of_limbs - v_offset));
-          }
-          else
-          {
-            std::copy(values.cbegin(), values.cend(), uu.begin());
+      bool wr_string_is_ok = true;
 
-            uu[number_of_limbs - u_offset] = limb_type(0U);
+      if(base_rep == 8U)
+      {
+        const limb_type mask(std::uint8_t(0x7U));
 
-            vv = other.values;
-          }
+        char str_temp[wr_string_max_buffer_size_oct];
 
-          // Step D2: Initialize j.
-          // Step D7: Loop on j from m to 0.
+        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
 
-          const local_uint_index_type n   = local_uint_index_type(number_of_limbs - v_offset);
-          const local_uint_index_type m   = local_uint_index_type(number_of_limbs - u_offset) - n;
-          const local_uint_index_type vj0 = (number_of_limbs - 1U) - v_offset;
+        if(t.is_zero())
+        {
+          --pos;
 
-          for(local_uint_index_type j = local_uint_index_type(0U); j <= m; ++j)
+          str_temp[pos] = char('0');
+        }
+        else
+        {
+          while(t.is_zero() == false)
           {
-            // Step D3 [Calculate q_hat].
-            //   if u[j] == v[j0]
-            //     set q_hat = b - 1
-            //   else
-            //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
-
-            const local_uint_index_type uj     = (((number_of_limbs + 1U) - 1U) - u_offset) - j;
-            const double_limb_type      u_j_j1 = (double_limb_type(uu[uj]) << std::numeric_limits<limb_type>::digits) + uu[uj - 1U];
-
-            limb_type q_hat = ((uu[uj] == vv[vj0]) ? (std::numeric_limits<limb_type>::max)()
-                                                   : limb_type(u_j_j1 / vv[vj0]));
+            char c = char(t.values[0U] & mask);
 
-            // Decrease q_hat if necessary.
-            // This means that q_hat must be decreased if the
-            // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
-            // exceeds the range of uintwide_t.
+            if(c <= 8) { c += char(0x30); }
 
-            for(double_limb_type t = u_j_j1 - double_limb_type(q_hat * double_limb_type(vv[vj0])); ; --q_hat, t += vv[vj0])
-            {
-              if(   (detail::make_hi<limb_type>(t) != limb_type(0U))
-                 || (   double_limb_type(double_limb_type(vv[vj0 - 1U]) * q_hat)
-                     <= double_limb_type(double_limb_type(t << std::numeric_limits<limb_type>::digits) + uu[uj - 2U])))
-              {
-                break;
-              }
-            }
+            --pos;
 
-            // Step D4: Multiply and subtract.
-            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+            str_temp[pos] = c;
 
-            // Set nv = q_hat * (v[1, ... n]).
-            std::array<limb_type, number_of_limbs + 1U> nv;
+            t >>= 3;
+          }
+        }
 
-            nv[n] = eval_multiply_1d(nv.data(), vv.data(), q_hat, n);
+        if(show_base)
+        {
+          --pos;
 
-            const bool has_borrow =
-              eval_subtract_n(uu.data() + (uj - n), uu.data() + (uj - n), nv.data(), n + 1U);
+          str_temp[pos] = char('0');
+        }
 
+        if(show_pos)
+        {
+          --pos;
 
-            // Get the result data.
-            values[m - j] = q_hat - (has_borrow ? 1U : 0U);
+          str_temp[pos] = char('+');
+        }
 
-            // Step D5: Test the remainder.
-            // Set the result value: Set result.m_data[m - j] = q_hat.
-            // Use the condition (u[j] < 0), in other words if the borrow
-            // is non-zero, then step D6 needs to be carried out.
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
 
-            if(has_borrow)
-            {
-              // Step D6: Add back.
-              // Add v[1, ... n] back to u[j, ... j + n],
-              // and decrease the result by 1.
+          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
+          {
+            --pos;
 
-              static_cast<void>(eval_add_n(uu.data() + (uj - n), uu.data() + (uj - n), vv.data(), n));
-            }
+            str_temp[pos] = fill_char;
           }
+        }
 
-          // Clear the data elements that have not
-          // been computed in the division algorithm.
-          std::fill(values.begin() + (m + 1U), values.end(), limb_type(0U));
+        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
 
-          if(remainder != nullptr)
+        detail::strcpy_unsafe(str_result, str_temp + pos);
+      }
+      else if(base_rep == 10U)
+      {
+        char str_temp[wr_string_max_buffer_size_dec];
+
+        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
+
+        if(t.is_zero() == true)
+        {
+          --pos;
+
+          str_temp[pos] = char('0');
+        }
+        else
+        {
+          const char* p_first = wr_string_dec(t, str_temp + pos, 0U);
+
+          pos = std::uint_fast32_t(p_first - str_temp);
+        }
+
+        if(show_pos)
+        {
+          --pos;
+
+          str_temp[pos] = char('+');
+        }
+
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
+
+          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
           {
-            if(d == 1U)
-            {
-              std::copy(uu.cbegin(),
-                        uu.cbegin() + (number_of_limbs - v_offset),
-                        remainder->values.begin());
-            }
-            else
-            {
-              limb_type previous_u = limb_type(0U);
+            --pos;
 
-              for(std::int_fast32_t rl = std::int_fast32_t(n - 1U), ul = std::int_fast32_t(number_of_limbs - (v_offset + 1U)); rl >= 0; --rl, --ul)
-              {
-                const double_limb_type t =
-                  double_limb_type(  uu[std::uint_fast32_t(ul)]
-                                   + double_limb_type(double_limb_type(previous_u) << std::numeric_limits<limb_type>::digits));
+            str_temp[pos] = fill_char;
+          }
+        }
 
-                remainder->values[std::uint_fast32_t(rl)] = limb_type(double_limb_type(t / d));
-                previous_u                                = limb_type(double_limb_type(t - double_limb_type(double_limb_type(d) * remainder->values[std::uint_fast32_t(rl)])));
-              }
-            }
+        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+
+        detail::strcpy_unsafe(str_result, str_temp + pos);
+      }
+      else if(base_rep == 16U)
+      {
+        const limb_type mask(std::uint8_t(0xFU));
+
+        char str_temp[wr_string_max_buffer_size_hex];
+
+        std::uint_fast32_t pos = (sizeof(str_temp) - 1U);
+
+        if(t.is_zero() == true)
+        {
+          --pos;
+
+          str_temp[pos] = char('0');
+        }
+        else
+        {
+          while(t.is_zero() == false)
+          {
+            char c(t.values[0U] & mask);
+
+            if      (c <= char(  9))                      { c += char(0x30); }
+            else if((c >= char(0xA)) && (c <= char(0xF))) { c += (is_uppercase ? char(55) : char(87)); }
+
+            --pos;
+
+            str_temp[pos] = c;
+
+            t >>= 4;
+          }
+        }
+
+        if(show_base)
+        {
+          --pos;
+
+          str_temp[pos] = (is_uppercase ? char('X') : char('x'));
+
+          --pos;
+
+          str_temp[pos] = char('0');
+        }
+
+        if(show_pos)
+        {
+          --pos;
+
+          str_temp[pos] = char('+');
+        }
+
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, std::uint_fast32_t(sizeof(str_temp) - 1U));
+
+          while(std::int_fast32_t(pos) > std::int_fast32_t((sizeof(str_temp) - 1U) - field_width))
+          {
+            --pos;
+
+            str_temp[pos] = fill_char;
+          }
+        }
+
+        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+
+        detail::strcpy_unsafe(str_result, str_temp + pos);
+      }
+      else
+      {
+        wr_string_is_ok = false;
+      }
+
+      return wr_string_is_ok;
+    }
+
+    WIDE_INTEGER_CONSTEXPR std::int_fast8_t compare(const uintwide_t& other) const
+    {
+      const std::int_fast8_t cmp_result = compare_ranges(values.data(), other.values.data(), number_of_limbs);
+
+      return cmp_result;
+    }
+
+    WIDE_INTEGER_CONSTEXPR void negate()
+    {
+      bitwise_not();
+
+      preincrement();
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_divide_by_single_limb(const limb_type          short_denominator,
+                                                           const std::uint_fast32_t u_offset,
+                                                                 uintwide_t*        remainder)
+    {
+      // The denominator has one single limb.
+      // Use a one-dimensional division algorithm.
+
+      double_limb_type long_numerator = double_limb_type(0U);
+
+      limb_type hi_part = limb_type(0U);
+
+      for(std::int_fast32_t i = std::int_fast32_t((number_of_limbs - 1U) - u_offset); std::int_fast32_t(i) >= 0; --i)
+      {
+        long_numerator =
+            double_limb_type(values[std::uint_fast32_t(i)])
+          + ((long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << std::numeric_limits<limb_type>::digits);
+
+        values[std::uint_fast32_t(i)] =
+          detail::make_lo<limb_type>(double_limb_type(long_numerator / short_denominator));
+
+        hi_part = values[std::uint_fast32_t(i)];
+      }
+
+      if(remainder != nullptr)
+      {
+        long_numerator = double_limb_type(values[0U]) + ((long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << std::numeric_limits<limb_type>::digits);
+
+        *remainder = limb_type(long_numerator >> std::numeric_limits<limb_type>::digits);
+      }
+    }
+
+  private:
+    representation_type values;
+
+    static WIDE_INTEGER_CONSTEXPR std::int_fast8_t compare_ranges(const limb_type*         a,
+                                                                  const limb_type*         b,
+                                                                  const std::uint_fast32_t count)
+    {
+      std::int_fast8_t cmp_result { };
+
+      std::int_fast32_t element_index = std::int_fast32_t(count) - 1;
+
+      while((   (element_index >= 0)
+             && (a[(element_index)] == b[(element_index)])))
+      {
+        --element_index;
+      }
+
+      if(element_index == std::int_fast32_t(-1))
+      {
+        cmp_result = std::int_fast8_t(0);
+      }
+      else
+      {
+        const bool left_is_greater_than_right =
+          (a[(element_index)] > b[(element_index)]);
+
+        cmp_result = (left_is_greater_than_right ? std::int_fast8_t(1) : std::int_fast8_t(-1));
+      }
+
+      return cmp_result;
+    }
+
+    template<const std::uint_fast32_t OtherDigits2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherDigits2, LimbType>& u,
+                                                      const uintwide_t<OtherDigits2, LimbType>& v,
+                                                      typename std::enable_if<((OtherDigits2 / std::numeric_limits<LimbType>::digits) < uintwide_t::number_of_limbs_karatsuba_threshold)>::type* = nullptr)
+    {
+      // Unary multiplication function using schoolbook multiplication,
+      // but we only need to retain the low half of the n*n algorithm.
+      // In other words, this is an n*n->n bit multiplication.
+
+      constexpr std::uint_fast32_t local_number_of_limbs = uintwide_t<OtherDigits2, LimbType>::number_of_limbs;
+
+      std::array<limb_type, local_number_of_limbs> result { };
+
+      eval_multiply_n_by_n_to_lo_part(result.data(),
+                                      u.values.data(),
+                                      v.values.data(),
+                                      local_number_of_limbs);
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<const std::uint_fast32_t OtherDigits2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherDigits2, LimbType>& u,
+                                                      const uintwide_t<OtherDigits2, LimbType>& v,
+                                                      typename std::enable_if<(   ((OtherDigits2 / std::numeric_limits<LimbType>::digits) >= uintwide_t::number_of_limbs_karatsuba_threshold)
+                                                                               && (detail::ntt_multiplication_is_enabled(OtherDigits2, uintwide_t::my_digits_ntt_threshold) == false))>::type* = nullptr)
+    {
+      // Unary multiplication function using Karatsuba multiplication.
+
+      constexpr std::uint_fast32_t local_number_of_limbs = uintwide_t<OtherDigits2, LimbType>::number_of_limbs;
+
+      // TBD: Can use specialized allocator or memory pool for these arrays.
+      std::array<limb_type, local_number_of_limbs * 2U> result { };
+      std::array<limb_type, local_number_of_limbs * 4U> t { };
+
+      eval_multiply_kara_n_by_n_to_2n(result.data(),
+                                      u.values.data(),
+                                      v.values.data(),
+                                      local_number_of_limbs,
+                                      t.data());
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<const std::uint_fast32_t OtherDigits2>
+    static void eval_mul_unary(      uintwide_t<OtherDigits2, LimbType>& u,
+                               const uintwide_t<OtherDigits2, LimbType>& v,
+                               typename std::enable_if<(   ((OtherDigits2 / std::numeric_limits<LimbType>::digits) >= uintwide_t::number_of_limbs_karatsuba_threshold)
+                                                        && (detail::ntt_multiplication_is_enabled(OtherDigits2, uintwide_t::my_digits_ntt_threshold) == true))>::type* = nullptr)
+    {
+      // Unary multiplication function using the number-theoretic transform.
+
+      constexpr std::uint_fast32_t local_number_of_limbs = uintwide_t<OtherDigits2, LimbType>::number_of_limbs;
+
+      constexpr std::uint_fast32_t local_transform_length = detail::ntt_transform_length(OtherDigits2 / 32U);
+
+      // The workspace is static, so no memory is allocated per
+      // multiplication. It is thread_local, since the twiddle tables
+      // are built lazily on the first multiplication in each thread.
+      static thread_local detail::ntt_workspace<local_transform_length> ntt_scratch_pool;
+
+      detail::eval_multiply_ntt_lo(u.values.data(),
+                                   u.values.data(),
+                                   v.values.data(),
+                                   local_number_of_limbs,
+                                   ntt_scratch_pool);
+    }
+
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == true)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_add_n(      limb_type* r,
+                                                         const limb_type* u,
+                                                         const limb_type* v,
+                                                         const std::uint_fast32_t  count,
+                                                         const limb_type  carry_in = 0U)
+    {
+      // The x86-64 kernels can not be used in constant expressions.
+      return (detail::is_constant_evaluated() ? eval_add_n_portable(r, u, v, count, carry_in)
+                                              : detail::x86_64_add_n(r, u, v, count, carry_in));
+    }
+    #endif
+
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == false)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_add_n(      limb_type* r,
+                                                         const limb_type* u,
+                                                         const limb_type* v,
+                                                         const std::uint_fast32_t  count,
+                                                         const limb_type  carry_in = 0U)
+    {
+      return eval_add_n_portable(r, u, v, count, carry_in);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_add_n_portable(      limb_type* r,
+                                                                  const limb_type* u,
+                                                                  const limb_type* v,
+                                                                  const std::uint_fast32_t  count,
+                                                                  const limb_type  carry_in = 0U)
+    {
+      limb_type carry_out = carry_in;
+
+      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      {
+        const double_limb_type uv_as_ularge = double_limb_type(double_limb_type(u[i]) + v[i]) + carry_out;
+
+        carry_out = detail::make_hi<limb_type>(uv_as_ularge);
+
+        r[i] = limb_type(uv_as_ularge);
+      }
+
+      return carry_out;
+    }
+
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == true)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR bool eval_subtract_n(      limb_type*         r,
+                                                       const limb_type*         u,
+                                                       const limb_type*         v,
+                                                       const std::uint_fast32_t count,
+                                                       const bool               has_borrow_in = false)
+    {
+      return (detail::is_constant_evaluated() ? eval_subtract_n_portable(r, u, v, count, has_borrow_in)
+                                              : detail::x86_64_subtract_n(r, u, v, count, has_borrow_in));
+    }
+    #endif
+
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == false)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR bool eval_subtract_n(      limb_type*         r,
+                                                       const limb_type*         u,
+                                                       const limb_type*         v,
+                                                       const std::uint_fast32_t count,
+                                                       const bool               has_borrow_in = false)
+    {
+      return eval_subtract_n_portable(r, u, v, count, has_borrow_in);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR bool eval_subtract_n_portable(      limb_type*         r,
+                                                                const limb_type*         u,
+                                                                const limb_type*         v,
+                                                                const std::uint_fast32_t count,
+                                                                const bool               has_borrow_in = false)
+    {
+      bool has_borrow_out = has_borrow_in;
+
+      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      {
+        double_limb_type uv_as_ularge = double_limb_type(u[i]) - v[i];
+
+        if(has_borrow_out)
+        {
+          --uv_as_ularge;
+        }
+
+        has_borrow_out = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
+
+        r[i] = limb_type(uv_as_ularge);
+      }
+
+      return has_borrow_out;
+    }
+
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<limb_type>::value && (RePhraseDigits2 != 0U))>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      limb_type*         r,
+                                                                       const limb_type*         a,
+                                                                       const limb_type*         b,
+                                                                       const std::uint_fast32_t count)
+    {
+      if(detail::is_constant_evaluated())
+      {
+        eval_multiply_n_by_n_to_lo_part_portable(r, a, b, count);
+      }
+      else
+      {
+        detail::x86_64_multiply_n_by_n_to_lo_part(r, a, b, count);
+      }
+    }
+    #endif
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<(   (detail::x86_64_limb_kernels_are_enabled<limb_type>::value == false)
+                                      && (std::numeric_limits<limb_type>::digits * 4 == RePhraseDigits2))>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      limb_type*         r,
+                                                                       const limb_type*         a,
+                                                                       const limb_type*         b,
+                                                                       const std::uint_fast32_t count)
+    {
+      // The algorithm has been derived from the polynomial multiplication
+      // given by: (D + Cx + Bx^2 + Ax^3) * (d + cx + bx^2 + ax^3).
+      // After the multiplication terms of equal order are grouped
+      // together and retained up to order(3). The carries from the
+      // multiplications are included when adding up the terms.
+      // The results of the intermediate multiplications are stored
+      // in local variables in memory.
+
+      // Performance improvement:
+      //   (old) kops_per_sec: 33173.50
+      //   (new) kops_per_sec: 95069.43
+
+      static_cast<void>(count);
+
+      double_limb_type r1 { };
+      double_limb_type r2 { };
+
+      const double_limb_type dD = a[0U] * double_limb_type(b[0U]);
+      const double_limb_type Cd = a[0U] * double_limb_type(b[1U]);
+      const double_limb_type cD = a[1U] * double_limb_type(b[0U]);
+      const double_limb_type cC = a[1U] * double_limb_type(b[1U]);
+
+      // One special case is considered, the case of multiplication
+      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
+      // can be significantly simplified by using only the 'lower-halves'
+      // of the data.
+      if(    (a[2U] == 0U)
+          && (b[2U] == 0U)
+          && (a[3U] == 0U)
+          && (b[3U] == 0U))
+      {
+        r1    = double_limb_type(detail::make_lo<limb_type>(Cd)) + detail::make_lo<limb_type>(cD) + detail::make_hi<limb_type>(dD);
+        r2    = double_limb_type(detail::make_lo<limb_type>(cC)) + detail::make_hi<limb_type>(Cd) + detail::make_hi<limb_type>(cD) + detail::make_hi<limb_type>(r1);
+        r[3U] = detail::make_hi<limb_type>(cC) + detail::make_hi<limb_type>(r2);
+      }
+      else
+      {
+        const double_limb_type Bd =           a[0U] * double_limb_type(b[2U]);
+        const        limb_type Ad = limb_type(a[0U] * b[3U]);
+        const        limb_type Bc = limb_type(a[1U] * b[2U]);
+        const double_limb_type bD =           a[2U] * double_limb_type(b[0U]);
+        const        limb_type bC = limb_type(a[2U] * b[1U]);
+        const        limb_type aD = limb_type(a[3U] * b[0U]);
+
+        r1    = double_limb_type(detail::make_lo<limb_type>(Cd)) + detail::make_lo<limb_type>(cD) + detail::make_hi<limb_type>(dD);
+        r2    = double_limb_type(detail::make_lo<limb_type>(cC)) + detail::make_lo<limb_type>(Bd) + detail::make_lo<limb_type>(bD) + detail::make_hi<limb_type>(Cd) + detail::make_hi<limb_type>(cD) + detail::make_hi<limb_type>(r1);
+        r[3U] =   limb_type(limb_type(Bc + bC) + limb_type(aD + Ad))
+                + detail::make_hi<limb_type>(cC)
+                + detail::make_hi<limb_type>(Bd)
+                + detail::make_hi<limb_type>(bD)
+                + detail::make_hi<limb_type>(r2);
+      }
+
+      r[0U] = limb_type(dD);
+      r[1U] = limb_type(r1);
+      r[2U] = limb_type(r2);
+    }
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<(   (detail::x86_64_limb_kernels_are_enabled<limb_type>::value == false)
+                                      && (std::numeric_limits<limb_type>::digits * 4 != RePhraseDigits2))>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      limb_type*         r,
+                                                                       const limb_type*         a,
+                                                                       const limb_type*         b,
+                                                                       const std::uint_fast32_t count)
+    {
+      eval_multiply_n_by_n_to_lo_part_portable(r, a, b, count);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part_portable(      limb_type*         r,
+                                                                                const limb_type*         a,
+                                                                                const limb_type*         b,
+                                                                                const std::uint_fast32_t count)
+    {
+      detail::fill_unsafe(r, r + count, limb_type(0U));
+
+      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      {
+        if(a[i] != limb_type(0U))
+        {
+          double_limb_type carry = 0U;
+
+          for(std::uint_fast32_t j = 0U; j < (count - i); ++j)
+          {
+            carry += double_limb_type(double_limb_type(a[i]) * b[j]);
+            carry += r[i + j];
+
+            r[i + j] = limb_type(carry);
+            carry    = detail::make_hi<limb_type>(carry);
+          }
+        }
+      }
+    }
+
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == true)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_2n(      limb_type*         r,
+                                                                  const limb_type*         a,
+                                                                  const limb_type*         b,
+                                                                  const std::uint_fast32_t count)
+    {
+      if(detail::is_constant_evaluated())
+      {
+        eval_multiply_n_by_n_to_2n_portable(r, a, b, count);
+      }
+      else
+      {
+        detail::x86_64_multiply_limbs_lo(r, count * 2U, a, count, b, count);
+      }
+    }
+    #endif
+
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == false)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_2n(      limb_type*         r,
+                                                                  const limb_type*         a,
+                                                                  const limb_type*         b,
+                                                                  const std::uint_fast32_t count)
+    {
+      eval_multiply_n_by_n_to_2n_portable(r, a, b, count);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_2n_portable(      limb_type*         r,
+                                                                           const limb_type*         a,
+                                                                           const limb_type*         b,
+                                                                           const std::uint_fast32_t count)
+    {
+      detail::fill_unsafe(r, r + (count * 2U), limb_type(0U));
+
+      for(std::uint_fast32_t i = 0U; i < count; ++i)
+      {
+        if(a[i] != limb_type(0U))
+        {
+          std::uint_fast32_t j = 0U;
+
+          double_limb_type carry = 0U;
+
+          for( ; j < count; ++j)
+          {
+            carry += double_limb_type(double_limb_type(a[i]) * b[j]);
+            carry += r[i + j];
+
+            r[i + j] = limb_type(carry);
+            carry    = detail::make_hi<limb_type>(carry);
+          }
+
+          r[i + j] = limb_type(carry);
+        }
+      }
+    }
+
+    #if defined(WIDE_INTEGER_HAS_X86_64_LIMB_KERNELS)
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == true)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_multiply_1d(      limb_type*         r,
+                                                             const limb_type*         a,
+                                                             const limb_type          b,
+                                                             const std::uint_fast32_t count)
+    {
+      return (detail::is_constant_evaluated() ? eval_multiply_1d_portable(r, a, b, count)
+                                              : detail::x86_64_multiply_1d(r, a, b, count));
+    }
+    #endif
+
+    template<typename RePhraseLimbType = limb_type,
+             typename std::enable_if<(detail::x86_64_limb_kernels_are_enabled<RePhraseLimbType>::value == false)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_multiply_1d(      limb_type*         r,
+                                                             const limb_type*         a,
+                                                             const limb_type          b,
+                                                             const std::uint_fast32_t count)
+    {
+      return eval_multiply_1d_portable(r, a, b, count);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR limb_type eval_multiply_1d_portable(      limb_type*         r,
+                                                                      const limb_type*         a,
+                                                                      const limb_type          b,
+                                                                      const std::uint_fast32_t count)
+    {
+      double_limb_type carry = 0U;
+
+      if(b == 0U)
+      {
+        detail::fill_unsafe(r, r + count, limb_type(0U));
+      }
+      else
+      {
+        for(std::uint_fast32_t i = 0U ; i < count; ++i)
+        {
+          carry += double_limb_type(double_limb_type(a[i]) * b);
+
+          r[i]  = limb_type(carry);
+          carry = detail::make_hi<limb_type>(carry);
+        }
+      }
+
+      return limb_type(carry);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_kara_propagate_carry(limb_type* t, const std::uint_fast32_t n, const limb_type carry)
+    {
+      std::uint_fast32_t i = 0U;
+
+      limb_type carry_out = carry;
+
+      while((i < n) && (carry_out != 0U))
+      {
+        const double_limb_type uv_as_ularge = double_limb_type(t[i]) + carry_out;
+
+        carry_out = detail::make_hi<limb_type>(uv_as_ularge);
+
+        t[i] = limb_type(uv_as_ularge);
+
+        ++i;
+      }
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_kara_propagate_borrow(limb_type* t, const std::uint_fast32_t n, const bool has_borrow)
+    {
+      std::uint_fast32_t i = 0U;
+
+      bool has_borrow_out = has_borrow;
+
+      while((i < n) && (has_borrow_out == true))
+      {
+        double_limb_type uv_as_ularge = double_limb_type(t[i]);
+
+        if(has_borrow_out)
+        {
+          --uv_as_ularge;
+        }
+
+        has_borrow_out = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
+
+        t[i] = limb_type(uv_as_ularge);
+
+        ++i;
+      }
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_kara_n_by_n_to_2n(      limb_type*         r,
+                                                                       const limb_type*         a,
+                                                                       const limb_type*         b,
+                                                                       const std::uint_fast32_t n,
+                                                                             limb_type*         t)
+    {
+      if(n <= 32U)
+      {
+        static_cast<void>(t);
+
+        eval_multiply_n_by_n_to_2n(r, a, b, n);
+      }
+      else
+      {
+        // Based on "Algorithm 1.3 KaratsubaMultiply", Sect. 1.3.2, page 5
+        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press (2011).
+
+        // The Karatsuba multipliation computes the product of u*v as:
+        // [b^N + b^(N/2)] a1*b1 + [b^(N/2)](a1 - a0)(b0 - b1) + [b^(N/2) + 1] a0*b0
+
+        // Here we visualize u and v in two components 0,1 corresponding
+        // to the high and low order parts, respectively.
+
+        // Step 1
+        // Calculate a1*b1 and store it in the upper part of r.
+        // Calculate a0*b0 and store it in the lower part of r.
+        // copy r to t0.
+
+        // Step 2
+        // Add a1*b1 (which is t2) to the middle two-quarters of r (which is r1)
+        // Add a0*b0 (which is t0) to the middle two-quarters of r (which is r1)
+
+        // Step 3
+        // Calculate |a1-a0| in t0 and note the sign (i.e., the borrow flag)
+
+        // Step 4
+        // Calculate |b0-b1| in t1 and note the sign (i.e., the borrow flag)
+
+        // Step 5
+        // Call kara mul to calculate |a1-a0|*|b0-b1| in (t2),
+        // while using temporary storage in t4 along the way.
+
+        // Step 6
+        // Check the borrow signs. If a1-a0 and b0-b1 have the same signs,
+        // then add |a1-a0|*|b0-b1| to r1, otherwise subtract it from r1.
+
+        const std::uint_fast32_t  nh = n / 2U;
+
+        const limb_type* a0 = a + 0U;
+        const limb_type* a1 = a + nh;
+
+        const limb_type* b0 = b + 0U;
+        const limb_type* b1 = b + nh;
+
+              limb_type* r0 = r + 0U;
+              limb_type* r1 = r + nh;
+              limb_type* r2 = r + n;
+              limb_type* r3 = r + (n + nh);
+              limb_type* r4 = r + (n + n);
+
+              limb_type* t0 = t + 0U;
+              limb_type* t1 = t + nh;
+              limb_type* t2 = t + n;
+              limb_type* t4 = t + (n + n);
+
+        // Step 1
+        //   a1*b1 -> r2
+        //   a0*b0 -> r0
+        //   r -> t0
+        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0);
+        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0);
+        detail::copy_unsafe(r0, r4, t0);
+
+        // Step 2
+        //   r1 += a1*b1
+        //   r1 += a0*b0
+        limb_type carry = eval_add_n(r1, r1, t2, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+        carry = eval_add_n(r1, r1, t0, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+
+        // Step 3
+        //   |a1-a0| -> t0
+        const std::int_fast8_t cmp_result_a1a0 = compare_ranges(a1, a0, nh);
+
+        if(cmp_result_a1a0 == 1)
+        {
+          static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
+        }
+        else if(cmp_result_a1a0 == -1)
+        {
+          static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
+        }
+
+        // Step 4
+        //   |b0-b1| -> t1
+        const std::int_fast8_t cmp_result_b0b1 = compare_ranges(b0, b1, nh);
+
+        if(cmp_result_b0b1 == 1)
+        {
+          static_cast<void>(eval_subtract_n(t1, b0, b1, nh));
+        }
+        else if(cmp_result_b0b1 == -1)
+        {
+          static_cast<void>(eval_subtract_n(t1, b1, b0, nh));
+        }
+
+        // Step 5
+        //   |a1-a0|*|b0-b1| -> t2
+        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
+
+        // Step 6
+        //   either r1 += |a1-a0|*|b0-b1|
+        //   or     r1 -= |a1-a0|*|b0-b1|
+        if((cmp_result_a1a0 * cmp_result_b0b1) == 1)
+        {
+          carry = eval_add_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_carry(r3, nh, carry);
+        }
+        else if((cmp_result_a1a0 * cmp_result_b0b1) == -1)
+        {
+          const bool has_borrow = eval_subtract_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
+        }
+      }
+    }
+
+    static void eval_multiply_toomcook3(      limb_type*         r,
+                                        const limb_type*         u,
+                                        const limb_type*         v,
+                                        const std::uint_fast32_t n,
+                                              limb_type*         t)
+    {
+      if(n == 3072U)
+      {
+        // TBD: Tune the threshold for the transition
+        // from Toom-Cook3 back to base case Karatsuba.
+
+        // Base case Karatsuba multiplication.
+        eval_multiply_kara_n_by_n_to_2n(r, u, v, n, t);
+      }
+      else
+      {
+        // Based on "Algorithm 1.4 ToomCook3", Sect. 1.3.3, page 7 of
+        // R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press (2011).
+
+        // TBD: Toom-Cook3
+      }
+    }
+
+    static void eval_multiply_toomcook4(      limb_type*         r,
+                                        const limb_type*         u,
+                                        const limb_type*         v,
+                                        const std::uint_fast32_t n,
+                                              limb_type*         t)
+    {
+      if(n == 2048U)
+      {
+        // TBD: Tune the threshold for the transition
+        // from Toom-Cook4 back to base case Karatsuba.
+
+        // Base case Karatsuba multiplication.
+        eval_multiply_kara_n_by_n_to_2n(r, u, v, n, t);
+      }
+      else
+      {
+        // TBD: Toom-Cook4
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder)
+    {
+      // Use Knuth's long division algorithm.
+      // The loop-ordering of indexes in Knuth's original
+      // algorithm has been reversed due to the data format
+      // used here. Several optimizations and combinations
+      // of logic have been carried out in the source code.
+
+      // See also:
+      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
+      // Seminumerical Algorithms", Addison-Wesley (1998),
+      // Section 4.3.1 Algorithm D and Exercise 16.
+
+      using local_uint_index_type = std::uint_fast32_t;
+
+      local_uint_index_type u_offset = local_uint_index_type(0U);
+      local_uint_index_type v_offset = local_uint_index_type(0U);
+
+      // Compute the offsets for u and v.
+      for(local_uint_index_type i = 0U; (i < number_of_limbs) && (      values[(number_of_limbs - 1U) - i] == limb_type(0U)); ++i) { ++u_offset; }
+      for(local_uint_index_type i = 0U; (i < number_of_limbs) && (other.values[(number_of_limbs - 1U) - i] == limb_type(0U)); ++i) { ++v_offset; }
+
+      if(v_offset == local_uint_index_type(number_of_limbs))
+      {
+        // The denominator is zero. Set the maximum value and return.
+        // This also catches (0 / 0) and sets the maximum value for it.
+        operator=(limits_helper_max());
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(std::uint8_t(0U));
+        }
+      }
+      else if(u_offset == local_uint_index_type(number_of_limbs))
+      {
+        // The numerator is zero. Do nothing and return.
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(std::uint8_t(0U));
+        }
+      }
+      else
+      {
+        const int result_of_compare_left_with_right = compare(other);
+
+        const bool left_is_less_than_right = (result_of_compare_left_with_right == -1);
+        const bool left_is_equal_to_right  = (result_of_compare_left_with_right ==  0);
+
+        if(left_is_less_than_right)
+        {
+          // If the denominator is larger than the numerator,
+          // then the result of the division is zero.
+          if(remainder != nullptr)
+          {
+            *remainder = *this;
+          }
+
+          operator=(std::uint8_t(0U));
+        }
+        else if(left_is_equal_to_right)
+        {
+          // If the denominator is equal to the numerator,
+          // then the result of the division is one.
+          operator=(std::uint8_t(1U));
+
+          if(remainder != nullptr)
+          {
+            *remainder = uintwide_t(std::uint8_t(0U));
+          }
+        }
+        else if(v_offset == local_uint_index_type(number_of_limbs - 1U))
+        {
+          // The denominator has one single limb.
+          // Use a one-dimensional division algorithm.
+          const limb_type short_denominator = other.values[0U];
+
+          eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+        }
+        else
+        {
+          // We will now use the Knuth long division algorithm.
+
+          // Compute the normalization factor d.
+          const limb_type d =
+            limb_type(double_limb_type(  double_limb_type(double_limb_type(1U) << std::numeric_limits<limb_type>::digits)
+                                       / double_limb_type(double_limb_type(other.values[(number_of_limbs - 1U) - v_offset]) + limb_type(1U))));
+
+          // Step D1(b), normalize u -> u * d = uu.
+          // Step D1(c): normalize v -> v * d = vv.
+
+          std::array<limb_type, number_of_limbs + 1U> uu { };
+          std::array<limb_type, number_of_limbs>      vv { };
+
+          if(d > limb_type(1U))
+          {
+            uu[number_of_limbs - u_offset] =
+              eval_multiply_1d(uu.data(), values.data(), d, number_of_limbs - u_offset);
+
+            static_cast<void>(eval_multiply_1d(vv.data(), other.values.data(), d, number_of_limbs - v_offset));
+          }
+          else
+          {
+            detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
+
+            uu[number_of_limbs - u_offset] = limb_type(0U);
+
+            vv = other.values;
+          }
+
+          // Step D2: Initialize j.
+          // Step D7: Loop on j from m to 0.
+
+          const local_uint_index_type n   = local_uint_index_type(number_of_limbs - v_offset);
+          const local_uint_index_type m   = local_uint_index_type(number_of_limbs - u_offset) - n;
+          const local_uint_index_type vj0 = (number_of_limbs - 1U) - v_offset;
+
+          // The array nv holds the product q_hat * (v[1, ... n]).
+          std::array<limb_type, number_of_limbs + 1U> nv { };
+
+          for(local_uint_index_type j = local_uint_index_type(0U); j <= m; ++j)
+          {
+            // Step D3 [Calculate q_hat].
+            //   if u[j] == v[j0]
+            //     set q_hat = b - 1
+            //   else
+            //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+
+            const local_uint_index_type uj     = (((number_of_limbs + 1U) - 1U) - u_offset) - j;
+            const double_limb_type      u_j_j1 = (double_limb_type(uu[uj]) << std::numeric_limits<limb_type>::digits) + uu[uj - 1U];
+
+            limb_type q_hat = ((uu[uj] == vv[vj0]) ? (std::numeric_limits<limb_type>::max)()
+                                                   : limb_type(u_j_j1 / vv[vj0]));
+
+            // Decrease q_hat if necessary.
+            // This means that q_hat must be decreased if the
+            // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
+            // exceeds the range of uintwide_t.
+
+            for(double_limb_type t = u_j_j1 - double_limb_type(q_hat * double_limb_type(vv[vj0])); ; --q_hat, t += vv[vj0])
+            {
+              if(   (detail::make_hi<limb_type>(t) != limb_type(0U))
+                 || (   double_limb_type(double_limb_type(vv[vj0 - 1U]) * q_hat)
+                     <= double_limb_type(double_limb_type(t << std::numeric_limits<limb_type>::digits) + uu[uj - 2U])))
+              {
+                break;
+              }
+            }
+
+            // Step D4: Multiply and subtract.
+            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+
+            // Set nv = q_hat * (v[1, ... n]).
+            nv[n] = eval_multiply_1d(nv.data(), vv.data(), q_hat, n);
+
+            const bool has_borrow =
+              eval_subtract_n(uu.data() + (uj - n), uu.data() + (uj - n), nv.data(), n + 1U);
+
+
+            // Get the result data.
+            values[m - j] = q_hat - (has_borrow ? 1U : 0U);
+
+            // Step D5: Test the remainder.
+            // Set the result value: Set result.m_data[m - j] = q_hat.
+            // Use the condition (u[j] < 0), in other words if the borrow
+            // is non-zero, then step D6 needs to be carried out.
+
+            if(has_borrow)
+            {
+              // Step D6: Add back.
+              // Add v[1, ... n] back to u[j, ... j + n],
+              // and decrease the result by 1.
+
+              static_cast<void>(eval_add_n(uu.data() + (uj - n), uu.data() + (uj - n), vv.data(), n));
+            }
+          }
+
+          // Clear the data elements that have not
+          // been computed in the division algorithm.
+          detail::fill_unsafe(values.begin() + (m + 1U), values.end(), limb_type(0U));
+
+          if(remainder != nullptr)
+          {
+            if(d == 1U)
+            {
+              detail::copy_unsafe(uu.cbegin(),
+                                  uu.cbegin() + (number_of_limbs - v_offset),
+                                  remainder->values.begin());
+            }
+            else
+            {
+              limb_type previous_u = limb_type(0U);
+
+              for(std::int_fast32_t rl = std::int_fast32_t(n - 1U), ul = std::int_fast32_t(number_of_limbs - (v_offset + 1U)); rl >= 0; --rl, --ul)
+              {
+                const double_limb_type t =
+                  double_limb_type(  uu[std::uint_fast32_t(ul)]
+                                   + double_limb_type(double_limb_type(previous_u) << std::numeric_limits<limb_type>::digits));
+
+                remainder->values[std::uint_fast32_t(rl)] = limb_type(double_limb_type(t / d));
+                previous_u                                = limb_type(double_limb_type(t - double_limb_type(double_limb_type(d) * remainder->values[std::uint_fast32_t(rl)])));
+              }
+            }
+
+            detail::fill_unsafe(remainder->values.begin() + n,
+                                remainder->values.end(),
+                                limb_type(0U));
+          }
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void shl(const std::uint_fast32_t offset, const std::uint_fast32_t left_shift_amount)
+    {
+      if(offset > 0U)
+      {
+        detail::copy_backward_unsafe(values.data(),
+                                     values.data() + (number_of_limbs - offset),
+                                     values.data() +  number_of_limbs);
+
+        detail::fill_unsafe(values.begin(), values.begin() + offset, limb_type(0U));
+      }
+
+      limb_type part_from_previous_value = limb_type(0U);
+
+      using local_integral_type = std::uint_fast32_t;
+
+      if(left_shift_amount != local_integral_type(0U))
+      {
+        for(std::uint_fast32_t i = offset; i < number_of_limbs; ++i)
+        {
+          const limb_type t = values[i];
+
+          values[i] = (t << local_integral_type(left_shift_amount)) | part_from_previous_value;
+
+          part_from_previous_value = limb_type(t >> local_integral_type(std::uint_fast32_t(std::numeric_limits<limb_type>::digits - left_shift_amount)));
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void shr(const std::uint_fast32_t offset, const std::uint_fast32_t right_shift_amount)
+    {
+      if(offset > 0U)
+      {
+        detail::copy_unsafe(values.begin() + offset,
+                            values.begin() + number_of_limbs,
+                            values.begin());
+
+        detail::fill_unsafe(values.end() - offset, values.end(), limb_type(0U));
+      }
+
+      limb_type part_from_previous_value = limb_type(0U);
+
+      using local_integral_type = std::uint_fast32_t;
+
+      if(right_shift_amount != local_integral_type(0U))
+      {
+        for(std::int_fast32_t i = std::int_fast32_t((number_of_limbs - 1U) - offset); i >= 0; --i)
+        {
+          const limb_type t = values[std::uint_fast32_t(i)];
+
+          values[std::uint_fast32_t(i)] = (t >> local_integral_type(right_shift_amount)) | part_from_previous_value;
+
+          part_from_previous_value = limb_type(t << local_integral_type(std::uint_fast32_t(std::numeric_limits<limb_type>::digits - right_shift_amount)));
+        }
+      }
+    }
+
+    // Read string function.
+    bool rd_string(const char* str_input)
+    {
+      std::fill(values.begin(), values.end(), limb_type(0U));
+
+      const std::uint_fast32_t str_length = detail::strlen_unsafe(str_input);
+
+      std::uint_fast8_t base = 10U;
+
+      std::uint_fast32_t pos = 0U;
+
+      // Skip over a potential plus sign.
+      if((str_length > 0U) && (str_input[0U] == char('+')))
+      {
+        ++pos;
+      }
+
+      // Perform a dynamic detection of the base.
+      if(str_length > (pos + 0U))
+      {
+        const bool might_be_oct_or_hex = ((str_input[pos + 0U] == char('0')) && (str_length > (pos + 1U)));
+
+        if(might_be_oct_or_hex)
+        {
+          if((str_input[pos + 1U] >= char('0')) && (str_input[pos + 1U] <= char('8')))
+          {
+            // The input format is octal.
+            base = 8U;
+
+            pos += 1U;
+          }
+          else if((str_input[pos + 1U] == char('x')) || (str_input[pos + 1U] == char('X')))
+          {
+            // The input format is hexadecimal.
+            base = 16U;
+
+            pos += 2U;
+          }
+        }
+        else if((str_input[pos + 0U] >= char('0')) && (str_input[pos + 0U] <= char('9')))
+        {
+          // The input format is decimal.
+          ;
+        }
+      }
+
+      if(base == 10U)
+      {
+        return rd_string_dec(str_input + pos, str_length - pos);
+      }
+
+      bool char_is_valid = true;
+
+      for( ; ((pos < str_length) && char_is_valid); ++pos)
+      {
+        std::uint8_t c = std::uint8_t(str_input[pos]);
+
+        const bool char_is_apostrophe = (c == char(39));
+
+        if(char_is_apostrophe == false)
+        {
+          if(base == 8U)
+          {
+            if  ((c >= char('0')) && (c <= char('8'))) { c -= std::uint8_t(0x30U); }
+            else                                       { char_is_valid = false; }
+
+            if(char_is_valid)
+            {
+              operator<<=(3);
+
+              values[0U] |= std::uint8_t(c);
+            }
+          }
+          else if(base == 16U)
+          {
+            if     ((c >= std::uint8_t('a')) && (c <= std::uint8_t('f'))) { c -= std::uint8_t(  87U); }
+            else if((c >= std::uint8_t('A')) && (c <= std::uint8_t('F'))) { c -= std::uint8_t(  55U); }
+            else if((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { c -= std::uint8_t(0x30U); }
+            else                                                          { char_is_valid = false; }
+
+            if(char_is_valid)
+            {
+              operator<<=(4);
+
+              values[0U] |= c;
+            }
+          }
+        }
+      }
+
+      return char_is_valid;
+    }
+
+    // Decimal conversion works in chunks of the largest
+    // number of decimal digits which fit into one limb.
+    static constexpr std::uint_fast32_t dec_chunk_digits = std::uint_fast32_t(std::numeric_limits<limb_type>::digits10);
+
+    static constexpr limb_type dec_chunk_value() { return limb_type(detail::pow10_helper(dec_chunk_digits)); }
+
+    // The table of powers 10^(c * 2^k), where c is the chunk digit count.
+    // A table entry of k is roughly 2^k limbs wide, so entries up to about
+    // half of the width are needed for the divide-and-conquer splitting.
+    static constexpr std::uint_fast32_t dec_power_table_size = detail::log2_ceil_helper(number_of_limbs) + 1U;
+
+    struct dec_power_table_type
+    {
+      std::array<uintwide_t, dec_power_table_size> powers;
+      std::array<std::uint_fast32_t, dec_power_table_size> limb_counts;
+      std::uint_fast32_t count;
+    };
+
+    static const dec_power_table_type& dec_power_table()
+    {
+      static const dec_power_table_type the_table = make_dec_power_table();
+
+      return the_table;
+    }
+
+    static dec_power_table_type make_dec_power_table()
+    {
+      dec_power_table_type table;
+
+      table.powers[0U]      = uintwide_t(dec_chunk_value());
+      table.limb_counts[0U] = 1U;
+      table.count           = 1U;
+
+      // Square the previous entry as long as the square fits.
+      while(   (table.count < dec_power_table_size)
+            && ((table.limb_counts[table.count - 1U] * 2U) <= number_of_limbs))
+      {
+        const uintwide_t& p = table.powers[table.count - 1U];
+
+        const std::uint_fast32_t p_limb_count = table.limb_counts[table.count - 1U];
+
+        detail::eval_multiply_limbs_lo(table.powers[table.count].values.data(),
+                                       number_of_limbs,
+                                       p.values.data(),
+                                       p_limb_count,
+                                       p.values.data(),
+                                       p_limb_count);
+
+        table.limb_counts[table.count] = significant_limb_count(table.powers[table.count]);
+
+        ++table.count;
+      }
+
+      return table;
+    }
+
+    static std::uint_fast32_t significant_limb_count(const uintwide_t& u)
+    {
+      std::uint_fast32_t n = number_of_limbs;
+
+      while((n > 0U) && (u.values[n - 1U] == limb_type(0U)))
+      {
+        --n;
+      }
+
+      return n;
+    }
+
+    static limb_type eval_divide_by_single_limb_in_place(limb_type* u, const std::uint_fast32_t count, const limb_type d)
+    {
+      // Divide the lowest count limbs of u in place by d and return the remainder.
+      double_limb_type r = 0U;
+
+      for(std::uint_fast32_t i = count; i-- > 0U; )
+      {
+        const double_limb_type numerator = double_limb_type(double_limb_type(r << std::numeric_limits<limb_type>::digits) | u[i]);
+
+        u[i] = limb_type(numerator / d);
+        r    = double_limb_type(numerator - double_limb_type(double_limb_type(u[i]) * d));
+      }
+
+      return limb_type(r);
+    }
+
+    static char* wr_string_dec_chunked(const uintwide_t& t, char* p_end)
+    {
+      // Write the decimal digits of t backwards, ending just before p_end.
+      // Each pass of the single-limb division extracts a whole chunk of
+      // decimal digits. The leading zero limbs are not processed.
+      representation_type u(t.values);
+
+      std::uint_fast32_t n = significant_limb_count(t);
+
+      char* p = p_end;
+
+      while(n != 0U)
+      {
+        limb_type chunk = eval_divide_by_single_limb_in_place(u.data(), n, dec_chunk_value());
+
+        if(u[n - 1U] == limb_type(0U))
+        {
+          --n;
+        }
+
+        if(n != 0U)
+        {
+          for(std::uint_fast32_t j = 0U; j < dec_chunk_digits; ++j)
+          {
+            *(--p) = char(char(chunk % 10U) + char('0'));
+
+            chunk = limb_type(chunk / 10U);
+          }
+        }
+        else
+        {
+          while(chunk != limb_type(0U))
+          {
+            *(--p) = char(char(chunk % 10U) + char('0'));
+
+            chunk = limb_type(chunk / 10U);
+          }
+        }
+      }
+
+      return p;
+    }
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<((RePhraseDigits2 / std::numeric_limits<limb_type>::digits) <= number_of_limbs_radix_dc_threshold)>::type const* = nullptr>
+    static char* wr_string_dec(const uintwide_t& t, char* p_end, const std::uint_fast32_t pad_digits)
+    {
+      char* p = wr_string_dec_chunked(t, p_end);
+
+      while(std::uint_fast32_t(p_end - p) < pad_digits)
+      {
+        *(--p) = char('0');
+      }
+
+      return p;
+    }
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<((RePhraseDigits2 / std::numeric_limits<limb_type>::digits) > number_of_limbs_radix_dc_threshold)>::type const* = nullptr>
+    static char* wr_string_dec(const uintwide_t& t, char* p_end, const std::uint_fast32_t pad_digits)
+    {
+      // Write the decimal digits of t backwards, ending just before p_end,
+      // and pad with leading zeros up to pad_digits. Large values are split
+      // into t = hi * 10^(c * 2^k) + lo, where the power is roughly half as
+      // wide as t, and the two halves are written recursively.
+
+      // See also "Algorithm 1.26 FastIntegerOutput", Sect. 1.7 in
+      // R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press (2011). Unlike there, the division
+      // is quadratic, and so is the conversion (see above).
+
+      const std::uint_fast32_t t_limb_count = significant_limb_count(t);
+
+      char* p;
+
+      if(t_limb_count <= number_of_limbs_radix_dc_threshold)
+      {
+        p = wr_string_dec_chunked(t, p_end);
+      }
+      else
+      {
+        const dec_power_table_type& table = dec_power_table();
+
+        std::uint_fast32_t k = 0U;
+
+        while(((k + 1U) < table.count) && ((table.limb_counts[k + 1U] * 2U) <= t_limb_count))
+        {
+          ++k;
+        }
+
+        // The power has fewer limbs than t, so the upper part is non-zero.
+        uintwide_t hi(t);
+        uintwide_t lo;
+
+        hi.eval_divide_knuth(table.powers[k], &lo);
+
+        const std::uint_fast32_t lo_digits = dec_chunk_digits << k;
+
+        p = wr_string_dec(lo, p_end, lo_digits);
+        p = wr_string_dec(hi, p,     0U);
+      }
+
+      while(std::uint_fast32_t(p_end - p) < pad_digits)
+      {
+        *(--p) = char('0');
+      }
+
+      return p;
+    }
+
+    static uintwide_t rd_string_dec_chunked(const char* p, const std::uint_fast32_t digit_count)
+    {
+      // Read the decimal digits in chunks, each of which is accumulated
+      // with one single multiply-by-limb and one limb addition.
+      uintwide_t u(std::uint8_t(0U));
+
+      std::uint_fast32_t n = 0U;
+
+      std::uint_fast32_t first_chunk_digits = std::uint_fast32_t(digit_count % dec_chunk_digits);
+
+      if(first_chunk_digits == 0U)
+      {
+        first_chunk_digits = dec_chunk_digits;
+      }
+
+      for(std::uint_fast32_t i = 0U; i < digit_count; )
+      {
+        const std::uint_fast32_t chunk_digits = ((i == 0U) ? first_chunk_digits : dec_chunk_digits);
+
+        limb_type chunk      = limb_type(0U);
+        limb_type chunk_base = limb_type(1U);
+
+        for(std::uint_fast32_t j = 0U; j < chunk_digits; ++j, ++i)
+        {
+          chunk      = limb_type(limb_type(chunk * 10U) + limb_type(p[i] - char('0')));
+          chunk_base = limb_type(chunk_base * 10U);
+        }
+
+        // Multiply by the chunk base and add the chunk.
+        // Only the significant limbs are processed.
+        double_limb_type carry = chunk;
+
+        for(std::uint_fast32_t j = 0U; j < n; ++j)
+        {
+          carry += double_limb_type(double_limb_type(u.values[j]) * chunk_base);
+
+          u.values[j] = limb_type(carry);
+          carry       = detail::make_hi<limb_type>(carry);
+        }
+
+        if((n < number_of_limbs) && (carry != 0U))
+        {
+          u.values[n] = limb_type(carry);
+
+          ++n;
+        }
+      }
+
+      return u;
+    }
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<((RePhraseDigits2 / std::numeric_limits<limb_type>::digits) <= number_of_limbs_radix_dc_threshold)>::type const* = nullptr>
+    static uintwide_t rd_string_dec_digits(const char* p, const std::uint_fast32_t digit_count)
+    {
+      return rd_string_dec_chunked(p, digit_count);
+    }
+
+    template<const std::uint_fast32_t RePhraseDigits2 = Digits2,
+             typename std::enable_if<((RePhraseDigits2 / std::numeric_limits<limb_type>::digits) > number_of_limbs_radix_dc_threshold)>::type const* = nullptr>
+    static uintwide_t rd_string_dec_digits(const char* p, const std::uint_fast32_t digit_count)
+    {
+      // Read a long string of decimal digits by splitting it into
+      // upper and lower parts, where the lower part has c * 2^k digits.
+      // The result is hi * 10^(c * 2^k) + lo, computed modulo 2^Digits2.
+
+      uintwide_t u;
+
+      if(digit_count <= (number_of_limbs_radix_dc_threshold * dec_chunk_digits))
+      {
+        u = rd_string_dec_chunked(p, digit_count);
+      }
+      else
+      {
+        const dec_power_table_type& table = dec_power_table();
+
+        std::uint_fast32_t k = 0U;
+
+        while(((k + 1U) < table.count) && (std::uint_fast32_t(dec_chunk_digits << (k + 1U)) <= (digit_count / 2U)))
+        {
+          ++k;
+        }
+
+        const std::uint_fast32_t lo_digits = dec_chunk_digits << k;
+
+        const uintwide_t hi = rd_string_dec_digits(p,                              digit_count - lo_digits);
+        const uintwide_t lo = rd_string_dec_digits(p + (digit_count - lo_digits), lo_digits);
+
+        detail::eval_multiply_limbs_lo(u.values.data(),
+                                       number_of_limbs,
+                                       hi.values.data(),
+                                       significant_limb_count(hi),
+                                       table.powers[k].values.data(),
+                                       table.limb_counts[k]);
+
+        static_cast<void>(eval_add_n(u.values.data(), u.values.data(), lo.values.data(), number_of_limbs));
+      }
+
+      return u;
+    }
+
+    bool rd_string_dec(const char* str_input, const std::uint_fast32_t str_length)
+    {
+      // Validate the decimal input and count its digits.
+      // Apostrophes are allowed as digit separators.
+
+      std::uint_fast32_t digit_count = 0U;
+
+      bool has_apostrophe = false;
+
+      for(std::uint_fast32_t i = 0U; i < str_length; ++i)
+      {
+        const char c = str_input[i];
+
+        if     ((c >= char('0')) && (c <= char('9'))) { ++digit_count; }
+        else if(c == char(39))                        { has_apostrophe = true; }
+        else                                          { return false; }
+      }
+
+      if(has_apostrophe == false)
+      {
+        operator=(rd_string_dec_digits(str_input, digit_count));
+      }
+      else
+      {
+        // Process the groups of digits between the apostrophes.
+        values.fill(limb_type(0U));
+
+        std::uint_fast32_t i = 0U;
+
+        while(i < str_length)
+        {
+          std::uint_fast32_t group_length = 0U;
+
+          while(((i + group_length) < str_length) && (str_input[i + group_length] != char(39)))
+          {
+            ++group_length;
+          }
+
+          if(group_length != 0U)
+          {
+            // Shift the previous value by 10^group_length and add the group.
+            uintwide_t scale(std::uint8_t(1U));
+
+            for(std::uint_fast32_t j = 0U; j < group_length; ++j)
+            {
+              scale.mul_by_limb(limb_type(10U));
+            }
+
+            operator*=(scale);
+            operator+=(rd_string_dec_digits(str_input + i, group_length));
+          }
+
+          i += (group_length + 1U);
+        }
+      }
+
+      return true;
+    }
+
+    WIDE_INTEGER_CONSTEXPR void bitwise_not()
+    {
+      for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+      {
+        values[i] = limb_type(~values[i]);
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void preincrement()
+    {
+      // Implement pre-increment.
+      std::uint_fast32_t i = 0U;
+
+      for( ; (i < (values.size() - 1U)) && (++values[i] == limb_type(0U)); ++i)
+      {
+        ;
+      }
+
+      if(i == (values.size() - 1U))
+      {
+        ++values[i];
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void predecrement()
+    {
+      // Implement pre-decrement.
+      std::uint_fast32_t i = 0U;
+
+      for( ; (i < (values.size() - 1U)) && (values[i]-- == limb_type(0U)); ++i)
+      {
+        ;
+      }
+
+      if(i == (values.size() - 1U))
+      {
+        --values[i];
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR bool is_zero() const
+    {
+      std::uint_fast32_t i = 0U;
+
+      while((i < number_of_limbs) && (values[i] == limb_type(0U)))
+      {
+        ++i;
+      }
+
+      return (i == number_of_limbs);
+    }
+  };
+
+  // Define some convenient unsigned wide integer types.
+  using uint64_t    = uintwide_t<   64U, std::uint16_t>;
+  using uint128_t   = uintwide_t<  128U, std::uint32_t>;
+  using uint256_t   = uintwide_t<  256U, std::uint32_t>;
+  using uint512_t   = uintwide_t<  512U, std::uint32_t>;
+  using uint1024_t  = uintwide_t< 1024U, std::uint32_t>;
+  using uint2048_t  = uintwide_t< 2048U, std::uint32_t>;
+  using uint4096_t  = uintwide_t< 4096U, std::uint32_t>;
+  using uint8192_t  = uintwide_t< 8192U, std::uint32_t>;
+  using uint16384_t = uintwide_t<16384U, std::uint32_t>;
+  using uint32768_t = uintwide_t<32768U, std::uint32_t>;
+
+  // Insert a base class for numeric_limits<> support.
+  // This class inherits from std::numeric_limits<unsigned int>
+  // in order to provide limits for a non-specific unsigned type.
+
+  template<typename WideUnsignedIntegerType>
+  class numeric_limits_uintwide_t_base : public std::numeric_limits<unsigned int>
+  {
+  private:
+    using local_wide_integer_type = WideUnsignedIntegerType;
+
+  public:
+    static constexpr int digits   = static_cast<int>(local_wide_integer_type::my_digits);
+    static constexpr int digits10 = static_cast<int>(local_wide_integer_type::my_digits10);
+
+    static WIDE_INTEGER_CONSTEXPR local_wide_integer_type (max)() { return local_wide_integer_type::limits_helper_max(); }
+    static WIDE_INTEGER_CONSTEXPR local_wide_integer_type (min)() { return local_wide_integer_type::limits_helper_min(); }
+  };
+
+  template<class T>
+  struct is_integral : public std::is_integral<T> { };
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  struct is_integral<wide_integer::generic_template::uintwide_t<Digits2, LimbType>>
+    : public std::integral_constant<bool, true> { };
+
+  } } // namespace wide_integer::generic_template
+
+  namespace std
+  {
+    // Specialization of std::numeric_limits<uintwide_t>.
+    template<const std::uint_fast32_t Digits2,
+             typename LimbType>
+    class numeric_limits<wide_integer::generic_template::uintwide_t<Digits2, LimbType>>
+      : public wide_integer::generic_template::numeric_limits_uintwide_t_base<wide_integer::generic_template::uintwide_t<Digits2, LimbType>> { };
+  }
+
+  namespace wide_integer { namespace generic_template {
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator+ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator+=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator- (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator-=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator* (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator*=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator/ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator/=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator% (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator%=(right); }
+
+  // Non-member binary logic operations of (uintwide_t op uintwide_t).
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator| (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator|=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator^ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator^=(right); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> WIDE_INTEGER_CONSTEXPR uintwide_t<Digits2, LimbType> operator& (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator&=(right); }
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator+(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator+=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator-(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator-=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator*(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v)
+  {
+    // TBD: Make separate functions for signed/unsigned IntegralType.
+    // TBD: And subsequently use the optimized mul_by_limb function where appropriate.
+    return uintwide_t<Digits2, LimbType>(u).operator*=(uintwide_t<Digits2, LimbType>(v));
+  }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator/(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator/=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == false)), uintwide_t<Digits2, LimbType>>::type
+  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == true)
+                                                  && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)), typename uintwide_t<Digits2, LimbType>::limb_type>::type
+  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v)
+  {
+    uintwide_t<Digits2, LimbType> remainder { };
+
+    uintwide_t<Digits2, LimbType>(u).eval_divide_by_single_limb(v, 0U, &remainder);
+
+    using local_limb_type = typename uintwide_t<Digits2, LimbType>::limb_type;
+
+    return local_limb_type(remainder);
+  }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)
+                                                  && (std::is_unsigned   <IntegralType>::value == true)
+                                                  && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)), uintwide_t<Digits2, LimbType>>::type
+  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(uintwide_t<Digits2, LimbType>(v)); }
+
+  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator+(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator+=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator-(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator-=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator*(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v)
+  {
+    // TBD: Make separate functions for signed/unsigned IntegralType.
+    // TBD: And subsequently use the optimized mul_by_limb function where appropriate.
+    return uintwide_t<Digits2, LimbType>(u).operator*=(v);
+  }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator/(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator/=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator%(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(v); }
+
+  // Non-member binary logic operations of (uintwide_t op IntegralType).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator|(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator|=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator^(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator^=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator&(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator&=(uintwide_t<Digits2, LimbType>(v)); }
+
+  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator|(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator|=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator^(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator^=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator&(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator&=(v); }
+
+  // Non-member shift functions of (uintwide_t shift IntegralType).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator<<(const uintwide_t<Digits2, LimbType>& u, const IntegralType n) { return uintwide_t<Digits2, LimbType>(u).operator<<=(n); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
+  operator>>(const uintwide_t<Digits2, LimbType>& u, const IntegralType n) { return uintwide_t<Digits2, LimbType>(u).operator>>=(n); }
+
+  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator==(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator==(v); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator!=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator!=(v); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator> (const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator> (v); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator< (const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator< (v); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator>=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator>=(v); }
+  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator<=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator<=(v); }
+
+  // Non-member comparison functions of (uintwide_t cmp IntegralType).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator==(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator==(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator!=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator!=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator> (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator> (uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator< (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator< (uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator>=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator>=(uintwide_t<Digits2, LimbType>(v)); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator<=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator<=(uintwide_t<Digits2, LimbType>(v)); }
+
+  // Non-member comparison functions of (IntegralType cmp uintwide_t).
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator==(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator==(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator!=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator!=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator> (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator> (v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator< (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator< (v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator>=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator>=(v); }
+
+  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
+  WIDE_INTEGER_CONSTEXPR typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
+                                                  && (std::is_integral   <IntegralType>::value == true)), bool>::type
+  operator<=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator<=(v); }
+
+  #if defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+  #else
+
+  // I/O streaming functions.
+  template<typename char_type,
+           typename traits_type,
+           const std::uint_fast32_t Digits2,
+           typename LimbType>
+  std::basic_ostream<char_type, traits_type>&
+  operator<<(std::basic_ostream<char_type, traits_type>& out,
+             const uintwide_t<Digits2, LimbType>& x)
+  {
+    std::basic_ostringstream<char_type, traits_type> ostr;
+
+    const std::ios::fmtflags my_flags = out.flags();
+
+    const bool show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
+    const bool show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
+    const bool is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+
+    std::uint_fast8_t base_rep;
+
+    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep =  8U; }
+    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = 16U; }
+    else                                                 { base_rep = 10U; }
+
+    const std::uint_fast32_t field_width = std::uint_fast32_t(out.width());
+    const char               fill_char   = out.fill();
+
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+
+    if(base_rep == 8U)
+    {
+      char str_result[local_wide_integer_type::wr_string_max_buffer_size_oct];
+
+      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result);
+    }
+    else if(base_rep == 10U)
+    {
+      char str_result[local_wide_integer_type::wr_string_max_buffer_size_dec];
+
+      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result);
+    }
+    else if(base_rep == 16U)
+    {
+      char str_result[local_wide_integer_type::wr_string_max_buffer_size_hex];
+
+      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result);
+    }
+
+    return (out << ostr.str());
+  }
+
+  template<typename char_type,
+           typename traits_type,
+           const std::uint_fast32_t Digits2,
+           typename LimbType>
+  std::basic_istream<char_type, traits_type>&
+  operator>>(std::basic_istream<char_type, traits_type>& in,
+             uintwide_t<Digits2, LimbType>& x)
+  {
+    std::string str_in;
+
+    in >> str_in;
+
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+
+    x = local_wide_integer_type(str_in.c_str());
+
+    return in;
+  }
+
+  #endif
+
+  } } // namespace wide_integer::generic_template
+
+  // Implement various number-theoretical tools.
+
+  namespace wide_integer { namespace generic_template {
+
+  namespace detail {
+
+  template<typename UnsignedIntegralType>
+  inline std::uint_fast32_t lsb_helper(const UnsignedIntegralType& x)
+  {
+    // Compile-time checks.
+    static_assert((   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                   && (std::is_integral<UnsignedIntegralType>::value    == true)
+                   && (std::is_unsigned<UnsignedIntegralType>::value    == true)),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
 
-            std::fill(remainder->values.begin() + n,
-                      remainder->values.end(),
-                      limb_type(0U));
-          }
-        }
-      }
-    }
+    std::uint_fast32_t result = 0U;
+
+    UnsignedIntegralType mask(x);
+
+    // This assumes that at least one bit is set.
+    // Otherwise saturation of the index will occur.
 
-    void shl(const std::uint_fast32_t offset, const std::uint_fast32_t left_shift_amount)
+    // Naive and basic LSB search.
+    // TBD: This could be improved with a binary search
+    // on the lowest bit position of the fundamental type.
+    while((std::uint_fast32_t(mask) & 1U) == 0U)
     {
-      if(offset > 0U)
-      {
-        std::copy_backward(values.data(),
-                           values.data() + (number_of_limbs - offset),
-                           values.data() +  number_of_limbs);
+      mask >>= 1U;
 
-        std::fill(values.begin(), values.begin() + offset, limb_type(0U));
-      }
+      ++result;
+    }
 
-      limb_type part_from_previous_value = limb_type(0U);
+    return result;
+  }
 
-      using local_integral_type = std::uint_fast32_t;
+  template<typename UnsignedIntegralType>
+  inline std::uint_fast32_t msb_helper(const UnsignedIntegralType& u)
+  {
+    // Compile-time checks.
+    static_assert((   (std::is_fundamental<UnsignedIntegralType>::value == true)
+                   && (std::is_integral<UnsignedIntegralType>::value    == true)
+                   && (std::is_unsigned<UnsignedIntegralType>::value    == true)),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
 
-      if(left_shift_amount != local_integral_type(0U))
-      {
-        for(std::uint_fast32_t i = offset; i < number_of_limbs; ++i)
-        {
-          const limb_type t = values[i];
+    using local_unsigned_integral_type = UnsignedIntegralType;
 
-          values[i] = (t << local_integral_type(left_shift_amount)) | part_from_previous_value;
+    std::int_fast32_t i;
 
-          part_from_previous_value = limb_type(t >> local_integral_type(std::uint_fast32_t(std::numeric_limits<limb_type>::digits - left_shift_amount)));
-        }
-      }
-    }
+    // TBD: This could potentially be improved with a binary
+    // search for the highest bit position in the type.
 
-    void shr(const std::uint_fast32_t offset, const std::uint_fast32_t right_shift_amount)
+    for(i = std::int_fast32_t(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= 0; --i)
     {
-      if(offset > 0U)
+      if((u & UnsignedIntegralType(local_unsigned_integral_type(1U) << i)) != 0U)
       {
-        std::copy(values.begin() + offset,
-                  values.begin() + number_of_limbs,
-                  values.begin());
-
-        std::fill(values.end() - offset, values.end(), limb_type(0U));
+        break;
       }
+    }
 
-      limb_type part_from_previous_value = limb_type(0U);
-
-      using local_integral_type = std::uint_fast32_t;
+    return std::uint_fast32_t((std::max)(std::int_fast32_t(0), i));
+  }
 
-      if(right_shift_amount != local_integral_type(0U))
-      {
-        for(std::int_fast32_t i = std::int_fast32_t((number_of_limbs - 1U) - offset); i >= 0; --i)
-        {
-          const limb_type t = values[std::uint_fast32_t(i)];
+  template<>
+  inline std::uint_fast32_t msb_helper(const std::uint32_t& u)
+  {
+    std::uint_fast32_t r(0);
 
-          values[std::uint_fast32_t(i)] = (t >> local_integral_type(right_shift_amount)) | part_from_previous_value;
+    std::uint32_t x = u;
 
-          part_from_previous_value = limb_type(t << local_integral_type(std::uint_fast32_t(std::numeric_limits<limb_type>::digits - right_shift_amount)));
-        }
-      }
-    }
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT32_C(0xFFFF0000)) != UINT32_C(0)) { x >>= 16U; r |= UINT8_C(16); }
+    if((x & UINT32_C(0x0000FF00)) != UINT32_C(0)) { x >>=  8U; r |= UINT8_C( 8); }
+    if((x & UINT32_C(0x000000F0)) != UINT32_C(0)) { x >>=  4U; r |= UINT8_C( 4); }
+    if((x & UINT32_C(0x0000000C)) != UINT32_C(0)) { x >>=  2U; r |= UINT8_C( 2); }
+    if((x & UINT32_C(0x00000002)) != UINT32_C(0)) { x >>=  1U; r |= UINT8_C( 1); }
 
-    // Read string function.
-    bool rd_string(const char* str_input)
-    {
-      std::fill(values.begin(), values.end(), limb_type(0U));
+    return std::uint_fast32_t(r);
+  }
 
-      const std::uint_fast32_t str_length = detail::strlen_unsafe(str_input);
+  template<>
+  inline std::uint_fast32_t msb_helper(const std::uint16_t& u)
+  {
+    std::uint_fast32_t r(0);
 
-      std::uint_fast8_t base = 10U;
+    std::uint16_t x = u;
 
-      std::uint_fast32_t pos = 0U;
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT16_C(0xFF00)) != UINT16_C(0)) { x >>= 8U; r |= UINT8_C(8); }
+    if((x & UINT16_C(0x00F0)) != UINT16_C(0)) { x >>= 4U; r |= UINT8_C(4); }
+    if((x & UINT16_C(0x000C)) != UINT16_C(0)) { x >>= 2U; r |= UINT8_C(2); }
+    if((x & UINT16_C(0x0002)) != UINT16_C(0)) { x >>= 1U; r |= UINT8_C(1); }
 
-      // Skip over a potential plus sign.
-      if((str_length > 0U) && (str_input[0U] == char('+')))
-      {
-        ++pos;
-      }
+    return std::uint_fast32_t(r);
+  }
 
-      // Perform a dynamic detection of the base.
-      if(str_length > (pos + 0U))
-      {
-        const bool might_be_oct_or_hex = ((str_input[pos + 0U] == char('0')) && (str_length > (pos + 1U)));
+  template<>
+  inline std::uint_fast32_t msb_helper(const std::uint8_t& u)
+  {
+    std::uint_fast32_t r(0);
 
-        if(might_be_oct_or_hex)
-        {
-          if((str_input[pos + 1U] >= char('0')) && (str_input[pos + 1U] <= char('8')))
-          {
-            // The input format is octal.
-            base = 8U;
+    std::uint8_t x = u;
 
-            pos += 1U;
-          }
-          else if((str_input[pos + 1U] == char('x')) || (str_input[pos + 1U] == char('X')))
-          {
-            // The input format is hexadecimal.
-            base = 16U;
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT8_C(0xF0)) != UINT8_C(0)) { x >>= 4U; r |= UINT8_C(4); }
+    if((x & UINT8_C(0x0C)) != UINT8_C(0)) { x >>= 2U; r |= UINT8_C(2); }
+    if((x & UINT8_C(0x02)) != UINT8_C(0)) { x >>= 1U; r |= UINT8_C(1); }
 
-            pos += 2U;
-          }
-        }
-        else if((str_input[pos + 0U] >= char('0')) && (str_input[pos + 0U] <= char('9')))
-        {
-          // The input format is decimal.
-          ;
-        }
-      }
+    return std::uint_fast32_t(r);
+  }
 
-      bool char_is_valid = true;
+  }
 
-      for( ; ((pos < str_length) && char_is_valid); ++pos)
-      {
-        std::uint8_t c = std::uint8_t(str_input[pos]);
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  void swap(uintwide_t<Digits2, LimbType>& x,
+            uintwide_t<Digits2, LimbType>& y)
+  {
+    if(&x != &y)
+    {
+      using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
 
-        const bool char_is_apostrophe = (c == char(39));
+      const local_wide_integer_type tmp_x(x);
 
-        if(char_is_apostrophe == false)
-        {
-          if(base == 8U)
-          {
-            if  ((c >= char('0')) && (c <= char('8'))) { c -= std::uint8_t(0x30U); }
-            else                                       { char_is_valid = false; }
+      x = y;
+      y = tmp_x;
+    }
+  }
 
-            if(char_is_valid)
-            {
-              operator<<=(3);
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  std::uint_fast32_t lsb(const uintwide_t<Digits2, LimbType>& x)
+  {
+    // Calculate the position of the least-significant bit.
+    // Use a linear search starting from the least significant limbs.
 
-              values[0U] |= std::uint8_t(c);
-            }
-          }
-          else if(base == 10U)
-          {
-            if   ((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { c -= std::uint8_t(0x30U); }
-            else                                                        { char_is_valid = false; }
+    using local_wide_integer_type   = uintwide_t<Digits2, LimbType>;
+    using local_const_iterator_type = typename local_wide_integer_type::const_iterator;
+    using local_value_type          = typename local_wide_integer_type::limb_type;
 
-            if(char_is_valid)
-            {
-              mul_by_limb(10U);
+    std::uint_fast32_t bpos = 0U;
 
-              operator+=(c);
-            }
-          }
-          else if(base == 16U)
-          {
-            if     ((c >= std::uint8_t('a')) && (c <= std::uint8_t('f'))) { c -= std::uint8_t(  87U); }
-            else if((c >= std::uint8_t('A')) && (c <= std::uint8_t('F'))) { c -= std::uint8_t(  55U); }
-            else if((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { c -= std::uint8_t(0x30U); }
-            else                                                          { char_is_valid = false; }
+    for(local_const_iterator_type it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it)
+    {
+      if((*it & (std::numeric_limits<local_value_type>::max)()) != 0U)
+      {
+        const std::uint_fast32_t offset = std::uint_fast32_t(it - x.crepresentation().cbegin());
 
-            if(char_is_valid)
-            {
-              operator<<=(4);
+        bpos =   detail::lsb_helper(*it)
+               + std::uint_fast32_t(std::uint_fast32_t(std::numeric_limits<local_value_type>::digits) * offset);
 
-              values[0U] |= c;
-            }
-          }
-        }
+        break;
       }
-
-      return char_is_valid;
     }
 
-    void bitwise_not()
+    return bpos;
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  std::uint_fast32_t msb(const uintwide_t<Digits2, LimbType>& x)
+  {
+    // Calculate the position of the most-significant bit.
+    // Use a linear search starting from the most significant limbs.
+
+    using local_wide_integer_type           = uintwide_t<Digits2, LimbType>;
+    using local_const_reverse_iterator_type = typename local_wide_integer_type::const_reverse_iterator;
+    using local_value_type                  = typename local_wide_integer_type::limb_type;
+
+    std::uint_fast32_t bpos = 0U;
+
+    for(local_const_reverse_iterator_type ri = x.crepresentation().crbegin(); ri != x.crepresentation().crend(); ++ri)
     {
-      for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+      if((*ri & (std::numeric_limits<local_value_type>::max)()) != 0U)
       {
-        values[i] = limb_type(~values[i]);
+        const std::uint_fast32_t offset = std::uint_fast32_t((x.crepresentation().crend() - 1U) - ri);
+
+        bpos =   detail::msb_helper(*ri)
+               + std::uint_fast32_t(std::uint_fast32_t(std::numeric_limits<local_value_type>::digits) * offset);
+
+        break;
       }
     }
 
-    void preincrement()
+    return bpos;
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> sqrt(const uintwide_t<Digits2, LimbType>& m)
+  {
+    // Calculate the square root.
+
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
+                                              m.crepresentation().cend(),
+                                              [](const local_limb_type& a) -> bool
+                                              {
+                                                return (a == 0U);
+                                              });
+
+    local_wide_integer_type s;
+
+    if(argument_is_zero)
     {
-      // Implement pre-increment.
-      std::uint_fast32_t i = 0U;
+      s = local_wide_integer_type(std::uint_fast8_t(0U));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const std::uint_fast32_t msb_pos = msb(m);
 
-      for( ; (i < (values.size() - 1U)) && (++values[i] == limb_type(0U)); ++i)
-      {
-        ;
-      }
+      // Obtain the initial value.
+      const std::uint_fast32_t left_shift_amount =
+        ((std::uint_fast32_t(msb_pos % 2U) == 0U)
+          ? 1U + std::uint_fast32_t((msb_pos + 0U) / 2U)
+          : 1U + std::uint_fast32_t((msb_pos + 1U) / 2U));
 
-      if(i == (values.size() - 1U))
-      {
-        ++values[i];
-      }
-    }
+      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
 
-    void predecrement()
-    {
-      // Implement pre-decrement.
-      std::uint_fast32_t i = 0U;
+      // Perform the iteration for the square root.
+      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
 
-      for( ; (i < (values.size() - 1U)) && (values[i]-- == limb_type(0U)); ++i)
+      for(std::uint_fast32_t i = 0U; i < 64U; ++i)
       {
-        ;
-      }
+        s = u;
 
-      if(i == (values.size() - 1U))
-      {
-        --values[i];
+        u = (s + (m / s)) >> 1;
+
+        if(u >= s)
+        {
+          break;
+        }
       }
     }
 
-    bool is_zero() const
-    {
-      return std::all_of(values.cbegin(),
-                         values.cend(),
-                         [](const limb_type& u) -> bool
-                         {
-                           return (u == limb_type(0U));
-                         });
-    }
-  };
+    return s;
+  }
 
-  // Define some convenient unsigned wide integer types.
-  using uint64_t    = uintwide_t<   64U, std::uint16_t>;
-  using uint128_t   = uintwide_t<  128U, std::uint32_t>;
-  using uint256_t   = uintwide_t<  256U, std::uint32_t>;
-  using uint512_t   = uintwide_t<  512U, std::uint32_t>;
-  using uint1024_t  = uintwide_t< 1024U, std::uint32_t>;
-  using uint2048_t  = uintwide_t< 2048U, std::uint32_t>;
-  using uint4096_t  = uintwide_t< 4096U, std::uint32_t>;
-  using uint8192_t  = uintwide_t< 8192U, std::uint32_t>;
-  using uint16384_t = uintwide_t<16384U, std::uint32_t>;
-  using uint32768_t = uintwide_t<32768U, std::uint32_t>;
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> cbrt(const uintwide_t<Digits2, LimbType>& m)
+  {
+    // Calculate the cube root.
 
-  // Insert a base class for numeric_limits<> support.
-  // This class inherits from std::numeric_limits<unsigned int>
-  // in order to provide limits for a non-specific unsigned type.
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-  template<typename WideUnsignedIntegerType>
-  class numeric_limits_uintwide_t_base : public std::numeric_limits<unsigned int>
-  {
-  private:
-    using local_wide_integer_type = WideUnsignedIntegerType;
+    local_wide_integer_type s;
 
-  public:
-    static constexpr int digits   = static_cast<int>(local_wide_integer_type::my_digits);
-    static constexpr int digits10 = static_cast<int>(local_wide_integer_type::my_digits10);
+    const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
+                                              m.crepresentation().cend(),
+                                              [](const local_limb_type& a) -> bool
+                                              {
+                                                return (a == 0U);
+                                              });
 
-    static local_wide_integer_type (max)() { return local_wide_integer_type::limits_helper_max(); }
-    static local_wide_integer_type (min)() { return local_wide_integer_type::limits_helper_min(); }
-  };
+    if(argument_is_zero)
+    {
+      s = local_wide_integer_type(std::uint_fast8_t(0U));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const std::uint_fast32_t msb_pos = msb(m);
 
-  template<class T>
-  struct is_integral : public std::is_integral<T> { };
+      // Obtain the initial value.
+      const std::uint_fast32_t msb_pos_mod_3 = msb_pos % 3;
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  struct is_integral<wide_integer::generic_template::uintwide_t<Digits2, LimbType>>
-    : public std::integral_constant<bool, true> { };
+      const std::uint_fast32_t left_shift_amount =
+        ((msb_pos_mod_3 == 0U)
+          ? 1U + std::uint_fast32_t((msb_pos +                  0U ) / 3U)
+          : 1U + std::uint_fast32_t((msb_pos + (3U - msb_pos_mod_3)) / 3U));
 
-  } } // namespace wide_integer::generic_template
+      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
 
-  namespace std
-  {
-    // Specialization of std::numeric_limits<uintwide_t>.
-    template<const std::uint_fast32_t Digits2,
-             typename LimbType>
-    class numeric_limits<wide_integer::generic_template::uintwide_t<Digits2, LimbType>>
-      : public wide_integer::generic_template::numeric_limits_uintwide_t_base<wide_integer::generic_template::uintwide_t<Digits2, LimbType>> { };
-  }
+      // Perform the iteration for the k'th root.
+      // See Algorithm 1.14 RootInt, Sect. 1.5.2
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
 
-  namespace wide_integer { namespace generic_template {
+      const std::uint_fast32_t three_minus_one(3U - 1U);
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator+ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator+=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator- (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator-=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator* (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator*=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator/ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator/=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator% (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator%=(right); }
+      for(std::uint_fast32_t i = 0U; i < 64U; ++i)
+      {
+        s = u;
 
-  // Non-member binary logic operations of (uintwide_t op uintwide_t).
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator| (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator|=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator^ (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator^=(right); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> uintwide_t<Digits2, LimbType> operator& (const uintwide_t<Digits2, LimbType>& left, const uintwide_t<Digits2, LimbType>& right) { return uintwide_t<Digits2, LimbType>(left).operator&=(right); }
+        local_wide_integer_type m_over_s_pow_3_minus_one = m;
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator+(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator+=(uintwide_t<Digits2, LimbType>(v)); }
+        for(std::uint_fast32_t j = 0U; j < 3U - 1U; ++j)
+        {
+          // Use a loop here to divide by s^(3 - 1) because
+          // without a loop, s^(3 - 1) is likely to overflow.
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator-(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator-=(uintwide_t<Digits2, LimbType>(v)); }
+          m_over_s_pow_3_minus_one /= s;
+        }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator*(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v)
-  {
-    // TBD: Make separate functions for signed/unsigned IntegralType.
-    // TBD: And subsequently use the optimized mul_by_limb function where appropriate.
-    return uintwide_t<Digits2, LimbType>(u).operator*=(uintwide_t<Digits2, LimbType>(v));
-  }
+        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / 3U;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator/(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator/=(uintwide_t<Digits2, LimbType>(v)); }
+        if(u >= s)
+        {
+          break;
+        }
+      }
+    }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == false)), uintwide_t<Digits2, LimbType>>::type
-  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(uintwide_t<Digits2, LimbType>(v)); }
+    return s;
+  }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == true)
-                           && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)), typename uintwide_t<Digits2, LimbType>::limb_type>::type
-  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v)
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> rootk(const uintwide_t<Digits2, LimbType>& m,
+                                      const std::uint_fast8_t k)
   {
-    uintwide_t<Digits2, LimbType> remainder;
+    // Calculate the k'th root.
 
-    uintwide_t<Digits2, LimbType>(u).eval_divide_by_single_limb(v, 0U, &remainder);
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-    using local_limb_type = typename uintwide_t<Digits2, LimbType>::limb_type;
+    local_wide_integer_type s;
 
-    return local_limb_type(remainder);
-  }
+    if(k < 2U)
+    {
+      s = m;
+    }
+    else if(k == 2U)
+    {
+      s = sqrt(m);
+    }
+    else
+    {
+      const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
+                                                m.crepresentation().cend(),
+                                                [](const local_limb_type& a) -> bool
+                                                {
+                                                  return (a == 0U);
+                                                });
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)
-                           && (std::is_unsigned   <IntegralType>::value == true)
-                           && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)), uintwide_t<Digits2, LimbType>>::type
-  operator%(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(uintwide_t<Digits2, LimbType>(v)); }
+      if(argument_is_zero)
+      {
+        s = local_wide_integer_type(std::uint_fast8_t(0U));
+      }
+      else
+      {
+        // Obtain the initial guess via algorithms
+        // involving the position of the msb.
+        const std::uint_fast32_t msb_pos = msb(m);
 
-  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator+(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator+=(v); }
+        // Obtain the initial value.
+        const std::uint_fast32_t msb_pos_mod_k = msb_pos % k;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator-(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator-=(v); }
+        const std::uint_fast32_t left_shift_amount =
+          ((msb_pos_mod_k == 0U)
+            ? 1U + std::uint_fast32_t((msb_pos +                 0U ) / k)
+            : 1U + std::uint_fast32_t((msb_pos + (k - msb_pos_mod_k)) / k));
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator*(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v)
-  {
-    // TBD: Make separate functions for signed/unsigned IntegralType.
-    // TBD: And subsequently use the optimized mul_by_limb function where appropriate.
-    return uintwide_t<Digits2, LimbType>(u).operator*=(v);
-  }
+        local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator/(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator/=(v); }
+        // Perform the iteration for the k'th root.
+        // See Algorithm 1.14 RootInt, Sect. 1.5.2
+        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press, 2011.
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator%(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator%=(v); }
+        const std::uint_fast32_t k_minus_one(k - 1U);
 
-  // Non-member binary logic operations of (uintwide_t op IntegralType).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator|(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator|=(uintwide_t<Digits2, LimbType>(v)); }
+        for(std::uint_fast32_t i = 0U; i < 64U; ++i)
+        {
+          s = u;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator^(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator^=(uintwide_t<Digits2, LimbType>(v)); }
+          local_wide_integer_type m_over_s_pow_k_minus_one = m;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator&(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return uintwide_t<Digits2, LimbType>(u).operator&=(uintwide_t<Digits2, LimbType>(v)); }
+          for(std::uint_fast32_t j = 0U; j < k - 1U; ++j)
+          {
+            // Use a loop here to divide by s^(k - 1) because
+            // without a loop, s^(k - 1) is likely to overflow.
 
-  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator|(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator|=(v); }
+            m_over_s_pow_k_minus_one /= s;
+          }
+
+          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+
+          if(u >= s)
+          {
+            break;
+          }
+        }
+      }
+    }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator^(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator^=(v); }
+    return s;
+  }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator&(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator&=(v); }
+  template<typename OtherUnsignedIntegralTypeP,
+           const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> pow(const uintwide_t<Digits2, LimbType>& b,
+                                    const OtherUnsignedIntegralTypeP&    p)
+  {
+    // Calculate (b ^ p).
 
-  // Non-member shift functions of (uintwide_t shift IntegralType).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator<<(const uintwide_t<Digits2, LimbType>& u, const IntegralType n) { return uintwide_t<Digits2, LimbType>(u).operator<<=(n); }
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), uintwide_t<Digits2, LimbType>>::type
-  operator>>(const uintwide_t<Digits2, LimbType>& u, const IntegralType n) { return uintwide_t<Digits2, LimbType>(u).operator>>=(n); }
+    local_wide_integer_type result;
 
-  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator==(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator==(v); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator!=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator!=(v); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator> (const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator> (v); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator< (const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator< (v); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator>=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator>=(v); }
-  template<const std::uint_fast32_t Digits2, typename LimbType> bool operator<=(const uintwide_t<Digits2, LimbType>& u, const uintwide_t<Digits2, LimbType>& v) { return u.operator<=(v); }
+    const OtherUnsignedIntegralTypeP zero(std::uint8_t(0U));
 
-  // Non-member comparison functions of (uintwide_t cmp IntegralType).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator==(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator==(uintwide_t<Digits2, LimbType>(v)); }
+    if(p == zero)
+    {
+      result = local_wide_integer_type(std::uint8_t(1U));
+    }
+    else if(p == 1U)
+    {
+      result = b;
+    }
+    else if(p == 2U)
+    {
+      result  = b;
+      result *= b;
+    }
+    else
+    {
+      result = local_wide_integer_type(std::uint8_t(1U));
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator!=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator!=(uintwide_t<Digits2, LimbType>(v)); }
+      local_wide_integer_type y      (b);
+      local_wide_integer_type p_local(p);
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator> (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator> (uintwide_t<Digits2, LimbType>(v)); }
+      while(!(p_local == zero))
+      {
+        if(std::uint_fast8_t(p_local) & 1U)
+        {
+          result *= y;
+        }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator< (const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator< (uintwide_t<Digits2, LimbType>(v)); }
+        y *= y;
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator>=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator>=(uintwide_t<Digits2, LimbType>(v)); }
+        p_local >>= 1;
+      }
+    }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator<=(const uintwide_t<Digits2, LimbType>& u, const IntegralType& v) { return u.operator<=(uintwide_t<Digits2, LimbType>(v)); }
+    return result;
+  }
 
-  // Non-member comparison functions of (IntegralType cmp uintwide_t).
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator==(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator==(v); }
+  namespace detail {
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator!=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator!=(v); }
+  template<typename LimbType,
+           const std::size_t LimbCount,
+           typename OtherUnsignedIntegralTypeP>
+  typename std::enable_if<(std::numeric_limits<OtherUnsignedIntegralTypeP>::digits <= std::numeric_limits<LimbType>::digits)>::type
+  extract_exponent_limbs(std::array<LimbType, LimbCount>& e, const OtherUnsignedIntegralTypeP& p)
+  {
+    // The exponent fits within one single limb.
+    e.fill(LimbType(0U));
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator> (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator> (v); }
+    e[0U] = static_cast<LimbType>(p);
+  }
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator< (const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator< (v); }
+  template<typename LimbType,
+           const std::size_t LimbCount,
+           typename OtherUnsignedIntegralTypeP>
+  typename std::enable_if<(std::numeric_limits<OtherUnsignedIntegralTypeP>::digits > std::numeric_limits<LimbType>::digits)>::type
+  extract_exponent_limbs(std::array<LimbType, LimbCount>& e, const OtherUnsignedIntegralTypeP& p)
+  {
+    // The exponent is wider than one single limb.
+    // Extract its limbs in order of increasing significance.
+    OtherUnsignedIntegralTypeP p_local(p);
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator>=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator>=(v); }
+    for(std::size_t i = 0U; i < LimbCount; ++i)
+    {
+      e[i] = static_cast<LimbType>(p_local);
 
-  template<typename IntegralType, const std::uint_fast32_t Digits2, typename LimbType>
-  typename std::enable_if<(   (std::is_fundamental<IntegralType>::value == true)
-                           && (std::is_integral   <IntegralType>::value == true)), bool>::type
-  operator<=(const IntegralType& u, const uintwide_t<Digits2, LimbType>& v) { return uintwide_t<Digits2, LimbType>(u).operator<=(v); }
+      p_local >>= std::numeric_limits<LimbType>::digits;
+    }
+  }
 
-  #if defined(WIDE_INTEGER_DISABLE_IOSTREAM)
-  #else
+  }
 
-  // I/O streaming functions.
-  template<typename char_type,
-           typename traits_type,
-           const std::uint_fast32_t Digits2,
+  template<const std::uint_fast32_t Digits2,
            typename LimbType>
-  std::basic_ostream<char_type, traits_type>&
-  operator<<(std::basic_ostream<char_type, traits_type>& out,
-             const uintwide_t<Digits2, LimbType>& x)
+  class montgomery_context
   {
-    std::basic_ostringstream<char_type, traits_type> ostr;
+  public:
+    // This class precomputes the quantities needed for Montgomery
+    // multiplication with a fixed, odd modulus n. These are
+    // n' = -n^-1 mod b (where b is the limb base) and R^2 mod n,
+    // where R = 2^Digits2. Montgomery products are computed with
+    // a full multiplication followed by a separated REDC step.
+
+    // See also "Algorithm 2.6 REDC" and "Algorithm 2.7 MontgomeryMul",
+    // Sect. 2.4.2 in R.P. Brent and P. Zimmermann, "Modern Computer
+    // Arithmetic", Cambridge University Press (2011).
+
+    using wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using limb_type         = typename wide_integer_type::limb_type;
+    using double_limb_type  = typename wide_integer_type::double_limb_type;
+
+    static constexpr std::uint_fast32_t number_of_limbs = wide_integer_type::number_of_limbs;
+
+    // The maximum width of the window used in sliding-window
+    // exponentiation. A window of width w needs a table
+    // of 2^(w - 1) precomputed odd powers.
+    static constexpr std::uint_fast32_t window_bits_max = 4U;
+
+    explicit montgomery_context(const wide_integer_type& n)
+      : my_n       (n),
+        my_n_prime (eval_n_prime(n.crepresentation()[0U])),
+        my_r_mod_n (),
+        my_r2_mod_n()
+    {
+      using local_double_width_type = typename wide_integer_type::double_width_type;
 
-    const std::ios::fmtflags my_flags = out.flags();
+      // Calculate R mod n and R^2 mod n using the double-width type.
+      const local_double_width_type n_dw(n);
 
-    const bool show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
-    const bool show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
-    const bool is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+      local_double_width_type r_dw(std::uint8_t(1U));
 
-    std::uint_fast8_t base_rep;
+      r_dw <<= Digits2;
+      r_dw  %= n_dw;
 
-    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep =  8U; }
-    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = 16U; }
-    else                                                 { base_rep = 10U; }
+      my_r_mod_n = wide_integer_type(r_dw);
 
-    const std::uint_fast32_t field_width = std::uint_fast32_t(out.width());
-    const char               fill_char   = out.fill();
+      r_dw *= r_dw;
+      r_dw %= n_dw;
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+      my_r2_mod_n = wide_integer_type(r_dw);
+    }
 
-    if(base_rep == 8U)
-    {
-      char str_result[local_wide_integer_type::wr_string_max_buffer_size_oct];
+    montgomery_context(const montgomery_context& other)
+      : my_n       (other.my_n),
+        my_n_prime (other.my_n_prime),
+        my_r_mod_n (other.my_r_mod_n),
+        my_r2_mod_n(other.my_r2_mod_n) { }
 
-      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+    ~montgomery_context() = default;
 
-      static_cast<void>(ostr << str_result);
-    }
-    else if(base_rep == 10U)
-    {
-      char str_result[local_wide_integer_type::wr_string_max_buffer_size_dec];
+    montgomery_context& operator=(const montgomery_context&) = delete;
 
-      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+    const wide_integer_type& modulus() const { return my_n; }
 
-      static_cast<void>(ostr << str_result);
+    // The representation of one in Montgomery form, which is R mod n.
+    const wide_integer_type& one() const { return my_r_mod_n; }
+
+    // Convert a into Montgomery form, in other words a * R mod n.
+    // The argument a is allowed to have any value less than R.
+    wide_integer_type to_montgomery(const wide_integer_type& a) const
+    {
+      return multiply(a, my_r2_mod_n);
     }
-    else if(base_rep == 16U)
+
+    // Convert a out of Montgomery form, in other words a * R^-1 mod n.
+    wide_integer_type from_montgomery(const wide_integer_type& a) const
     {
-      char str_result[local_wide_integer_type::wr_string_max_buffer_size_hex];
+      std::array<limb_type, (number_of_limbs * 2U) + 1U> t;
 
-      x.wr_string(str_result, base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+      std::copy(a.crepresentation().cbegin(), a.crepresentation().cend(), t.begin());
+      std::fill(t.begin() + number_of_limbs, t.end(), limb_type(0U));
 
-      static_cast<void>(ostr << str_result);
-    }
+      wide_integer_type result;
 
-    return (out << ostr.str());
-  }
+      eval_redc(result.representation().data(), t.data());
 
-  template<typename char_type,
-           typename traits_type,
-           const std::uint_fast32_t Digits2,
-           typename LimbType>
-  std::basic_istream<char_type, traits_type>&
-  operator>>(std::basic_istream<char_type, traits_type>& in,
-             uintwide_t<Digits2, LimbType>& x)
-  {
-    std::string str_in;
+      return result;
+    }
 
-    in >> str_in;
+    // Calculate the Montgomery product a * b * R^-1 mod n.
+    wide_integer_type multiply(const wide_integer_type& a, const wide_integer_type& b) const
+    {
+      std::array<limb_type, (number_of_limbs * 2U) + 1U> t;
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+      detail::eval_multiply_limbs_lo(t.data(),
+                                     number_of_limbs * 2U,
+                                     a.crepresentation().data(),
+                                     number_of_limbs,
+                                     b.crepresentation().data(),
+                                     number_of_limbs);
 
-    x = local_wide_integer_type(str_in.c_str());
+      t.back() = limb_type(0U);
 
-    return in;
-  }
+      wide_integer_type result;
 
-  #endif
+      eval_redc(result.representation().data(), t.data());
 
-  } } // namespace wide_integer::generic_template
+      return result;
+    }
 
-  // Implement various number-theoretical tools.
+    // Calculate the Montgomery square a * a * R^-1 mod n.
+    wide_integer_type square(const wide_integer_type& a) const
+    {
+      std::array<limb_type, (number_of_limbs * 2U) + 1U> t;
 
-  namespace wide_integer { namespace generic_template {
+      eval_square_n_to_2n(t.data(), a.crepresentation().data());
 
-  namespace detail {
+      t.back() = limb_type(0U);
 
-  template<typename UnsignedIntegralType>
-  inline std::uint_fast32_t lsb_helper(const UnsignedIntegralType& x)
-  {
-    // Compile-time checks.
-    static_assert((   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                   && (std::is_integral<UnsignedIntegralType>::value    == true)
-                   && (std::is_unsigned<UnsignedIntegralType>::value    == true)),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+      wide_integer_type result;
 
-    std::uint_fast32_t result = 0U;
+      eval_redc(result.representation().data(), t.data());
 
-    UnsignedIntegralType mask(x);
+      return result;
+    }
 
-    // This assumes that at least one bit is set.
-    // Otherwise saturation of the index will occur.
+    // Calculate (b ^ p) % n. Both b and the result are in normal form.
+    template<typename OtherUnsignedIntegralTypeP>
+    wide_integer_type powm(const wide_integer_type& b, const OtherUnsignedIntegralTypeP& p) const
+    {
+      return from_montgomery(powm_montgomery(to_montgomery(b), p));
+    }
 
-    // Naive and basic LSB search.
-    // TBD: This could be improved with a binary search
-    // on the lowest bit position of the fundamental type.
-    while((std::uint_fast32_t(mask) & 1U) == 0U)
+    // Calculate (b ^ p) % n using left-to-right sliding-window
+    // exponentiation. Both b and the result are in Montgomery form.
+    template<typename OtherUnsignedIntegralTypeP>
+    wide_integer_type powm_montgomery(const wide_integer_type& b, const OtherUnsignedIntegralTypeP& p) const
     {
-      mask >>= 1U;
+      constexpr std::uint_fast32_t limb_digits = std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
 
-      ++result;
-    }
+      constexpr std::uint_fast32_t exponent_digits =
+        std::uint_fast32_t(std::numeric_limits<OtherUnsignedIntegralTypeP>::digits);
 
-    return result;
-  }
+      constexpr std::size_t exponent_limbs =
+        std::size_t((exponent_digits + (limb_digits - 1U)) / limb_digits);
 
-  template<typename UnsignedIntegralType>
-  inline std::uint_fast32_t msb_helper(const UnsignedIntegralType& u)
-  {
-    // Compile-time checks.
-    static_assert((   (std::is_fundamental<UnsignedIntegralType>::value == true)
-                   && (std::is_integral<UnsignedIntegralType>::value    == true)
-                   && (std::is_unsigned<UnsignedIntegralType>::value    == true)),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+      std::array<limb_type, exponent_limbs> e;
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+      detail::extract_exponent_limbs(e, p);
 
-    std::int_fast32_t i;
+      const auto exponent_bit =
+        [&e](const std::int_fast32_t i) -> std::uint_fast8_t
+        {
+          return std::uint_fast8_t(   e[std::size_t(std::uint_fast32_t(i) / limb_digits)]
+                                   >> (std::uint_fast32_t(i) % limb_digits)) & 1U;
+        };
 
-    // TBD: This could potentially be improved with a binary
-    // search for the highest bit position in the type.
+      std::int_fast32_t i = std::int_fast32_t(exponent_limbs * limb_digits) - 1;
 
-    for(i = std::int_fast32_t(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= 0; --i)
-    {
-      if((u & UnsignedIntegralType(local_unsigned_integral_type(1U) << i)) != 0U)
+      while((i >= 0) && (exponent_bit(i) == 0U))
       {
-        break;
+        --i;
       }
-    }
 
-    return std::uint_fast32_t((std::max)(std::int_fast32_t(0), i));
-  }
+      const std::uint_fast32_t exponent_bit_count = std::uint_fast32_t(i + 1);
 
-  template<>
-  inline std::uint_fast32_t msb_helper(const std::uint32_t& u)
-  {
-    std::uint_fast32_t r(0);
+      // Select the window width from the length of the exponent.
+      const std::uint_fast32_t window_bits =
+        std::uint_fast32_t((exponent_bit_count > 79U) ? window_bits_max
+                         : (exponent_bit_count > 23U) ? 3U
+                         : (exponent_bit_count >  1U) ? 2U : 1U);
 
-    std::uint32_t x = u;
+      // Precompute the odd powers b^1, b^3, ..., b^(2^w - 1) in Montgomery form.
+      // The array is value-initialized, since narrow windows use only
+      // part of it, which GCC may otherwise report as uninitialized.
+      std::array<wide_integer_type, std::size_t(1U) << (window_bits_max - 1U)> odd_powers { };
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT32_C(0xFFFF0000)) != UINT32_C(0)) { x >>= 16U; r |= UINT8_C(16); }
-    if((x & UINT32_C(0x0000FF00)) != UINT32_C(0)) { x >>=  8U; r |= UINT8_C( 8); }
-    if((x & UINT32_C(0x000000F0)) != UINT32_C(0)) { x >>=  4U; r |= UINT8_C( 4); }
-    if((x & UINT32_C(0x0000000C)) != UINT32_C(0)) { x >>=  2U; r |= UINT8_C( 2); }
-    if((x & UINT32_C(0x00000002)) != UINT32_C(0)) { x >>=  1U; r |= UINT8_C( 1); }
+      odd_powers[0U] = b;
 
-    return std::uint_fast32_t(r);
-  }
+      const std::size_t odd_power_count = std::size_t(1U) << (window_bits - 1U);
 
-  template<>
-  inline std::uint_fast32_t msb_helper(const std::uint16_t& u)
-  {
-    std::uint_fast32_t r(0);
+      if(odd_power_count > 1U)
+      {
+        const wide_integer_type b2 = square(odd_powers[0U]);
 
-    std::uint16_t x = u;
+        for(std::size_t k = 1U; k < odd_power_count; ++k)
+        {
+          odd_powers[k] = multiply(odd_powers[k - 1U], b2);
+        }
+      }
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT16_C(0xFF00)) != UINT16_C(0)) { x >>= 8U; r |= UINT8_C(8); }
-    if((x & UINT16_C(0x00F0)) != UINT16_C(0)) { x >>= 4U; r |= UINT8_C(4); }
-    if((x & UINT16_C(0x000C)) != UINT16_C(0)) { x >>= 2U; r |= UINT8_C(2); }
-    if((x & UINT16_C(0x0002)) != UINT16_C(0)) { x >>= 1U; r |= UINT8_C(1); }
+      wide_integer_type x = my_r_mod_n;
 
-    return std::uint_fast32_t(r);
-  }
+      bool x_is_one = true;
 
-  template<>
-  inline std::uint_fast32_t msb_helper(const std::uint8_t& u)
-  {
-    std::uint_fast32_t r(0);
+      while(i >= 0)
+      {
+        if(exponent_bit(i) == 0U)
+        {
+          if(x_is_one == false) { x = square(x); }
 
-    std::uint8_t x = u;
+          --i;
+        }
+        else
+        {
+          // Find the longest window ending in a set bit.
+          std::int_fast32_t lo = (std::max)(std::int_fast32_t(i + 1) - std::int_fast32_t(window_bits), std::int_fast32_t(0));
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT8_C(0xF0)) != UINT8_C(0)) { x >>= 4U; r |= UINT8_C(4); }
-    if((x & UINT8_C(0x0C)) != UINT8_C(0)) { x >>= 2U; r |= UINT8_C(2); }
-    if((x & UINT8_C(0x02)) != UINT8_C(0)) { x >>= 1U; r |= UINT8_C(1); }
+          while(exponent_bit(lo) == 0U)
+          {
+            ++lo;
+          }
 
-    return std::uint_fast32_t(r);
-  }
+          std::uint_fast32_t window_value = 0U;
 
-  }
+          for(std::int_fast32_t j = i; j >= lo; --j)
+          {
+            window_value = std::uint_fast32_t(window_value << 1U) | exponent_bit(j);
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  void swap(uintwide_t<Digits2, LimbType>& x,
-            uintwide_t<Digits2, LimbType>& y)
-  {
-    if(&x != &y)
-    {
-      using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+            if(x_is_one == false) { x = square(x); }
+          }
 
-      const local_wide_integer_type tmp_x(x);
+          if(x_is_one)
+          {
+            x = odd_powers[window_value >> 1U];
 
-      x = y;
-      y = tmp_x;
-    }
-  }
+            x_is_one = false;
+          }
+          else
+          {
+            x = multiply(x, odd_powers[window_value >> 1U]);
+          }
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  std::uint_fast32_t lsb(const uintwide_t<Digits2, LimbType>& x)
-  {
-    // Calculate the position of the least-significant bit.
-    // Use a linear search starting from the least significant limbs.
+          i = lo - 1;
+        }
+      }
 
-    using local_wide_integer_type   = uintwide_t<Digits2, LimbType>;
-    using local_const_iterator_type = typename local_wide_integer_type::const_iterator;
-    using local_value_type          = typename local_wide_integer_type::limb_type;
+      return x;
+    }
 
-    std::uint_fast32_t bpos = 0U;
+  private:
+    const wide_integer_type my_n;
+    const limb_type         my_n_prime;
+          wide_integer_type my_r_mod_n;
+          wide_integer_type my_r2_mod_n;
 
-    for(local_const_iterator_type it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it)
+    static limb_type eval_n_prime(const limb_type n0)
     {
-      if((*it & (std::numeric_limits<local_value_type>::max)()) != 0U)
+      // Compute -n0^-1 mod b with a Newton iteration. The initial
+      // guess n0 is correct to 3 bits because n0 is odd, and each
+      // iteration doubles the number of correct bits.
+      limb_type inv = n0;
+
+      for(std::uint_fast32_t correct_bits = 3U;
+                             correct_bits < std::uint_fast32_t(std::numeric_limits<limb_type>::digits);
+                             correct_bits *= 2U)
       {
-        const std::uint_fast32_t offset = std::uint_fast32_t(it - x.crepresentation().cbegin());
-
-        bpos =   detail::lsb_helper(*it)
-               + std::uint_fast32_t(std::uint_fast32_t(std::numeric_limits<local_value_type>::digits) * offset);
+        const limb_type n0_times_inv = limb_type(double_limb_type(n0) * inv);
 
-        break;
+        inv = limb_type(double_limb_type(inv) * limb_type(limb_type(2U) - n0_times_inv));
       }
+
+      return limb_type(limb_type(0U) - inv);
     }
 
-    return bpos;
-  }
+    static void eval_square_n_to_2n(limb_type* r, const limb_type* a)
+    {
+      // Squaring needs only the products a[i] * a[j] with i < j,
+      // which are doubled, followed by adding the diagonal squares.
+      std::fill(r, r + (number_of_limbs * 2U), limb_type(0U));
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  std::uint_fast32_t msb(const uintwide_t<Digits2, LimbType>& x)
-  {
-    // Calculate the position of the most-significant bit.
-    // Use a linear search starting from the most significant limbs.
+      for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+      {
+        double_limb_type carry = 0U;
 
-    using local_wide_integer_type           = uintwide_t<Digits2, LimbType>;
-    using local_const_reverse_iterator_type = typename local_wide_integer_type::const_reverse_iterator;
-    using local_value_type                  = typename local_wide_integer_type::limb_type;
+        if(a[i] != limb_type(0U))
+        {
+          for(std::uint_fast32_t j = i + 1U; j < number_of_limbs; ++j)
+          {
+            carry += double_limb_type(double_limb_type(a[i]) * a[j]);
+            carry += r[i + j];
 
-    std::uint_fast32_t bpos = 0U;
+            r[i + j] = limb_type(carry);
+            carry    = detail::make_hi<limb_type>(carry);
+          }
+        }
 
-    for(local_const_reverse_iterator_type ri = x.crepresentation().crbegin(); ri != x.crepresentation().crend(); ++ri)
-    {
-      if((*ri & (std::numeric_limits<local_value_type>::max)()) != 0U)
+        r[i + number_of_limbs] = limb_type(carry);
+      }
+
+      // Double the off-diagonal sum.
+      limb_type part_from_previous_value = limb_type(0U);
+
+      for(std::uint_fast32_t i = 0U; i < (number_of_limbs * 2U); ++i)
       {
-        const std::uint_fast32_t offset = std::uint_fast32_t((x.crepresentation().crend() - 1U) - ri);
+        const limb_type t = r[i];
 
-        bpos =   detail::msb_helper(*ri)
-               + std::uint_fast32_t(std::uint_fast32_t(std::numeric_limits<local_value_type>::digits) * offset);
+        r[i] = limb_type(limb_type(t << 1U) | part_from_previous_value);
 
-        break;
+        part_from_previous_value = limb_type(t >> (std::numeric_limits<limb_type>::digits - 1));
       }
-    }
 
-    return bpos;
-  }
+      // Add the diagonal squares.
+      double_limb_type carry = 0U;
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  uintwide_t<Digits2, LimbType> sqrt(const uintwide_t<Digits2, LimbType>& m)
-  {
-    // Calculate the square root.
+      for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+      {
+        const double_limb_type a_i_squared = double_limb_type(double_limb_type(a[i]) * a[i]);
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+        carry += detail::make_lo<limb_type>(a_i_squared);
+        carry += r[(i * 2U) + 0U];
 
-    const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
-                                              m.crepresentation().cend(),
-                                              [](const local_limb_type& a) -> bool
-                                              {
-                                                return (a == 0U);
-                                              });
+        r[(i * 2U) + 0U] = limb_type(carry);
+        carry            = detail::make_hi<limb_type>(carry);
 
-    local_wide_integer_type s;
+        carry += detail::make_hi<limb_type>(a_i_squared);
+        carry += r[(i * 2U) + 1U];
 
-    if(argument_is_zero)
-    {
-      s = local_wide_integer_type(std::uint_fast8_t(0U));
+        r[(i * 2U) + 1U] = limb_type(carry);
+        carry            = detail::make_hi<limb_type>(carry);
+      }
     }
-    else
+
+    void eval_redc(limb_type* r, limb_type* t) const
     {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const std::uint_fast32_t msb_pos = msb(m);
+      // Reduce t having (2n + 1) limbs, where t < n * R,
+      // and store t * R^-1 mod n in r having n limbs.
 
-      // Obtain the initial value.
-      const std::uint_fast32_t left_shift_amount =
-        ((std::uint_fast32_t(msb_pos % 2U) == 0U)
-          ? 1U + std::uint_fast32_t((msb_pos + 0U) / 2U)
-          : 1U + std::uint_fast32_t((msb_pos + 1U) / 2U));
+      const limb_type* n = my_n.crepresentation().data();
 
-      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+      for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+      {
+        const limb_type m = limb_type(double_limb_type(t[i]) * my_n_prime);
 
-      // Perform the iteration for the square root.
-      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+        double_limb_type carry = 0U;
 
-      for(std::uint_fast32_t i = 0U; i < 64U; ++i)
-      {
-        s = u;
+        for(std::uint_fast32_t j = 0U; j < number_of_limbs; ++j)
+        {
+          carry += double_limb_type(double_limb_type(m) * n[j]);
+          carry += t[i + j];
 
-        u = (s + (m / s)) >> 1;
+          t[i + j] = limb_type(carry);
+          carry    = detail::make_hi<limb_type>(carry);
+        }
 
-        if(u >= s)
+        for(std::uint_fast32_t k = i + number_of_limbs; ((k <= (number_of_limbs * 2U)) && (carry != 0U)); ++k)
         {
-          break;
+          carry += t[k];
+
+          t[k]  = limb_type(carry);
+          carry = detail::make_hi<limb_type>(carry);
         }
       }
-    }
 
-    return s;
-  }
+      // The upper part of t is less than 2n. Use at most one
+      // subtraction of n in order to obtain the result.
+      const limb_type* t_hi = t + number_of_limbs;
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  uintwide_t<Digits2, LimbType> cbrt(const uintwide_t<Digits2, LimbType>& m)
-  {
-    // Calculate the cube root.
+      bool t_hi_is_greater_than_or_equal_to_n = (t_hi[number_of_limbs] != limb_type(0U));
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+      if(t_hi_is_greater_than_or_equal_to_n == false)
+      {
+        std::int_fast32_t element_index = std::int_fast32_t(number_of_limbs) - 1;
 
-    local_wide_integer_type s;
+        while((element_index >= 0) && (t_hi[element_index] == n[element_index]))
+        {
+          --element_index;
+        }
 
-    const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
-                                              m.crepresentation().cend(),
-                                              [](const local_limb_type& a) -> bool
-                                              {
-                                                return (a == 0U);
-                                              });
+        t_hi_is_greater_than_or_equal_to_n = ((element_index < 0) || (t_hi[element_index] > n[element_index]));
+      }
 
-    if(argument_is_zero)
-    {
-      s = local_wide_integer_type(std::uint_fast8_t(0U));
-    }
-    else
-    {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const std::uint_fast32_t msb_pos = msb(m);
+      if(t_hi_is_greater_than_or_equal_to_n)
+      {
+        bool has_borrow = false;
 
-      // Obtain the initial value.
-      const std::uint_fast32_t msb_pos_mod_3 = msb_pos % 3;
+        for(std::uint_fast32_t i = 0U; i < number_of_limbs; ++i)
+        {
+          double_limb_type uv_as_ularge = double_limb_type(t_hi[i]) - n[i];
 
-      const std::uint_fast32_t left_shift_amount =
-        ((msb_pos_mod_3 == 0U)
-          ? 1U + std::uint_fast32_t((msb_pos +                  0U ) / 3U)
-          : 1U + std::uint_fast32_t((msb_pos + (3U - msb_pos_mod_3)) / 3U));
+          if(has_borrow)
+          {
+            --uv_as_ularge;
+          }
 
-      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+          has_borrow = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
 
-      // Perform the iteration for the k'th root.
-      // See Algorithm 1.14 RootInt, Sect. 1.5.2
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+          r[i] = limb_type(uv_as_ularge);
+        }
+      }
+      else
+      {
+        std::copy(t_hi, t_hi + number_of_limbs, r);
+      }
+    }
+  };
 
-      const std::uint_fast32_t three_minus_one(3U - 1U);
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class barrett_reducer
+  {
+  public:
+    // This class reduces values modulo a fixed modulus m with
+    // Barrett's method. The reciprocal mu = floor(b^n / m), where
+    // b is the limb base and n is the number of limbs, is precomputed
+    // once. Each reduction then needs one multiplication to estimate
+    // the quotient, one truncated multiplication of the quotient
+    // estimate with m, and a subtraction followed by at most two
+    // corrections. No division is carried out. The method is most
+    // effective when m is at least about half as wide as the values
+    // being reduced, for instance when reducing products modulo m.
+
+    // See also "Algorithm 2.5 BarrettDivRem", Sect. 2.4.1 in
+    // R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+    // Cambridge University Press (2011), and Algorithm 14.42 in
+    // A.J. Menezes, P.C. van Oorschot and S.A. Vanstone,
+    // "Handbook of Applied Cryptography", CRC Press (1996).
+
+    using wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using limb_type         = typename wide_integer_type::limb_type;
+    using double_limb_type  = typename wide_integer_type::double_limb_type;
+
+    static constexpr std::uint_fast32_t number_of_limbs = wide_integer_type::number_of_limbs;
+
+    explicit barrett_reducer(const wide_integer_type& m)
+      : my_m            (m),
+        my_mu           (std::uint8_t(0U)),
+        my_m_ext        (),
+        my_m_limb_count (significant_limb_count(m.crepresentation().data(), number_of_limbs)),
+        my_mu_limb_count(0U),
+        my_m_is_trivial (m <= 1U)
+    {
+      std::copy(m.crepresentation().cbegin(), m.crepresentation().cend(), my_m_ext.begin());
 
-      for(std::uint_fast32_t i = 0U; i < 64U; ++i)
-      {
-        s = u;
+      my_m_ext.back() = limb_type(0U);
 
-        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+      if(my_m_is_trivial == false)
+      {
+        using local_double_width_type = typename wide_integer_type::double_width_type;
 
-        for(std::uint_fast32_t j = 0U; j < 3U - 1U; ++j)
-        {
-          // Use a loop here to divide by s^(3 - 1) because
-          // without a loop, s^(3 - 1) is likely to overflow.
+        // Calculate mu = floor(b^n / m) with the double-width type.
+        // Since m >= 2, the result fits in the normal width.
+        local_double_width_type mu_dw(std::uint8_t(1U));
 
-          m_over_s_pow_3_minus_one /= s;
-        }
+        mu_dw <<= Digits2;
+        mu_dw  /= local_double_width_type(m);
 
-        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / 3U;
+        my_mu = wide_integer_type(mu_dw);
 
-        if(u >= s)
-        {
-          break;
-        }
+        my_mu_limb_count = significant_limb_count(my_mu.crepresentation().data(), number_of_limbs);
       }
     }
 
-    return s;
-  }
+    barrett_reducer(const barrett_reducer& other)
+      : my_m            (other.my_m),
+        my_mu           (other.my_mu),
+        my_m_ext        (other.my_m_ext),
+        my_m_limb_count (other.my_m_limb_count),
+        my_mu_limb_count(other.my_mu_limb_count),
+        my_m_is_trivial (other.my_m_is_trivial) { }
 
-  template<const std::uint_fast32_t Digits2,
-           typename LimbType>
-  uintwide_t<Digits2, LimbType> rootk(const uintwide_t<Digits2, LimbType>& m,
-                                      const std::uint_fast8_t k)
-  {
-    // Calculate the k'th root.
+    ~barrett_reducer() = default;
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+    barrett_reducer& operator=(const barrett_reducer&) = delete;
 
-    local_wide_integer_type s;
+    const wide_integer_type& modulus   () const { return my_m; }
+    const wide_integer_type& reciprocal() const { return my_mu; }
 
-    if(k < 2U)
-    {
-      s = m;
-    }
-    else if(k == 2U)
-    {
-      s = sqrt(m);
-    }
-    else
+    // Calculate x % m.
+    wide_integer_type reduce(const wide_integer_type& x) const
     {
-      const bool argument_is_zero = std::all_of(m.crepresentation().cbegin(),
-                                                m.crepresentation().cend(),
-                                                [](const local_limb_type& a) -> bool
-                                                {
-                                                  return (a == 0U);
-                                                });
+      wide_integer_type result;
 
-      if(argument_is_zero)
+      if(my_m_is_trivial)
       {
-        s = local_wide_integer_type(std::uint_fast8_t(0U));
+        // Reduction modulo one is always zero. Reduction modulo zero
+        // is also set to zero, in agreement with operator%=.
+        result = wide_integer_type(std::uint8_t(0U));
+      }
+      else if(x < my_m)
+      {
+        result = x;
       }
       else
       {
-        // Obtain the initial guess via algorithms
-        // involving the position of the msb.
-        const std::uint_fast32_t msb_pos = msb(m);
+        // Let k be the limb count of m. Estimate the quotient with
+        //   q = floor(floor(x / b^(k - 1)) * mu / b^(n - k + 1)).
+        // The true quotient exceeds q by at most 2.
 
-        // Obtain the initial value.
-        const std::uint_fast32_t msb_pos_mod_k = msb_pos % k;
+        const std::uint_fast32_t k = my_m_limb_count;
 
-        const std::uint_fast32_t left_shift_amount =
-          ((msb_pos_mod_k == 0U)
-            ? 1U + std::uint_fast32_t((msb_pos +                 0U ) / k)
-            : 1U + std::uint_fast32_t((msb_pos + (k - msb_pos_mod_k)) / k));
+        const std::uint_fast32_t q1_limb_count =
+          significant_limb_count(x.crepresentation().data(), number_of_limbs) - (k - 1U);
 
-        local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+        std::array<limb_type, number_of_limbs * 2U> q1_times_mu;
 
-        // Perform the iteration for the k'th root.
-        // See Algorithm 1.14 RootInt, Sect. 1.5.2
-        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press, 2011.
+        detail::eval_multiply_limbs_lo(q1_times_mu.data(),
+                                       q1_limb_count + my_mu_limb_count,
+                                       x.crepresentation().data() + (k - 1U),
+                                       q1_limb_count,
+                                       my_mu.crepresentation().data(),
+                                       my_mu_limb_count);
 
-        const std::uint_fast32_t k_minus_one(k - 1U);
+        const std::uint_fast32_t q_offset = (number_of_limbs - k) + 1U;
 
-        for(std::uint_fast32_t i = 0U; i < 64U; ++i)
-        {
-          s = u;
+        const std::uint_fast32_t q_limb_count =
+          (((q1_limb_count + my_mu_limb_count) > q_offset) ? ((q1_limb_count + my_mu_limb_count) - q_offset) : 0U);
+
+        // The remainder x - (q * m) is less than 3m, which is less than
+        // b^(k + 1). So only the lowest (k + 1) limbs are needed for it.
+        std::array<limb_type, number_of_limbs + 1U> q_times_m;
 
-          local_wide_integer_type m_over_s_pow_k_minus_one = m;
+        detail::eval_multiply_limbs_lo(q_times_m.data(),
+                                       k + 1U,
+                                       q1_times_mu.data() + q_offset,
+                                       q_limb_count,
+                                       my_m.crepresentation().data(),
+                                       k);
 
-          for(std::uint_fast32_t j = 0U; j < k - 1U; ++j)
-          {
-            // Use a loop here to divide by s^(k - 1) because
-            // without a loop, s^(k - 1) is likely to overflow.
+        std::array<limb_type, number_of_limbs + 1U> r;
 
-            m_over_s_pow_k_minus_one /= s;
-          }
+        std::copy(x.crepresentation().cbegin(), x.crepresentation().cbegin() + k, r.begin());
 
-          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+        r[k] = ((k < number_of_limbs) ? x.crepresentation()[k] : limb_type(0U));
 
-          if(u >= s)
-          {
-            break;
-          }
+        eval_subtract(r.data(), q_times_m.data(), k + 1U);
+
+        while(compare_ranges(r.data(), my_m_ext.data(), k + 1U) >= 0)
+        {
+          eval_subtract(r.data(), my_m_ext.data(), k + 1U);
         }
-      }
-    }
 
-    return s;
-  }
+        std::copy(r.cbegin(), r.cbegin() + k, result.representation().begin());
 
-  template<typename OtherUnsignedIntegralTypeP,
-           const std::uint_fast32_t Digits2,
-           typename LimbType>
-  uintwide_t<Digits2, LimbType> pow(const uintwide_t<Digits2, LimbType>& b,
-                                    const OtherUnsignedIntegralTypeP&    p)
-  {
-    // Calculate (b ^ p).
+        std::fill(result.representation().begin() + k, result.representation().end(), limb_type(0U));
+      }
 
-    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+      return result;
+    }
 
-    local_wide_integer_type result;
+    // Reduce each element in the range [first, last) and store
+    // the results in the range beginning at d_first.
+    template<typename InputIteratorType,
+             typename OutputIteratorType>
+    OutputIteratorType reduce(InputIteratorType  first,
+                              InputIteratorType  last,
+                              OutputIteratorType d_first) const
+    {
+      while(first != last)
+      {
+        *d_first = reduce(*first);
 
-    const OtherUnsignedIntegralTypeP zero(std::uint8_t(0U));
+        ++first;
+        ++d_first;
+      }
 
-    if(p == zero)
-    {
-      result = local_wide_integer_type(std::uint8_t(1U));
+      return d_first;
     }
-    else if(p == 1U)
+
+  private:
+    const wide_integer_type                           my_m;
+          wide_integer_type                           my_mu;
+          std::array<limb_type, number_of_limbs + 1U> my_m_ext;
+    const std::uint_fast32_t                          my_m_limb_count;
+          std::uint_fast32_t                          my_mu_limb_count;
+    const bool                                        my_m_is_trivial;
+
+    static std::uint_fast32_t significant_limb_count(const limb_type* a, const std::uint_fast32_t count)
     {
-      result = b;
+      std::uint_fast32_t n = count;
+
+      while((n > 0U) && (a[n - 1U] == limb_type(0U)))
+      {
+        --n;
+      }
+
+      return n;
     }
-    else if(p == 2U)
+
+    static std::int_fast8_t compare_ranges(const limb_type* a, const limb_type* b, const std::uint_fast32_t count)
     {
-      result  = b;
-      result *= b;
+      std::int_fast32_t element_index = std::int_fast32_t(count) - 1;
+
+      while((element_index >= 0) && (a[element_index] == b[element_index]))
+      {
+        --element_index;
+      }
+
+      return ((element_index < 0) ? std::int_fast8_t(0)
+                                  : ((a[element_index] > b[element_index]) ? std::int_fast8_t(1) : std::int_fast8_t(-1)));
     }
-    else
-    {
-      result = local_wide_integer_type(std::uint8_t(1U));
 
-      local_wide_integer_type y      (b);
-      local_wide_integer_type p_local(p);
+    static void eval_subtract(limb_type* r, const limb_type* v, const std::uint_fast32_t count)
+    {
+      bool has_borrow = false;
 
-      while(!(p_local == zero))
+      for(std::uint_fast32_t i = 0U; i < count; ++i)
       {
-        if(std::uint_fast8_t(p_local) & 1U)
+        double_limb_type uv_as_ularge = double_limb_type(r[i]) - v[i];
+
+        if(has_borrow)
         {
-          result *= y;
+          --uv_as_ularge;
         }
 
-        y *= y;
+        has_borrow = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U));
 
-        p_local >>= 1;
+        r[i] = limb_type(uv_as_ularge);
       }
     }
-
-    return result;
-  }
+  };
 
   template<typename OtherUnsignedIntegralTypeP,
            typename OtherUnsignedIntegralTypeM,
@@ -3072,6 +5023,18 @@
 
       result = local_normal_width_type(y);
     }
+    else if(   ((static_cast<local_limb_type>(m_local) & 1U) != 0U)
+            && (local_double_width_type(local_normal_width_type(m_local)) == m_local))
+    {
+      // The modulus is odd and fits in the normal width.
+      // Use Montgomery multiplication, which avoids the
+      // long division after each multiplication.
+      const local_normal_width_type m_normal(m_local);
+
+      const montgomery_context<Digits2, LimbType> mont_ctx(m_normal);
+
+      result = mont_ctx.powm(b, p);
+    }
     else
     {
       local_double_width_type    x      (std::uint8_t(1U));
@@ -3164,6 +5127,241 @@
     return u;
   }
 
+  template<typename LimbType>
+  struct lehmer_cofactors
+  {
+    // The magnitudes of the cofactors A, B, C, D of Lehmer's algorithm,
+    // and the number of Euclidean steps which they represent. For an even
+    // step count, the signs are A >= 0, B <= 0, C <= 0, D >= 0, and for an
+    // odd step count, they are reversed.
+    LimbType           a;
+    LimbType           b;
+    LimbType           c;
+    LimbType           d;
+    std::uint_fast32_t steps;
+  };
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  typename uintwide_t<Digits2, LimbType>::double_limb_type lehmer_leading_bits(const uintwide_t<Digits2, LimbType>& x,
+                                                                               const std::uint_fast32_t             shift)
+  {
+    // Extract the bits at the positions shift ... shift + (2 * p) - 3
+    // of x, where p is the number of bits in a limb.
+
+    using local_double_limb_type = typename uintwide_t<Digits2, LimbType>::double_limb_type;
+
+    constexpr std::uint_fast32_t p = std::uint_fast32_t(std::numeric_limits<LimbType>::digits);
+
+    constexpr std::uint_fast32_t n = uintwide_t<Digits2, LimbType>::number_of_limbs;
+
+    const std::uint_fast32_t index  = shift / p;
+    const std::uint_fast32_t offset = shift % p;
+
+    local_double_limb_type result = local_double_limb_type(x.crepresentation()[index]) >> offset;
+
+    if((index + 1U) < n)
+    {
+      result |= local_double_limb_type(local_double_limb_type(x.crepresentation()[index + 1U]) << (p - offset));
+    }
+
+    if(((index + 2U) < n) && (offset > 2U))
+    {
+      result |= local_double_limb_type(local_double_limb_type(x.crepresentation()[index + 2U]) << ((2U * p) - offset));
+    }
+
+    return local_double_limb_type(result & local_double_limb_type((std::numeric_limits<local_double_limb_type>::max)() >> 2U));
+  }
+
+  template<typename LimbType,
+           typename DoubleLimbType>
+  void lehmer_simulate(DoubleLimbType u_hat, DoubleLimbType v_hat, lehmer_cofactors<LimbType>& cof)
+  {
+    // Simulate the Euclidean algorithm on the leading bits u_hat, v_hat
+    // (each having 2 * p - 2 bits) as long as the quotients are certain
+    // to agree with those of the full values, and the cofactors fit into
+    // one limb. This is the inner loop of Algorithm L in Sect. 4.5.2 of
+    // D.E. Knuth, "The Art of Computer Programming, Volume 2".
+
+    using local_signed_type = typename int_type_helper<std::uint_fast32_t(std::numeric_limits<DoubleLimbType>::digits)>::exact_signed_type;
+
+    constexpr DoubleLimbType limb_max = DoubleLimbType((std::numeric_limits<LimbType>::max)());
+
+    DoubleLimbType a = 1U;
+    DoubleLimbType b = 0U;
+    DoubleLimbType c = 0U;
+    DoubleLimbType d = 1U;
+
+    std::uint_fast32_t k = 0U;
+
+    for(;;)
+    {
+      const bool k_is_even = ((k % 2U) == 0U);
+
+      const local_signed_type sa = (k_is_even ? local_signed_type(a) : local_signed_type(-local_signed_type(a)));
+      const local_signed_type sb = (k_is_even ? local_signed_type(-local_signed_type(b)) : local_signed_type(b));
+      const local_signed_type sc = (k_is_even ? local_signed_type(-local_signed_type(c)) : local_signed_type(c));
+      const local_signed_type sd = (k_is_even ? local_signed_type(d) : local_signed_type(-local_signed_type(d)));
+
+      const local_signed_type num1 = local_signed_type(local_signed_type(u_hat) + sa);
+      const local_signed_type den1 = local_signed_type(local_signed_type(v_hat) + sc);
+      const local_signed_type num2 = local_signed_type(local_signed_type(u_hat) + sb);
+      const local_signed_type den2 = local_signed_type(local_signed_type(v_hat) + sd);
+
+      if((den1 <= 0) || (den2 <= 0) || (num1 < 0) || (num2 < 0))
+      {
+        break;
+      }
+
+      const DoubleLimbType q = DoubleLimbType(DoubleLimbType(num1) / DoubleLimbType(den1));
+
+      if((q != DoubleLimbType(DoubleLimbType(num2) / DoubleLimbType(den2))) || (q > limb_max))
+      {
+        break;
+      }
+
+      const DoubleLimbType c_next = DoubleLimbType(a + DoubleLimbType(q * c));
+      const DoubleLimbType d_next = DoubleLimbType(b + DoubleLimbType(q * d));
+
+      if((c_next > limb_max) || (d_next > limb_max))
+      {
+        break;
+      }
+
+      a = c;
+      b = d;
+      c = c_next;
+      d = d_next;
+
+      const DoubleLimbType r_hat = DoubleLimbType(u_hat - DoubleLimbType(q * v_hat));
+
+      u_hat = v_hat;
+      v_hat = r_hat;
+
+      ++k;
+    }
+
+    cof.a     = LimbType(a);
+    cof.b     = LimbType(b);
+    cof.c     = LimbType(c);
+    cof.d     = LimbType(d);
+    cof.steps = k;
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  void lehmer_linear_sub(      uintwide_t<Digits2, LimbType>& r,
+                         const uintwide_t<Digits2, LimbType>& x,
+                         const LimbType                       a,
+                         const uintwide_t<Digits2, LimbType>& y,
+                         const LimbType                       b)
+  {
+    // Compute r = (a * x) - (b * y) modulo 2^Digits2 in one pass.
+    // The caller ensures that the exact result is non-negative
+    // and fits, so the modular result is exact.
+
+    using local_double_limb_type = typename uintwide_t<Digits2, LimbType>::double_limb_type;
+
+    local_double_limb_type carry_x = 0U;
+    local_double_limb_type carry_y = 0U;
+
+    bool has_borrow = false;
+
+    for(std::uint_fast32_t i = 0U; i < uintwide_t<Digits2, LimbType>::number_of_limbs; ++i)
+    {
+      carry_x += local_double_limb_type(local_double_limb_type(x.crepresentation()[i]) * a);
+      carry_y += local_double_limb_type(local_double_limb_type(y.crepresentation()[i]) * b);
+
+      local_double_limb_type diff = local_double_limb_type(LimbType(carry_x)) - LimbType(carry_y);
+
+      if(has_borrow)
+      {
+        --diff;
+      }
+
+      has_borrow = (make_hi<LimbType>(diff) != LimbType(0U));
+
+      r.representation()[i] = LimbType(diff);
+
+      carry_x = make_hi<LimbType>(carry_x);
+      carry_y = make_hi<LimbType>(carry_y);
+    }
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  void lehmer_linear_add(      uintwide_t<Digits2, LimbType>& r,
+                         const uintwide_t<Digits2, LimbType>& x,
+                         const LimbType                       a,
+                         const uintwide_t<Digits2, LimbType>& y,
+                         const LimbType                       b)
+  {
+    // Compute r = (a * x) + (b * y) modulo 2^Digits2 in one pass.
+
+    using local_double_limb_type = typename uintwide_t<Digits2, LimbType>::double_limb_type;
+
+    local_double_limb_type carry_x = 0U;
+    local_double_limb_type carry_y = 0U;
+
+    LimbType carry = 0U;
+
+    for(std::uint_fast32_t i = 0U; i < uintwide_t<Digits2, LimbType>::number_of_limbs; ++i)
+    {
+      carry_x += local_double_limb_type(local_double_limb_type(x.crepresentation()[i]) * a);
+      carry_y += local_double_limb_type(local_double_limb_type(y.crepresentation()[i]) * b);
+
+      const local_double_limb_type sum = local_double_limb_type(local_double_limb_type(LimbType(carry_x)) + LimbType(carry_y)) + carry;
+
+      r.representation()[i] = LimbType(sum);
+
+      carry   = make_hi<LimbType>(sum);
+      carry_x = make_hi<LimbType>(carry_x);
+      carry_y = make_hi<LimbType>(carry_y);
+    }
+  }
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  bool lehmer_step(uintwide_t<Digits2, LimbType>& u,
+                   uintwide_t<Digits2, LimbType>& v,
+                   lehmer_cofactors<LimbType>&    cof)
+  {
+    // Perform one step of Lehmer's algorithm on u > v > 0, replacing
+    // (u, v) with (A * u + B * v, C * u + D * v) for the cofactors of
+    // several Euclidean steps. Return false if no step could be found
+    // from the leading bits, in which case u and v are unchanged.
+
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+
+    constexpr std::uint_fast32_t hat_bits = std::uint_fast32_t(std::numeric_limits<LimbType>::digits * 2) - 2U;
+
+    const std::uint_fast32_t u_bits = msb(u) + 1U;
+
+    const std::uint_fast32_t shift = ((u_bits > hat_bits) ? (u_bits - hat_bits) : 0U);
+
+    lehmer_simulate(lehmer_leading_bits(u, shift), lehmer_leading_bits(v, shift), cof);
+
+    const bool has_step = (cof.b != LimbType(0U));
+
+    if(has_step)
+    {
+      const local_wide_integer_type u_prev(u);
+
+      if((cof.steps % 2U) == 0U)
+      {
+        lehmer_linear_sub(u, u_prev, cof.a, v,      cof.b);
+        lehmer_linear_sub(v, v,      cof.d, u_prev, cof.c);
+      }
+      else
+      {
+        lehmer_linear_sub(u, v,      cof.b, u_prev, cof.a);
+        lehmer_linear_sub(v, u_prev, cof.c, v,      cof.d);
+      }
+    }
+
+    return has_step;
+  }
+
   }
 
   template<const std::uint_fast32_t Digits2,
@@ -3171,8 +5369,8 @@
   uintwide_t<Digits2, LimbType> gcd(const uintwide_t<Digits2, LimbType>& a,
                                     const uintwide_t<Digits2, LimbType>& b)
   {
-    // This implementation of GCD is an adaptation
-    // of existing code from Boost.Multiprecision.
+    // This implementation of GCD handles the special cases
+    // as in existing code from Boost.Multiprecision.
 
     using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
     using local_ushort_type       = typename local_wide_integer_type::limb_type;
@@ -3202,64 +5400,52 @@
     {
       // Now we handle cases having (u != 0) and (v != 0).
 
-      // Let shift := lg K, where K is the greatest
-      // power of 2 dividing both u and v.
-
-      std::uint_fast32_t left_shift_amount;
+      // Use Lehmer's algorithm, which performs several Euclidean
+      // steps at a time based on the leading bits of u and v,
+      // as long as the values are wider than a double limb.
+      // See also Algorithm L in Sect. 4.5.2 of D.E. Knuth,
+      // "The Art of Computer Programming, Volume 2".
 
+      if(u < v)
       {
-        const std::uint_fast32_t u_shift = lsb(u);
-        const std::uint_fast32_t v_shift = lsb(v);
-
-        left_shift_amount = (std::min)(u_shift, v_shift);
-
-        u >>= u_shift;
-        v >>= v_shift;
+        swap(u, v);
       }
 
-      for(;;)
-      {
-        // Now u and v are both odd, so diff(u, v) is even.
-        // Let u = min(u, v), v = diff(u, v) / 2.
+      detail::lehmer_cofactors<local_ushort_type> cof;
 
-        if(u > v)
+      while((v != 0U) && (u > (std::numeric_limits<local_ularge_type>::max)()))
+      {
+        if(detail::lehmer_step(u, v, cof) == false)
         {
-          swap(u, v);
-        }
+          // The leading bits do not determine a quotient,
+          // so perform one full Euclidean step.
+          const local_wide_integer_type r = u % v;
 
-        if(u == v)
-        {
-          break;
+          u = v;
+          v = r;
         }
+      }
 
-        if(v <= (std::numeric_limits<local_ularge_type>::max)())
-        {
-          if(v <= (std::numeric_limits<local_ushort_type>::max)())
-          {
-            u = detail::integer_gcd_reduce_short(v.crepresentation()[0U],
-                                                 u.crepresentation()[0U]);
-          }
-          else
-          {
-            const local_ularge_type v_large =
-              detail::make_large(v.crepresentation()[0U],
-                                 v.crepresentation()[1U]);
-
-            const local_ularge_type u_large =
-              detail::make_large(u.crepresentation()[0U],
-                                 u.crepresentation()[1U]);
+      if(v == 0U)
+      {
+        result = u;
+      }
+      else
+      {
+        // Both u and v fit into a double limb.
+        local_ularge_type u_large = detail::make_large(u.crepresentation()[0U], u.crepresentation()[1U]);
+        local_ularge_type v_large = detail::make_large(v.crepresentation()[0U], v.crepresentation()[1U]);
 
-            u = detail::integer_gcd_reduce_large(v_large, u_large);
-          }
+        while(v_large != 0U)
+        {
+          const local_ularge_type r_large = local_ularge_type(u_large % v_large);
 
-          break;
+          u_large = v_large;
+          v_large = r_large;
         }
 
-        v  -= u;
-        v >>= lsb(v);
+        result = local_wide_integer_type(u_large);
       }
-
-      result = (u << left_shift_amount);
     }
 
     return result;
@@ -3300,6 +5486,80 @@
     return result;
   }
 
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  uintwide_t<Digits2, LimbType> modinv(const uintwide_t<Digits2, LimbType>& a,
+                                       const uintwide_t<Digits2, LimbType>& m)
+  {
+    // Calculate the modular inverse x of a modulo m, with (a * x) mod m = 1,
+    // using the extended form of Lehmer's algorithm. The result is zero
+    // if the inverse does not exist, in other words if gcd(a, m) != 1,
+    // and also for the trivial moduli m <= 1.
+
+    // The Euclidean remainders r_i = t_i * a (mod m) start with
+    // r_0 = m, t_0 = 0 and r_1 = a mod m, t_1 = 1. The signs of the
+    // cofactors t_i alternate, so only their magnitudes are stored,
+    // together with the index i of the remainder held in u. The
+    // magnitudes are bounded by m, so no modular reduction is needed.
+
+    using local_wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using local_ushort_type       = typename local_wide_integer_type::limb_type;
+
+    local_wide_integer_type result(std::uint8_t(0U));
+
+    if(m > 1U)
+    {
+      local_wide_integer_type u(m);
+      local_wide_integer_type v(a % m);
+
+      local_wide_integer_type tu(std::uint8_t(0U));
+      local_wide_integer_type tv(std::uint8_t(1U));
+
+      std::uint_fast32_t i = 0U;
+
+      detail::lehmer_cofactors<local_ushort_type> cof;
+
+      while(v != 0U)
+      {
+        if(   (u > (std::numeric_limits<typename local_wide_integer_type::double_limb_type>::max)())
+           && (detail::lehmer_step(u, v, cof) == true))
+        {
+          // The magnitudes of the cofactors combine additively.
+          const local_wide_integer_type tu_prev(tu);
+
+          detail::lehmer_linear_add(tu, tu_prev, cof.a, tv,      cof.b);
+          detail::lehmer_linear_add(tv, tu_prev, cof.c, tv,      cof.d);
+
+          i += cof.steps;
+        }
+        else
+        {
+          // Perform one full Euclidean step.
+          const local_wide_integer_type q = u / v;
+          const local_wide_integer_type r = u - (q * v);
+
+          u = v;
+          v = r;
+
+          const local_wide_integer_type t_next = tu + (q * tv);
+
+          tu = tv;
+          tv = t_next;
+
+          ++i;
+        }
+      }
+
+      if(u == 1U)
+      {
+        // The cofactor t_i is positive for odd i and negative for even i.
+        result = (((i % 2U) != 0U) ? tu : local_wide_integer_type(m - tu));
+      }
+    }
+
+    return result;
+  }
+
   template<const std::uint_fast32_t Digits2,
            typename LimbType>
   class uniform_int_distribution
@@ -3613,17 +5873,24 @@
     // Since we have already excluded all small factors
     // up to and including 227, n is greater than 227.
 
+    // The candidate n is odd. Set up one single Montgomery
+    // context which is shared by all of the trials below.
+    // The values stay in Montgomery form for the whole test,
+    // and are compared with the Montgomery forms of 1 and (n - 1).
+    const montgomery_context<Digits2, LimbType> mont_ctx(n);
+
+    const local_wide_integer_type one_m = mont_ctx.one();
+    const local_wide_integer_type nm1_m = mont_ctx.to_montgomery(nm1);
+
     {
       // Perform a single Fermat test which will
       // exclude many non-prime candidates.
 
       static const local_wide_integer_type n228(local_limb_type(228U));
 
-      const local_wide_integer_type fn = powm(n228, nm1, n);
+      const local_wide_integer_type fn = mont_ctx.powm_montgomery(mont_ctx.to_montgomery(n228), nm1);
 
-      const local_limb_type fn0 = static_cast<local_limb_type>(fn);
-
-      if((fn0 != 1U) && (fn != 1U))
+      if(fn != one_m)
       {
         return false;
       }
@@ -3648,24 +5915,20 @@
     do
     {
       x = distribution(generator, params);
-      y = powm(x, q, n);
+      y = mont_ctx.powm_montgomery(mont_ctx.to_montgomery(x), q);
 
       std::uint_fast32_t j = 0U;
 
-      while(y != nm1)
+      while(y != nm1_m)
       {
-        const local_limb_type y0(y);
-
-        if((y0 == 1U) && (y == 1U))
+        if(y == one_m)
         {
-          if(j == 0U)
-          {
-            break;
-          }
-          else
+          if(j != 0U)
           {
             is_probably_prime = false;
           }
+
+          break;
         }
         else
         {
@@ -3674,10 +5937,12 @@
           if(j == k)
           {
             is_probably_prime = false;
+
+            break;
           }
           else
           {
-            y = powm(y, 2U, n);
+            y = mont_ctx.square(y);
           }
         }
       }
@@ -0,0 +1,373 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef GENERIC_TEMPLATE_UINTWIDE_T_BATCH_2026_10_18_H_
+  #define GENERIC_TEMPLATE_UINTWIDE_T_BATCH_2026_10_18_H_
+
+  #include <algorithm>
+  #include <array>
+  #include <cstdint>
+  #include <limits>
+
+  #include <math/wide_integer/generic_template_uintwide_t.h>
+
+  // GCC unrolls the loops over the values of small batches completely,
+  // before they reach the loop vectorizer, and then leaves the unrolled
+  // carry chains scalar. The loops over the values are therefore kept
+  // rolled, which lets GCC vectorize them for every batch size.
+  #if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8))
+  #define WIDE_INTEGER_BATCH_VALUE_LOOP _Pragma("GCC unroll 1")
+  #else
+  #define WIDE_INTEGER_BATCH_VALUE_LOOP
+  #endif
+
+  namespace wide_integer { namespace generic_template {
+
+  // Forward declaration of the batch class.
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType,
+           const std::uint_fast32_t BatchSize>
+  class uintwide_t_batch;
+
+  // Forward declarations of non-member binary add, sub operators.
+  template<const std::uint_fast32_t Digits2, typename LimbType, const std::uint_fast32_t BatchSize>
+  uintwide_t_batch<Digits2, LimbType, BatchSize> operator+(const uintwide_t_batch<Digits2, LimbType, BatchSize>& u, const uintwide_t_batch<Digits2, LimbType, BatchSize>& v);
+
+  template<const std::uint_fast32_t Digits2, typename LimbType, const std::uint_fast32_t BatchSize>
+  uintwide_t_batch<Digits2, LimbType, BatchSize> operator-(const uintwide_t_batch<Digits2, LimbType, BatchSize>& u, const uintwide_t_batch<Digits2, LimbType, BatchSize>& v);
+
+  } } // namespace wide_integer::generic_template
+
+  namespace wide_integer { namespace generic_template {
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType,
+           const std::uint_fast32_t BatchSize>
+  class uintwide_t_batch
+  {
+  public:
+    // A batch of BatchSize independent values of uintwide_t<Digits2, LimbType>,
+    // stored limb-major (structure of arrays). Limb k of all values is held
+    // contiguously, so each kernel loops over the limbs and, inside, over
+    // the values. The inner loops have no dependencies across the values,
+    // and the carries, borrows and comparison states are kept per value.
+    // This lets the compiler vectorize the inner loops with the SIMD width
+    // of the target (such as SSE2, AVX2 or AVX-512 on x86-64, or NEON),
+    // without target-specific code.
+
+    using value_type       = uintwide_t<Digits2, LimbType>;
+    using limb_type        = typename value_type::limb_type;
+    using double_limb_type = typename value_type::double_limb_type;
+
+    static constexpr std::uint_fast32_t number_of_limbs = value_type::number_of_limbs;
+    static constexpr std::uint_fast32_t batch_size      = BatchSize;
+
+    static_assert(batch_size > 0U, "Error: The batch size must be greater than zero");
+
+    // The type of one limb of all values in the batch.
+    using lane_type = std::array<limb_type, batch_size>;
+
+    // The type of the internal data representation.
+    using representation_type = std::array<lane_type, number_of_limbs>;
+
+    // The type of the per-value comparison result.
+    using compare_result_type = std::array<std::int_fast8_t, batch_size>;
+
+    // Default constructor.
+    uintwide_t_batch() = default;
+
+    // Constructor filling the batch with one value.
+    explicit uintwide_t_batch(const value_type& v)
+    {
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+        values[k].fill(v.crepresentation()[k]);
+      }
+    }
+
+    // Copy constructor.
+    uintwide_t_batch(const uintwide_t_batch& other) : values(other.values) { }
+
+    // Assignment operator.
+    uintwide_t_batch& operator=(const uintwide_t_batch& other)
+    {
+      if(this != &other)
+      {
+        values = other.values;
+      }
+
+      return *this;
+    }
+
+    // Access to the value at a given index of the batch.
+    value_type get(const std::uint_fast32_t index) const
+    {
+      value_type v;
+
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+        v.representation()[k] = values[k][index];
+      }
+
+      return v;
+    }
+
+    void set(const std::uint_fast32_t index, const value_type& v)
+    {
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+        values[k][index] = v.crepresentation()[k];
+      }
+    }
+
+    // Transpose batch_size values from the input range into the batch.
+    template<typename InputIterator>
+    void load(InputIterator first)
+    {
+      for(std::uint_fast32_t i = 0U; i < batch_size; ++i, ++first)
+      {
+        set(i, *first);
+      }
+    }
+
+    // Transpose the batch into batch_size values of the output range.
+    template<typename OutputIterator>
+    OutputIterator store(OutputIterator d_first) const
+    {
+      for(std::uint_fast32_t i = 0U; i < batch_size; ++i, ++d_first)
+      {
+        *d_first = get(i);
+      }
+
+      return d_first;
+    }
+
+    // Provide a user interface to the internal data representation.
+          representation_type&  representation()       { return values; }
+    const representation_type&  representation() const { return values; }
+    const representation_type& crepresentation() const { return values; }
+
+    uintwide_t_batch& operator+=(const uintwide_t_batch& other)
+    {
+      // Element-wise addition modulo 2^Digits2.
+      lane_type carry;
+
+      carry.fill(limb_type(0U));
+
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+              lane_type& u = values[k];
+        const lane_type& v = other.values[k];
+
+        WIDE_INTEGER_BATCH_VALUE_LOOP
+        for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+        {
+          // The carries are computed with comparisons on limb_type,
+          // which keeps the vector lanes as wide as the limbs.
+          const limb_type uv = limb_type(u[i] + v[i]);
+          const limb_type r  = limb_type(uv + carry[i]);
+
+          carry[i] = limb_type(limb_type(uv < u[i]) | limb_type(r < uv));
+          u[i]     = r;
+        }
+      }
+
+      return *this;
+    }
+
+    uintwide_t_batch& operator-=(const uintwide_t_batch& other)
+    {
+      // Element-wise subtraction modulo 2^Digits2.
+      lane_type borrow;
+
+      borrow.fill(limb_type(0U));
+
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+              lane_type& u = values[k];
+        const lane_type& v = other.values[k];
+
+        WIDE_INTEGER_BATCH_VALUE_LOOP
+        for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+        {
+          const limb_type uv = limb_type(u[i] - v[i]);
+          const limb_type r  = limb_type(uv - borrow[i]);
+
+          borrow[i] = limb_type(limb_type(u[i] < v[i]) | limb_type(uv < borrow[i]));
+          u[i]      = r;
+        }
+      }
+
+      return *this;
+    }
+
+    uintwide_t_batch& mul_by_limb(const limb_type v)
+    {
+      // Element-wise multiplication with one limb modulo 2^Digits2.
+      lane_type carry;
+
+      carry.fill(limb_type(0U));
+
+      for(std::uint_fast32_t k = 0U; k < number_of_limbs; ++k)
+      {
+        lane_type& u = values[k];
+
+        WIDE_INTEGER_BATCH_VALUE_LOOP
+        for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+        {
+          const double_limb_type uv = double_limb_type(double_limb_type(u[i]) * v) + carry[i];
+
+          u[i]     = limb_type(uv);
+          carry[i] = detail::make_hi<limb_type>(uv);
+        }
+      }
+
+      return *this;
+    }
+
+    uintwide_t_batch& operator<<=(const std::uint_fast32_t n)
+    {
+      // Element-wise left shift of all values by the same amount.
+      if(n >= std::uint_fast32_t(Digits2))
+      {
+        fill_zero(0U, number_of_limbs);
+      }
+      else if(n != 0U)
+      {
+        const std::uint_fast32_t offset = std::uint_fast32_t(n / std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
+        const std::uint_fast32_t left   = std::uint_fast32_t(n % std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
+        const std::uint_fast32_t right  = std::uint_fast32_t(std::numeric_limits<limb_type>::digits) - left;
+
+        for(std::uint_fast32_t k = number_of_limbs; k-- > offset; )
+        {
+                lane_type& r  = values[k];
+          const lane_type& lo = values[k - offset];
+
+          if(left == 0U)
+          {
+            r = lo;
+          }
+          else if(k == offset)
+          {
+            WIDE_INTEGER_BATCH_VALUE_LOOP
+            for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+            {
+              r[i] = limb_type(lo[i] << left);
+            }
+          }
+          else
+          {
+            const lane_type& lo_next = values[k - offset - 1U];
+
+            WIDE_INTEGER_BATCH_VALUE_LOOP
+            for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+            {
+              r[i] = limb_type(limb_type(lo[i] << left) | limb_type(lo_next[i] >> right));
+            }
+          }
+        }
+
+        fill_zero(0U, offset);
+      }
+
+      return *this;
+    }
+
+    uintwide_t_batch& operator>>=(const std::uint_fast32_t n)
+    {
+      // Element-wise right shift of all values by the same amount.
+      if(n >= std::uint_fast32_t(Digits2))
+      {
+        fill_zero(0U, number_of_limbs);
+      }
+      else if(n != 0U)
+      {
+        const std::uint_fast32_t offset = std::uint_fast32_t(n / std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
+        const std::uint_fast32_t right  = std::uint_fast32_t(n % std::uint_fast32_t(std::numeric_limits<limb_type>::digits));
+        const std::uint_fast32_t left   = std::uint_fast32_t(std::numeric_limits<limb_type>::digits) - right;
+
+        for(std::uint_fast32_t k = 0U; k < (number_of_limbs - offset); ++k)
+        {
+                lane_type& r  = values[k];
+          const lane_type& hi = values[k + offset];
+
+          if(right == 0U)
+          {
+            r = hi;
+          }
+          else if((k + offset + 1U) == number_of_limbs)
+          {
+            WIDE_INTEGER_BATCH_VALUE_LOOP
+            for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+            {
+              r[i] = limb_type(hi[i] >> right);
+            }
+          }
+          else
+          {
+            const lane_type& hi_next = values[k + offset + 1U];
+
+            WIDE_INTEGER_BATCH_VALUE_LOOP
+            for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+            {
+              r[i] = limb_type(limb_type(hi[i] >> right) | limb_type(hi_next[i] << left));
+            }
+          }
+        }
+
+        fill_zero(number_of_limbs - offset, number_of_limbs);
+      }
+
+      return *this;
+    }
+
+    void compare(const uintwide_t_batch& other, compare_result_type& result) const
+    {
+      // Element-wise comparison, with the result being -1, 0 or +1
+      // for less than, equal to or greater than the other value.
+      // All limbs are examined from the most significant limb down,
+      // and the first difference of each value is retained.
+
+      result.fill(std::int_fast8_t(0));
+
+      for(std::uint_fast32_t k = number_of_limbs; k-- > 0U; )
+      {
+        const lane_type& u = values[k];
+        const lane_type& v = other.values[k];
+
+        WIDE_INTEGER_BATCH_VALUE_LOOP
+        for(std::uint_fast32_t i = 0U; i < batch_size; ++i)
+        {
+          const std::int_fast8_t cmp_limb = std::int_fast8_t(std::int_fast8_t(u[i] > v[i]) - std::int_fast8_t(u[i] < v[i]));
+
+          result[i] = ((result[i] == std::int_fast8_t(0)) ? cmp_limb : result[i]);
+        }
+      }
+    }
+
+  private:
+    representation_type values;
+
+    void fill_zero(const std::uint_fast32_t k_first, const std::uint_fast32_t k_last)
+    {
+      for(std::uint_fast32_t k = k_first; k < k_last; ++k)
+      {
+        values[k].fill(limb_type(0U));
+      }
+    }
+  };
+
+  // Non-member binary add, sub operators.
+  template<const std::uint_fast32_t Digits2, typename LimbType, const std::uint_fast32_t BatchSize>
+  uintwide_t_batch<Digits2, LimbType, BatchSize> operator+(const uintwide_t_batch<Digits2, LimbType, BatchSize>& u, const uintwide_t_batch<Digits2, LimbType, BatchSize>& v) { return uintwide_t_batch<Digits2, LimbType, BatchSize>(u).operator+=(v); }
+
+  template<const std::uint_fast32_t Digits2, typename LimbType, const std::uint_fast32_t BatchSize>
+  uintwide_t_batch<Digits2, LimbType, BatchSize> operator-(const uintwide_t_batch<Digits2, LimbType, BatchSize>& u, const uintwide_t_batch<Digits2, LimbType, BatchSize>& v) { return uintwide_t_batch<Digits2, LimbType, BatchSize>(u).operator-=(v); }
+
+  } } // namespace wide_integer::generic_template
+
+#endif // GENERIC_TEMPLATE_UINTWIDE_T_BATCH_2026_10_18_H_
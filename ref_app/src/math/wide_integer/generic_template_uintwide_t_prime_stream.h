@@ -0,0 +1,591 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef GENERIC_TEMPLATE_UINTWIDE_T_PRIME_STREAM_2026_10_18_H_
+  #define GENERIC_TEMPLATE_UINTWIDE_T_PRIME_STREAM_2026_10_18_H_
+
+  #include <algorithm>
+  #include <array>
+  #include <cstdint>
+  #include <limits>
+
+  // Testing the sieve survivors on several threads is optional.
+  // It is enabled by defining WIDE_INTEGER_ENABLE_THREADS, which
+  // requires <thread>, <mutex> and <condition_variable> from the
+  // standard library. The worker threads are started once, when
+  // the stream is constructed, and are reused for every window.
+  #if defined(WIDE_INTEGER_ENABLE_THREADS)
+  #include <atomic>
+  #include <condition_variable>
+  #include <functional>
+  #include <memory>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+  #endif
+
+  #include <math/wide_integer/generic_template_uintwide_t.h>
+
+  namespace wide_integer { namespace generic_template {
+
+  // Forward declaration of the prime candidate stream class.
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class prime_candidate_stream;
+
+  } } // namespace wide_integer::generic_template
+
+  #if defined(WIDE_INTEGER_ENABLE_THREADS)
+  namespace wide_integer { namespace generic_template { namespace detail {
+
+  // A persistent set of worker threads. The workers sleep until
+  // a job (a number of independent tasks) is posted, and they then
+  // take tasks one-by-one together with the calling thread.
+  class prime_stream_worker_pool final
+  {
+  public:
+    explicit prime_stream_worker_pool(const std::uint_fast32_t number_of_workers)
+      : my_workers   (),
+        my_job       (),
+        my_task_count(0U),
+        my_next_task (0U),
+        my_busy_count(0U),
+        my_generation(0U),
+        my_stop      (false)
+    {
+      my_workers.reserve(number_of_workers);
+
+      for(std::uint_fast32_t t = 0U; t < number_of_workers; ++t)
+      {
+        my_workers.emplace_back([this]() { work(); });
+      }
+    }
+
+    prime_stream_worker_pool(const prime_stream_worker_pool&) = delete;
+
+    prime_stream_worker_pool& operator=(const prime_stream_worker_pool&) = delete;
+
+    ~prime_stream_worker_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_stop = true;
+      }
+
+      my_cv_start.notify_all();
+
+      for(std::thread& w : my_workers)
+      {
+        w.join();
+      }
+    }
+
+    // Run the tasks 0, 1, ..., task_count - 1 of f on the workers and
+    // the calling thread. Only one job runs at a time, and a call made
+    // while the pool is busy executes its tasks in sequence.
+    template<typename FunctionType>
+    void run(const std::uint_fast32_t task_count, FunctionType f)
+    {
+      std::unique_lock<std::mutex> run_lock(my_run_mutex, std::try_to_lock);
+
+      if((run_lock.owns_lock() == false) || (task_count < 2U))
+      {
+        for(std::uint_fast32_t i = 0U; i < task_count; ++i) { f(i); }
+
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_job        = f;
+        my_task_count = task_count;
+        my_next_task.store(0U);
+        my_busy_count = static_cast<std::uint_fast32_t>(my_workers.size());
+
+        ++my_generation;
+      }
+
+      my_cv_start.notify_all();
+
+      take_tasks();
+
+      std::unique_lock<std::mutex> lock(my_mutex);
+
+      my_cv_done.wait(lock, [this]() { return (my_busy_count == 0U); });
+
+      my_job = nullptr;
+    }
+
+  private:
+    std::vector<std::thread>                 my_workers;
+    std::mutex                               my_run_mutex;
+    std::mutex                               my_mutex;
+    std::condition_variable                  my_cv_start;
+    std::condition_variable                  my_cv_done;
+    std::function<void(std::uint_fast32_t)>  my_job;
+    std::uint_fast32_t                       my_task_count;
+    std::atomic<std::uint_fast32_t>          my_next_task;
+    std::uint_fast32_t                       my_busy_count;
+    std::uint_fast32_t                       my_generation;
+    bool                                     my_stop;
+
+    void take_tasks()
+    {
+      for(std::uint_fast32_t i = my_next_task++; i < my_task_count; i = my_next_task++)
+      {
+        my_job(i);
+      }
+    }
+
+    void work()
+    {
+      std::uint_fast32_t generation_seen = 0U;
+
+      for(;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(my_mutex);
+
+          my_cv_start.wait(lock, [this, generation_seen]() { return (my_stop || (my_generation != generation_seen)); });
+
+          if(my_stop) { return; }
+
+          generation_seen = my_generation;
+        }
+
+        take_tasks();
+
+        {
+          std::lock_guard<std::mutex> lock(my_mutex);
+
+          --my_busy_count;
+        }
+
+        my_cv_done.notify_one();
+      }
+    }
+  };
+
+  } } } // namespace wide_integer::generic_template::detail
+  #endif // WIDE_INTEGER_ENABLE_THREADS
+
+  namespace wide_integer { namespace generic_template {
+
+  template<const std::uint_fast32_t Digits2,
+           typename LimbType>
+  class prime_candidate_stream
+  {
+  public:
+    // A stream of the (probable) primes greater than or equal to
+    // a given starting value, in ascending order. The odd candidates
+    // are handled in windows. Each window is first sieved with the
+    // odd primes below 2^15, and the residues of the window start
+    // modulo these primes are carried over incrementally from one
+    // window to the next. Only the survivors of the sieve undergo
+    // Miller-Rabin testing, which shares one Montgomery context
+    // per candidate among all of its bases.
+
+    // The bases of the Miller-Rabin test are the smallest primes
+    // 2, 3, 5, ... For candidates below 2^81, the thirteen bases
+    // 2 ... 41 give a deterministic result. For larger candidates,
+    // number_of_trials bases are used. Unlike miller_rabin(), the
+    // bases are not random, so the stream is intended for random
+    // starting values, as in the generation of prime numbers.
+
+    // When number_of_trials is zero, the number of bases depends
+    // on the size of the candidate, such that the probability of
+    // a composite result for a random candidate is below 2^-80.
+    // See I. Damgard, P. Landrock and C. Pomerance, "Average Case
+    // Error Estimates for the Strong Probable Prime Test",
+    // Mathematics of Computation 61 (1993), pp. 177-194.
+
+    // With WIDE_INTEGER_ENABLE_THREADS, number_of_threads - 1 worker
+    // threads are started in the constructor. They are shared by the
+    // copies of the stream and stop when the last copy is destroyed.
+
+    using wide_integer_type = uintwide_t<Digits2, LimbType>;
+    using limb_type         = typename wide_integer_type::limb_type;
+
+    // The number of odd candidates in one sieve window.
+    static constexpr std::uint_fast32_t window_size = 4096U;
+
+    // The number of odd sieving primes 3, 5, ..., 32749,
+    // which are all of the odd primes below 2^15.
+    static constexpr std::uint_fast32_t number_of_sieve_primes = 3511U;
+
+    explicit prime_candidate_stream(const wide_integer_type&  start,
+                                    const std::uint_fast32_t number_of_trials  = 0U,
+                                    const std::uint_fast32_t number_of_threads = 1U)
+      : my_base             (start),
+        my_number_of_trials (number_of_trials),
+        my_number_of_threads((std::max)(number_of_threads, std::uint_fast32_t(1U))),
+        my_window_count     (0U),
+        my_survivor_count   (0U),
+        my_survivor_index   (0U),
+        my_emit_two         (start <= 2U),
+        my_window_is_sieved (false),
+        my_is_exhausted     (false)
+        #if defined(WIDE_INTEGER_ENABLE_THREADS)
+      , my_worker_pool      ((my_number_of_threads > 1U) ? std::make_shared<detail::prime_stream_worker_pool>(my_number_of_threads - 1U)
+                                                         : std::shared_ptr<detail::prime_stream_worker_pool>())
+        #endif
+    {
+      if(my_emit_two)
+      {
+        my_base = 3U;
+      }
+      else if((static_cast<limb_type>(my_base) & 1U) == 0U)
+      {
+        ++my_base;
+
+        my_is_exhausted = (my_base == 0U);
+      }
+
+      const sieve_primes_type& primes = sieve_primes();
+
+      for(std::uint_fast32_t i = 0U; i < number_of_sieve_primes; ++i)
+      {
+        my_residues[i] = std::uint16_t(remainder_by_small_prime(my_base, primes[i]));
+      }
+    }
+
+    prime_candidate_stream(const prime_candidate_stream&) = default;
+
+    prime_candidate_stream& operator=(const prime_candidate_stream&) = default;
+
+    ~prime_candidate_stream() = default;
+
+    // Get the next (probable) prime of the stream. Return false
+    // when there are no more primes within the range of the type.
+    bool next(wide_integer_type& p)
+    {
+      if(my_emit_two)
+      {
+        my_emit_two = false;
+
+        p = 2U;
+
+        return true;
+      }
+
+      while(my_is_exhausted == false)
+      {
+        if(my_window_is_sieved == false)
+        {
+          sieve_window();
+        }
+
+        const std::uint_fast32_t j = find_first_prime(my_survivor_index);
+
+        if(j < my_survivor_count)
+        {
+          p = candidate(my_survivors[j]);
+
+          my_survivor_index = j + 1U;
+
+          return true;
+        }
+
+        advance_window();
+      }
+
+      return false;
+    }
+
+  private:
+    using sieve_primes_type = std::array<std::uint16_t, number_of_sieve_primes>;
+
+    wide_integer_type                                 my_base;
+    std::uint_fast32_t                                my_number_of_trials;
+    std::uint_fast32_t                                my_number_of_threads;
+    std::uint_fast32_t                                my_window_count;
+    std::uint_fast32_t                                my_survivor_count;
+    std::uint_fast32_t                                my_survivor_index;
+    bool                                              my_emit_two;
+    bool                                              my_window_is_sieved;
+    bool                                              my_is_exhausted;
+    std::array<std::uint16_t, number_of_sieve_primes> my_residues;
+    std::array<std::uint16_t, window_size>            my_survivors;
+    std::array<bool, window_size>                     my_composite_flags;
+    #if defined(WIDE_INTEGER_ENABLE_THREADS)
+    std::shared_ptr<detail::prime_stream_worker_pool> my_worker_pool;
+    #endif
+
+    static const sieve_primes_type& sieve_primes()
+    {
+      static const sieve_primes_type primes = make_sieve_primes();
+
+      return primes;
+    }
+
+    static sieve_primes_type make_sieve_primes()
+    {
+      sieve_primes_type primes;
+
+      std::uint_fast32_t count = 0U;
+
+      for(std::uint_fast32_t c = 3U; count < number_of_sieve_primes; c += 2U)
+      {
+        bool is_prime = true;
+
+        for(std::uint_fast32_t i = 0U; (i < count) && ((std::uint_fast32_t(primes[i]) * primes[i]) <= c); ++i)
+        {
+          if((c % primes[i]) == 0U)
+          {
+            is_prime = false;
+
+            break;
+          }
+        }
+
+        if(is_prime)
+        {
+          primes[count] = std::uint16_t(c);
+
+          ++count;
+        }
+      }
+
+      return primes;
+    }
+
+    static std::uint_fast32_t remainder_by_small_prime(const wide_integer_type& n, const std::uint_fast32_t p)
+    {
+      // The remainder is below 2^15 and the limbs have at most
+      // 32 bits, so the running value fits into 64 bits.
+
+      std::uint64_t r = 0U;
+
+      for(std::uint_fast32_t i = wide_integer_type::number_of_limbs; i-- > 0U; )
+      {
+        r = ((r << std::numeric_limits<limb_type>::digits) | n.crepresentation()[i]) % p;
+      }
+
+      return std::uint_fast32_t(r);
+    }
+
+    static std::uint_fast32_t number_of_trials_for_bits(const std::uint_fast32_t bits)
+    {
+      // The number of bases for an error probability below 2^-80
+      // for random candidates having the given number of bits.
+      return ((bits >= 1300U) ?  2U :
+              (bits >=  850U) ?  3U :
+              (bits >=  650U) ?  4U :
+              (bits >=  550U) ?  5U :
+              (bits >=  450U) ?  6U :
+              (bits >=  400U) ?  7U :
+              (bits >=  350U) ?  8U :
+              (bits >=  300U) ?  9U :
+              (bits >=  250U) ? 12U :
+              (bits >=  200U) ? 15U :
+              (bits >=  150U) ? 18U : 27U);
+    }
+
+    wide_integer_type candidate(const std::uint_fast32_t index) const
+    {
+      return my_base + wide_integer_type(std::uint32_t(2U * index));
+    }
+
+    void sieve_window()
+    {
+      // Limit the last window to the range of the type.
+      const wide_integer_type distance_to_max = (std::numeric_limits<wide_integer_type>::max)() - my_base;
+
+      my_window_count =
+        ((distance_to_max < std::uint32_t(2U * window_size))
+          ? std::uint_fast32_t(static_cast<std::uint32_t>(distance_to_max) / 2U) + 1U
+          : window_size);
+
+      std::fill(my_composite_flags.begin(), my_composite_flags.end(), false);
+
+      // Sieving primes p which are themselves candidates must not
+      // be crossed out. This can only happen for small windows.
+      const bool base_is_small = (my_base < std::uint32_t(UINT32_C(1) << 16U));
+
+      const std::uint_fast32_t base_lo = (base_is_small ? std::uint_fast32_t(static_cast<std::uint32_t>(my_base)) : 0U);
+
+      const sieve_primes_type& primes = sieve_primes();
+
+      for(std::uint_fast32_t i = 0U; i < number_of_sieve_primes; ++i)
+      {
+        const std::uint_fast32_t p = primes[i];
+        const std::uint_fast32_t r = my_residues[i];
+
+        // Find the first index j with (base + 2j) = 0 (mod p),
+        // in other words with 2j = -r (mod p).
+        std::uint_fast32_t j = ((r == 0U) ? 0U : (p - r));
+
+        if((j & 1U) != 0U)
+        {
+          j += p;
+        }
+
+        j /= 2U;
+
+        if(base_is_small && ((base_lo + (2U * j)) == p))
+        {
+          j += p;
+        }
+
+        for( ; j < my_window_count; j += p)
+        {
+          my_composite_flags[j] = true;
+        }
+      }
+
+      my_survivor_count = 0U;
+      my_survivor_index = 0U;
+
+      for(std::uint_fast32_t j = 0U; j < my_window_count; ++j)
+      {
+        if(my_composite_flags[j] == false)
+        {
+          my_survivors[my_survivor_count] = std::uint16_t(j);
+
+          ++my_survivor_count;
+        }
+      }
+
+      my_window_is_sieved = true;
+    }
+
+    void advance_window()
+    {
+      if(my_window_count < window_size)
+      {
+        my_is_exhausted = true;
+      }
+      else
+      {
+        my_base += std::uint32_t(2U * window_size);
+
+        const sieve_primes_type& primes = sieve_primes();
+
+        for(std::uint_fast32_t i = 0U; i < number_of_sieve_primes; ++i)
+        {
+          const std::uint_fast32_t p = primes[i];
+
+          my_residues[i] = std::uint16_t((my_residues[i] + ((2U * window_size) % p)) % p);
+        }
+
+        my_window_is_sieved = false;
+      }
+    }
+
+    bool is_prime_survivor(const std::uint_fast32_t j) const
+    {
+      const wide_integer_type n = candidate(my_survivors[j]);
+
+      // A survivor of the sieve which is below the square
+      // of the sieving limit 2^15 is prime.
+      if(msb(n) < 30U)
+      {
+        return (n != 1U);
+      }
+
+      const std::uint_fast32_t number_of_bases =
+        ((msb(n) < 81U) ? std::uint_fast32_t(13U)
+                        : ((my_number_of_trials == 0U) ? number_of_trials_for_bits(msb(n) + 1U)
+                                                       : (std::min)(my_number_of_trials, std::uint_fast32_t(number_of_sieve_primes))));
+
+      const wide_integer_type nm1(n - 1U);
+
+      const std::uint_fast32_t k = lsb(nm1);
+
+      const wide_integer_type q = nm1 >> k;
+
+      const montgomery_context<Digits2, LimbType> mont_ctx(n);
+
+      const wide_integer_type one_m = mont_ctx.one();
+      const wide_integer_type nm1_m = mont_ctx.to_montgomery(nm1);
+
+      const sieve_primes_type& primes = sieve_primes();
+
+      bool is_probably_prime = true;
+
+      for(std::uint_fast32_t i = 0U; ((i < number_of_bases) && is_probably_prime); ++i)
+      {
+        const wide_integer_type a((i == 0U) ? std::uint16_t(2U) : primes[i - 1U]);
+
+        // The powering and the squarings stay in Montgomery form.
+        wide_integer_type y = mont_ctx.powm_montgomery(mont_ctx.to_montgomery(a), q);
+
+        if((y != one_m) && (y != nm1_m))
+        {
+          std::uint_fast32_t s = 1U;
+
+          for( ; s < k; ++s)
+          {
+            y = mont_ctx.square(y);
+
+            if((y == nm1_m) || (y == one_m))
+            {
+              break;
+            }
+          }
+
+          is_probably_prime = ((s < k) && (y == nm1_m));
+        }
+      }
+
+      return is_probably_prime;
+    }
+
+    std::uint_fast32_t find_first_prime(const std::uint_fast32_t first) const
+    {
+      // Return the smallest index j >= first of a survivor
+      // which is (probably) prime, or my_survivor_count
+      // if there is no such survivor in this window.
+
+      #if defined(WIDE_INTEGER_ENABLE_THREADS)
+      if(my_worker_pool)
+      {
+        // Each task tests an interleaved subset of the survivors
+        // in ascending order and stops at its first prime, or when
+        // a smaller prime has been found by another task.
+
+        std::atomic<std::uint_fast32_t> best(my_survivor_count);
+
+        my_worker_pool->run
+        (
+          my_number_of_threads,
+          [this, first, &best](const std::uint_fast32_t t)
+          {
+            for(std::uint_fast32_t j = first + t; j < best.load(); j += my_number_of_threads)
+            {
+              if(is_prime_survivor(j))
+              {
+                std::uint_fast32_t current = best.load();
+
+                while((j < current) && (best.compare_exchange_weak(current, j) == false)) { ; }
+
+                break;
+              }
+            }
+          }
+        );
+
+        return best.load();
+      }
+      #endif
+
+      std::uint_fast32_t j = first;
+
+      while((j < my_survivor_count) && (is_prime_survivor(j) == false))
+      {
+        ++j;
+      }
+
+      return j;
+    }
+  };
+
+  } } // namespace wide_integer::generic_template
+
+#endif // GENERIC_TEMPLATE_UINTWIDE_T_PRIME_STREAM_2026_10_18_H_
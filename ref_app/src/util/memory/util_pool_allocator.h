@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_POOL_ALLOCATOR_2026_10_18_H_
+  #define UTIL_POOL_ALLOCATOR_2026_10_18_H_
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <memory>
+  #include <new>
+
+  namespace util
+  {
+    // A pool of memory blocks of varying size. Each request is rounded
+    // up to a size class (a power of two), and the freed blocks are kept
+    // in one list per size class, from which they are handed out again.
+    // The blocks are carved from large chunks of memory (an arena),
+    // which are obtained with operator new and only returned
+    // in release(). This suits objects that are created and destroyed
+    // over and over with a handful of distinct sizes, such as the
+    // temporaries of multiple-precision arithmetic.
+
+    // The pool is not thread-safe.
+    class memory_pool
+    {
+    public:
+      typedef std::size_t size_type;
+
+      static constexpr size_type min_block_size = 64U;
+      static constexpr size_type chunk_size     = 65536U;
+
+      static memory_pool& instance()
+      {
+        static memory_pool the_pool;
+
+        return the_pool;
+      }
+
+      memory_pool(const memory_pool&) = delete;
+
+      memory_pool& operator=(const memory_pool&) = delete;
+
+      // Blocks that are still in use at the end of the program (such as
+      // those of static objects destroyed after the pool) are not freed.
+      ~memory_pool() { static_cast<void>(release()); }
+
+      void* allocate(const size_type byte_count)
+      {
+        const std::uint_fast8_t c = size_class(byte_count);
+
+        void* p = my_free_lists[c];
+
+        if(p != nullptr)
+        {
+          my_free_lists[c] = static_cast<free_block*>(p)->next;
+        }
+        else
+        {
+          const size_type block_size = static_cast<size_type>(min_block_size << c);
+
+          if(block_size > (chunk_size - min_block_size))
+          {
+            // Large blocks get a chunk of their own.
+            p = static_cast<void*>(new_chunk(block_size) + min_block_size);
+          }
+          else
+          {
+            if(static_cast<size_type>(my_chunk_end - my_chunk_ptr) < block_size)
+            {
+              // Distribute the remainder of the current chunk
+              // among the free lists, and begin a new chunk.
+              recycle_chunk_remainder();
+
+              my_chunk_ptr = new_chunk(chunk_size - min_block_size) + min_block_size;
+              my_chunk_end = my_chunk_ptr + (chunk_size - min_block_size);
+            }
+
+            p = static_cast<void*>(my_chunk_ptr);
+
+            my_chunk_ptr += block_size;
+          }
+        }
+
+        ++my_blocks_in_use;
+
+        return p;
+      }
+
+      void deallocate(void* p, const size_type byte_count)
+      {
+        if(p != nullptr)
+        {
+          const std::uint_fast8_t c = size_class(byte_count);
+
+          static_cast<free_block*>(p)->next = my_free_lists[c];
+
+          my_free_lists[c] = static_cast<free_block*>(p);
+
+          --my_blocks_in_use;
+        }
+      }
+
+      size_type blocks_in_use() const { return my_blocks_in_use; }
+
+      // Return all of the memory to the system, provided
+      // that none of the blocks is in use anymore.
+      bool release()
+      {
+        const bool release_is_ok = (my_blocks_in_use == 0U);
+
+        if(release_is_ok)
+        {
+          release_chunks();
+        }
+
+        return release_is_ok;
+      }
+
+    private:
+      static constexpr std::uint_fast8_t size_class_count = 48U;
+
+      struct free_block
+      {
+        free_block* next;
+      };
+
+      free_block*    my_free_lists[size_class_count];
+      std::uint8_t*  my_chunks;
+      std::uint8_t*  my_chunk_ptr;
+      std::uint8_t*  my_chunk_end;
+      size_type      my_blocks_in_use;
+
+      memory_pool() : my_free_lists   (),
+                      my_chunks       (nullptr),
+                      my_chunk_ptr    (nullptr),
+                      my_chunk_end    (nullptr),
+                      my_blocks_in_use(0U) { }
+
+      static std::uint_fast8_t size_class(const size_type byte_count)
+      {
+        std::uint_fast8_t c = 0U;
+
+        for(size_type block_size = min_block_size; block_size < byte_count; block_size <<= 1U)
+        {
+          ++c;
+        }
+
+        return c;
+      }
+
+      // Get a new chunk (whose first min_block_size bytes link
+      // the list of chunks) with room for the given byte count.
+      std::uint8_t* new_chunk(const size_type byte_count)
+      {
+        std::uint8_t* p_chunk = static_cast<std::uint8_t*>(::operator new(byte_count + min_block_size));
+
+        *reinterpret_cast<std::uint8_t**>(p_chunk) = my_chunks;
+
+        my_chunks = p_chunk;
+
+        return p_chunk;
+      }
+
+      void recycle_chunk_remainder()
+      {
+        // The remainder is a multiple of min_block_size, and it
+        // is cut into blocks of decreasing power-of-two size.
+        while(static_cast<size_type>(my_chunk_end - my_chunk_ptr) >= min_block_size)
+        {
+          const size_type remaining = static_cast<size_type>(my_chunk_end - my_chunk_ptr);
+
+          std::uint_fast8_t c = 0U;
+
+          while((min_block_size << (c + 1U)) <= remaining)
+          {
+            ++c;
+          }
+
+          static_cast<free_block*>(static_cast<void*>(my_chunk_ptr))->next = my_free_lists[c];
+
+          my_free_lists[c] = static_cast<free_block*>(static_cast<void*>(my_chunk_ptr));
+
+          my_chunk_ptr += static_cast<size_type>(min_block_size << c);
+        }
+      }
+
+      void release_chunks()
+      {
+        while(my_chunks != nullptr)
+        {
+          std::uint8_t* p_next = *reinterpret_cast<std::uint8_t**>(my_chunks);
+
+          ::operator delete(static_cast<void*>(my_chunks));
+
+          my_chunks = p_next;
+        }
+
+        for(free_block*& list : my_free_lists)
+        {
+          list = nullptr;
+        }
+
+        my_chunk_ptr = nullptr;
+        my_chunk_end = nullptr;
+      }
+    };
+
+    template<typename T>
+    class pool_allocator;
+
+    template<>
+    class pool_allocator<void>
+    {
+    public:
+      typedef void              value_type;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+
+      template<typename U>
+      struct rebind
+      {
+        using other = pool_allocator<U>;
+      };
+    };
+
+    template<typename T>
+    class pool_allocator
+    {
+    public:
+      typedef std::size_t       size_type;
+      typedef std::ptrdiff_t    difference_type;
+      typedef T                 value_type;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+
+      static_assert(alignof(value_type) <= alignof(std::max_align_t),
+                    "The alignment of the allocation object can not exceed that of std::max_align_t.");
+
+      pool_allocator() noexcept = default;
+
+      pool_allocator(const pool_allocator&) noexcept = default;
+
+      template<typename U>
+      pool_allocator(const pool_allocator<U>&) noexcept { }
+
+      template<typename U>
+      struct rebind
+      {
+        using other = pool_allocator<U>;
+      };
+
+      size_type max_size() const noexcept
+      {
+        return static_cast<size_type>(static_cast<size_type>(SIZE_MAX / 2U) / sizeof(value_type));
+      }
+
+            pointer address(      reference x) const { return &x; }
+      const_pointer address(const_reference x) const { return &x; }
+
+      pointer allocate(size_type count,
+                       typename pool_allocator<void>::const_pointer = nullptr)
+      {
+        return static_cast<pointer>(memory_pool::instance().allocate(count * sizeof(value_type)));
+      }
+
+      void deallocate(pointer p, size_type count)
+      {
+        memory_pool::instance().deallocate(static_cast<void*>(p), count * sizeof(value_type));
+      }
+    };
+
+    // Global comparison operators (required by the standard).
+    template<typename T, typename U>
+    bool operator==(const pool_allocator<T>&, const pool_allocator<U>&) noexcept
+    {
+      return true;
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const pool_allocator<T>&, const pool_allocator<U>&) noexcept
+    {
+      return false;
+    }
+  }
+
+#endif // UTIL_POOL_ALLOCATOR_2026_10_18_H_
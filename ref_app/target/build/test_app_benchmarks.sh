@@ -29,14 +29,24 @@ $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/h
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FAST_MATH           -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fast_math.cpp            -o ./bin/app_benchmark_fast_math.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FILTER              -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_filter.cpp               -o ./bin/app_benchmark_filter.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT         -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point.cpp          -o ./bin/app_benchmark_fixed_point.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point_cordic.cpp   -o ./bin/app_benchmark_fixed_point_cordic.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FLOAT               -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_float.cpp                -o ./bin/app_benchmark_float.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_hash.cpp                 -o ./bin/app_benchmark_hash.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_NONE                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_none.cpp                 -o ./bin/app_benchmark_none.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_AGM              -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_agm.cpp               -o ./bin/app_benchmark_pi_agm.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_BBP              -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_bbp.cpp               -o ./bin/app_benchmark_pi_bbp.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_CHUDNOVSKY       -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_chudnovsky.cpp        -o ./bin/app_benchmark_pi_chudnovsky.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT           -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot.cpp            -o ./bin/app_benchmark_pi_spigot.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -pthread -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT_PARALLEL  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot_parallel.cpp   -o ./bin/app_benchmark_pi_spigot_parallel.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT_SINGLE    -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot_single.cpp     -o ./bin/app_benchmark_pi_spigot_single.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL        -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_decimal.cpp         -o ./bin/app_benchmark_wide_decimal.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL_DYNAMIC -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_decimal_dynamic.cpp -o ./bin/app_benchmark_wide_decimal_dynamic.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER        -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_integer.cpp         -o ./bin/app_benchmark_wide_integer.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER_ARITHMETIC -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_integer_arithmetic.cpp -o ./bin/app_benchmark_wide_integer_arithmetic.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL_PI_CHECKPOINT -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_decimal_pi_checkpoint.cpp -o ./bin/app_benchmark_wide_decimal_pi_checkpoint.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_ARRAY -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point_array.cpp -o ./bin/app_benchmark_fixed_point_array.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_POLICIES -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point_policies.cpp -o ./bin/app_benchmark_fixed_point_policies.exe
+$GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -pthread -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER_MODULAR -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_integer_modular.cpp -o ./bin/app_benchmark_wide_integer_modular.exe
 $GCC -std=$STD -Wall -Werror -O3 -march=native -fsanitize=address -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_TRAPEZOID_INTEGRAL  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_trapezoid_integral.cpp   -o ./bin/app_benchmark_trapezoid_integral.exe
 
 ./bin/app_benchmark_complex.exe
@@ -54,6 +64,9 @@ result_var_filter=$?
 ./bin/app_benchmark_fixed_point.exe
 result_var_fixed_point=$?
 
+./bin/app_benchmark_fixed_point_cordic.exe
+result_var_fixed_point_cordic=$?
+
 ./bin/app_benchmark_float.exe
 result_var_float=$?
 
@@ -66,9 +79,18 @@ result_var_none=$?
 ./bin/app_benchmark_pi_agm.exe
 result_var_pi_agm=$?
 
+./bin/app_benchmark_pi_bbp.exe
+result_var_pi_bbp=$?
+
+./bin/app_benchmark_pi_chudnovsky.exe
+result_var_pi_chudnovsky=$?
+
 ./bin/app_benchmark_pi_spigot.exe
 result_var_pi_spigot=$?
 
+./bin/app_benchmark_pi_spigot_parallel.exe
+result_var_pi_spigot_parallel=$?
+
 ./bin/app_benchmark_pi_spigot_single.exe
 result_var_pi_spigot_single=$?
 
@@ -78,25 +100,53 @@ result_var_trapezoid_integral=$?
 ./bin/app_benchmark_wide_decimal.exe
 result_var_wide_decimal=$?
 
+./bin/app_benchmark_wide_decimal_dynamic.exe
+result_var_wide_decimal_dynamic=$?
+
 ./bin/app_benchmark_wide_integer.exe
 result_var_wide_integer=$?
 
+./bin/app_benchmark_wide_integer_arithmetic.exe
+result_var_wide_integer_arithmetic=$?
+
+./bin/app_benchmark_wide_decimal_pi_checkpoint.exe
+result_var_wide_decimal_pi_checkpoint=$?
+
+./bin/app_benchmark_fixed_point_array.exe
+result_var_fixed_point_array=$?
+
+./bin/app_benchmark_fixed_point_policies.exe
+result_var_fixed_point_policies=$?
+
+./bin/app_benchmark_wide_integer_modular.exe
+result_var_wide_integer_modular=$?
+
 echo "result_var_complex           : "  "$result_var_complex"
 echo "result_var_crc               : "  "$result_var_crc"
 echo "result_var_fast_math         : "  "$result_var_fast_math"
 echo "result_var_filter            : "  "$result_var_filter"
 echo "result_var_fixed_point       : "  "$result_var_fixed_point"
+echo "result_var_fixed_point_cordic: "  "$result_var_fixed_point_cordic"
 echo "result_var_float             : "  "$result_var_float"
 echo "result_var_hash              : "  "$result_var_hash"
 echo "result_var_none              : "  "$result_var_none"
 echo "result_var_pi_agm            : "  "$result_var_pi_agm"
+echo "result_var_pi_bbp            : "  "$result_var_pi_bbp"
+echo "result_var_pi_chudnovsky     : "  "$result_var_pi_chudnovsky"
 echo "result_var_pi_spigot         : "  "$result_var_pi_spigot"
+echo "result_var_pi_spigot_parallel: "  "$result_var_pi_spigot_parallel"
 echo "result_var_pi_spigot_single  : "  "$result_var_pi_spigot_single"
 echo "result_var_trapezoid_integral: "  "$result_var_trapezoid_integral"
 echo "result_var_wide_decimal      : "  "$result_var_wide_decimal"
+echo "result_var_wide_decimal_dynamic: "  "$result_var_wide_decimal_dynamic"
 echo "result_var_wide_integer      : "  "$result_var_wide_integer"
+echo "result_var_wide_integer_arithmetic: "  "$result_var_wide_integer_arithmetic"
+echo "result_var_wide_decimal_pi_checkpoint: "  "$result_var_wide_decimal_pi_checkpoint"
+echo "result_var_fixed_point_array : "  "$result_var_fixed_point_array"
+echo "result_var_fixed_point_policies: "  "$result_var_fixed_point_policies"
+echo "result_var_wide_integer_modular: "  "$result_var_wide_integer_modular"
 
-result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_spigot+result_var_pi_spigot_single+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_integer))
+result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_fixed_point_cordic+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_bbp+result_var_pi_chudnovsky+result_var_pi_spigot+result_var_pi_spigot_parallel+result_var_pi_spigot_single+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_decimal_dynamic+result_var_wide_integer+result_var_wide_integer_arithmetic+result_var_wide_decimal_pi_checkpoint+result_var_fixed_point_array+result_var_fixed_point_policies+result_var_wide_integer_modular))
 
 echo "result_total                 : "  "$result_total"
 
@@ -26,10 +26,13 @@ avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunu
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FAST_MATH          -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fast_math.cpp          ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_fast_math.map          -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_fast_math.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FILTER             -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_filter.cpp             ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_filter.map             -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_filter.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT        -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point.cpp        ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_fixed_point.map        -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_fixed_point.elf
+avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT_CORDIC -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point_cordic.cpp ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_fixed_point_cordic.map -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_fixed_point_cordic.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FLOAT              -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_float.cpp              ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_float.map              -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_float.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH               -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_hash.cpp               ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_hash.map               -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_hash.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_NONE               -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_none.cpp               ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_none.map               -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_none.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_AGM             -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_agm.cpp             ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_pi_agm.map             -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_pi_agm.elf
+avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_BBP             -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_bbp.cpp             ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_pi_bbp.map             -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_pi_bbp.elf
+avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_CHUDNOVSKY      -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_chudnovsky.cpp      ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_pi_chudnovsky.map      -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_pi_chudnovsky.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT          -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot.cpp          ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_pi_spigot.map          -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_pi_spigot.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT_SINGLE   -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot_single.cpp   ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_pi_spigot_single.map   -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_pi_spigot_single.elf
 avr-g++ -std=$STD -Wall -Wextra -pedantic -Wmain -Wundef -Wsign-conversion -Wunused-parameter -Wuninitialized -Wmissing-declarations -Wshadow -Wunreachable-code -Wswitch-default -Wswitch-enum -Wcast-align -Wmissing-include-dirs -Winit-self -Wfloat-equal -Wdouble-promotion -O2 -g -gdwarf-2 -fno-exceptions -ffunction-sections -fdata-sections -x c++ -fno-rtti -fno-use-cxa-atexit -fno-exceptions -fno-nonansi-builtins -fno-threadsafe-statics -fno-enforce-eh-specs -ftemplate-depth=32 -Wzero-as-null-pointer-constant -mmcu=atmega328p -mrelax -I./src/util/STL -I./src/mcal/avr -I./src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL       -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_decimal.cpp       ./src/mcal/mcal_gcc_cxx_completion.cpp -nostdlib  -nostartfiles -Wl,--gc-sections -Wl,-Map,./bin/app_benchmark_wide_decimal.map       -T ./target/micros/avr/make/avr.ld -o ./bin/app_benchmark_wide_decimal.elf
@@ -51,6 +54,9 @@ result_ls_filter=$?
 ls -la ./bin/app_benchmark_fixed_point.elf ./bin/app_benchmark_fixed_point.map
 result_ls_fixed_point=$?
 
+ls -la ./bin/app_benchmark_fixed_point_cordic.elf ./bin/app_benchmark_fixed_point_cordic.map
+result_ls_fixed_point_cordic=$?
+
 ls -la ./bin/app_benchmark_float.elf ./bin/app_benchmark_float.map
 result_ls_float=$?
 
@@ -63,6 +69,12 @@ result_ls_none=$?
 ls -la ./bin/app_benchmark_pi_agm.elf ./bin/app_benchmark_pi_agm.map
 result_ls_pi_agm=$?
 
+ls -la ./bin/app_benchmark_pi_bbp.elf ./bin/app_benchmark_pi_bbp.map
+result_ls_pi_bbp=$?
+
+ls -la ./bin/app_benchmark_pi_chudnovsky.elf ./bin/app_benchmark_pi_chudnovsky.map
+result_ls_pi_chudnovsky=$?
+
 ls -la ./bin/app_benchmark_pi_spigot.elf ./bin/app_benchmark_pi_spigot.map
 result_ls_pi_spigot=$?
 
@@ -83,17 +95,20 @@ echo "result_ls_crc               : "  "$result_ls_crc"
 echo "result_ls_fast_math         : "  "$result_ls_fast_math"
 echo "result_ls_filter            : "  "$result_ls_filter"
 echo "result_ls_fixed_point       : "  "$result_ls_fixed_point"
+echo "result_ls_fixed_point_cordic: "  "$result_ls_fixed_point_cordic"
 echo "result_ls_float             : "  "$result_ls_float"
 echo "result_ls_hash              : "  "$result_ls_hash"
 echo "result_ls_none              : "  "$result_ls_none"
 echo "result_ls_pi_agm            : "  "$result_ls_pi_agm"
+echo "result_ls_pi_bbp            : "  "$result_ls_pi_bbp"
+echo "result_ls_pi_chudnovsky     : "  "$result_ls_pi_chudnovsky"
 echo "result_ls_pi_spigot         : "  "$result_ls_pi_spigot"
 echo "result_ls_pi_spigot_single  : "  "$result_ls_pi_spigot_single"
 echo "result_ls_trapezoid_integral: "  "$result_ls_trapezoid_integral"
 echo "result_ls_wide_decimal      : "  "$result_ls_wide_decimal"
 echo "result_ls_wide_integer      : "  "$result_ls_wide_integer"
 
-result_total=$((result_ls_complex+result_ls_crc+result_ls_fast_math+result_ls_filter+result_ls_fixed_point+result_ls_float+result_ls_hash+result_ls_none+result_ls_pi_agm+result_ls_pi_spigot+result_ls_pi_spigot_single+result_ls_trapezoid_integral+result_ls_wide_decimal+result_ls_wide_integer))
+result_total=$((result_ls_complex+result_ls_crc+result_ls_fast_math+result_ls_filter+result_ls_fixed_point+result_ls_fixed_point_cordic+result_ls_float+result_ls_hash+result_ls_none+result_ls_pi_agm+result_ls_pi_bbp+result_ls_pi_chudnovsky+result_ls_pi_spigot+result_ls_pi_spigot_single+result_ls_trapezoid_integral+result_ls_wide_decimal+result_ls_wide_integer))
 
 echo "result_total                : "  "$result_total"
 